@@ -0,0 +1,56 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif /* _POSIX_C_SOURCE */
+
+#include <stdio.h>
+#include <time.h>
+#include "uelb.h"
+#include "bench/utils/object-pool.h"
+#include "bench/utils/promise.h"
+#include "bench/system/scheduler.h"
+#include "bench/system/event-loop.h"
+#include "bench/system/signal.h"
+
+#ifndef UELB_MIN_TIME_NS
+#define UELB_MIN_TIME_NS    (100000000ULL)
+#endif
+
+volatile uintptr_t uelb_sink;
+
+uint64_t uelb_now(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+void uelb_run(const char *id, uelb_function_t function, size_t size){
+    uelb_context_t context = {1, 0, 0, 0};
+    while(1){
+        context.ops = 0;
+        context.elapsed = 0;
+        function(&context, size);
+        if(context.elapsed >= UELB_MIN_TIME_NS || context.iterations >= (1ULL << 40)) break;
+        context.iterations *= 2;
+    }
+
+    double ns_per_op = (double)context.elapsed / (double)context.ops;
+    printf(
+        "  %-36s %8lu %12.2f ns/op %14.0f ops/s\n",
+        id,
+        (unsigned long)size,
+        ns_per_op,
+        1e9 / ns_per_op
+    );
+}
+
+int main(int argc, char *argv[]){
+    printf("  %-36s %8s %18s %20s\n", "benchmark", "size", "time", "throughput");
+
+    uelb_run_benchmark_group("objpool", uel_objpool_run_benchmarks);
+    uelb_run_benchmark_group("evloop", uel_evloop_run_benchmarks);
+    uelb_run_benchmark_group("scheduler", uel_sch_run_benchmarks);
+    uelb_run_benchmark_group("signal", uel_signal_run_benchmarks);
+    uelb_run_benchmark_group("promise", uel_promise_run_benchmarks);
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include "event-loop.h"
+
+#include <stdint.h>
+
+#include "uevloop/system/containers/application.h"
+#include "uevloop/utils/closure.h"
+#include "../uelb.h"
+
+static uel_application_t app;
+
+static void *count(void *context, void *params){
+    uelb_sink++;
+    return NULL;
+}
+
+static void enqueue_and_run(uelb_context_t *context, size_t size){
+    uel_app_init(&app);
+    uel_closure_t closure = uel_closure_create(count, NULL);
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        for(size_t j = 0; j < size; j++){
+            uel_evloop_enqueue_closure(&app.event_loop, &closure, NULL);
+        }
+        uel_evloop_run(&app.event_loop);
+    }
+    uelb_stop(context);
+    context->ops = context->iterations * size;
+}
+
+static void run_observers(uelb_context_t *context, size_t size){
+    static volatile uintptr_t values[256];
+    uel_app_init(&app);
+    uel_closure_t closure = uel_closure_create(count, NULL);
+    for(size_t j = 0; j < size; j++){
+        uel_evloop_observe(&app.event_loop, &values[j], &closure);
+    }
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        values[i % size]++;
+        uel_evloop_run(&app.event_loop);
+    }
+    uelb_stop(context);
+    context->ops = context->iterations * size;
+}
+
+void uel_evloop_run_benchmarks(){
+    uelb_run_benchmark("enqueue + run closures", enqueue_and_run, 1, 16, 256, 1024);
+    uelb_run_benchmark("run observers", run_observers, 1, 16, 64, 256);
+}
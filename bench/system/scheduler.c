@@ -0,0 +1,56 @@
+#include "scheduler.h"
+
+#include <stdint.h>
+
+#include "uevloop/system/containers/application.h"
+#include "uevloop/utils/closure.h"
+#include "../uelb.h"
+
+static uel_application_t app;
+
+static void *count(void *context, void *params){
+    uelb_sink++;
+    return NULL;
+}
+
+static void fire_periodic_timers(uelb_context_t *context, size_t size){
+    uel_app_init(&app);
+    uint32_t timer = 0;
+    for(size_t j = 0; j < size; j++){
+        uel_app_run_at_intervals(&app, 1, false, uel_closure_create(count, NULL), NULL);
+    }
+    uel_app_tick(&app);
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        uel_app_update_timer(&app, ++timer);
+        uel_app_tick(&app);
+    }
+    uelb_stop(context);
+    context->ops = context->iterations * size;
+}
+
+static void schedule_and_expire_timers(uelb_context_t *context, size_t size){
+    uel_app_init(&app);
+    uint32_t timer = 0;
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        for(size_t j = 0; j < size; j++){
+            // Spreads due times so insertion has to walk the timer list
+            uint16_t timeout = (uint16_t)(1 + (j * 7919) % size);
+            uel_app_run_later(&app, timeout, uel_closure_create(count, NULL), NULL);
+        }
+        uel_app_tick(&app);
+        timer += size + 1;
+        uel_app_update_timer(&app, timer);
+        uel_app_tick(&app);
+    }
+    uelb_stop(context);
+    context->ops = context->iterations * size;
+}
+
+void uel_sch_run_benchmarks(){
+    uelb_run_benchmark("fire periodic timers", fire_periodic_timers, 1, 16, 128, 512);
+    uelb_run_benchmark("schedule + expire one-shot timers", schedule_and_expire_timers, 1, 16, 128, 512);
+}
@@ -0,0 +1,38 @@
+#include "signal.h"
+
+#include <stdint.h>
+
+#include "uevloop/system/containers/application.h"
+#include "uevloop/system/signal.h"
+#include "uevloop/utils/closure.h"
+#include "../uelb.h"
+
+static uel_application_t app;
+
+static void *count(void *context, void *params){
+    uelb_sink++;
+    return NULL;
+}
+
+static void emit_and_dispatch(uelb_context_t *context, size_t size){
+    uel_llist_t relay_buffer[1];
+    uel_signal_relay_t relay;
+    uel_app_init(&app);
+    uel_signal_relay_init(&relay, &app.pools, &app.queues, relay_buffer, 1);
+    uel_closure_t closure = uel_closure_create(count, NULL);
+    for(size_t j = 0; j < size; j++){
+        uel_signal_listen(0, &relay, &closure);
+    }
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        uel_signal_emit(0, &relay, NULL);
+        uel_evloop_run(&app.event_loop);
+    }
+    uelb_stop(context);
+    context->ops = context->iterations;
+}
+
+void uel_signal_run_benchmarks(){
+    uelb_run_benchmark("emit + dispatch to listeners", emit_and_dispatch, 1, 4, 16, 64);
+}
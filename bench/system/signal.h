@@ -0,0 +1,6 @@
+#ifndef BENCH_SIGNAL_H
+#define BENCH_SIGNAL_H
+
+void uel_signal_run_benchmarks();
+
+#endif /* end of include guard: BENCH_SIGNAL_H */
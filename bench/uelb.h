@@ -0,0 +1,53 @@
+#ifndef UELB_H
+#define UELB_H
+
+/* Minimal microbenchmark harness, in the spirit of uelt.h */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+/* Each benchmark runs its workload `iterations` times and tallies how many
+ * operations were performed in `ops`. Only the time spent between
+ * `uelb_start()` and `uelb_stop()` is accounted for, so setup and teardown
+ * can be kept out of the measurements.
+ */
+typedef struct {
+    uint64_t iterations;
+    uint64_t ops;
+    uint64_t started_at;
+    uint64_t elapsed;
+} uelb_context_t;
+
+typedef void (*uelb_function_t)(uelb_context_t *context, size_t size);
+
+uint64_t uelb_now();
+
+#define uelb_start(context) do {                                            \
+    (context)->started_at = uelb_now();                                     \
+} while(0)
+
+#define uelb_stop(context) do {                                             \
+    (context)->elapsed += uelb_now() - (context)->started_at;               \
+} while(0)
+
+/* Calibrates the number of iterations until the benchmark runs for at least
+ * UELB_MIN_TIME_NS and prints ns/op and ops/s for the supplied size.
+ */
+void uelb_run(const char *id, uelb_function_t function, size_t size);
+
+#define uelb_run_benchmark(id, function, ...) do {                          \
+    const size_t sizes[] = {__VA_ARGS__};                                   \
+    for(size_t i = 0; i < sizeof(sizes) / sizeof(size_t); i++){             \
+        uelb_run(id, function, sizes[i]);                                   \
+    }                                                                       \
+} while(0)
+
+#define uelb_run_benchmark_group(id, group) do {                            \
+    printf("\n%s\n", id);                                                   \
+    group();                                                                \
+} while(0)
+
+/* Keeps the optimiser from discarding otherwise unused results */
+extern volatile uintptr_t uelb_sink;
+
+#endif /* UELB_H */
@@ -0,0 +1,51 @@
+#include "object-pool.h"
+
+#include <stdint.h>
+
+#include "uevloop/utils/object-pool.h"
+#include "uevloop/system/containers/system-pools.h"
+#include "../uelb.h"
+
+#define POOL_SIZE_LOG2N     (10)
+
+static UEL_DECLARE_OBJPOOL_BUFFERS(uintptr_t, POOL_SIZE_LOG2N, item);
+static void *items[1<<POOL_SIZE_LOG2N];
+static uel_syspools_t pools;
+
+static void acquire_and_release(uelb_context_t *context, size_t size){
+    uel_objpool_t pool;
+    uel_objpool_init(&pool, POOL_SIZE_LOG2N, sizeof(uintptr_t), UEL_OBJPOOL_BUFFERS(item));
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        for(size_t j = 0; j < size; j++){
+            items[j] = uel_objpool_acquire(&pool);
+        }
+        for(size_t j = 0; j < size; j++){
+            uel_objpool_release(&pool, items[j]);
+        }
+    }
+    uelb_stop(context);
+    context->ops = context->iterations * size;
+}
+
+static void acquire_and_release_events(uelb_context_t *context, size_t size){
+    uel_syspools_init(&pools);
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        for(size_t j = 0; j < size; j++){
+            items[j] = uel_syspools_acquire_event(&pools);
+        }
+        for(size_t j = 0; j < size; j++){
+            uel_syspools_release_event(&pools, (uel_event_t *)items[j]);
+        }
+    }
+    uelb_stop(context);
+    context->ops = context->iterations * size;
+}
+
+void uel_objpool_run_benchmarks(){
+    uelb_run_benchmark("acquire + release", acquire_and_release, 1, 16, 256, 1024);
+    uelb_run_benchmark("syspools event acquire + release", acquire_and_release_events, 1, 16, 256);
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_OBJECT_POOL_H
+#define BENCH_OBJECT_POOL_H
+
+void uel_objpool_run_benchmarks();
+
+#endif /* end of include guard: BENCH_OBJECT_POOL_H */
@@ -0,0 +1,45 @@
+#include "promise.h"
+
+#include <stdint.h>
+
+#include "uevloop/utils/object-pool.h"
+#include "uevloop/utils/promise.h"
+#include "uevloop/utils/closure.h"
+#include "../uelb.h"
+
+#define PROMISE_POOL_SIZE_LOG2N     (2)
+#define SEGMENT_POOL_SIZE_LOG2N     (8)
+
+static UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_t, PROMISE_POOL_SIZE_LOG2N, promise);
+static UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_segment_t, SEGMENT_POOL_SIZE_LOG2N, segment);
+
+static void *count(void *context, void *params){
+    uelb_sink++;
+    return NULL;
+}
+
+static void resolve_chain(uelb_context_t *context, size_t size){
+    uel_objpool_t promise_pool, segment_pool;
+    uel_objpool_init(&promise_pool, PROMISE_POOL_SIZE_LOG2N, sizeof(uel_promise_t),
+                                                    UEL_OBJPOOL_BUFFERS(promise));
+    uel_objpool_init(&segment_pool, SEGMENT_POOL_SIZE_LOG2N, sizeof(uel_promise_segment_t),
+                                                    UEL_OBJPOOL_BUFFERS(segment));
+    uel_promise_store_t store = uel_promise_store_create(&promise_pool, &segment_pool);
+    uel_closure_t closure = uel_closure_create(count, NULL);
+
+    uelb_start(context);
+    for(uint64_t i = 0; i < context->iterations; i++){
+        uel_promise_t *promise = uel_promise_create(&store, uel_nop());
+        for(size_t j = 0; j < size; j++){
+            uel_promise_then(promise, closure);
+        }
+        uel_promise_resolve(promise, NULL);
+        uel_promise_destroy(promise);
+    }
+    uelb_stop(context);
+    context->ops = context->iterations * size;
+}
+
+void uel_promise_run_benchmarks(){
+    uelb_run_benchmark("create + chain + resolve", resolve_chain, 1, 8, 32, 128);
+}
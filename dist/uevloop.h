@@ -0,0 +1,8740 @@
+/* µEvLoop single-header build.
+ *
+ * Generated by scripts/amalgamate.py. Do not edit: changes belong in the
+ * library sources. Every function is `static inline`, so translation units
+ * including this header get private copies of the library and its globals.
+ * Configuration macros must be defined before this header is included.
+ */
+
+#ifndef UEL_AMALGAMATED_H
+#define UEL_AMALGAMATED_H
+
+//! Defined when building from the single-header distribution
+#define UEL_AMALGAMATED
+#define UEL_API static inline
+#define UEL_EXTERN static
+#if defined(__GNUC__) || defined(__clang__)
+#define UEL_GLOBAL static __attribute__((unused))
+#else
+#define UEL_GLOBAL static
+#endif
+
+/* ---- uevloop/config.h ---- */
+/** \file config.h
+  *
+  * \brief Central repository of system configuration. This is meant to be edited by the
+  * programmer as needed.
+  */
+
+#ifndef UEL_CONFIG_H
+#define UEL_CONFIG_H
+
+/* UEL_SYSPOOLS MODULE CONFIGURATION */
+
+#ifndef UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N
+//! Defines the size of the event pool size in log2 form. Defaults to 128 events.
+#define UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N   (7)
+#endif /* UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N */
+
+#ifndef UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N
+//! Defines the size of the linked list node pool size in log2 form. Defaults to 128 nodes.
+#define UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N    (7)
+#endif /* UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N */
+
+
+/* UEL_SYSQUEUES MODULE CONFIGURATION */
+
+#ifndef UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N
+//! The size of the event queue in log2 form. Defaults to 32 events.
+#define UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N (5)
+#endif /* UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N */
+
+#ifndef UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N
+//! The size of the schedule queue in log2 form. Defaults to 32 events.
+#define UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N (4)
+#endif /* UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N */
+
+#ifndef UEL_SYSQUEUES_BATCH_SIZE
+//! \brief The max number of events moved at once by the scheduler and the event
+//! loop when using bulk queue operations. Bounds the stack used by them.
+#define UEL_SYSQUEUES_BATCH_SIZE (16)
+#endif /* UEL_SYSQUEUES_BATCH_SIZE */
+
+
+/* APPLICATION MODULE CONFIGURATION */
+
+#ifndef UEL_APP_SCRATCH_SIZE
+//! \brief The size in bytes of the application scratch arena, which is reset at
+//! the end of every tick. Every application, including each workgroup worker,
+//! reserves this much RAM for it. Defaults to 0, which disables the arena and
+//! `uel_app_scratch_alloc()`.
+#define UEL_APP_SCRATCH_SIZE    (0)
+#endif /* UEL_APP_SCRATCH_SIZE */
+
+/* SCHEDULER MODULE CONFIGURATION */
+
+#ifndef UEL_SCH_TICKS_PER_SECOND
+//! \brief How many scheduler timer ticks make up a second. Defaults to 1000,
+//! *i.e.* the timer counts milliseconds.
+#define UEL_SCH_TICKS_PER_SECOND    (1000)
+#endif /* UEL_SCH_TICKS_PER_SECOND */
+
+/* Define UEL_SCH_64BIT_TIME to represent time as 64-bit ticks and timeouts as
+ * 32-bit ticks, instead of 32-bit and 16-bit. Useful for fine tick resolutions
+ * on hosts, where the 32-bit counter would otherwise wrap around too soon.
+ */
+// #define UEL_SCH_64BIT_TIME
+
+
+/* SIGNAL MODULE CONFIGURATION */
+
+#ifndef UEL_SIGNAL_MAX_LISTENERS
+//! \brief Defines the max number of listeners to be attached to an speciffic
+//! signal in a single relay
+#define UEL_SIGNAL_MAX_LISTENERS    (5)
+#endif /* UEL_SIGNAL_MAX_LISTENERS */
+
+/* WORKGROUP MODULE CONFIGURATION */
+
+#ifndef UEL_WORKGROUP_DEQUE_SIZE_LOG2N
+//! The size of each worker's work-stealing deque in log2 form. Defaults to 32 closures.
+#define UEL_WORKGROUP_DEQUE_SIZE_LOG2N (5)
+#endif /* UEL_WORKGROUP_DEQUE_SIZE_LOG2N */
+
+#ifndef UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N
+//! \brief The size of the workgroup's shared injection queue in log2 form. This
+//! also sizes the pool of events backing injected closures. Defaults to 32 closures.
+#define UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N (5)
+#endif /* UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N */
+
+/* CHANNEL MODULE CONFIGURATION */
+
+#ifndef UEL_CHANNEL_BATCH_SIZE
+//! \brief Defines the max number of messages a channel delivers to its target
+//! event loop in a single runloop
+#define UEL_CHANNEL_BATCH_SIZE  (16)
+#endif /* UEL_CHANNEL_BATCH_SIZE */
+
+/* ITERATOR MODULE CONFIGURATION */
+
+#ifndef UEL_ITERATOR_BATCH_SIZE
+//! \brief Defines the max number of elements iterator operations request at
+//! once from iterators that implement `next_batch`
+#define UEL_ITERATOR_BATCH_SIZE (16)
+#endif /* UEL_ITERATOR_BATCH_SIZE */
+
+#ifndef UEL_ITERATOR_PAR_CHUNK_SIZE
+//! \brief Defines the default number of elements parallel iterator operations
+//! hand to a worker at once
+#define UEL_ITERATOR_PAR_CHUNK_SIZE (64)
+#endif /* UEL_ITERATOR_PAR_CHUNK_SIZE */
+
+/* LOCKING CONFIGURATION */
+
+/* Define one of UEL_LOCK_SPINLOCK, UEL_LOCK_FUTEX or UEL_LOCK_PTHREAD to guard
+ * critical sections with one of the locks in `uevloop/portability/lock.h`.
+ * Each system container then gets a lock of its own. If none is defined,
+ * critical sections are delimited by the user supplied UEL_CRITICAL_ENTER and
+ * UEL_CRITICAL_EXIT macros only.
+ */
+// #define UEL_LOCK_SPINLOCK
+// #define UEL_LOCK_FUTEX
+// #define UEL_LOCK_PTHREAD
+
+#ifndef UEL_LOCK_FUTEX_SPIN_COUNT
+//! How many times the futex lock retries before putting the thread to sleep
+#define UEL_LOCK_FUTEX_SPIN_COUNT   (100)
+#endif /* UEL_LOCK_FUTEX_SPIN_COUNT */
+
+/* INSTRUMENTATION CONFIGURATION */
+
+/* Define UEL_ENABLE_LATENCY_STATS (here or in the compiler command line) to
+ * timestamp events and record event loop latency histograms. Disabled by default.
+ */
+// #define UEL_ENABLE_LATENCY_STATS
+
+/* Define UEL_ENABLE_TRACE to log event dispatches, timer expirations, signal
+ * emissions and promise settlements into the trace ring. Disabled by default.
+ */
+// #define UEL_ENABLE_TRACE
+
+#ifndef UEL_TRACE_BUFFER_SIZE_LOG2N
+//! The number of records kept by the trace ring in log2 form. Defaults to 256 records.
+#define UEL_TRACE_BUFFER_SIZE_LOG2N (8)
+#endif /* UEL_TRACE_BUFFER_SIZE_LOG2N */
+
+/* Define UEL_ENABLE_PROFILER to account for the time consumed by each closure
+ * function invoked by the core. Disabled by default.
+ */
+// #define UEL_ENABLE_PROFILER
+
+#ifndef UEL_PROFILER_TABLE_SIZE_LOG2N
+//! The number of distinct closure functions the profiler can account for, in
+//! log2 form. Defaults to 64 functions.
+#define UEL_PROFILER_TABLE_SIZE_LOG2N   (6)
+#endif /* UEL_PROFILER_TABLE_SIZE_LOG2N */
+
+#ifndef UEL_HISTOGRAM_PRECISION_BITS
+//! \brief The number of linear sub-buckets per power of two in histograms, in
+//! log2 form. Bounds the relative error of recorded values. Defaults to 25%.
+#define UEL_HISTOGRAM_PRECISION_BITS    (2)
+#endif /* UEL_HISTOGRAM_PRECISION_BITS */
+
+/* SWITCH MODULE CONFIGURATION */
+
+#ifndef UEL_SWITCH_MAX_ATTEMPTS
+//! \brief How many hash multipliers a switch tries before giving up on a
+//! hashed table and falling back to linear search
+#define UEL_SWITCH_MAX_ATTEMPTS (1024)
+#endif /* UEL_SWITCH_MAX_ATTEMPTS */
+
+/* PROMISE MODULE CONFIGURATION */
+
+//! Enable promise chain functions aliases: THEN, CATCH, AFTER, ALWAYS
+#define UEL_PROMISE_SHORTCUTS
+
+#endif /* end of include guard: UEL_CONFIG_H */
+
+/* ---- uevloop/portability/lock.h ---- */
+/** \file lock.h
+  * \brief Ready-made locks to back critical sections on hosted and multi-core
+  * targets.
+  *
+  * Three lock types are provided:
+  * - `uel_spinlock_t`: a test-and-test-and-set spinlock built on the macros in
+  * `atomic.h`. Available wherever those are.
+  * - `uel_futex_t`: spins for a while and then sleeps on a futex. Linux only.
+  * - `uel_mutex_t`: a thin wrapper over `pthread_mutex_t`. POSIX only.
+  *
+  * Defining `UEL_LOCK_SPINLOCK`, `UEL_LOCK_FUTEX` or `UEL_LOCK_PTHREAD` selects
+  * one of them as `uel_lock_t`, the lock type used by critical sections.
+  */
+
+#ifndef UEL_LOCK_H
+#define UEL_LOCK_H
+
+/// \cond
+#include <stdbool.h>
+/// \endcond
+
+
+#if defined(__linux__)
+//! Defined when the futex lock is available on the target
+#define UEL_LOCK_HAS_FUTEX
+#endif /* __linux__ */
+
+#if defined(__unix__) || defined(__APPLE__)
+//! Defined when the pthread lock is available on the target
+#define UEL_LOCK_HAS_PTHREAD
+/// \cond
+#include <pthread.h>
+/// \endcond
+#endif /* __unix__ || __APPLE__ */
+
+#ifndef UEL_LOCK_RELAX
+#if defined(__x86_64__) || defined(__i386__)
+//! Hints the processor that the thread is busy-waiting
+#define UEL_LOCK_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define UEL_LOCK_RELAX() __asm__ __volatile__("yield")
+#else
+#define UEL_LOCK_RELAX() ((void)0)
+#endif
+#endif /* UEL_LOCK_RELAX */
+
+/** \brief A spinlock. Zero when released, so it can be statically initialised
+  * with `UEL_SPINLOCK_INITIALIZER`.
+  */
+typedef int uel_spinlock_t;
+//! Static initialiser for spinlocks
+#define UEL_SPINLOCK_INITIALIZER 0
+
+/** \brief Initialises a spinlock in the released state
+  *
+  * \param lock The spinlock to be initialised
+  */
+UEL_API void uel_spinlock_init(uel_spinlock_t *lock);
+
+/** \brief Acquires a spinlock, busy-waiting until it is released
+  *
+  * \param lock The spinlock to be acquired
+  */
+UEL_API void uel_spinlock_acquire(uel_spinlock_t *lock);
+
+/** \brief Tries to acquire a spinlock without waiting
+  *
+  * \param lock The spinlock to be acquired
+  * \returns Whether the lock was acquired
+  */
+UEL_API bool uel_spinlock_try_acquire(uel_spinlock_t *lock);
+
+/** \brief Releases a spinlock
+  *
+  * \param lock The spinlock to be released
+  */
+UEL_API void uel_spinlock_release(uel_spinlock_t *lock);
+
+#ifdef UEL_LOCK_HAS_FUTEX
+/** \brief A futex lock. Zero when released, one when held and two when held
+  * with threads sleeping on it.
+  */
+typedef int uel_futex_t;
+//! Static initialiser for futex locks
+#define UEL_FUTEX_INITIALIZER 0
+
+/** \brief Initialises a futex lock in the released state
+  *
+  * \param lock The futex lock to be initialised
+  */
+UEL_API void uel_futex_init(uel_futex_t *lock);
+
+/** \brief Acquires a futex lock. Spins `UEL_LOCK_FUTEX_SPIN_COUNT` times and
+  * then sleeps until the lock is released.
+  *
+  * \param lock The futex lock to be acquired
+  */
+UEL_API void uel_futex_acquire(uel_futex_t *lock);
+
+/** \brief Tries to acquire a futex lock without waiting
+  *
+  * \param lock The futex lock to be acquired
+  * \returns Whether the lock was acquired
+  */
+UEL_API bool uel_futex_try_acquire(uel_futex_t *lock);
+
+/** \brief Releases a futex lock, waking one sleeping thread if there is any
+  *
+  * \param lock The futex lock to be released
+  */
+UEL_API void uel_futex_release(uel_futex_t *lock);
+#endif /* UEL_LOCK_HAS_FUTEX */
+
+#ifdef UEL_LOCK_HAS_PTHREAD
+//! A lock backed by a pthread mutex
+typedef pthread_mutex_t uel_mutex_t;
+//! Static initialiser for pthread locks
+#define UEL_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+
+/** \brief Initialises a pthread lock with default attributes
+  *
+  * \param lock The pthread lock to be initialised
+  */
+UEL_API void uel_mutex_init(uel_mutex_t *lock);
+
+/** \brief Acquires a pthread lock
+  *
+  * \param lock The pthread lock to be acquired
+  */
+UEL_API void uel_mutex_acquire(uel_mutex_t *lock);
+
+/** \brief Tries to acquire a pthread lock without waiting
+  *
+  * \param lock The pthread lock to be acquired
+  * \returns Whether the lock was acquired
+  */
+UEL_API bool uel_mutex_try_acquire(uel_mutex_t *lock);
+
+/** \brief Releases a pthread lock
+  *
+  * \param lock The pthread lock to be released
+  */
+UEL_API void uel_mutex_release(uel_mutex_t *lock);
+#endif /* UEL_LOCK_HAS_PTHREAD */
+
+#if defined(UEL_LOCK_SPINLOCK)
+//! Defined when a lock type backs critical sections
+#define UEL_LOCK_BACKEND
+//! The lock type guarding critical sections
+typedef uel_spinlock_t uel_lock_t;
+//! Static initialiser for `uel_lock_t`
+#define UEL_LOCK_INITIALIZER UEL_SPINLOCK_INITIALIZER
+//! Initialises a lock of the selected type
+#define uel_lock_init(lock) uel_spinlock_init(lock)
+//! Acquires a lock of the selected type
+#define uel_lock_acquire(lock) uel_spinlock_acquire(lock)
+//! Releases a lock of the selected type
+#define uel_lock_release(lock) uel_spinlock_release(lock)
+
+#elif defined(UEL_LOCK_FUTEX)
+#ifndef UEL_LOCK_HAS_FUTEX
+#error "UEL_LOCK_FUTEX requires a Linux target"
+#endif /* UEL_LOCK_HAS_FUTEX */
+#define UEL_LOCK_BACKEND
+typedef uel_futex_t uel_lock_t;
+#define UEL_LOCK_INITIALIZER UEL_FUTEX_INITIALIZER
+#define uel_lock_init(lock) uel_futex_init(lock)
+#define uel_lock_acquire(lock) uel_futex_acquire(lock)
+#define uel_lock_release(lock) uel_futex_release(lock)
+
+#elif defined(UEL_LOCK_PTHREAD)
+#ifndef UEL_LOCK_HAS_PTHREAD
+#error "UEL_LOCK_PTHREAD requires a POSIX target"
+#endif /* UEL_LOCK_HAS_PTHREAD */
+#define UEL_LOCK_BACKEND
+typedef uel_mutex_t uel_lock_t;
+#define UEL_LOCK_INITIALIZER UEL_MUTEX_INITIALIZER
+#define uel_lock_init(lock) uel_mutex_init(lock)
+#define uel_lock_acquire(lock) uel_mutex_acquire(lock)
+#define uel_lock_release(lock) uel_mutex_release(lock)
+
+#else
+/* Without a backend, containers still hold a lock member so their layout does
+ * not depend on the users' critical section macros. It is never touched.
+ */
+typedef unsigned char uel_lock_t;
+#define UEL_LOCK_INITIALIZER 0
+#define uel_lock_init(lock) ((void)(lock))
+#define uel_lock_acquire(lock) ((void)(lock))
+#define uel_lock_release(lock) ((void)(lock))
+#endif
+
+#endif /* end of include guard: UEL_LOCK_H */
+
+/* ---- uevloop/portability/atomic.h ---- */
+/** \file atomic.h
+  * \brief Contains macros for lock-free access to shared memory.
+  *
+  * On GCC-compatible compilers these map to the `__atomic` builtins, which
+  * implement the C11 memory model while remaining usable from C99 code.
+  * Each macro can be overridden by the programmer, according to the
+  * synchronisation methods available on the target platform.
+  */
+
+#ifndef UEL_ATOMIC_H
+#define UEL_ATOMIC_H
+
+/// \cond
+#include <stdbool.h>
+/// \endcond
+
+#if defined(__GNUC__) || defined(__clang__)
+
+//! No ordering constraints, only atomicity
+#define UEL_ATOMIC_RELAXED  __ATOMIC_RELAXED
+//! Subsequent memory accesses are not reordered before the operation
+#define UEL_ATOMIC_ACQUIRE  __ATOMIC_ACQUIRE
+//! Preceding memory accesses are not reordered after the operation
+#define UEL_ATOMIC_RELEASE  __ATOMIC_RELEASE
+//! Full sequential consistency
+#define UEL_ATOMIC_SEQ_CST  __ATOMIC_SEQ_CST
+
+#ifndef UEL_ATOMIC_LOAD
+//! Atomically loads the value stored at `ptr`
+#define UEL_ATOMIC_LOAD(ptr, order) __atomic_load_n((ptr), (order))
+#endif /* UEL_ATOMIC_LOAD */
+
+#ifndef UEL_ATOMIC_STORE
+//! Atomically stores `value` at `ptr`
+#define UEL_ATOMIC_STORE(ptr, value, order) __atomic_store_n((ptr), (value), (order))
+#endif /* UEL_ATOMIC_STORE */
+
+#ifndef UEL_ATOMIC_FETCH_ADD
+//! Atomically adds `value` to the value stored at `ptr`, returning the old value
+#define UEL_ATOMIC_FETCH_ADD(ptr, value, order) __atomic_fetch_add((ptr), (value), (order))
+#endif /* UEL_ATOMIC_FETCH_ADD */
+
+#ifndef UEL_ATOMIC_CAS
+/** \brief Atomically replaces the value at `ptr` with `desired` if it equals
+  * `*expected`. Otherwise, `*expected` is updated with the current value.
+  * Evaluates to whether the exchange took place.
+  */
+#define UEL_ATOMIC_CAS(ptr, expected, desired)                              \
+    __atomic_compare_exchange_n(                                            \
+        (ptr), (expected), (desired), false,                                \
+        __ATOMIC_SEQ_CST, __ATOMIC_RELAXED                                  \
+    )
+#endif /* UEL_ATOMIC_CAS */
+
+#ifndef UEL_ATOMIC_FENCE
+//! Issues a memory fence with the supplied ordering
+#define UEL_ATOMIC_FENCE(order) __atomic_thread_fence(order)
+#endif /* UEL_ATOMIC_FENCE */
+
+#else /* __GNUC__ || __clang__ */
+
+/* Without compiler support, atomic operations degrade to plain memory accesses.
+ * This is only safe on single-core targets where the operations below are not
+ * interrupted midway. Override the macros otherwise.
+ */
+#define UEL_ATOMIC_RELAXED  0
+#define UEL_ATOMIC_ACQUIRE  0
+#define UEL_ATOMIC_RELEASE  0
+#define UEL_ATOMIC_SEQ_CST  0
+
+#ifndef UEL_ATOMIC_LOAD
+#define UEL_ATOMIC_LOAD(ptr, order) (*(ptr))
+#endif /* UEL_ATOMIC_LOAD */
+
+#ifndef UEL_ATOMIC_STORE
+#define UEL_ATOMIC_STORE(ptr, value, order) ((void)(*(ptr) = (value)))
+#endif /* UEL_ATOMIC_STORE */
+
+#ifndef UEL_ATOMIC_FETCH_ADD
+#define UEL_ATOMIC_FETCH_ADD(ptr, value, order) ((*(ptr) += (value)) - (value))
+#endif /* UEL_ATOMIC_FETCH_ADD */
+
+#ifndef UEL_ATOMIC_CAS
+#define UEL_ATOMIC_CAS(ptr, expected, desired)                              \
+    (*(ptr) == *(expected) ?                                                \
+        (*(ptr) = (desired), true) :                                        \
+        (*(expected) = *(ptr), false))
+#endif /* UEL_ATOMIC_CAS */
+
+#ifndef UEL_ATOMIC_FENCE
+#define UEL_ATOMIC_FENCE(order) ((void)0)
+#endif /* UEL_ATOMIC_FENCE */
+
+#endif /* __GNUC__ || __clang__ */
+
+#endif /* end of include guard: UEL_ATOMIC_H */
+
+/* ---- uevloop/portability/linkage.h ---- */
+/** \file linkage.h
+  * \brief Contains macros that set the linkage of the library's symbols.
+  *
+  * By default, µEvLoop is built as a regular library and its symbols have
+  * external linkage. The single-header build generated by
+  * `scripts/amalgamate.py` redefines these so every function is `static inline`
+  * and the whole dispatch path can be inlined by the compiler.
+  */
+
+#ifndef UEL_LINKAGE_H
+#define UEL_LINKAGE_H
+
+#ifndef UEL_API
+//! Prefixes every library function. Empty for regular builds.
+#define UEL_API
+#endif /* UEL_API */
+
+#ifndef UEL_EXTERN
+//! Prefixes declarations of library owned globals. `extern` for regular builds.
+#define UEL_EXTERN extern
+#endif /* UEL_EXTERN */
+
+#ifndef UEL_GLOBAL
+//! Prefixes definitions of library owned globals. Empty for regular builds.
+#define UEL_GLOBAL
+#endif /* UEL_GLOBAL */
+
+#endif /* end of include guard: UEL_LINKAGE_H */
+
+/* ---- uevloop/portability/critical-section.h ---- */
+/** \file critical-section.h
+  * \brief Contains macros for delimitating critical sections.
+  */
+
+#ifndef CRITICAL_SECTION_H
+#define CRITICAL_SECTION_H
+
+
+#if defined(UEL_LOCK_BACKEND) && !defined(UEL_CRITICAL_ENTER) && \
+    !defined(UEL_CRITICAL_SECTION_OBJ_TYPE)
+//! Defined when the global critical section object is allocated by the library
+#define UEL_CRITICAL_SECTION_BUILTIN
+#define UEL_CRITICAL_SECTION_OBJ_TYPE uel_lock_t
+#define UEL_CRITICAL_ENTER uel_lock_acquire(&uel_critical_section)
+#define UEL_CRITICAL_EXIT uel_lock_release(&uel_critical_section)
+#endif
+
+#ifndef UEL_CRITICAL_ENTER
+/** \brief Enters a critical section.
+  *
+  * This is a no-op meant to be overridden by the programmer, according to the
+  * synchronisation methods available on the target platform. If a lock backend
+  * is selected, it acquires the global `uel_critical_section` lock instead.
+  */
+#define UEL_CRITICAL_ENTER
+#endif /* UEL_CRITICAL_ENTER */
+
+#ifndef UEL_CRITICAL_EXIT
+/** \brief Exits a critical section..
+  *
+  * This is a no-op meant to be overridden by the programmer, according to the
+  * synchronisation methods available on the target platform. If a lock backend
+  * is selected, it releases the global `uel_critical_section` lock instead.
+  */
+#define UEL_CRITICAL_EXIT
+#endif /* UEL_CRITICAL_EXIT */
+
+#ifndef UEL_CRITICAL_ENTER_ON
+#ifdef UEL_LOCK_BACKEND
+/** \brief Enters a critical section guarded by a particular `uel_lock_t`.
+  *
+  * Without a lock backend, this falls back to `UEL_CRITICAL_ENTER`.
+  */
+#define UEL_CRITICAL_ENTER_ON(lock) uel_lock_acquire(lock)
+#else
+#define UEL_CRITICAL_ENTER_ON(lock) UEL_CRITICAL_ENTER
+#endif /* UEL_LOCK_BACKEND */
+#endif /* UEL_CRITICAL_ENTER_ON */
+
+#ifndef UEL_CRITICAL_EXIT_ON
+#ifdef UEL_LOCK_BACKEND
+/** \brief Exits a critical section guarded by a particular `uel_lock_t`.
+  *
+  * Without a lock backend, this falls back to `UEL_CRITICAL_EXIT`.
+  */
+#define UEL_CRITICAL_EXIT_ON(lock) uel_lock_release(lock)
+#else
+#define UEL_CRITICAL_EXIT_ON(lock) UEL_CRITICAL_EXIT
+#endif /* UEL_LOCK_BACKEND */
+#endif /* UEL_CRITICAL_EXIT_ON */
+
+#ifdef UEL_CRITICAL_SECTION_OBJ_TYPE
+/** \brief The global critical section object.
+*
+* Should the programmer need a critical section object to manage the system lock,
+* the `UEL_CRITICAL_SECTION_OBJ_TYPE` must be defined with the desired
+* type of such object.
+*
+* An object of type `UEL_CRITICAL_SECTION_OBJ_TYPE` will be then declared as
+* an external global under the symbol `uel_critical_section`.
+* It is the programmer's responsability to actually allocate such object. It will
+* then be available in all critical sections. When a lock backend provides the
+* global lock, the library allocates it instead.
+*/
+#ifdef UEL_CRITICAL_SECTION_BUILTIN
+UEL_EXTERN UEL_CRITICAL_SECTION_OBJ_TYPE uel_critical_section;
+#else
+extern UEL_CRITICAL_SECTION_OBJ_TYPE uel_critical_section;
+#endif /* UEL_CRITICAL_SECTION_BUILTIN */
+#endif /* UEL_CRITICAL_SECTION_OBJ_TYPE */
+
+#endif /* end of include guard: CRITICAL_SECTION_H */
+
+/* ---- uevloop/utils/closure.h ---- */
+/** \file closure.h
+  *
+  * \brief Defines closures, objects that bind functions to creating and calling
+  * contexts
+  */
+
+#ifndef UEL_CLOSURE_H
+#define	UEL_CLOSURE_H
+
+/** \brief Defines a closure function, suitable for being bound at a closure.
+  *
+  * Must take two pointers ar arguments, one for the context and one for
+  * closure parameters. Must return a void pointer.
+  */
+typedef void * (* uel_closure_function_t)(void *context, void *params);
+
+/** \brief Defines a closure, a tuple <function, context, destructor>
+  *
+  * A closure is a data structure that binds some function to a predetermined
+  * context. When the function is run, this context will be available to
+  * the function body.
+  *
+  * When invoking the closure, additional parameters may be passed along and will
+  * also be available to the function body. The function can also return a value
+  * that will be passed back by the `uel_closure_invoke` function.
+  */
+typedef struct uel_closure uel_closure_t;
+struct uel_closure{
+    //! \brief The function to be run when the closure is invoked.
+    //! Must take two pointers ar arguments, one for the context and one for
+    //! closure parameters. Must return a void pointer.
+    uel_closure_function_t function;
+    //! \brief The context supplied to the closure durint creation.
+    //! This context will be available during the function execution.
+    void *context;
+};
+
+/** \brief Creates a new closure.
+  *
+  * Binds the tuple <function, context> and populates a new closure
+  * object with it. The object is returned by value.
+  * \param function The function to be run on closure invokation.
+  * \param context The creation context of the closure.
+  * \return The closure object, by value.
+  */
+UEL_API uel_closure_t uel_closure_create(uel_closure_function_t function,void *context);
+
+/** \brief Invokes a closure and returns whatever value it returned.
+  *
+  * \param closure The closure reference to be invoked.
+  * \param params The parameters to be passed along during closure invokation.
+  * \return This function returns whatever the closure function returned.
+  */
+UEL_API void *uel_closure_invoke(uel_closure_t *closure, void *params);
+
+/** \brief Returns a closure that does nothing.
+  *
+  * The returned closure can be passed as parameters to functions that take
+  * closures as callbacks when the caller does not need to callback.
+  */
+UEL_API uel_closure_t uel_nop();
+
+#endif	/* UEL_CLOSURE_H */
+
+/* ---- uevloop/utils/linked-list.h ---- */
+/** \file linked-list.h
+  *
+  * \brief Defines a simple implementation of linked lists and functions to manipulate it
+  */
+
+#ifndef UEL_LINKED_LIST_H
+#define	UEL_LINKED_LIST_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+
+//! Defines a node of the linked list. Holds a void pointer.
+typedef struct uel_llist_node uel_llist_node_t;
+struct uel_llist_node{
+    //! The value of the node, as a void pointer
+    void *value;
+    //! The next node in the list
+    uel_llist_node_t *next;
+};
+
+/** \brief Defines a linked list. If it is empty, head == tail == NULL.
+  * Pushing or popping from both the head or tail is always O(1).
+  */
+typedef struct uel_llist uel_llist_t;
+struct uel_llist{
+    //! A pointer to the head of the list. Is NULL when the list is empty.
+    uel_llist_node_t *head;
+    //! A pointer to the tail of the list. Is NULL when the list is empty.
+    uel_llist_node_t *tail;
+    //! The count of enqueued nodes
+    uintptr_t count;
+};
+
+/** \brief Initialised a linked list
+  *
+  * \param list The list to be initialised. It will be empty after initialisation.
+  */
+UEL_API void uel_llist_init(uel_llist_t *list);
+
+/** \brief Pushes a node to the head of the list
+  *
+  * \param list The list into which to insert the node
+  * \param node The node to be inserted.
+  */
+UEL_API void uel_llist_push_head(uel_llist_t *list, uel_llist_node_t *node);
+
+/** \brief Pushes a node to the tail of the list
+*
+* \param list The list into which to insert the node
+* \param node The node to be inserted.
+*/
+UEL_API void uel_llist_push_tail(uel_llist_t *list, uel_llist_node_t *node);
+
+/** \brief Pops a node from the head of the list
+*
+* \param list The list from where the node will be popped
+* \return node A pointer to the popped node if it exists. Otherwise, NULL.
+*/
+UEL_API uel_llist_node_t *uel_llist_pop_head(uel_llist_t *list);
+
+/** \brief Pops a node from the tail of the list
+*
+* \param list The list from where the node will be popped
+* \return node A pointer to the popped node if it exists. Otherwise, NULL.
+*/
+UEL_API uel_llist_node_t *uel_llist_pop_tail(uel_llist_t *list);
+
+/** \brief Peeks the element at the head of the list
+*
+* \param list The list from where the node will be peeked
+* \return node A pointer to the peeked node if it exists. Otherwise, NULL.
+*/
+UEL_API uel_llist_node_t *uel_llist_peek_head(uel_llist_t *list);
+
+/** \brief Peeks the element at the tail of the list
+*
+* \param list The list from where the node will be peeked
+* \return node A pointer to the peeked node if it exists. Otherwise, NULL.
+*/
+UEL_API uel_llist_node_t *uel_llist_peek_tail(uel_llist_t *list);
+
+/** \brief Removes a node from the queue
+  *
+  * \param list The list from where the node will be removed
+  * \param node Address of the node being removed
+  * \returns Whether the node was found and removed
+  */
+UEL_API bool uel_llist_remove(uel_llist_t *list, uel_llist_node_t *node);
+
+/** \brief Splits a list in two. The rupture point is determined by the supplied
+ * closure.
+  *
+  * This function iterates the linked list invoking the provided closure for each
+  * node in it. While the closure returns true, nodes are popped from the list.
+  *
+  * \param list The list from where to pop nodes
+  * \param should_remove A closure that will be invoked taking each node as parameter.
+  * The closure should return a boolean indicating whether the node should be
+  * removed or not.
+  * \return A new list containing the removed nodes, in their original order.
+  */
+UEL_API uel_llist_t uel_llist_remove_while(uel_llist_t *list, uel_closure_t *should_remove);
+
+/** \brief Scans a list until it finds a suitable spot to insert the provided node.
+  *
+  * This function iterates the linked list invoking the supplied closure until
+  * it returns true. The supplied node is then inserted at this position.
+  *
+  * The `should_insert` closure will be invoked for each pair of node addresses
+  * in the range [NULL, &NODE_1, &NODE_2, ..., &NODE_N, NULL] as parameter.
+  * When it finds a suitable position, it must return true.
+  *
+  * \param list The list to insert the node at
+  * \param node The node to be inserted
+  * \param should_insert A closure that returns whether the node ought to be
+  * inserted at the current position. The closure function must unpack the
+  * closure parameters to a `uel_llist_node_t **[2]` and return a boolean.
+  */
+UEL_API void uel_llist_insert_at(uel_llist_t *list, uel_llist_node_t *node, uel_closure_t *should_insert);
+
+#endif	/* UEL_LINKED_LIST_H */
+
+/* ---- uevloop/utils/circular-queue.h ---- */
+/** \file circular-queue.h
+  *
+  * \brief Defines circular queues, fast and efficient FIFO data structures
+  */
+
+#ifndef UEL_CIRCULAR_QUEUE_H
+#define	UEL_CIRCULAR_QUEUE_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+/** \brief Defines a circular queue of void pointers
+  *
+  * The circular queue implementation provided is a fast and memory efficient
+  * FIFO data structure that holds void pointers.
+  *
+  * Its capacity is **required** to be a power of two. This makes possible to
+  * use fast modulo-2 arithmetic when dealing with the queue indices.
+  */
+typedef struct uel_cqueue uel_cqueue_t;
+struct uel_cqueue {
+    //! The buffer that will contain the enqueued values.
+    void **buffer;
+    //! The size of the queue. Must be a power of two.
+    uintptr_t size;
+    //! The mask used to wrap the indices around the capacity of the queue when
+    //! they are incremented during pushs/pops
+    uintptr_t mask;
+    //! The position that indicates where the oldest enqueued element is
+    uintptr_t tail;
+    //! The count of enqueued elements.
+    //! New elements are put at (tail + count) % size.
+    uintptr_t count;
+};
+
+/** \brief Initialised a circular queue object
+  *
+  * \param queue The queue object to be intialised
+  * \param buffer An array of void pointers that will be used to store the enqueued
+  * values.
+  * \param size_log2n The size of the queue in its log2 form.
+  */
+UEL_API void uel_cqueue_init(uel_cqueue_t *queue, void **buffer, uintptr_t size_log2n);
+
+/** \brief Empties a queue by resetting its tail and count values.
+  *
+  * \param queue The queue to be cleared.
+  * \param clear_buffer If this is set, completely de-initialises the queue.
+  */
+UEL_API void uel_cqueue_clear(uel_cqueue_t *queue, bool clear_buffer);
+
+/** \brief Pushes an element into the queue
+  *
+  * \param queue The queue into which to push the element
+  * \param element The element to be pushed into the queue
+  * \return Whether the push operation was successfull
+  */
+UEL_API bool uel_cqueue_push(uel_cqueue_t *queue, void *element);
+
+/** \brief Pops an element from the queue.
+  *
+  * \param queue The queue from where to pop
+  * \return The oldest element in the queue, if it exists. Otherwise, NULL.
+  */
+UEL_API void *uel_cqueue_pop(uel_cqueue_t *queue);
+
+/** \brief Pushes many elements into the queue at once
+  *
+  * \param queue The queue into which to push the elements
+  * \param elements The elements to be pushed, from the oldest to the newest
+  * \param count The number of elements to be pushed
+  * \return How many elements were pushed. If the queue cannot hold all of them,
+  * only the first elements that fit are pushed.
+  */
+UEL_API uintptr_t uel_cqueue_push_many(uel_cqueue_t *queue, void **elements, uintptr_t count);
+
+/** \brief Pops many elements from the queue at once
+  *
+  * \param queue The queue from where to pop
+  * \param elements The array where to store the popped elements, from the oldest
+  * to the newest
+  * \param max The max number of elements to be popped. `elements` must be able
+  * to hold this many elements.
+  * \return How many elements were popped
+  */
+UEL_API uintptr_t uel_cqueue_pop_many(uel_cqueue_t *queue, void **elements, uintptr_t max);
+
+/** \brief Peeks the tail of the queue, where the oldest element is enqueued.
+  * This is the element that will be returned on the next pop operation.
+  *
+  * \param queue The queue to peek
+  * \return The oldest element in the queue if it exists. Otherwise, NULL.
+  */
+UEL_API void *uel_cqueue_peek_tail(uel_cqueue_t *queue);
+
+/** \brief Peeks the head of the queue, where the newest element is enqueued.
+* This is the element that was enqueued on the last push operation.
+*
+* \param queue The queue to peek
+* \return The newest element in the queue if it exists. Otherwise, NULL.
+*/
+UEL_API void *uel_cqueue_peek_head(uel_cqueue_t *queue);
+
+/** \brief Checks if the queue is full
+  *
+  * \param queue The queue to check
+  * \return Whether the queue is full or not
+  */
+UEL_API bool uel_cqueue_is_full(uel_cqueue_t *queue);
+
+/** \brief Checks if the queue is empty. Use this before popping from the queue.
+*
+* \param queue The queue to check
+* \return Whether the queue is empty or not
+*/
+UEL_API bool uel_cqueue_is_empty(uel_cqueue_t *queue);
+
+/** \brief Counts the number o elements in the queue
+  *
+  * \param queue The queue whoese elements should be counted
+  * \returns The number of enqueued elements
+  */
+UEL_API uintptr_t uel_cqueue_count(uel_cqueue_t *queue);
+
+#endif	/* UEL_CIRCULAR_QUEUE_H */
+
+/* ---- uevloop/utils/object-pool.h ---- */
+/** \file object-pool.h
+  *
+  * \brief Defines object pools, arrays of pre-allocated objects for dynamic use
+  */
+
+#ifndef UEL_OBJECT_POOL_H
+#define	UEL_OBJECT_POOL_H
+
+
+/// \cond
+#include <stdint.h>
+#include <stdlib.h>
+/// \endcond
+
+/** \brief Pre-allocated memory bound to speciffic types suitable for providing
+  * dynamic object management in the stack.
+  *
+  * Object pools are arrays of objects that are pre-allocated in the stack at
+  * compile time as an alternative to runtime memory allocation for dynamic
+  * object management.
+  *
+  * Objects that have never been acquired are handed out in buffer order by
+  * bumping an index, so initialisation takes constant time regardless of the
+  * pool size. Once released, the addresses of objects are kept in a circular
+  * queue, from where they are acquired again before any untouched object.
+  */
+typedef struct uel_objpool uel_objpool_t;
+struct uel_objpool {
+    //! The buffer that contains each object managed by this pool.
+    uint8_t *buffer;
+    //! The queue containing the addresses of released objects.
+    uel_cqueue_t queue;
+    //! The size of each object in the pool
+    size_t item_size;
+    //! The index of the first object in the buffer never acquired
+    uintptr_t untouched;
+    //! Guards the pool when it is shared between threads and a lock backend is
+    //! selected. Acquiring and releasing do not take it themselves.
+    uel_lock_t lock;
+};
+
+/** \brief Initialises an object pool
+  *
+  * \param pool The pool to be initialised
+  * \param size_log2n The number of objects in the pool in its log2 form
+  * \param item_size The size of each object in the pool. If special alignment
+  * is required, it must be included in this value.
+  * \param buffer The buffer that contains each object in the pool. Must be
+  * `2**size_log2n * item_size` long.
+  * \param queue_buffer A void pointer array that will be used as the buffer to
+  * the object pointer queue. Must be `2**size_log2n` long.
+  */
+UEL_API void uel_objpool_init(
+    uel_objpool_t *pool,
+    size_t size_log2n,
+    size_t item_size,
+    uint8_t *buffer,
+    void **queue_buffer
+);
+
+/** \brief Acquires an object from the pool.
+  *
+  * \param pool The pool from where to acquire the object
+  * \return A pointer to the acquired object or NULL if the pool is depleted
+  */
+UEL_API void *uel_objpool_acquire(uel_objpool_t *pool);
+
+/** \brief Releases an object to the pool
+  *
+  * \param pool The pool where the object will be released to
+  * \param element The element to be returned to the pool
+  * \return Whether the object could be released
+  */
+UEL_API bool uel_objpool_release(uel_objpool_t *pool, void *element);
+
+/** \brief Checks if a pool is depleted
+  *
+  * \param pool The pool to be verified
+  * \return Whether the pool is empty (*i.e.*: All addresses have been given out)
+  */
+UEL_API bool uel_objpool_is_empty(uel_objpool_t *pool);
+
+/** \brief Counts the objects that can still be acquired from a pool
+  *
+  * \param pool The pool to be verified
+  * \return How many objects are available, released or never acquired
+  */
+UEL_API size_t uel_objpool_count_available(uel_objpool_t *pool);
+
+/** \brief Declares the necessary buffers to back an object pool, so the
+  * programmer doesn't have to reason much about it.
+  *
+  * Use this macro as a shortcut to create the required buffers for an object pool.
+  * This will declare two buffers in the calling scope.
+  *
+  * \param type The type of the objects the pool will contain
+  * \param size_log2n The number of elements the pool will contain in log2 form
+  * \param id A valid identifier for the pools.
+  */
+#define UEL_DECLARE_OBJPOOL_BUFFERS(type, size_log2n, id)           \
+    type id##_pool_buffer[(1<<size_log2n)];                         \
+    void *id##_pool_queue_buffer[1<<size_log2n]
+
+/** \brief Refers to a previously declared buffer set.
+  *
+  * This is a convenience macro to supply the buffers generated by
+  * `UEL_DECLARE_OBJPOOL_BUFFERS` to the `uel_objpool_init` function.
+  *
+  * \param id The identifier used to declare the pool buffers
+  */
+#define UEL_OBJPOOL_BUFFERS(id)                                     \
+    (uint8_t *)&id##_pool_buffer, id##_pool_queue_buffer
+
+/** \brief Refers to a previously declared buffer set.
+  *
+  * This is a convenience macro to supply the buffers generated by
+  * `UEL_DECLARE_OBJPOOL_BUFFERS` to the `uel_objpool_init` function.
+  * Use this if the buffers were defined inside a local object, accessible in the
+  * current scope.
+  *
+  * \param id The identifier used to declare the pool buffers
+  * \param obj The object storing the pool buffers
+  */
+#define UEL_OBJPOOL_BUFFERS_IN(id, obj)                             \
+    (uint8_t *)&obj.id##_pool_buffer, obj.id##_pool_queue_buffer
+
+/** \brief Refers to a previously declared buffer set.
+  *
+  * This is a convenience macro to supply the buffers generated by
+  * `UEL_DECLARE_OBJPOOL_BUFFERS` to the `uel_objpool_init` function.
+  * Use this if the buffers were defined inside an object whose address is
+  * accessible in the current scope
+  *
+  * \param id The identifier used to declare the pool buffers
+  * \param obj The address of the object storing the pool buffers
+  */
+#define UEL_OBJPOOL_BUFFERS_AT(id, obj)                             \
+    (uint8_t *)&obj->id##_pool_buffer, obj->id##_pool_queue_buffer
+
+#endif	/* UEL_OBJECT_POOL_H */
+
+/* ---- uevloop/system/time.h ---- */
+/** \file time.h
+  *
+  * \brief Defines the types used to represent time in the scheduler and helpers
+  * to convert between scheduler ticks and physical time units
+  */
+
+#ifndef UEL_TIME_H
+#define UEL_TIME_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+
+#ifdef UEL_SCH_64BIT_TIME
+//! A point in time, measured in scheduler ticks since the application started
+typedef uint64_t uel_time_t;
+//! An interval between two points in time, measured in scheduler ticks
+typedef uint32_t uel_timeout_t;
+#else
+//! A point in time, measured in scheduler ticks since the application started
+typedef uint32_t uel_time_t;
+//! An interval between two points in time, measured in scheduler ticks
+typedef uint16_t uel_timeout_t;
+#endif /* UEL_SCH_64BIT_TIME */
+
+//! Converts a duration in seconds to scheduler ticks
+#define UEL_TIME_FROM_S(s) ((uel_time_t)((uint64_t)(s) * UEL_SCH_TICKS_PER_SECOND))
+//! Converts a duration in milliseconds to scheduler ticks, rounding down
+#define UEL_TIME_FROM_MS(ms) \
+    ((uel_time_t)((uint64_t)(ms) * UEL_SCH_TICKS_PER_SECOND / 1000))
+//! Converts a duration in microseconds to scheduler ticks, rounding down
+#define UEL_TIME_FROM_US(us) \
+    ((uel_time_t)((uint64_t)(us) * UEL_SCH_TICKS_PER_SECOND / 1000000))
+//! Converts a duration in nanoseconds to scheduler ticks, rounding down
+#define UEL_TIME_FROM_NS(ns) \
+    ((uel_time_t)((uint64_t)(ns) * UEL_SCH_TICKS_PER_SECOND / 1000000000))
+
+//! Converts a number of scheduler ticks to milliseconds, rounding down
+#define UEL_TIME_TO_MS(ticks) ((uint64_t)(ticks) * 1000 / UEL_SCH_TICKS_PER_SECOND)
+//! Converts a number of scheduler ticks to microseconds, rounding down
+#define UEL_TIME_TO_US(ticks) ((uint64_t)(ticks) * 1000000 / UEL_SCH_TICKS_PER_SECOND)
+//! Converts a number of scheduler ticks to nanoseconds, rounding down
+#define UEL_TIME_TO_NS(ticks) ((uint64_t)(ticks) * 1000000000 / UEL_SCH_TICKS_PER_SECOND)
+
+#endif /* end of include guard: UEL_TIME_H */
+
+/* ---- uevloop/utils/clock.h ---- */
+/** \file clock.h
+  *
+  * \brief Defines the instrumentation clock, a high resolution time source used
+  * by the optional instrumentation facilities
+  */
+
+#ifndef UEL_CLOCK_H
+#define UEL_CLOCK_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+
+/** \brief A reading of the instrumentation clock.
+  *
+  * The unit is defined by whatever source is installed (*e.g.* CPU cycles,
+  * microseconds or nanoseconds). Timestamps are expected to wrap around, so
+  * only differences between close readings are meaningful.
+  */
+typedef uint32_t uel_timestamp_t;
+
+/** \brief Installs the source of the instrumentation clock.
+  *
+  * The source closure is invoked with no meaningful parameters and must return
+  * the current reading of a free-running counter, cast to a `void *`.
+  * Until a source is installed, the clock always reads zero.
+  *
+  * \param source The closure that reads the clock
+  */
+UEL_API void uel_clock_set_source(uel_closure_t source);
+
+/** \brief Reads the instrumentation clock
+  *
+  * \returns The current clock reading
+  */
+UEL_API uel_timestamp_t uel_clock_now();
+
+#endif /* end of include guard: UEL_CLOCK_H */
+
+/* ---- uevloop/system/event.h ---- */
+/** \file event.h
+  * \brief Defines events and methods to configure events.
+  */
+
+#ifndef UEL_EVENT_H
+#define	UEL_EVENT_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+//! Possible types of events understood by the core
+enum uel_event_type {
+    UEL_CLOSURE_EVENT,
+    UEL_TIMER_EVENT,
+    UEL_SIGNAL_EVENT,
+    UEL_SIGNAL_LISTENER_EVENT,
+    UEL_OBSERVER_EVENT,
+    UEL_EVENT_TYPE_COUNT
+};
+//! Alias to the uel_event_type enum.
+typedef enum uel_event_type uel_event_type_t;
+
+
+//! Possible statuses for a timer event
+enum uel_event_timer_status {
+    UEL_TIMER_RUNNING,
+    UEL_TIMER_PAUSED,
+    UEL_TIMER_CANCELLED
+};
+//! Alias to the uel_event_timer_status
+typedef enum uel_event_timer_status uel_event_timer_status_t;
+
+//! Possible policies for recurring timers that fall behind schedule
+enum uel_event_timer_overrun {
+    //! Run once for each missed period, as soon as possible. This is the default.
+    UEL_TIMER_CATCH_UP,
+    //! Drop missed periods and run again on the next period boundary
+    UEL_TIMER_SKIP,
+    //! Run once right away, standing for every missed period
+    UEL_TIMER_COALESCE
+};
+//! Alias to the uel_event_timer_overrun enum
+typedef enum uel_event_timer_overrun uel_event_timer_overrun_t;
+
+
+/** \brief Events are special messages passed around the core.
+  * They represent tasks to be run at some point by the system.
+  *
+  * Events are bound to information on how and when they should be invoked.
+  * There are five types of events:
+  *
+  * - `UEL_CLOSURE_EVENT`: lifeless wrappers to closures.
+  * - `UEL_TIMER_EVENT`: contains scheduling information associated with some closure
+  * - `UEL_SIGNAL_EVENT`: contains information on the emission of a signal
+  * - `UEL_SIGNAL_LISTENER_EVENT`: represent a single listening operation
+  * - `UEL_OBSERVER_EVENT`: represents a variable being observer by the event loop
+  *
+  * Closure and timer events can be recurring, in which case they won't be discarded
+  * after processing by the event loop.
+  *
+  * Signal events are *always* discarded by the event loop.
+  * Signal listeners are never meant to be sent there. In their case, the `repeating`
+  * flag determines whether the signal should be able to fire multiple times or just once.
+  */
+typedef struct event uel_event_t;
+struct event {
+    uel_event_type_t type; //!< The type of the event, as defined by `uel_event_type_t`
+    uel_closure_t closure; //!< The closure to be invoked a.k.a. the action to be run
+    void *value; //!< The value the closure should be invoked with
+    bool repeating; //!< Marks whether the event should be discarded after processing.
+#ifdef UEL_ENABLE_LATENCY_STATS
+    //! The instrumentation clock reading when this event was last enqueued
+    uel_timestamp_t enqueued_at;
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+    //! Allows to compact many speciffic details on various event types on a single
+    //! memory slot. Pertinent content depends on the `type` member value.
+    union uel_event_detail {
+
+        //! Contains information suitable for scheduling an event at the scheduler.
+        struct uel_event_timer {
+            /** \brief The value the system timer must be at when this event's closure
+            * should be invoked. This is a best effort value.
+            */
+            uel_time_t due_time;
+            /** \brief When the scheduler will actually expire this timer. This is
+              * `due_time`, possibly deferred within `slack` to match other timers.
+              */
+            uel_time_t expires_at;
+            uel_timeout_t timeout; //!< Holds the interval between two executions of the timer
+            /** \brief How much later than `due_time` this timer may expire, so
+              * the scheduler can batch it with other timers.
+              */
+            uel_timeout_t slack;
+            uel_event_timer_status_t status; //!< Current timer status
+            //! What to do when a recurring timer falls behind schedule
+            uel_event_timer_overrun_t overrun;
+            //! How many periods were dropped by the overrun policy the last time
+            //! this timer was rescheduled (skip) or expired (coalesce)
+            uint16_t missed;
+        } timer; //!< The scheduling information of this event. Relevant only for timers
+
+        //! Contains information related to an emitted `signal`.
+        struct uel_event_signal {
+            uintptr_t value; //!< The integer value that identifies this signal
+            uel_llist_t *listeners; //!< Reference to the signal listeners
+            uel_lock_t *lock; //!< The lock guarding the signal listeners
+        } signal; //!< The emission information of this event. Relevant only for signals
+
+        //! Contains the context of a particular signal listener
+        struct uel_event_listener {
+            /** When this flag is set, the `event_loop` will not run this event's
+              * closure. Additionally, the event will be destroyed.
+              */
+            bool unlistened;
+        } listener; //!< The listening information of this event. Relevant only for signal listeners
+
+        //! Contains the reference to an observer variable
+        struct uel_event_observer {
+            volatile uintptr_t *condition_var; //!< The address of a volatile value to observe
+            uintptr_t last_value; //!< The last value read
+            //! Whether this observer has been cancelled and is awaiting for destruction
+            bool cancelled;
+        } observer; //!< The observing information of this event. Relevant only for observers
+    } detail; //!< Represents speciffic detail on a event depending on its type.
+};
+
+/** \brief Configures a closure event
+  *
+  * \param event The event to be configured
+  * \param closure The closure to be invoked when the event is run
+  * \param value The value to supply to the closure as parameters when it is invoked
+  * \param repeating Intructs the system whether should this event be disposed of
+  * after processing
+  */
+UEL_API void uel_event_config_closure(
+    uel_event_t *event,
+    uel_closure_t *closure,
+    void *value,
+    bool repeating
+);
+
+/** \brief Configures a signal event
+  *
+  * \param event The event to be configured
+  * \param signal The integer value that identifies this signal
+  * \param listeners The listeners associated to this signal
+  * \param lock The lock guarding the listeners, usually the relay's
+  * \param params The parameters associated with this signal emission
+  */
+UEL_API void uel_event_config_signal(
+    uel_event_t *event,
+    uintptr_t signal,
+    uel_llist_t *listeners,
+    uel_lock_t *lock,
+    void *params
+);
+
+/** \brief Configures a signal listener event
+  *
+  * \param event The event to be configured
+  * \param closure The closure to be invoked when the event is run
+  * \param repeating Intructs the system whether should this event be disposed of
+  * after processing
+  */
+UEL_API void uel_event_config_signal_listener(uel_event_t *event, uel_closure_t *closure, bool repeating);
+
+/** \brief Configures an observer event
+  *
+  * \param event The event to be configured
+  * \param closure The closure to be invoked when the observed value changes
+  * \param condition_var The address of a volatile variable to be observed
+  * \param repeating Intructs the system whether should this event be disposed of
+  * after processing
+  */
+UEL_API void uel_event_config_observer(
+    uel_event_t *event,
+    uel_closure_t *closure,
+    volatile uintptr_t *condition_var,
+    bool repeating
+);
+
+/** \brief Cancels an observer
+  *
+  * \param event The observer event to be cancelled
+  */
+UEL_API void uel_event_observer_cancel(uel_event_t *event);
+
+/** \brief Configures a timer event
+  * \param event The event to be configured
+  * \param timeout The delay to process this event, in scheduler ticks. If the
+  * event is repeating, this defines the interval between successive executions.
+  * \param repeating If this flag is set, the event will not be destroyed after
+  * execution. Instead it will be put on the schedule queue.
+  * \param immediate If this flag is set, a recurring timer will be immediately
+  * enqueued for processing. One-shot timers will ignore this setting.
+  * \param closure The closure to be invoked when the timer expires
+  * \param value The value to supply to the closure as parameters when it is invoked
+  * \param current_time The current value set in the system counter.
+  */
+UEL_API void uel_event_config_timer(
+    uel_event_t *event,
+    uel_timeout_t timeout,
+    bool repeating,
+    bool immediate,
+    uel_closure_t *closure,
+    void *value,
+    uel_time_t current_time
+);
+
+/** \brief Sets the slack of a timer event
+  *
+  * Whenever the timer is scheduled, its expiration may be deferred by up to
+  * `slack` so that it expires together with some other timer already
+  * scheduled. This reduces the number of times the scheduler wakes up when
+  * many timers have close due times. The nominal due time is left untouched,
+  * so recurring timers do not drift. Timers are created with no slack.
+  *
+  * \param event The timer event whose slack should be set
+  * \param slack The maximum deferral of each expiration, in scheduler ticks
+  */
+UEL_API void uel_event_timer_set_slack(uel_event_t *event, uel_timeout_t slack);
+
+/** \brief Sets the overrun policy of a recurring timer event
+  *
+  * When the application stalls for longer than a timer's period, its due time
+  * is already past by the time it is rescheduled. The overrun policy determines
+  * whether the timer then runs once for each missed period
+  * (`UEL_TIMER_CATCH_UP`), runs again only on the next period boundary
+  * (`UEL_TIMER_SKIP`) or runs once right away (`UEL_TIMER_COALESCE`). In any
+  * case, due times stay aligned to the original period grid.
+  *
+  * \param event The timer event whose policy should be set
+  * \param overrun The overrun policy
+  */
+UEL_API void uel_event_timer_set_overrun(uel_event_t *event, uel_event_timer_overrun_t overrun);
+
+/** \brief Fetches how many periods a timer event dropped due to its overrun
+  * policy. A coalescing timer can read this from its closure to account for the
+  * periods its current run stands for, besides its own.
+  *
+  * \param event The timer event
+  * \returns The number of periods dropped the last time the timer was
+  * rescheduled (skipping timers) or expired (coalescing timers). Always zero for
+  * catch-up timers.
+  */
+UEL_API uint16_t uel_event_timer_get_missed(uel_event_t *event);
+
+/** \brief Pauses a timer event
+  *
+  * \param event The timer event to be paused
+  */
+UEL_API void uel_event_timer_pause(uel_event_t *event);
+
+/** \brief Resumes a paused timer event
+  *
+  * \param event The timer event to be resumed
+  */
+UEL_API void uel_event_timer_resume(uel_event_t *event);
+
+/** \brief Cancels a timer event
+  *
+  * \param event The timer event to be cancelled
+  */
+UEL_API void uel_event_timer_cancel(uel_event_t *event);
+
+#endif	/* UEL_EVENT_H */
+
+/* ---- uevloop/system/containers/system-pools.h ---- */
+/** \file system-pools.h
+  * \brief A container for the system's internal pools
+  */
+
+#ifndef UEL_SYSTEM_POOLS_H
+#define	UEL_SYSTEM_POOLS_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+
+/** \brief A container for the system pools
+  *
+  * The syspools object is meant as a container for the internal system pools.
+  * It is a safe interface to the pools, acquiring and releasing objects on demand.
+  */
+typedef struct syspools uel_syspools_t;
+struct syspools{
+
+    //! Unrolls the `UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_SYSPOOLS_EVENT_POOL_SIZE (1<<UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N)
+    //! The buffer used to store events in the event pool
+    uel_event_t event_pool_buffer[UEL_SYSPOOLS_EVENT_POOL_SIZE];
+    //! The buffer used to store event pointers in the event pool queue
+    void *event_pool_queue_buffer[UEL_SYSPOOLS_EVENT_POOL_SIZE];
+    //! The event pool object. Contains all the events used by the core.
+    uel_objpool_t event_pool;
+
+    //! Unrolls the `UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE (1<<UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N)
+    //! The buffer used to store llist nodes in the llist node pool
+    uel_llist_node_t llist_node_pool_buffer[UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE];
+    //! The budder used to store llist node pointers in the llist node pool queue
+    void *llist_node_pool_queue_buffer[UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE];
+    //! The llist node pool object. Contains all llist nodes used by the core.
+    uel_objpool_t llist_node_pool;
+};
+
+/** \brief Initialise the system pools
+  *
+  * \param pools The uel_syspools_t instance
+  */
+UEL_API void uel_syspools_init(uel_syspools_t *pools);
+
+/** \brief Acquires an event from the system pools
+  *
+  * \param pools The uel_syspools_t instance
+  * \returns The acquired event
+  */
+UEL_API uel_event_t *uel_syspools_acquire_event(uel_syspools_t *pools);
+
+/** \brief Acquires a linked list node from the system pools
+  *
+  * \param pools The uel_syspools_t instance
+  * \returns The acquired linked list node
+  */
+UEL_API uel_llist_node_t *uel_syspools_acquire_llist_node(uel_syspools_t *pools);
+
+/** \brief Releases an event to the system pools
+  *
+  * \param pools The uel_syspools_t instance
+  * \param event The event to be released
+  * \returns Whether the event was successfully released
+  */
+UEL_API bool uel_syspools_release_event(uel_syspools_t *pools, uel_event_t *event);
+
+/** \brief Releases a linked list node to the system pools
+  *
+  * \param pools The uel_syspools_t instance
+  * \param node The linked list node to be released
+  * \returns Wheter the linked list node was successfully released
+  */
+UEL_API bool uel_syspools_release_llist_node(uel_syspools_t *pools, uel_llist_node_t *node);
+
+#endif	/* UEL_SYSTEM_POOLS_H */
+
+/* ---- uevloop/system/containers/system-queues.h ---- */
+/** \file system-queues.h
+  * \brief A container for the system's internal queues
+  */
+
+#ifndef UEL_SYSTEM_QUEUES_H
+#define UEL_SYSTEM_QUEUES_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+
+/** \brief A container for the system's internal queues
+  *
+  * This module conveniently declares and contains the object queues necessary for
+  * internal operation of the application.
+  *
+  * It also encapsulate manipulation of shared memory in critical sections. All
+  * of its functions are safe, except for `uel_sysqueues_init`.
+  */
+typedef struct sysqueues uel_sysqueues_t;
+struct sysqueues {
+
+    //! Unrolls the `UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_SYSQUEUES_EVENT_QUEUE_SIZE (1<<UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N)
+    //! The event queue buffer
+    void *event_queue_buffer[UEL_SYSQUEUES_EVENT_QUEUE_SIZE];
+    /** \brief The application's event queue.
+      *
+      * Holds events ready to be processed on the next runloop.
+      */
+    uel_cqueue_t event_queue;
+    //! Guards the event queue when a lock backend is selected
+    uel_lock_t event_queue_lock;
+
+
+    //! Unrolls the `UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE (1<<UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N)
+    //! The schedule queue buffer
+    void *schedule_queue_buffer[UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE];
+    /** \brief The application's schedule queue.
+      *
+      * Hold events already processed by the runloop but fit for rescheduling at
+      * the scheduler.
+      */
+    uel_cqueue_t schedule_queue;
+    //! Guards the schedule queue when a lock backend is selected
+    uel_lock_t schedule_queue_lock;
+};
+
+/** \brief Initialises a new uel_sysqueues_t
+  *
+  * \param queues The uel_sysqueues_t instance to be initialised
+  */
+UEL_API void uel_sysqueues_init(uel_sysqueues_t *queues);
+
+/** \brief Pushes an event into the event queue.
+  *
+  * This makes the event ready for colletion e processing by the event loop.
+  *
+  * \param queues The uel_sysqueues_t instance to be initialised
+  * \param event The event to be enqueued
+  */
+UEL_API void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event);
+
+/** \brief Pushes many events into the event queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events The events to be enqueued, in order
+  * \param count The number of events to be enqueued
+  * \returns How many events were enqueued. Fewer than `count` events are only
+  * enqueued if the queue gets full.
+  */
+UEL_API uintptr_t uel_sysqueues_enqueue_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+);
+
+/** \brief Pops an event from the event queue.
+  *
+  * \param queues The uel_sysqueues_t instance from whose event queue the event must
+  * be popped.
+  * \returns The popped event's address. If the queue is empty, returns NULL.
+  */
+UEL_API uel_event_t *uel_sysqueues_get_enqueued_event(uel_sysqueues_t *queues);
+
+/** \brief Pops many events from the event queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events Where to store the popped events, from the oldest to the newest
+  * \param max The max number of events to be popped
+  * \returns How many events were popped
+  */
+UEL_API uintptr_t uel_sysqueues_get_enqueued_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+);
+
+/** \brief Counts the number of elements in the event queue
+  *
+  * \param queues The uel_sysqueues_t instance whose event queue's elements should
+  * be counted
+  * \returns The number of elements in the queue
+  */
+UEL_API uintptr_t uel_sysqueues_count_enqueued_events(uel_sysqueues_t *queues);
+
+/** \brief Pushes an event into the schedule queue.
+  *
+  * This makes the event ready for collection and scheduling by the scheduler.
+  *
+  * \param queues The uel_sysqueues_t instance to be initialised
+  * \param event The event to be scheduled
+  */
+UEL_API void uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event);
+
+/** \brief Pushes many events into the schedule queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events The events to be scheduled, in order
+  * \param count The number of events to be scheduled
+  * \returns How many events were scheduled. Fewer than `count` events are only
+  * scheduled if the queue gets full.
+  */
+UEL_API uintptr_t uel_sysqueues_schedule_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+);
+
+/** \brief Pops an event from the schedule queue.
+  *
+  * \param queues The uel_sysqueues_t instance from whose schedule queue the event must
+  * be popped.
+  * \returns The popped event's address. If the queue is empty, returns NULL.
+  */
+UEL_API uel_event_t *uel_sysqueues_get_scheduled_event(uel_sysqueues_t *queues);
+
+/** \brief Pops many events from the schedule queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events Where to store the popped events, from the oldest to the newest
+  * \param max The max number of events to be popped
+  * \returns How many events were popped
+  */
+UEL_API uintptr_t uel_sysqueues_get_scheduled_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+);
+
+/** \brief Counts the number of elements in the schedule queue
+  *
+  * \param queues The uel_sysqueues_t instance whose schedule queue's elements should
+  * be counted
+  * \returns The number of elements in the queue
+  */
+UEL_API uintptr_t uel_sysqueues_count_scheduled_events(uel_sysqueues_t *queues);
+
+#endif /* end of include guard: UEL_SYSTEM_QUEUES_H */
+
+/* ---- uevloop/utils/histogram.h ---- */
+/** \file histogram.h
+  *
+  * \brief Defines log-linear histograms, compact structures that record
+  * distributions of values spanning many orders of magnitude
+  */
+
+#ifndef UEL_HISTOGRAM_H
+#define UEL_HISTOGRAM_H
+
+/// \cond
+#include <stdint.h>
+#include <stdlib.h>
+/// \endcond
+
+
+//! Unrolls `UEL_HISTOGRAM_PRECISION_BITS` into the number of buckets per power of two
+#define UEL_HISTOGRAM_SUB_BUCKET_COUNT (1<<UEL_HISTOGRAM_PRECISION_BITS)
+//! The number of buckets needed to cover the whole 32-bit range
+#define UEL_HISTOGRAM_BUCKET_COUNT \
+    ((33 - UEL_HISTOGRAM_PRECISION_BITS) * UEL_HISTOGRAM_SUB_BUCKET_COUNT)
+
+/** \brief A log-linear histogram of 32-bit values
+  *
+  * Values are sorted into buckets in the same fashion as HDR histograms: each
+  * power of two is split into `UEL_HISTOGRAM_SUB_BUCKET_COUNT` linear buckets.
+  * Values smaller than twice that are recorded exactly; larger values are
+  * recorded with a relative error bounded by `1/UEL_HISTOGRAM_SUB_BUCKET_COUNT`.
+  *
+  * Recording a value takes constant time and no memory other than the
+  * histogram itself.
+  */
+typedef struct uel_histogram uel_histogram_t;
+struct uel_histogram {
+    //! The number of recorded values in each bucket
+    uint32_t buckets[UEL_HISTOGRAM_BUCKET_COUNT];
+    //! The number of recorded values
+    uint32_t count;
+    //! The smallest recorded value
+    uint32_t min;
+    //! The largest recorded value
+    uint32_t max;
+    //! The sum of every recorded value
+    uint64_t sum;
+};
+
+/** \brief Initialises a histogram. This also clears any recorded values.
+  *
+  * \param histogram The histogram to be initialised
+  */
+UEL_API void uel_histogram_init(uel_histogram_t *histogram);
+
+/** \brief Records a value into a histogram
+  *
+  * \param histogram The histogram where to record the value
+  * \param value The value to be recorded
+  */
+UEL_API void uel_histogram_record(uel_histogram_t *histogram, uint32_t value);
+
+/** \brief Finds which bucket a value is recorded at
+  *
+  * \param value The value to be located
+  * \returns The index of the bucket that holds `value`
+  */
+UEL_API size_t uel_histogram_bucket_index(uint32_t value);
+
+/** \brief Computes the smallest value recorded at some bucket. Use this to
+  * label buckets when exporting histograms.
+  *
+  * \param index The index of the bucket
+  * \returns The lower bound of the bucket
+  */
+UEL_API uint32_t uel_histogram_bucket_floor(size_t index);
+
+/** \brief Estimates a quantile of the recorded distribution
+  *
+  * \param histogram The histogram to be inspected
+  * \param permille The quantile to be estimated, in permille (*e.g.* 500 for the
+  * median, 990 for the 99th percentile)
+  * \returns The lower bound of the bucket that contains the quantile. If no
+  * value was recorded, returns zero.
+  */
+UEL_API uint32_t uel_histogram_quantile(uel_histogram_t *histogram, uint16_t permille);
+
+#endif /* end of include guard: UEL_HISTOGRAM_H */
+
+/* ---- uevloop/system/latency.h ---- */
+/** \file latency.h
+  *
+  * \brief Defines latency statistics, optional histograms of how long events
+  * wait before being run. Only available when `UEL_ENABLE_LATENCY_STATS` is defined.
+  */
+
+#ifndef UEL_LATENCY_H
+#define UEL_LATENCY_H
+
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+
+/** \brief Latency statistics of an application
+  *
+  * Once attached to an event loop and a scheduler, this records:
+  *
+  * - The queueing delay of each event, *i.e.* the time between the event being
+  * enqueued and its closure being invoked, measured in instrumentation clock
+  * units (see `uel_clock_set_source()`) and sorted by event type
+  * - The lateness of each timer, *i.e.* the time between its due time and it
+  * being enqueued by the scheduler, measured in scheduler timer units. The total
+  * delay of a timer is its lateness plus its queueing delay.
+  *
+  * Histograms can be scraped directly at any moment and reset with
+  * `uel_latency_init()`.
+  */
+typedef struct uel_latency uel_latency_t;
+struct uel_latency {
+    //! Queueing delay histograms, indexed by `uel_event_type_t`
+    uel_histogram_t queueing_delay[UEL_EVENT_TYPE_COUNT];
+    //! Timer lateness histogram
+    uel_histogram_t timer_lateness;
+};
+
+/** \brief Initialises latency statistics. This also clears any recorded values.
+  *
+  * \param latency The uel_latency_t instance to be initialised
+  */
+UEL_API void uel_latency_init(uel_latency_t *latency);
+
+/** \brief Records the queueing delay of an event that is about to be run
+  *
+  * \param latency The uel_latency_t instance where to record the delay
+  * \param event The event about to be run
+  */
+UEL_API void uel_latency_record_queueing(uel_latency_t *latency, uel_event_t *event);
+
+/** \brief Records the lateness of a timer that has just expired
+  *
+  * \param latency The uel_latency_t instance where to record the lateness
+  * \param timer The expired timer
+  * \param current_time The scheduler's timer value when the timer expired
+  */
+UEL_API void uel_latency_record_lateness(
+    uel_latency_t *latency,
+    uel_event_t *timer,
+    uel_time_t current_time
+);
+
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+#endif /* end of include guard: UEL_LATENCY_H */
+
+/* ---- uevloop/system/event-loop.h ---- */
+/** \file event-loop.h
+  * \brief Module responsible for running enqueued events and process them accordingly
+  */
+
+#ifndef UEL_EVENT_LOOP_H
+#define UEL_EVENT_LOOP_H
+
+
+/** \brief The event loop object
+  *
+  * This object represents an event loop. It is operated primarily by the system
+  * internal queues:
+  * 1. The inbound event queue, which is the feeding point of the event loop.
+  * 2. The outbound schedule queue, which holds reusable timers already run.
+  */
+typedef struct uel_evloop uel_evloop_t;
+struct uel_evloop{
+    uel_syspools_t *pools; //!< Reference to the system's pools
+    uel_sysqueues_t *queues; //!< Reference to the system's queues
+    uel_llist_t observers; //!< Stores references to values to be observed
+    //! Guards the observer list when a lock backend is selected
+    uel_lock_t observers_lock;
+    uintptr_t dispatched; //!< How many events were taken from the event queue so far
+#ifdef UEL_ENABLE_LATENCY_STATS
+    //! Where to record queueing delays. Nothing is recorded if `NULL`.
+    uel_latency_t *latency;
+#endif /* UEL_ENABLE_LATENCY_STATS */
+};
+
+/** \brief Initialises an event loop
+  *
+  * \param event_loop The uel_evloop_t instance to be initialised
+  * \param pools The system's internal pools
+  * \param queues The system's internal queues
+  */
+UEL_API void uel_evloop_init(
+    uel_evloop_t *event_loop,
+    uel_syspools_t *pools,
+    uel_sysqueues_t *queues
+);
+
+/** \brief Triggers a runloop.
+  *
+  * This function flushes the event queue and processes each event in it.
+  * Afterwards, depending on the event type, it disposes of the event in
+  * different ways.
+  *
+  * Each iteration of this cycle is called a runloop.
+  *
+  * \param event_loop The uel_evloop_t instance to be run
+  */
+UEL_API void uel_evloop_run(uel_evloop_t *event_loop);
+
+/** \brief Enqueues a closure to be invoked
+  *
+  * \param event_loop The uel_evloop_t instance into which the closure will be enqueued
+  * \param closure The closure to be enqueued
+  * \param value The value to invoked the closure with
+  */
+UEL_API void uel_evloop_enqueue_closure(
+    uel_evloop_t *event_loop,
+    uel_closure_t *closure,
+    void *value
+);
+
+/** \brief Observes a value and reacts to changes in it
+  *
+  * \param event_loop The event loop where to register this observer
+  * \param condition_var The address of some data that should be observed
+  * \param closure The closure to be invoked when the observed value changes
+  *
+  * \returns The observer event representing this observation operation
+  */
+UEL_API uel_event_t *uel_evloop_observe(
+    uel_evloop_t *event_loop,
+    volatile uintptr_t *condition_var,
+    uel_closure_t *closure
+);
+
+/** \brief Observes a value and reacts once to changes in it. Afterwards, the observer
+  * will be destroyed.
+  *
+  * \param event_loop The event loop where to register this observer
+  * \param condition_var The address of some data that should be observed
+  * \param closure The closure to be invoked when the observed value changes
+  *
+  * \returns The observer event representing this observation operation
+  */
+UEL_API uel_event_t *uel_evloop_observe_once(
+    uel_evloop_t *event_loop,
+    volatile uintptr_t *condition_var,
+    uel_closure_t *closure
+);
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+/** \brief Attaches latency statistics to an event loop. From now on, the
+  * queueing delay of each event run is recorded.
+  *
+  * \param event_loop The event loop to be measured
+  * \param latency Where to record the statistics. Pass `NULL` to detach.
+  */
+UEL_API void uel_evloop_set_latency(uel_evloop_t *event_loop, uel_latency_t *latency);
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+#endif /* end of include guard: UEL_EVENT_LOOP_H */
+
+/* ---- uevloop/utils/pipeline.h ---- */
+/** \file pipeline.h
+  *
+  * \brief Defines pipelines, structures to hold many closures and functions to invoke
+  * them sequentially, composing their functionality
+  */
+
+#ifndef UEL_PIPELINE_H
+#define UEL_PIPELINE_H
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+
+/** \brief A pipeline is an ordered closure list to be run in sequence.
+  *
+  * Pipelines contain an ordered list of closures. When applied to some initial
+  * parameter, each closure is invoked with the previous one's return value as
+  * parameter.
+  */
+typedef struct uel_pipeline uel_pipeline_t;
+struct uel_pipeline{
+    //! A reference to an array of closures to be run.
+    uel_closure_t *closures;
+    //! The number of closures in the array.
+    size_t count;
+};
+
+/** \brief Initialises a new pipeline
+  *
+  * \param pipeline The pipeline to be initialised
+  * \param closures The closures that should be run in sequence, in an array.
+  * \param count The number of closures to be piped.
+  */
+UEL_API void uel_pipeline_init(uel_pipeline_t *pipeline, uel_closure_t *closures, size_t count);
+
+/** \brief Applies a pipeline to some input
+  *
+  * This function takes some input and passes it to the first closure
+  * in the pipeline. The value returned from this first closure will be passed
+  * to the second one and so on.
+  *
+  * \param pipeline The pipeline to be applied
+  * \param params The initial parameters that will be passed to the first closure
+  * \returns Whatever was returned by the last closure invoked
+  */
+UEL_API void *uel_pipeline_apply(uel_pipeline_t *pipeline, void *params);
+
+/** \brief Helper macro to create a pipeline and its required data structures
+  *
+  * This macro, based on the input identifier, declares:
+  * - a closure array with any supplied closures ([id]_pipeline_closures)
+  * - a pipeline object wrapping the closure array ([id]_pipeline)
+  *
+  * \param id The identifier on which to base declared variables' names.
+  * \param ... The closures to be pipelined.
+  */
+#define UEL_PIPELINE_DECLARE(id, ...)                                         \
+    uel_closure_t id##_pipeline_closures[] = {__VA_ARGS__};                   \
+    uel_pipeline_t id##_pipeline;                                             \
+    uel_pipeline_init(&id##_pipeline, id##_pipeline_closures,                 \
+                    sizeof(id##_pipeline_closures) / sizeof(uel_closure_t));
+
+//! \cond
+#define UEL_PIPELINE_STAGE_CALL(...) UEL_PIPELINE_STAGE_CALL_(__VA_ARGS__)
+#define UEL_PIPELINE_STAGE_CALL_(value, function, context)                    \
+    function((void *)(context), (value))
+#define UEL_PIPELINE_STAGE_UNPACK(function, context) function, context
+#define UEL_PIPELINE_STAGE(value, stage)                                      \
+    UEL_PIPELINE_STAGE_CALL(value, UEL_PIPELINE_STAGE_UNPACK stage)
+
+#define UEL_PIPELINE_CHAIN_1(v, s1) UEL_PIPELINE_STAGE(v, s1)
+#define UEL_PIPELINE_CHAIN_2(v, s1, s2)                                       \
+    UEL_PIPELINE_CHAIN_1(UEL_PIPELINE_STAGE(v, s1), s2)
+#define UEL_PIPELINE_CHAIN_3(v, s1, s2, s3)                                   \
+    UEL_PIPELINE_CHAIN_2(UEL_PIPELINE_STAGE(v, s1), s2, s3)
+#define UEL_PIPELINE_CHAIN_4(v, s1, s2, s3, s4)                               \
+    UEL_PIPELINE_CHAIN_3(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4)
+#define UEL_PIPELINE_CHAIN_5(v, s1, s2, s3, s4, s5)                           \
+    UEL_PIPELINE_CHAIN_4(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5)
+#define UEL_PIPELINE_CHAIN_6(v, s1, s2, s3, s4, s5, s6)                       \
+    UEL_PIPELINE_CHAIN_5(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5, s6)
+#define UEL_PIPELINE_CHAIN_7(v, s1, s2, s3, s4, s5, s6, s7)                   \
+    UEL_PIPELINE_CHAIN_6(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5, s6, s7)
+#define UEL_PIPELINE_CHAIN_8(v, s1, s2, s3, s4, s5, s6, s7, s8)               \
+    UEL_PIPELINE_CHAIN_7(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5, s6, s7, s8)
+
+#define UEL_PIPELINE_COUNT(...)                                               \
+    UEL_PIPELINE_COUNT_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define UEL_PIPELINE_COUNT_(_1, _2, _3, _4, _5, _6, _7, _8, count, ...) count
+#define UEL_PIPELINE_CHAIN(count, value, ...)                                 \
+    UEL_PIPELINE_CHAIN_(count, value, __VA_ARGS__)
+#define UEL_PIPELINE_CHAIN_(count, value, ...)                                \
+    UEL_PIPELINE_CHAIN_##count(value, __VA_ARGS__)
+//! \endcond
+
+/** \brief Helper macro to define a pipeline whose stages are known at compile
+  * time
+  *
+  * Instead of an array of closures walked at runtime, this macro expands into
+  * a direct chain of calls that the compiler can inline. It must be used at
+  * file scope and, based on the input identifier, defines:
+  * - `void *[id]_pipeline_apply(void *params)`, with the same semantics as
+  * `uel_pipeline_apply()`
+  * - `void *[id]_pipeline_function(void *context, void *params)`, which ignores
+  * its context and can be bound with `uel_closure_create()` wherever a closure
+  * is expected
+  *
+  * Stages are given as parenthesised `(function, context)` pairs, where
+  * `function` is a closure function and `context` is an expression valid at
+  * file scope, such as a constant or the address of a static object. Up to 8
+  * stages are supported. Unlike closures invoked by the core, stages are not
+  * accounted for by the profiler.
+  *
+  * \param id The identifier on which to base defined functions' names.
+  * \param ... The `(function, context)` stages to be pipelined.
+  */
+#define UEL_PIPELINE_DECLARE_STATIC(id, ...)                                  \
+    static inline void *id##_pipeline_apply(void *params){                    \
+        return UEL_PIPELINE_CHAIN(                                            \
+            UEL_PIPELINE_COUNT(__VA_ARGS__), params, __VA_ARGS__              \
+        );                                                                    \
+    }                                                                         \
+    static inline void *id##_pipeline_function(void *context, void *params){  \
+        return id##_pipeline_apply(params);                                   \
+    }
+
+#endif /* end of include guard: UEL_PIPELINE_H */
+
+/* ---- uevloop/utils/promise.h ---- */
+/** \file promise.h
+  * \brief Contains definitions for promise stores, promises and functions to
+  * manipulate them.
+  *
+  * Promises are structures that associate asynchronous operations to synchronous
+  * processing of the values produces by them, allowing async data pipelines to
+  * be built.
+  */
+
+#ifndef UEL_PROMISE_H
+#define UEL_PROMISE_H
+
+
+/** \brief Defines the possible states for a prommise
+  */
+enum uel_promise_state {
+    UEL_PROMISE_PENDING , //!< A promise that has not been resolved nor rejected
+    UEL_PROMISE_RESOLVED, //!< A promise that has been resolved with some value
+    UEL_PROMISE_REJECTED, //!< A promise that has been rejected with some error
+};
+//! Alias to the `uel_promise_state` enum
+typedef enum uel_promise_state uel_promise_state_t;
+
+/** \brief Defines a single synchronous operation to be invoked when the promise
+  * is either resolved or rejected.
+  *
+  * A promise segment is a data structure that defines how to process a value
+  * yielded by a promise when it resolves or rejects.
+  *
+  * Segments contain two closures, representing success and error execution paths.
+  * Once the promise containing a segment is settled, depending on its state,
+  * either closure is invoked with the promise as parameter.
+  *
+  * If a handler closure returns anything different that NULL, it's assumed to
+  * be a promise pointer to be awaited for.
+  */
+typedef struct uel_promise_segment uel_promise_segment_t;
+struct uel_promise_segment {
+    //! The closure to be invoked when the promise is resolved
+    uel_closure_t resolve;
+    //! The closure to be invoked when the promise is rejected
+    uel_closure_t reject;
+    //! The next synchronous segment to be processed
+    uel_promise_segment_t *next;
+};
+
+//! Forward declaration of the store struct
+struct uel_promise_store;
+
+/** \brief A promise is association of an asynchronous operation to the possible
+  * execution paths that follow its resolution. It is also a holder for the value
+  * it was settled with.
+  *
+  * A promise is an object that can be in three different states:
+  * - PENDING: <br/>
+  *     A promise is pending when its asynchronous operation has not completed
+  *     yet and the promise does **NOT** hold any meaningful value. <br/>
+  *     If a segment handler returns a new promise, the original promise is
+  *     considered pending while it awaits for the new promise to settle.
+  *
+  * - RESOLVED: <br/>
+  *     A promise is resolved when its asynchronous operation is successfully
+  *     completed. It consistently holds whatever value it has been resolved with.
+  *
+  * - REJECTED: <br/>
+  *     A promise is rejected if its asynchronous operation could not complete
+  *     successfully. Its value is set to whatever error it has been resolved with.
+  */
+typedef struct uel_promise uel_promise_t;
+struct uel_promise {
+    //! The promise store from where this promise was issued
+    struct uel_promise_store *source;
+    //! The current state of this promise
+    uel_promise_state_t state;
+    //! The value this promise holds. Only meaningful if already settled.
+    void *value;
+    //! The first segment to be processed when this promise settles
+    uel_promise_segment_t *first_segment;
+    //! The last segment to be processed when this promise settles
+    uel_promise_segment_t *last_segment;
+};
+
+/** \brief An issuer of promises. Contains references to pools for promises and
+  * segments.
+  *
+  * Many stores may share the same pools. With a lock backend selected, each
+  * pool is guarded by its own `uel_objpool_t::lock`, so stores on different
+  * threads can draw from the same pools. A promise and its segment chain are
+  * not guarded, though: each promise must only be used from one thread.
+  */
+typedef struct uel_promise_store uel_promise_store_t;
+struct uel_promise_store {
+    //! A reference to the promise pool
+    uel_objpool_t *promise_pool;
+    //! A reference to the segment pool
+    uel_objpool_t *segment_pool;
+};
+
+/** \brief Creates a new promise store from the promise and segment pools
+  *
+  * \param promise_pool The `uel_objpool_t` that holds promises
+  * \param segment_pool The `uel_objpool_t` that holds segments
+  * \return A new promise store bound to the object pools provided
+  */
+UEL_API uel_promise_store_t uel_promise_store_create(
+    uel_objpool_t *promise_pool,
+    uel_objpool_t *segment_pool
+);
+
+/** \brief Acquires a new promise from the supplied store and binds it to the
+  * asynchronous operation started by the supplied closure. The closure is
+  * invoked immediately.
+  *
+  * \param store The store from where to acquire promises and segments
+  * \param closure The closure that initiates the asynchronous operation
+  * \returns A pointer to the promise
+  */
+UEL_API uel_promise_t *uel_promise_create(uel_promise_store_t *store, uel_closure_t closure);
+
+/** \brief Destroys a promise and all of its segments. Settling this promise
+  * afterwards yields undefined behaviour.
+  *
+  * \param promise The promise to be destroyed
+  */
+UEL_API void uel_promise_destroy(uel_promise_t *promise);
+
+/** \brief Adds a new synchronous segment to the promise. It will be invoked
+  * upon promise resolution. In case of rejection, this segment will be ignored.
+  *
+  * \param promise The promise to attach the segment to
+  * \param resolve The closure to  be invoked when the promise is resolved
+  */
+UEL_API void uel_promise_then(uel_promise_t *promise, uel_closure_t resolve);
+
+/** \brief Adds a new synchronous segment to the promise. It will be invoked
+  * upon promise rejection. In case of resolution, this segment will be ignored.
+  *
+  * \param promise The promise to attach the segment to
+  * \param reject The closure to  be invoked when the promise is rejected
+  */
+UEL_API void uel_promise_catch(uel_promise_t *promise, uel_closure_t reject);
+
+/** \brief Adds a new synchronous segment to the promise. The same closure will
+  * be invoked on promise settling regardless of the settled state.
+  *
+  * \param promise The promise to attach the segment to
+  * \param always The closure to be invoked when the promise is settled
+  */
+UEL_API void uel_promise_always(uel_promise_t *promise, uel_closure_t always);
+
+/** \brief Adds a new synchronous segment to the promise. Either of its closures
+  * will be invoked, depending on the settled state of the promise.
+  *
+  * \param promise The promise to attach the segment to
+  * \param resolve The closure to be invoked when the promise is resolved
+  * \param reject The closure to be invoked when the promise is rejected
+  */
+UEL_API void uel_promise_after(
+    uel_promise_t *promise,
+    uel_closure_t resolve,
+    uel_closure_t reject
+);
+
+/** \brief Settles a promise as resolved and, **synchronously**, invokes the
+  * `resolve` closures of each segment in the order they were registered.
+  *
+  * If a segment returns a non-NULL pointer, it is cast to a promise pointer
+  * and the original promise awaits until the returned promise is settled.
+  *
+  * \param promise The promise to be resolved
+  * \param value The value to resolve the promise with
+  */
+UEL_API void uel_promise_resolve(uel_promise_t *promise, void *value);
+
+/** \brief Settles a promise as rejected and, **synchronously**, invokes the
+  * `reject` closures of each segment in the order they were registered.
+  *
+  * If a segment returns a non-NULL pointer, it is cast to a promise pointer
+  * and the original promise awaits until the returned promise is settled.
+  *
+  * \param promise The promise to be rejected
+  * \param value The value to reject the promise with
+  */
+UEL_API void uel_promise_reject(uel_promise_t *promise, void *value);
+
+/** \brief Resettles a promise as the supplied state. Unlike `uel_promise_resolve()`
+  * and `uel_promise_reject()`, does **not** invoke the synchronous segments.
+  *
+  * This function should be used to switch execution paths during synchronous
+  * processing of segments as to signal that an error was raised or rescued
+  * by a particular segment. If the promise is settled as pending, the synchronous
+  * processing phase is interrupted.
+  *
+  * \param promise The promise to be resettled
+  * \param state The new promise state
+  * \param value The new promise value
+  */
+UEL_API void uel_promise_resettle(
+    uel_promise_t *promise,
+    uel_promise_state_t state,
+    void *value
+);
+
+/** \brief Creates a closure bound to a promise. When the closure is invoked
+  * with some parameter, the promise is resolved with this parameter as value.
+  *
+  * \param promise The promise to be resolved
+  * \returns A closure that resolves the promise when invoked
+  */
+UEL_API uel_closure_t uel_promise_resolver(uel_promise_t *promise);
+
+/** \brief Creates a closure bound to a promise. When the closure is invoked
+  * with some parameter, the promise is rejected with this parameter as error.
+  *
+  * \param promise The promise to be rejected
+  * \returns A closure that resolves the promise when invoked
+  */
+UEL_API uel_closure_t uel_promise_rejecter(uel_promise_t *promise);
+
+/** \brief Creates a closure bound to a promise. When the closure is invoked,
+  * the promise is destroyed. Any parameters passed to the closure are ignored.
+  *
+  * \param promise The promise to be destroyed
+  * \returns A closure that destroyes the promise when invoked
+  */
+UEL_API uel_closure_t uel_promise_destroyer(uel_promise_t *promise);
+
+#ifdef UEL_PROMISE_SHORTCUTS
+
+#define THEN    uel_promise_then
+#define CATCH   uel_promise_catch
+#define AFTER   uel_promise_after
+#define ALWAYS  uel_promise_always
+
+
+#endif /* UEL_PROMISE_SHORTCUTS */
+
+#endif /* end of include guard: UEL_PROMISE_H */
+
+/* ---- uevloop/system/async-pipeline.h ---- */
+/** \file async-pipeline.h
+  * \brief Defines asynchronous pipelines, which apply a pipeline one stage per
+  * event so long pipelines do not block the event loop
+  */
+
+#ifndef UEL_ASYNC_PIPELINE_H
+#define UEL_ASYNC_PIPELINE_H
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+
+/** \brief Applies a pipeline asynchronously.
+  *
+  * Each stage of the pipeline is enqueued into the event loop as a separate
+  * closure event, so other events, timers included, can run between stages.
+  * Stages wrapped with `uel_async_pipeline_awaiting()` return a promise instead
+  * of a value: the pipeline is suspended until it settles and resumes with its
+  * value. The outcome of the whole pipeline is reported through a promise.
+  *
+  * Only one application may be in flight at a time and the structure must
+  * outlive it.
+  */
+typedef struct uel_async_pipeline uel_async_pipeline_t;
+struct uel_async_pipeline {
+    //! The pipeline to be applied
+    uel_pipeline_t *pipeline;
+    //! The event loop where stages are enqueued
+    uel_evloop_t *event_loop;
+    //! The store from where the resulting promise is acquired
+    uel_promise_store_t *store;
+    //! Where to record how long each stage took. Nothing is recorded if `NULL`.
+    uel_timestamp_t *durations;
+    //! The closure enqueued to run each stage
+    uel_closure_t step;
+
+    //! The promise settled when the current application is over
+    uel_promise_t *promise;
+    //! The promise returned by the awaited stage, if any
+    uel_promise_t *awaited;
+    //! The index of the next stage to be run
+    size_t stage;
+    //! The value passed along to the next stage
+    void *value;
+    //! When the stage being awaited started
+    uel_timestamp_t started_at;
+};
+
+/** \brief Initialises an asynchronous pipeline
+  *
+  * \param async_pipeline The asynchronous pipeline to be initialised
+  * \param pipeline The pipeline to be applied
+  * \param event_loop The event loop where to enqueue stages
+  * \param store The store from where to acquire promises
+  * \param durations An array with one timestamp per stage of the pipeline.
+  * Each application records there how long each stage took, measured with the
+  * instrumentation clock, including the time spent waiting for awaited stages
+  * to settle. Pass `NULL` if no timing is needed.
+  */
+UEL_API void uel_async_pipeline_init(
+    uel_async_pipeline_t *async_pipeline,
+    uel_pipeline_t *pipeline,
+    uel_evloop_t *event_loop,
+    uel_promise_store_t *store,
+    uel_timestamp_t *durations
+);
+
+/** \brief Applies an asynchronous pipeline to some input
+  *
+  * The first stage is enqueued immediately and each stage enqueues the next
+  * when it is over. No stage is run during this call.
+  *
+  * \param async_pipeline The asynchronous pipeline to be applied
+  * \param params The initial parameters that will be passed to the first stage
+  * \returns A promise resolved with whatever was returned by the last stage, or
+  * rejected with the error of an awaited stage's promise. It must be destroyed
+  * by the caller.
+  */
+UEL_API uel_promise_t *uel_async_pipeline_apply(
+    uel_async_pipeline_t *async_pipeline,
+    void *params
+);
+
+/** \brief Marks a pipeline stage as returning a promise to be awaited
+  *
+  * When the asynchronous pipeline reaches the returned stage, it invokes
+  * `closure` and suspends until the promise it returns settles. If it is
+  * resolved, the next stage receives its value. If it is rejected, the whole
+  * pipeline is rejected with the same error. Either way, the awaited promise is
+  * destroyed by the pipeline.
+  *
+  * If applied synchronously with `uel_pipeline_apply()`, the stage simply
+  * passes on the promise.
+  *
+  * \param closure The closure that returns a `uel_promise_t *`. Must outlive
+  * the pipeline.
+  * \returns The stage to be placed in the pipeline
+  */
+UEL_API uel_closure_t uel_async_pipeline_awaiting(uel_closure_t *closure);
+
+#endif /* end of include guard: UEL_ASYNC_PIPELINE_H */
+
+/* ---- uevloop/utils/profiler.h ---- */
+/** \file profiler.h
+  *
+  * \brief Defines the profiler, an optional accounting of how much time each
+  * closure function consumes
+  */
+
+#ifndef UEL_PROFILER_H
+#define UEL_PROFILER_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+
+//! Unrolls `UEL_PROFILER_TABLE_SIZE_LOG2N` into its power-of-two form
+#define UEL_PROFILER_TABLE_SIZE (1<<UEL_PROFILER_TABLE_SIZE_LOG2N)
+
+/** \brief The accumulated cost of a single closure function
+  */
+typedef struct uel_profile_entry uel_profile_entry_t;
+struct uel_profile_entry {
+    //! The closure function accounted for. `NULL` if this entry is vacant.
+    uel_closure_function_t function;
+    uint32_t calls; //!< How many times the function was invoked
+    uint64_t total; //!< The sum of the durations of all invocations
+    uel_timestamp_t max; //!< The duration of the longest invocation
+};
+
+/** \brief Describes a single invocation, as reported to the watchdog
+  */
+typedef struct uel_profile_sample uel_profile_sample_t;
+struct uel_profile_sample {
+    uel_closure_t *closure; //!< The closure that was invoked
+    uel_timestamp_t elapsed; //!< How long the invocation took
+};
+
+/** \brief The profiler object
+  *
+  * Holds an open-addressing table of entries keyed by closure function address.
+  * Durations are measured with the instrumentation clock (see
+  * `uel_clock_set_source()`) and are inclusive: a closure that invokes other
+  * profiled closures is also charged for their time.
+  *
+  * A single profiler is attached for every event loop in the program, so
+  * entries are claimed and updated atomically and may be accounted from many
+  * threads at once. Each field of an entry is consistent on its own, but an
+  * entry read while being updated may mix old and new fields.
+  */
+typedef struct uel_profiler uel_profiler_t;
+struct uel_profiler {
+    //! The accounting table. Vacant entries have a `NULL` function.
+    uel_profile_entry_t entries[UEL_PROFILER_TABLE_SIZE];
+    //! Samples that could not be accounted because the table was full
+    uint32_t dropped;
+    //! Invocations longer than this trigger the watchdog
+    uel_timestamp_t threshold;
+    //! Invoked with a `uel_profile_sample_t *` when an invocation is too long
+    uel_closure_t watchdog;
+};
+
+#ifdef UEL_ENABLE_PROFILER
+//! Invokes a closure, accounting for it at the attached profiler
+#define UEL_PROFILED_INVOKE(closure, params) uel_profiler_invoke((closure), (params))
+#else
+//! Plain `uel_closure_invoke()` when `UEL_ENABLE_PROFILER` is not defined
+#define UEL_PROFILED_INVOKE(closure, params) uel_closure_invoke((closure), (params))
+#endif /* UEL_ENABLE_PROFILER */
+
+/** \brief Initialises a profiler
+  *
+  * \param profiler The profiler to be initialised
+  * \param threshold The longest acceptable invocation duration
+  * \param watchdog The closure to be invoked, with a `uel_profile_sample_t *` as
+  * parameter, whenever an invocation takes longer than `threshold`. Pass
+  * `uel_nop()` if no watchdog is needed.
+  */
+UEL_API void uel_profiler_init(
+    uel_profiler_t *profiler,
+    uel_timestamp_t threshold,
+    uel_closure_t watchdog
+);
+
+/** \brief Attaches a profiler to the core. From now on, the core accounts for
+  * closures invoked by the event loop, signal listeners, timers and promises.
+  *
+  * \param profiler The profiler to be attached. Pass `NULL` to detach.
+  */
+UEL_API void uel_profiler_attach(uel_profiler_t *profiler);
+
+/** \brief Accounts for an invocation
+  *
+  * \param profiler The profiler where to account
+  * \param closure The closure invoked
+  * \param elapsed How long the invocation took
+  */
+UEL_API void uel_profiler_record(
+    uel_profiler_t *profiler,
+    uel_closure_t *closure,
+    uel_timestamp_t elapsed
+);
+
+/** \brief Finds the entry of a closure function
+  *
+  * \param profiler The profiler to be searched
+  * \param function The closure function to be found
+  * \returns The function's entry or `NULL`, if it has never been accounted for
+  */
+UEL_API uel_profile_entry_t *uel_profiler_find(
+    uel_profiler_t *profiler,
+    uel_closure_function_t function
+);
+
+/** \brief Invokes a closure and accounts for it at the attached profiler, if any.
+  * Prefer the `UEL_PROFILED_INVOKE` macro, which vanishes when profiling is disabled.
+  *
+  * \param closure The closure to be invoked
+  * \param params The parameters to invoke the closure with
+  * \returns Whatever the closure returned
+  */
+UEL_API void *uel_profiler_invoke(uel_closure_t *closure, void *params);
+
+#endif /* end of include guard: UEL_PROFILER_H */
+
+/* ---- uevloop/system/scheduler.h ---- */
+/** \file scheduler.h
+  * \brief Module responsible for keeping track of time and tasks to be run in
+  * the future
+  */
+
+#ifndef UEL_SCHEDULER_H
+#define	UEL_SCHEDULER_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+
+/** \brief The scheduler object.
+  *
+  * This object keeps track of time run since the application was launched. It
+  * also keeps a queue of events due to be processed sometime in the future.
+  *
+  * It feeds and is fed by the system queues. Timers due to be processed are put
+  * in the outbound event queue. Timers awaiting scheduling are put in the
+  * inbound schedule queue.
+  */
+typedef struct uel_scheduler uel_scheduer_t;
+struct uel_scheduler{
+    /** \brief Scheduled timers linked list
+      *
+      * This linked list holds events/timers scheduled to be run in the future.
+      * Timers are inserted sorted by its due time, so it is always in
+      * execution order.
+      */
+    uel_llist_t timer_list;
+
+    /** \brief Paused timers linked list
+      *
+      * Holds events that had been scheduled but has been paused by the
+      * programmer.
+      * This is scanned for resumed timers every time `uel_sch_manage_timers`
+      * is called.
+      */
+    uel_llist_t pause_list;
+
+    uel_syspools_t *pools; //!< Reference to the system's pools
+    uel_sysqueues_t *queues; //!< Reference to the system's queues
+
+    /** \brief Internal timer. Must be updated via `uel_sch_update_timer()` */
+    volatile uel_time_t timer;
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+    //! Where to record timer lateness. Nothing is recorded if `NULL`.
+    uel_latency_t *latency;
+#endif /* UEL_ENABLE_LATENCY_STATS */
+};
+
+/** \brief Initialises a scheduler object
+  *
+  * \param scheduler The uel_scheduer_t instance to be initialised
+  * \param pools The system's internal pools
+  * \param queues The system's internal queues
+  */
+UEL_API void uel_sch_init(
+    uel_scheduer_t *scheduler,
+    uel_syspools_t *pools,
+    uel_sysqueues_t *queues
+);
+
+/** \brief Enqueues a closure for later execution.
+  *
+  * \param scheduler The uel_scheduer_t into which the event will be registered
+  * \param timeout The delay in scheduler ticks until the closure is run
+  * \param closure The closure to be invoked when the due time is reached
+  * \param value The value to invoked the closure with
+  * \returns The scheduled event
+  */
+UEL_API uel_event_t *uel_sch_run_later(
+    uel_scheduer_t *scheduler,
+    uel_timeout_t timeout,
+    uel_closure_t closure,
+    void *value
+);
+
+
+/** \brief Enqueues a closure for execution at intervals.
+  *
+  * \param scheduler The uel_scheduer_t into which the event will be registered
+  * \param interval The delay in scheduler ticks between two executions of the closure
+  * \param immediate If this flag is set, the the event will be created with a
+  * due time to the current time.
+  * \param closure The closure to be invoked when the due time is reached
+  * \param value The value to invoked the closure with
+  * \returns The scheduled event
+  */
+UEL_API uel_event_t *uel_sch_run_at_intervals(
+    uel_scheduer_t *scheduler,
+    uel_timeout_t interval,
+    bool immediate,
+    uel_closure_t closure,
+    void *value
+);
+
+/** \brief Enqueue timers that are due to be processed in the event queue
+  *
+  * Checks, based on the current time counter, what timers should be enqueued for
+  * execution. Afterwards, enqueue them.
+  *
+  * \param scheduler The uel_scheduer_t to manage
+  */
+UEL_API void uel_sch_manage_timers(uel_scheduer_t *scheduler);
+
+/** \brief Finds when the next scheduled timer is due
+  *
+  * Only timers already managed by the scheduler are considered, so call
+  * `uel_sch_manage_timers()` first to account for recently scheduled ones.
+  *
+  * \param scheduler The scheduler to be inspected
+  * \param deadline Where to store the due time of the next timer
+  * \returns Whether any timer is scheduled. If not, `deadline` is left untouched.
+  */
+UEL_API bool uel_sch_next_deadline(uel_scheduer_t *scheduler, uel_time_t *deadline);
+
+/** \brief Updates the internal time counter
+  *
+  * \param scheduler The scheduler whose time coounter should be updated
+  * \param timer The new counter value to be acknowledged.
+  */
+UEL_API void uel_sch_update_timer(uel_scheduer_t *scheduler, uel_time_t timer);
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+/** \brief Attaches latency statistics to a scheduler. From now on, the
+  * lateness of each expired timer is recorded.
+  *
+  * \param scheduler The scheduler to be measured
+  * \param latency Where to record the statistics. Pass `NULL` to detach.
+  */
+UEL_API void uel_sch_set_latency(uel_scheduer_t *scheduler, uel_latency_t *latency);
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+#endif	/* UEL_SCHEDULER_H */
+
+/* ---- uevloop/system/signal.h ---- */
+/** \file signal.h
+  * \brief Defines signals and relays, structures used to communicate
+  * asynchronously between distant parts of the application
+  */
+
+#ifndef UEL_SIGNAL_H
+#define UEL_SIGNAL_H
+
+
+/** \typedef uel_signal_t
+  *
+  * Any signal is defined as an unsigned integer type. This means that any signal
+  * type is only valid within the scope defined by the relay designed to respond
+  * to said signal.
+  */
+typedef uintptr_t uel_signal_t;
+
+/** \brief Defines a reference type suitable to manipulate the actual listener
+  * event's context.
+  */
+typedef struct uel_event_listener *uel_signal_listener_t;
+
+/** \brief Contains a signal vector and operates on in.
+  *
+  * The signal relay is the central data structure involved in signal operation.
+  * It contains a signal vector, an array of linked lists, each associated to a
+  * particular signal.
+  *
+  * When a signal is listened for, the listener closure is added to the linked
+  * list corresponding to said signal. When that signal is emitted, each listener
+  * closure in the list is invoked.
+  */
+typedef struct uel_signal_relay uel_signal_relay_t;
+struct uel_signal_relay{
+    //! Contains the signal vector. Must be large enough to contain every signal
+    //! bound to this relay.
+    uel_llist_t *signal_vector;
+    //! The system's internal queues. Upon emission, signals will be enqueued on
+    //! one of these.
+    uel_sysqueues_t *queues;
+    //! A quick reference to the system's internal pools
+    uel_syspools_t *pools;
+    //! The number of signals registered at this relay.
+    uintptr_t width;
+    //! Guards the signal vector when a lock backend is selected
+    uel_lock_t lock;
+};
+
+/** \brief Initialises a signal relay
+  *
+  * \param relay The signal relay object to be initialised
+  * \param pools The system's internal pools
+  * \param queues The system's internal queues
+  * \param buffer The buffer that will be used to store listeners registered at
+  * this relay. Must be the number of signals bound to this relay wide.
+  * \param width The number of signals bound to this relay.
+  */
+UEL_API void uel_signal_relay_init(
+    uel_signal_relay_t *relay,
+    uel_syspools_t *pools,
+    uel_sysqueues_t *queues,
+    uel_llist_t *buffer,
+    uintptr_t width
+);
+
+/** \brief Attaches a listener closure to some signal at a particular relay
+  *
+  * \param signal The signal to be listened for
+  * \param relay The relay where the listener will be registered
+  * \param closure The closure to be invoked when the signal is emitted. The
+  * closure will be invoked with whatever parameters are supplied during emission.
+  * \return Returns a listener that references this particular operation
+  */
+UEL_API uel_signal_listener_t uel_signal_listen(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+);
+
+/** \brief Attaches a listener closure to some signal at a particular relay. The
+  * listener closure will be invoked only once.
+  *
+  * \param signal The signal to be listened for
+  * \param relay The relay where the listener will be registered
+  * \param closure The closure to be invoked when the signal is emitted. The
+  * closure will be invoked with whatever parameters are supplied during emission.
+  * \return Returns a listener that references this particular operation
+  */
+UEL_API uel_signal_listener_t uel_signal_listen_once(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+);
+
+/** \brief Marks a signal listener as expired. When its corresponding signal is
+  * emitted, this listener's closure will not be invoked and the listener will
+  * be destroyed.
+  *
+  + \param listener The listener that identifies the listen operation to be undone
+  */
+UEL_API void uel_signal_unlisten(uel_signal_listener_t listener);
+
+/** \brief Emits a signal at the supplied relay. Any closure listening to this
+  * signal will be asynchronously invoked.
+  *
+  * \param signal The signal to be emitted
+  * \param relay The relay where the signal is registered
+  * \param params The parameters supplied to the listener's closure when it is
+  * invoked.
+  */
+UEL_API void uel_signal_emit(uel_signal_t signal, uel_signal_relay_t *relay, void *params);
+
+/** \brief Attaches a non-repeating listener that resolves the provided promise
+  * upon emission.
+  *
+  * \param signal The signal to be listened for
+  * \param relay The relay where the signal is registered
+  * \param promise The promise to be resolved upon signal emission
+  * \returns The listener associated with this operation
+  */
+UEL_API uel_signal_listener_t uel_signal_resolve_promise(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_promise_t *promise
+);
+
+/** \brief Attaches a non-repeating listener that rejects the provided promise
+  * upon emission.
+  *
+  * \param signal The signal to be listened for
+  * \param relay The relay where the signal is registered
+  * \param promise The promise to be rejected upon signal emission
+  * \returns The listener associated with this operation
+  */
+UEL_API uel_signal_listener_t uel_signal_reject_promise(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_promise_t *promise
+);
+
+#endif /* end of include guard: UEL_SIGNAL_H */
+
+/* ---- uevloop/utils/arena.h ---- */
+/** \file arena.h
+  *
+  * \brief Defines arenas, buffers from where memory of any size is bumped out
+  * and recycled all at once
+  */
+
+#ifndef UEL_ARENA_H
+#define UEL_ARENA_H
+
+/// \cond
+#include <stdint.h>
+#include <stdlib.h>
+/// \endcond
+
+/** \brief A buffer that hands out memory by bumping an offset.
+  *
+  * Arenas serve allocations of any size and alignment from a single buffer.
+  * Memory cannot be released piecemeal: instead, the whole arena is reset at
+  * once, when all its allocations are known to be dead. This fits short lived
+  * scratch memory that would otherwise require an object pool per type.
+  */
+typedef struct uel_arena uel_arena_t;
+struct uel_arena {
+    //! The buffer from where memory is allocated
+    uint8_t *buffer;
+    //! The size of the buffer, in bytes
+    size_t size;
+    //! How many bytes have been allocated since the last reset, padding included
+    size_t used;
+    //! The highest value `used` has ever reached
+    size_t peak;
+};
+
+/** \brief Initialises an arena
+  *
+  * \param arena The arena to be initialised
+  * \param buffer The buffer from where memory will be allocated
+  * \param size The size of the buffer, in bytes
+  */
+UEL_API void uel_arena_init(uel_arena_t *arena, uint8_t *buffer, size_t size);
+
+/** \brief Allocates memory from an arena
+  *
+  * \param arena The arena from where to allocate
+  * \param size The number of bytes to allocate
+  * \param align The alignment of the returned address. Must be a power of two.
+  * Zero is treated as one.
+  * \returns The allocated memory or `NULL` if the arena cannot fit it
+  */
+UEL_API void *uel_arena_alloc(uel_arena_t *arena, size_t size, size_t align);
+
+/** \brief Releases every allocation made from an arena at once
+  *
+  * \param arena The arena to be reset
+  */
+UEL_API void uel_arena_reset(uel_arena_t *arena);
+
+/** \brief Counts the bytes that can still be allocated from an arena
+  *
+  * \param arena The arena to be verified
+  * \returns How many bytes are left, before any alignment padding
+  */
+UEL_API size_t uel_arena_count_available(uel_arena_t *arena);
+
+#endif /* end of include guard: UEL_ARENA_H */
+
+/* ---- uevloop/utils/module.h ---- */
+/** \file module.h Defines modules, isolated units of behaviour with lifecycle hooks.
+  */
+
+#ifndef UEL_MODULE_H
+#define UEL_MODULE_H
+
+/// \cond
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+struct uel_application;
+struct uel_module;
+
+/** \brief Defines a module hook to be called during the module lifecycle
+  */
+typedef void (*uel_module_hook_t)(struct uel_module *);
+
+/** \brief Defines the stages of a module's launch
+  */
+enum uel_module_state {
+    //! The module has not been launched
+    UEL_MODULE_IDLE,
+    //! The module is due to launch as soon as its dependencies are launched
+    UEL_MODULE_WAITING,
+    //! The launch hook has been called, but the module has not finished launching
+    UEL_MODULE_LAUNCHING,
+    //! The module has finished launching
+    UEL_MODULE_LAUNCHED
+};
+//! Alias to the `uel_module_state` enum
+typedef enum uel_module_state uel_module_state_t;
+
+/** \brief A module is an isolated unit of behaviour with lifecycle hooks
+  *
+  * Modules can serve as a variety of purposes:
+  *
+  * - They can act as bridges to static data, such as SFRs;
+  * - They can be object factories, meant to distribute and recycle objects to
+  *   other modules;
+  * - They can act as services, background processes that interact with other
+  *   parts of the application in a sattelite-fashion.
+  *
+  * Modules are meant to be singletons and user extendable.
+  *
+  * Modules may depend on other modules of the same application, which are
+  * then launched first. Asynchronous modules are only considered launched once
+  * they call `uel_module_launched()`, so slow launches of independent modules
+  * can overlap. Lazy modules are only launched when first required.
+  */
+typedef struct uel_module uel_module_t;
+struct uel_module {
+    /** The config hook should be used for any setup of the module dependencies.
+      * It fires after the module has been fully initialised, but may still be
+      * in an inconsistent state.
+      */
+    uel_module_hook_t config;
+    /** The launch hook is used to start a module. The application will only fire
+      * it once all loaded modules are both initialised and configurated
+      * (*i.e.* `config` hook has been called).
+      */
+    uel_module_hook_t launch;
+    //! Keeps a reference to the application onto which the module is loaded
+    struct uel_application *app;
+    //! The registry IDs of the modules that must launch before this one
+    const size_t *dependencies;
+    //! The number of dependencies
+    size_t dependency_count;
+    //! Whether this module is only launched when first required
+    bool lazy;
+    //! Whether this module signals the end of its launch with `uel_module_launched()`
+    bool asynchronous;
+    //! The stage of this module's launch
+    volatile uel_module_state_t state;
+};
+
+/** \brief Initialised a module
+  *
+  * \param module The module to be initialised
+  * \param config A module hook to be invoked during the configuration phase
+  * \param launch A module hook to be invoked during the launching phase
+  * \param app The application instante onto which this module will be loaded
+  */
+UEL_API void uel_module_init(
+    uel_module_t *module,
+    uel_module_hook_t config,
+    uel_module_hook_t launch,
+    struct uel_application *app
+);
+
+/** \brief Calls the configuration hook of a module
+  *
+  * \param module The modules to config
+  */
+UEL_API void uel_module_config(uel_module_t *module);
+
+/** \brief Calls the launch hook of a module
+  *
+  * \param module The modules to launch
+  */
+UEL_API void uel_module_launch(uel_module_t *module);
+
+/** \brief Declares the modules a module depends on
+  *
+  * The application only launches a module after all its dependencies are
+  * launched. Modules involved in dependency cycles are never launched.
+  *
+  * \param module The dependent module
+  * \param dependencies The registry IDs of the dependencies. Must outlive the
+  * module.
+  * \param count The number of dependencies
+  */
+UEL_API void uel_module_set_dependencies(
+    uel_module_t *module,
+    const size_t *dependencies,
+    size_t count
+);
+
+/** \brief Marks a module as lazy. Lazy modules are not launched when loaded,
+  * but the first time they are required, either directly with
+  * `uel_app_require()` or as a dependency of a module being launched.
+  *
+  * \param module The module to be marked
+  * \param lazy Whether the module is lazy
+  */
+UEL_API void uel_module_set_lazy(uel_module_t *module, bool lazy);
+
+/** \brief Marks a module as asynchronous. Asynchronous modules are not
+  * considered launched when their launch hook returns, but when they call
+  * `uel_module_launched()`.
+  *
+  * \param module The module to be marked
+  * \param asynchronous Whether the module is asynchronous
+  */
+UEL_API void uel_module_set_async(uel_module_t *module, bool asynchronous);
+
+/** \brief Signals that an asynchronous module has finished launching
+  *
+  * Modules that depend on it are launched from the application's event loop,
+  * so this function may be called from interrupts.
+  *
+  * \param module The module that has finished launching
+  */
+UEL_API void uel_module_launched(uel_module_t *module);
+
+#endif /* end of include guard: UEL_MODULE_H */
+
+/* ---- uevloop/system/containers/application.h ---- */
+/**  \file application.h
+   * \brief The application module is a convenient top-level container for the
+   * system internals.
+   */
+
+#ifndef UEL_APPLICATION_H
+#define UEL_APPLICATION_H
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+
+//! Events emitted by the application relay. Unused ATM.
+enum uel_app_event{
+    UEL_APP_READY = 0,
+    UEL_APP_CRASHED,
+    UEL_APP_IDLE,
+    UEL_APP_EVENT_COUNT
+};
+//! Alias to the uel_app_event enum
+typedef enum uel_app_event uel_app_event_t;
+
+/** \brief Top-level container for µEvLoop'd application
+  *
+  * The application module is not necessary, but it does facilitate creating
+  * and managing the state of a µEvLoop application.
+  * It contains all the system insternals and manages the scheduler and event
+  * loops queues automatically.
+  */
+typedef struct uel_application uel_application_t;
+struct uel_application{
+    uel_module_t **registry; //!< The modules managed by this application
+    size_t registry_size; //!< The number of modules managed by this application
+    //! Whether all modules have been configured, so lazy modules may be launched
+    bool loaded;
+    uel_syspools_t pools; //!< Holds the system pools: events and llist nodes
+    uel_sysqueues_t queues; //!< Holds the system event queues
+    uel_evloop_t event_loop; //!< The application's event loop
+    uel_scheduer_t scheduler;  //!< The applications's scheduler;
+    uel_signal_relay_t relay;   //!< Unused
+    uel_llist_t relay_buffer[UEL_APP_EVENT_COUNT]; //!< Unused
+    bool run_scheduler; //!< Marks when it's time to wake the scheduler
+#if UEL_APP_SCRATCH_SIZE > 0
+    //! The buffer backing the scratch arena
+    uint8_t scratch_buffer[UEL_APP_SCRATCH_SIZE];
+    //! Holds memory that lives until the end of the current tick
+    uel_arena_t scratch;
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+};
+
+/** \brief Initialises an uel_application_t instance
+  * \param app The uel_application_t instance
+  */
+UEL_API void uel_app_init(uel_application_t *app);
+
+/** \brief Loads modules into an application and run their lifecycle hooks
+  *
+  * First, the `config` hook of every module is called, in array order. Then,
+  * every module that is not lazy is launched after its dependencies, which
+  * are launched even if lazy. Modules whose dependencies are all launched are
+  * launched right away, so this function returns with every module launched
+  * unless some of them are asynchronous. Modules depending on asynchronous ones
+  * are launched from the event loop once those signal they are done.
+  *
+  * \param app The application onto which to load the modules
+  * \param modules The modules to be loaded
+  * \param module_count The number of modules being loaded
+  */
+UEL_API void uel_app_load(uel_application_t *app, uel_module_t **modules, size_t module_count);
+
+/** \brief Fetches a module from the app's registry
+  *
+  * If the module is lazy and has not been launched yet, it is launched along
+  * with its dependencies. If any of them is asynchronous, the module may still
+  * be launching when returned: check `uel_module_t::state`.
+  *
+  * \param app The application from where to fetch the module
+  * \param id The module ID  to be fetched
+  *
+  * \returns The module at `id`th position in the registry
+  */
+UEL_API uel_module_t *uel_app_require(uel_application_t *app, size_t id);
+
+/** \brief Launches a module after its dependencies, if it has not been
+  * launched yet
+  *
+  * \param app The application where the module is loaded
+  * \param id The module ID to be launched
+  */
+UEL_API void uel_app_launch(uel_application_t *app, size_t id);
+
+/** \brief Marks a module as launched and launches the modules waiting on it.
+  *
+  * This is invoked from the event loop when an asynchronous module calls
+  * `uel_module_launched()`, and is seldom useful otherwise.
+  *
+  * \param app The application where the module is loaded
+  * \param module The module that has finished launching
+  */
+UEL_API void uel_app_complete_launch(uel_application_t *app, uel_module_t *module);
+
+/** \brief Ticks the application.
+  *
+  * Yields control to the application runtime. This will:
+  * 1. Check if the scheduler ought to be run (i.e.:  the counter has been
+  * updated or there are events awaiting rescheduling) and do so if necessary
+  * 2. Perform a runloop
+  * 3. Reset the scratch arena, if enabled, recycling all memory from
+  * `uel_app_scratch_alloc()`
+  *
+  * \param app The uel_application_t instance
+  */
+UEL_API void uel_app_tick(uel_application_t *app);
+
+#if UEL_APP_SCRATCH_SIZE > 0
+/** \brief Allocates scratch memory that lives until the end of the current tick
+  *
+  * Only available when `UEL_APP_SCRATCH_SIZE` is greater than zero. Scratch
+  * memory needs no releasing: it is all recycled once `uel_app_tick()`
+  * returns. This suits transient buffers such as signal payloads, which are
+  * consumed within the same tick. Scratch memory must never cross a tick
+  * boundary, so it must not be handed to anything that runs on a later tick,
+  * such as timers or async pipelines resuming after a promise settles. It must
+  * only be requested from the context that ticks the application, never from
+  * interrupts or other threads.
+  *
+  * \param app The uel_application_t instance
+  * \param size The number of bytes to allocate
+  * \param align The alignment of the returned address. Must be a power of two.
+  * \returns The allocated memory or `NULL` if the scratch arena is exhausted
+  */
+UEL_API void *uel_app_scratch_alloc(uel_application_t *app, size_t size, size_t align);
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+
+/** \brief Updates the internal timer of an application, located at the scheduler
+  *
+  * \param app The uel_application_t instance
+  * \param timer The current application timer, in scheduler ticks
+  */
+UEL_API void uel_app_update_timer(uel_application_t *app, uel_time_t timer);
+
+/** \brief Enqueues a closure for later execution.
+  *
+  * Proxies the call to uel_sch_run_later() with uel_application_t::scheduler as
+  * parameter.
+  *
+  * \param app The uel_application_t instance
+  * \param timeout The delay in scheduler ticks until the closure is run
+  * \param closure The closure to be invoked when the due time is reached
+  * \param value The value to invoked the closure with
+  * \returns The timer event associated with this operation
+  */
+UEL_API uel_event_t *uel_app_run_later(
+    uel_application_t *app,
+    uel_timeout_t timeout,
+    uel_closure_t closure,
+    void *value
+);
+
+/** \brief Enqueues a closure for execution at intervals.
+  *
+  * Proxies the call to uel_sch_run_at_intervals() with uel_application_t::scheduler as
+  * parameter.
+  *
+  * \param app The uel_application_t instance
+  * \param interval The delay in scheduler ticks between two executions of the closure
+  * \param immediate If this flag is set, the the event will be created with a
+  * due time to the current time.
+  * \param closure The closure to be invoked when the due time is reached
+  * \param value The value to invoked the closure with
+  * \returns The timer event associated with this operation
+  */
+UEL_API uel_event_t *uel_app_run_at_intervals(
+    uel_application_t *app,
+    uel_timeout_t interval,
+    bool immediate,
+    uel_closure_t closure,
+    void *value
+);
+
+/** \brief Enqueues a closure to be invoked.
+  *
+  * Proxies the call to uel_evloop_enqueue_closure() with uel_application_t::event_loop
+  * as parameter.
+  *
+  * \param app The uel_application_t instance
+  * \param closure The closure to be enqueued
+  * \param value The value to invoked the closure with
+  */
+UEL_API void uel_app_enqueue_closure(
+    uel_application_t *app,
+    uel_closure_t *closure,
+    void *value
+);
+
+/** \brief Sets up an observer
+  *
+  * Proxies the call to `uel_evloop_observe()` with uel_application_t::event_loop
+  * as parameter.
+  *
+  * \param app The `uel_application_t` instance
+  * \param condition_var The address of the value to be observed
+  * \param closure The closure to be invoked on change dection
+  *
+  * \returns The observer event associated with this operation
+  */
+UEL_API uel_event_t *uel_app_observe(
+    uel_application_t *app,
+    volatile uintptr_t *condition_var,
+    uel_closure_t *closure
+);
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+/** \brief Attaches latency statistics to an application
+  *
+  * Proxies the call to `uel_evloop_set_latency()` and `uel_sch_set_latency()`
+  * so both queueing delays and timer lateness are recorded.
+  *
+  * \param app The `uel_application_t` instance
+  * \param latency Where to record the statistics. Pass `NULL` to detach.
+  */
+UEL_API void uel_app_set_latency(uel_application_t *app, uel_latency_t *latency);
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+#endif /* end of include guard: UEL_APPLICATION_H */
+
+/* ---- uevloop/system/channel.h ---- */
+/** \file channel.h
+  * \brief Defines channels, lock-free structures used to pass messages from one
+  * application to another, possibly running in different threads
+  */
+
+#ifndef UEL_CHANNEL_H
+#define UEL_CHANNEL_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+
+//! Possible types of messages carried by a channel
+enum uel_channel_message_type {
+    UEL_CHANNEL_CLOSURE_MESSAGE, //!< A closure to be enqueued at the target
+    UEL_CHANNEL_SIGNAL_MESSAGE //!< A signal to be emitted at the target
+};
+//! Alias to the uel_channel_message_type enum
+typedef enum uel_channel_message_type uel_channel_message_type_t;
+
+/** \brief A single message in transit through a channel
+  */
+typedef struct uel_channel_message uel_channel_message_t;
+struct uel_channel_message {
+    uel_channel_message_type_t type; //!< The type of this message
+    //! What to do with this message once it is delivered. Depends on `type`.
+    union uel_channel_message_target {
+        uel_closure_t closure; //!< The closure to be enqueued at the target
+        //! The signal to be emitted at the target
+        struct uel_channel_signal {
+            uel_signal_t signal; //!< The signal to be emitted
+            uel_signal_relay_t *relay; //!< The relay where to emit the signal
+        } signal;
+    } target;
+    //! The value the closure will be invoked with or the signal emitted with
+    void *value;
+};
+
+/** \brief A single-producer, single-consumer channel into an application.
+  *
+  * Channels are lock-free rings of messages. A single producer thread sends
+  * messages, which are delivered into the target application's event queue
+  * in batches of up to `UEL_CHANNEL_BATCH_SIZE` per runloop.
+  *
+  * Delivery is driven by an observer registered at the target's event loop, so
+  * the target application needs only be ticked. Whenever a message is sent
+  * into an empty channel, the `wakeup` closure is invoked by the producer so
+  * the host driver of the target can be awaken, if sleeping.
+  */
+typedef struct uel_channel uel_channel_t;
+struct uel_channel {
+    //! The buffer that holds messages in transit
+    uel_channel_message_t *buffer;
+    //! The mask used to wrap indices around the capacity of the ring
+    uintptr_t mask;
+    //! The count of messages ever sent. Only modified by the producer.
+    volatile uintptr_t head;
+    //! The count of messages ever delivered. Only modified by the consumer.
+    volatile uintptr_t tail;
+    //! The application into which messages are delivered
+    uel_application_t *target;
+    //! The closure invoked when the channel goes from empty to non-empty
+    uel_closure_t wakeup;
+    //! The observer event that delivers messages at the target
+    uel_event_t *observer;
+    //! Bumped by the consumer whenever a delivery leaves messages behind
+    volatile uintptr_t backlog;
+    //! The observer event that resumes delivery of messages left behind
+    uel_event_t *backlog_observer;
+};
+
+/** \brief Initialises a channel and attaches it to its target application.
+  *
+  * This must be called from the thread that runs the target application.
+  *
+  * \param channel The channel to be initialised
+  * \param buffer The buffer used to store messages. Must be `2**size_log2n` long.
+  * \param size_log2n The capacity of the channel in log2 form.
+  * \param target The application into which messages will be delivered
+  * \param wakeup A closure invoked, with the channel as parameter, when a message
+  * is sent to an empty channel. Pass `uel_nop()` if no wakeup is needed.
+  */
+UEL_API void uel_channel_init(
+    uel_channel_t *channel,
+    uel_channel_message_t *buffer,
+    uintptr_t size_log2n,
+    uel_application_t *target,
+    uel_closure_t wakeup
+);
+
+/** \brief Detaches a channel from its target. Messages still in transit will
+  * not be delivered.
+  *
+  * \param channel The channel to be closed
+  */
+UEL_API void uel_channel_close(uel_channel_t *channel);
+
+/** \brief Sends a closure to be enqueued at the target application.
+  *
+  * \param channel The channel through which to send the closure
+  * \param closure The closure to be enqueued
+  * \param value The value to invoke the closure with
+  * \returns Whether the message could be sent. Fails if the channel is full.
+  */
+UEL_API bool uel_channel_send(uel_channel_t *channel, uel_closure_t *closure, void *value);
+
+/** \brief Sends a signal to be emitted at the target application.
+  *
+  * \param channel The channel through which to send the signal
+  * \param signal The signal to be emitted
+  * \param relay The relay where the signal is registered. Must belong to the
+  * target application.
+  * \param params The parameters supplied to the listeners' closures
+  * \returns Whether the message could be sent. Fails if the channel is full.
+  */
+UEL_API bool uel_channel_emit(
+    uel_channel_t *channel,
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    void *params
+);
+
+/** \brief Counts the messages in transit through a channel. When other threads
+  * are operating on the channel, this is only an estimate.
+  *
+  * \param channel The channel whose messages should be counted
+  * \returns The number of messages sent but not yet delivered
+  */
+UEL_API uintptr_t uel_channel_count(uel_channel_t *channel);
+
+#endif /* end of include guard: UEL_CHANNEL_H */
+
+/* ---- uevloop/utils/work-stealing-deque.h ---- */
+/** \file work-stealing-deque.h
+  *
+  * \brief Defines work-stealing deques, lock-free double-ended queues meant to
+  * distribute work between threads
+  */
+
+#ifndef UEL_WORK_STEALING_DEQUE_H
+#define UEL_WORK_STEALING_DEQUE_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+/** \brief Defines a bounded work-stealing deque of void pointers
+  *
+  * This is a fixed-capacity Chase-Lev deque. A single owner thread pushes and
+  * pops elements at the bottom end in LIFO order, while any other thread may
+  * concurrently steal elements from the top end in FIFO order. No operation
+  * ever blocks.
+  *
+  * Its capacity is **required** to be a power of two.
+  */
+typedef struct uel_wsdeque uel_wsdeque_t;
+struct uel_wsdeque {
+    //! The buffer that will contain the enqueued values.
+    void **buffer;
+    //! The mask used to wrap indices around the capacity of the deque.
+    intptr_t mask;
+    //! The index of the oldest element. Advanced by thieves.
+    volatile intptr_t top;
+    //! The index one past the newest element. Only modified by the owner.
+    volatile intptr_t bottom;
+};
+
+/** \brief Initialises a work-stealing deque
+  *
+  * \param deque The deque object to be initialised
+  * \param buffer An array of void pointers that will be used to store the
+  * enqueued values.
+  * \param size_log2n The size of the deque in its log2 form.
+  */
+UEL_API void uel_wsdeque_init(uel_wsdeque_t *deque, void **buffer, uintptr_t size_log2n);
+
+/** \brief Pushes an element at the bottom of the deque. Must only be called
+  * by the deque owner.
+  *
+  * \param deque The deque into which to push the element
+  * \param element The element to be pushed
+  * \returns Whether the push operation was successful
+  */
+UEL_API bool uel_wsdeque_push(uel_wsdeque_t *deque, void *element);
+
+/** \brief Pops the newest element from the bottom of the deque. Must only be
+  * called by the deque owner.
+  *
+  * \param deque The deque from where to pop
+  * \returns The newest element in the deque, if it exists. Otherwise, NULL.
+  */
+UEL_API void *uel_wsdeque_pop(uel_wsdeque_t *deque);
+
+/** \brief Steals the oldest element from the top of the deque. May be called
+  * from any thread.
+  *
+  * \param deque The deque from where to steal
+  * \returns The oldest element in the deque. If the deque is empty or the
+  * element was taken by a concurrent operation, returns NULL.
+  */
+UEL_API void *uel_wsdeque_steal(uel_wsdeque_t *deque);
+
+/** \brief Counts the number of elements in the deque. When other threads are
+  * operating on the deque, this is only an estimate.
+  *
+  * \param deque The deque whose elements should be counted
+  * \returns The number of enqueued elements
+  */
+UEL_API uintptr_t uel_wsdeque_count(uel_wsdeque_t *deque);
+
+#endif /* end of include guard: UEL_WORK_STEALING_DEQUE_H */
+
+/* ---- uevloop/system/containers/workgroup.h ---- */
+/** \file workgroup.h
+  * \brief The workgroup module is a multi-worker alternative to the application
+  * container, running one event loop per thread and balancing closures
+  * between them by work stealing.
+  */
+
+#ifndef UEL_WORKGROUP_H
+#define UEL_WORKGROUP_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+
+//! Affinity value that lets a closure be run by any worker in the group
+#define UEL_WORKGROUP_ANY SIZE_MAX
+
+/** \brief A single worker of a workgroup
+  *
+  * Each worker owns a complete application, with its own pools, queues, event
+  * loop and scheduler, plus a work-stealing deque holding closures that may
+  * be run by any other worker in the group.
+  *
+  * A worker is meant to be ticked by a single thread.
+  */
+typedef struct uel_worker uel_worker_t;
+struct uel_worker {
+    //! The worker's application. Holds everything pinned to this worker.
+    uel_application_t app;
+
+    //! Unrolls the `UEL_WORKGROUP_DEQUE_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_WORKGROUP_DEQUE_SIZE (1<<UEL_WORKGROUP_DEQUE_SIZE_LOG2N)
+    //! The buffer used to store closure events in the deque
+    void *deque_buffer[UEL_WORKGROUP_DEQUE_SIZE];
+    //! Closure events spawned at this worker that may be stolen by others
+    uel_wsdeque_t deque;
+};
+
+/** \brief A group of workers that share closures among themselves
+  *
+  * Closures submitted without affinity are balanced between workers: each
+  * worker first drains its own deque, then the group's shared injection queue
+  * and then tries to steal from the other workers' deques.
+  *
+  * Closures submitted with affinity are enqueued directly on the selected
+  * worker's event loop and are never stolen. Timers, signals and observers
+  * always belong to the application of the worker they were created at.
+  */
+typedef struct uel_workgroup uel_workgroup_t;
+struct uel_workgroup {
+    uel_worker_t *workers; //!< The workers in this group
+    size_t count; //!< The number of workers in this group
+
+    //! Unrolls the `UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_WORKGROUP_INJECT_QUEUE_SIZE (1<<UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N)
+    //! The buffer used to store events in the injected task pool
+    uel_event_t task_pool_buffer[UEL_WORKGROUP_INJECT_QUEUE_SIZE];
+    //! The buffer used to store event pointers in the injected task pool queue
+    void *task_pool_queue_buffer[UEL_WORKGROUP_INJECT_QUEUE_SIZE];
+    //! The pool of events backing closures injected from outside the workers
+    uel_objpool_t task_pool;
+    //! The injection queue buffer
+    void *inject_queue_buffer[UEL_WORKGROUP_INJECT_QUEUE_SIZE];
+    //! Holds closures injected from outside the workers, runnable by any of them
+    uel_cqueue_t inject_queue;
+    //! Guards the injection queue when a lock backend is selected
+    uel_lock_t inject_queue_lock;
+};
+
+/** \brief Initialises a workgroup and each of its workers
+  *
+  * \param group The uel_workgroup_t instance to be initialised
+  * \param workers An array of workers to be managed by the group
+  * \param count The number of workers in the array
+  */
+UEL_API void uel_workgroup_init(uel_workgroup_t *group, uel_worker_t *workers, size_t count);
+
+/** \brief Fetches the application owned by a worker
+  *
+  * Use this to schedule timers, set up observers or listen for signals on a
+  * speciffic worker.
+  *
+  * \param group The uel_workgroup_t instance
+  * \param worker_id The index of the worker
+  * \returns The application owned by the worker
+  */
+UEL_API uel_application_t *uel_workgroup_app(uel_workgroup_t *group, size_t worker_id);
+
+/** \brief Enqueues a closure to be invoked by the group.
+  *
+  * This is safe to call from any thread.
+  *
+  * \param group The uel_workgroup_t instance
+  * \param closure The closure to be enqueued
+  * \param value The value to invoke the closure with
+  * \param affinity The index of the worker the closure must run at. If
+  * `UEL_WORKGROUP_ANY`, the closure can be run by any worker.
+  * \returns Whether the closure could be enqueued. Fails only when the shared
+  * injection queue is full.
+  */
+UEL_API bool uel_workgroup_enqueue_closure(
+    uel_workgroup_t *group,
+    uel_closure_t *closure,
+    void *value,
+    size_t affinity
+);
+
+/** \brief Spawns a closure at a worker, allowing other workers to steal it.
+  *
+  * This is cheaper than `uel_workgroup_enqueue_closure()`, but **must** only be
+  * called from the thread that ticks the worker (*e.g.* from inside a closure
+  * running on it). If the worker's deque is full, the closure is pinned to
+  * the worker instead.
+  *
+  * \param group The uel_workgroup_t instance
+  * \param worker_id The index of the worker spawning the closure
+  * \param closure The closure to be spawned
+  * \param value The value to invoke the closure with
+  */
+UEL_API void uel_workgroup_spawn(
+    uel_workgroup_t *group,
+    size_t worker_id,
+    uel_closure_t *closure,
+    void *value
+);
+
+/** \brief Ticks a worker.
+  *
+  * Yields control to the worker runtime. This will:
+  * 1. Tick the worker's application, running its pinned events and timers
+  * 2. Run the closures in the worker's own deque. Closures spawned while
+  * these run are left for the next tick.
+  * 3. If the deque was empty, run one injected closure or, failing that,
+  * steal and run one closure from another worker
+  *
+  * \param group The uel_workgroup_t instance
+  * \param worker_id The index of the worker to be ticked
+  * \returns Whether any shareable closure was run. The host may use this to
+  * decide when the thread should sleep.
+  */
+UEL_API bool uel_workgroup_tick(uel_workgroup_t *group, size_t worker_id);
+
+#endif /* end of include guard: UEL_WORKGROUP_H */
+
+/* ---- uevloop/utils/iterator.h ---- */
+/** \file iterator.h
+  *
+  * \brief Defines iterators, structures and functions suitable for enumerating
+  * other data structures.
+  */
+
+#ifndef UEL_ITERATOR_H
+#define UEL_ITERATOR_H
+
+/// \cond
+#include <stdlib.h>
+#include <limits.h>
+/// \endcond
+
+
+/** \brief Iterators are data structures that wrap arbitrary collections of data
+  * and define ways of enumerating them.
+  *
+  * This is an unspecialised structure that should be augumented with actual
+  * behaviour implementation.
+  *
+  * In order to specialise it, create a struct that holds whatever state is
+  * meaningful to iteration and has a `uel_iterator_t` as its first member.
+  * Then, whenever needed, cast the iterator to your custom type.
+  */
+typedef struct uel_iterator uel_iterator_t;
+struct uel_iterator{
+    /** \brief The iteration function assigned to this iterator type
+      *
+      * This is the actual implementation of the iteration algorithm. It takes a
+      * reference to the iterator and the last accessed element's address and
+      * returns a reference to the next element.
+      *
+      * To resquest the first collection item, pass NULL as the last element
+      * parameter.
+      * When this function returns NULL, there are no more elements in the
+      * collection to be iterated over.
+      */
+    void * (* next)(uel_iterator_t *, void *);
+    //! A reference to the collection being iterated.
+    void *collection;
+    /** \brief The optional batched iteration function of this iterator type
+      *
+      * Takes a reference to the iterator, the last accessed element's address,
+      * a buffer and its capacity. Fills the buffer with the addresses of the
+      * elements following the last one, up to the capacity, and returns how many
+      * were stored. When it returns 0, there are no more elements.
+      *
+      * Iterator operations request up to `UEL_ITERATOR_BATCH_SIZE` elements at
+      * once through this function and process them in a tight loop. If it is
+      * `NULL`, they fall back to `next`.
+      */
+    size_t (* next_batch)(uel_iterator_t *, void *, void **, size_t);
+};
+
+//! The type of the `next` function of iterators
+typedef void * (* uel_iterator_next_t)(uel_iterator_t *, void *);
+//! The type of the `next_batch` function of iterators
+typedef size_t (* uel_iterator_next_batch_t)(uel_iterator_t *, void *, void **, size_t);
+
+/** \brief Fills a buffer with elements enumerated by an iterator
+  *
+  * Uses the iterator's `next_batch` function when available. Otherwise, yields
+  * a single element obtained from `next`.
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param last The last element yielded. If `NULL`, starts from the first one.
+  * \param batch The buffer where element addresses will be stored
+  * \param capacity The maximum number of elements to store. Must be at least 1.
+  * \returns How many elements were stored. If 0, the iteration is over.
+  */
+UEL_API size_t uel_iterator_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+);
+
+/** \brief Applies a closure to an enumerable collection
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param closure The closure to be invoked with each element in the enumerated
+  * collection as parameter. If this closure returns `false`, the iteration will
+  * be halted.
+  * \returns Whether the collection was fully iterated over or if the process was
+  * halted by returning `false`.
+  */
+UEL_API bool uel_iterator_foreach(uel_iterator_t *iterator, uel_closure_t *closure);
+
+/** \brief Applies a closure to an enumerable collection and stores its results
+  *
+  * This function takes an iterator that enumerates elements in a collection and
+  * yields each one to a closure. The return value of each closure call is stored
+  * in an array.
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param closure The closure to be invoked with each element in the enumerated
+  * collection ad parameter.
+  * \param destination The destination of the data produced by the invoked closure.
+  * This must be an array of void pointers large enough to store all produced data
+  * \param limit The maximum size of the destination buffer. If collection is
+  * larger than this array, in elements, it will not be iterated entirely, only
+  * up to the `limit`th element.
+  * \returns The number of effectively iterated elements.
+  */
+UEL_API size_t uel_iterator_map(uel_iterator_t *iterator, uel_closure_t *closure, void **destination, size_t limit);
+
+/** \brief Finds the first element enumerated by an iterator that passes the
+  * supplied test
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param closure The test to be applied against each enumerated element
+  * \returns The address of the first element that passes the supplied test. If
+  * no such element is found, returns NULL.
+  */
+UEL_API void *uel_iterator_find(uel_iterator_t *iterator, uel_closure_t *closure);
+
+/** \brief Counts elements enumerated by an iterator that pass the supplied test
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param closure The test to be applied against each enumerated element
+  * \returns How many elements successfully passed the supplied test
+  */
+UEL_API size_t uel_iterator_count(uel_iterator_t *iterator, uel_closure_t *closure);
+
+/** \brief Determines whether all elements enumerated by an iterator pass the
+  * supplied test or not.
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param closure The test to be applied against each enumerated element
+  * \returns Whether all elements are approved by the test closure.
+  */
+UEL_API bool uel_iterator_all(uel_iterator_t *iterator, uel_closure_t *closure);
+
+/** \brief Determines whether all elements enumerated by an iterator fail the
+  * supplied test or not.
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param closure The test to be applied against each enumerated element
+  * \returns Whether all elements are reproved by the test closure.
+  */
+UEL_API bool uel_iterator_none(uel_iterator_t *iterator, uel_closure_t *closure);
+
+/** \brief Determines whether any elements enumerated by an iterator pass the
+  * supplied test or not.
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param closure The test to be applied against each enumerated element
+  * \returns Whether any elements are approved by the test closure. If such
+  * element is found, this function returns early.
+  */
+UEL_API bool uel_iterator_any(uel_iterator_t *iterator, uel_closure_t *closure);
+
+/** \brief A specialised iterator suitable for iterating over arrays of arbitrary
+  * data
+  */
+typedef struct uel_iterator_array uel_iterator_array_t;
+struct uel_iterator_array{
+    //! The base iterator interface
+    uel_iterator_t base;
+    //! The number of elements in the array
+    size_t item_count;
+    //! The size of each element in the array
+    size_t item_size;
+};
+
+/** \brief Yields elements in a array
+  *
+  * \param iterator The iterator thar enumerates the elements in the target array
+  * \param last The last element yielded. If `NULL`, returns the first element.
+  * \returns The next element in the array with respect to the last one provided.
+  * If there are no more elements in the array, this returns `NULL`.
+  */
+UEL_API void *uel_iterator_array_next(uel_iterator_array_t *iterator, void *last);
+
+/** \brief Yields a contiguous range of elements in an array
+  *
+  * \param iterator The iterator that enumerates the elements in the target array
+  * \param last The last element yielded. If `NULL`, starts from the first element.
+  * \param batch The buffer where element addresses will be stored
+  * \param capacity The maximum number of elements to store
+  * \returns How many elements were stored. If 0, there are no more elements.
+  */
+UEL_API size_t uel_iterator_array_next_batch(
+    uel_iterator_array_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+);
+
+/** \brief Creates a new array iterator
+  *
+  * \param collection The array to be  enumerated
+  * \param count The number of elements in this array
+  * \param size The size of each element in the array
+  * \returns The created iterator
+  */
+UEL_API uel_iterator_array_t uel_iterator_array_create(void *collection, size_t count, size_t size);
+
+/** \brief Alias to `uel_iterator_t`. Iterator suitable to traverse linked lists.
+  *
+  * Because when traversing a linked list we need only know one element to know
+  * the next one, there is no need to store any additional state in linked list
+  * iterators.
+  */
+typedef uel_iterator_t uel_iterator_llist_t;
+
+/** \brief Yields elements in a linked list
+  *
+  * \param iterator The iterator thar enumerates the elements in the target list
+  * \param last The last element yielded. If `NULL`, returns the first element.
+  * \returns The next element in the list with respect to the last one provided.
+  * If there are no more elements in the list, this returns `NULL`.
+  */
+UEL_API void *uel_iterator_llist_next(uel_iterator_t *iterator, void *last);
+
+/** \brief Yields a run of elements in a linked list
+  *
+  * \param iterator The iterator that enumerates the elements in the target list
+  * \param last The last element yielded. If `NULL`, starts from the first element.
+  * \param batch The buffer where element addresses will be stored
+  * \param capacity The maximum number of elements to store
+  * \returns How many elements were stored. If 0, there are no more elements.
+  */
+UEL_API size_t uel_iterator_llist_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+);
+
+/** \brief Creates a new linked list iterator
+  *
+  * \param list The linked list to be enumerated
+  * \returns The created iterator
+  */
+UEL_API uel_iterator_llist_t uel_iterator_llist_create(uel_llist_t *list);
+
+/** \brief An iterator that lazily applies a closure to each element yielded by
+  * a source iterator.
+  *
+  * Yields the addresses of `void *` slots holding the values returned by the
+  * closure. Each slot is only valid until the iterator is advanced again.
+  *
+  * Like the other iterator adapters, it is stateful: it tracks its position in
+  * the source iterator and can only be enumerated in one pass. Requesting the
+  * first element again (passing `NULL` as the last element) restarts it.
+  */
+typedef struct uel_iterator_map_adapter uel_iterator_map_adapter_t;
+struct uel_iterator_map_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The closure applied to each element yielded by the source iterator
+    uel_closure_t closure;
+    //! The last element yielded by the source iterator
+    void *source_last;
+    //! The slots holding the values produced by the closure
+    void *values[UEL_ITERATOR_BATCH_SIZE];
+};
+
+/** \brief Creates a lazy mapping iterator
+  *
+  * \param source The iterator whose elements will be mapped
+  * \param closure The closure to be invoked with each element of the source
+  * iterator as parameter
+  * \returns The created iterator
+  */
+UEL_API uel_iterator_map_adapter_t uel_iterator_map_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+);
+
+/** \brief An iterator that lazily yields only the elements of a source iterator
+  * that pass some test.
+  */
+typedef struct uel_iterator_filter_adapter uel_iterator_filter_adapter_t;
+struct uel_iterator_filter_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The test applied to each element yielded by the source iterator
+    uel_closure_t closure;
+    //! The last element yielded by the source iterator
+    void *source_last;
+};
+
+/** \brief Creates a lazy filtering iterator
+  *
+  * \param source The iterator whose elements will be filtered
+  * \param closure The test to be applied against each element of the source
+  * iterator. Only elements for which it returns `true` are yielded.
+  * \returns The created iterator
+  */
+UEL_API uel_iterator_filter_adapter_t uel_iterator_filter_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+);
+
+/** \brief An iterator that yields at most a number of elements from a source
+  * iterator.
+  */
+typedef struct uel_iterator_take_adapter uel_iterator_take_adapter_t;
+struct uel_iterator_take_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The maximum number of elements to be yielded
+    size_t count;
+    //! How many elements were yielded so far
+    size_t taken;
+    //! The last element yielded by the source iterator
+    void *source_last;
+};
+
+/** \brief Creates an iterator that yields the first elements of another
+  *
+  * \param source The iterator whose elements will be taken
+  * \param count The maximum number of elements to be yielded
+  * \returns The created iterator
+  */
+UEL_API uel_iterator_take_adapter_t uel_iterator_take_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+);
+
+/** \brief An iterator that skips a number of elements from a source iterator
+  * before yielding the remaining ones.
+  */
+typedef struct uel_iterator_skip_adapter uel_iterator_skip_adapter_t;
+struct uel_iterator_skip_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The number of elements to be skipped
+    size_t count;
+    //! The last element yielded by the source iterator
+    void *source_last;
+};
+
+/** \brief Creates an iterator that skips the first elements of another
+  *
+  * \param source The iterator whose elements will be skipped
+  * \param count The number of elements to be skipped
+  * \returns The created iterator
+  */
+UEL_API uel_iterator_skip_adapter_t uel_iterator_skip_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+);
+
+/** \brief An iterator that pairs up the elements of two source iterators.
+  *
+  * Yields the addresses of two-element arrays of `void *`, holding one element
+  * of each source. Each pair is only valid until the iterator is advanced again.
+  * Iteration ends when either source is exhausted.
+  */
+typedef struct uel_iterator_zip_adapter uel_iterator_zip_adapter_t;
+struct uel_iterator_zip_adapter{
+    //! The base iterator interface. Its collection is the first source iterator.
+    uel_iterator_t base;
+    //! The second source iterator
+    uel_iterator_t *other;
+    //! The last element yielded by the first source iterator
+    void *source_last;
+    //! The last element yielded by the second source iterator
+    void *other_last;
+    //! The pairs of elements yielded by the source iterators
+    void *pairs[UEL_ITERATOR_BATCH_SIZE][2];
+};
+
+/** \brief Creates an iterator that pairs up the elements of two others
+  *
+  * \param source The iterator whose elements will be first in each pair
+  * \param other The iterator whose elements will be second in each pair
+  * \returns The created iterator
+  */
+UEL_API uel_iterator_zip_adapter_t uel_iterator_zip_adapter_create(
+    uel_iterator_t *source,
+    uel_iterator_t *other
+);
+
+//! Defines the maximum possible iteration limit for the `uel_iterator_map()`
+//! function.
+#define UEL_ITERATOR_MAP_BOUNDLESS UINT_MAX
+
+#endif /* UEL_ITERATOR_H */
+
+/* ---- uevloop/utils/trace.h ---- */
+/** \file trace.h
+  *
+  * \brief Defines the tracer, an optional flight recorder that logs what the
+  * core is doing into a fixed-size binary ring
+  */
+
+#ifndef UEL_TRACE_H
+#define UEL_TRACE_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+
+//! Kinds of records logged by the tracer
+enum uel_trace_record_type {
+    //! An event is about to be processed by the event loop. The subject is the
+    //! closure function (or the signal, for signal events) and the detail is
+    //! the event type.
+    UEL_TRACE_DISPATCH_BEGIN,
+    //! An event has just been processed. Mirrors `UEL_TRACE_DISPATCH_BEGIN`.
+    UEL_TRACE_DISPATCH_END,
+    //! A timer expired at the scheduler. The subject is the closure function and
+    //! the detail is the nominal due time, before any deferral due to slack.
+    UEL_TRACE_TIMER_EXPIRED,
+    //! A signal was emitted. The subject is the signal and the detail is the relay.
+    UEL_TRACE_SIGNAL_EMITTED,
+    //! A promise was resolved. The subject is the promise and the detail is the value.
+    UEL_TRACE_PROMISE_RESOLVED,
+    //! A promise was rejected. The subject is the promise and the detail is the value.
+    UEL_TRACE_PROMISE_REJECTED
+};
+//! Alias to the uel_trace_record_type enum
+typedef enum uel_trace_record_type uel_trace_record_type_t;
+
+/** \brief A single trace record.
+  *
+  * The layout is free of padding, so records can be dumped as raw bytes and
+  * decoded by host tools such as `scripts/uel-trace.py`, provided they know the
+  * target's pointer size and endianness.
+  */
+typedef struct uel_trace_record uel_trace_record_t;
+struct uel_trace_record {
+    uel_timestamp_t timestamp; //!< The instrumentation clock reading
+    uint32_t type; //!< The kind of record, as defined by `uel_trace_record_type_t`
+    uintptr_t subject; //!< What this record refers to. Depends on `type`.
+    uintptr_t detail; //!< Additional information. Depends on `type`.
+};
+
+#ifdef UEL_ENABLE_TRACE
+//! Logs a record into the trace ring
+#define UEL_TRACE(type, subject, detail)                                    \
+    uel_trace_record((type), (uintptr_t)(subject), (uintptr_t)(detail))
+#else
+//! Compiles to nothing when `UEL_ENABLE_TRACE` is not defined
+#define UEL_TRACE(type, subject, detail) ((void)0)
+#endif /* UEL_ENABLE_TRACE */
+
+/** \brief Logs a record into the trace ring, overwriting the oldest record
+  * once the ring is full.
+  *
+  * This is lock-free and safe to call from ISRs and any thread. A record being
+  * written while the ring is dumped may show up torn. Prefer the `UEL_TRACE`
+  * macro, which vanishes when tracing is disabled.
+  *
+  * \param type The kind of record
+  * \param subject What the record refers to
+  * \param detail Additional information
+  */
+UEL_API void uel_trace_record(uel_trace_record_type_t type, uintptr_t subject, uintptr_t detail);
+
+/** \brief Pauses or resumes tracing. Use this to freeze the ring as soon as
+  * an anomaly is detected. Tracing starts enabled.
+  *
+  * \param enabled Whether records should be logged
+  */
+UEL_API void uel_trace_set_enabled(bool enabled);
+
+//! \brief Discards every record in the trace ring
+UEL_API void uel_trace_reset();
+
+/** \brief Dumps the trace ring, from the oldest to the newest record
+  *
+  * \param writer A closure invoked with a pointer to each record in turn. It
+  * will usually write the record out through some host link.
+  * \returns The number of records dumped
+  */
+UEL_API uintptr_t uel_trace_dump(uel_closure_t *writer);
+
+#endif /* end of include guard: UEL_TRACE_H */
+
+/* ---- uevloop/system/parallel-iterator.h ---- */
+/** \file parallel-iterator.h
+  * \brief Defines parallel iterator operations, which split arrays into chunks
+  * and spread them over the workers of a workgroup
+  */
+
+#ifndef UEL_PARALLEL_ITERATOR_H
+#define UEL_PARALLEL_ITERATOR_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+
+//! The operations that can be run in parallel
+enum uel_iterator_par_operation {
+    UEL_ITERATOR_PAR_MAP, //!< Maps each element into a destination array
+    UEL_ITERATOR_PAR_COUNT, //!< Counts elements that pass a test
+    UEL_ITERATOR_PAR_FIND //!< Finds the first element that passes a test
+};
+//! Alias to the uel_iterator_par_operation enum
+typedef enum uel_iterator_par_operation uel_iterator_par_operation_t;
+
+/** \brief Runs iterator operations over arrays in parallel.
+  *
+  * Each operation splits an array iterator into chunks of `chunk_size`
+  * elements. The calling thread enqueues helper closures into the workgroup
+  * and then claims chunks itself, alongside the workers that pick the helpers
+  * up. The call returns once every chunk has been processed, so results are
+  * complete even if no worker is free to help.
+  *
+  * Helpers that run after their operation is over find no chunks left and
+  * return immediately. The structure must therefore outlive any helper still
+  * enqueued in the workgroup. Only one operation may run on it at a time.
+  */
+typedef struct uel_iterator_par uel_iterator_par_t;
+struct uel_iterator_par {
+    //! The workgroup whose workers help running operations
+    uel_workgroup_t *group;
+    //! How many elements each chunk is made of
+    size_t chunk_size;
+    //! The closure enqueued into the workgroup to help running operations
+    uel_closure_t helper;
+
+    //! The operation being run
+    uel_iterator_par_operation_t operation;
+    //! The array being iterated
+    char *collection;
+    //! How many elements of the array are processed
+    size_t item_count;
+    //! The size of each element in the array
+    size_t item_size;
+    //! The closure applied to each element
+    uel_closure_t closure;
+    //! Where mapped values are stored
+    void **destination;
+
+    //! The next chunk to be claimed. Only ever grows, across operations.
+    volatile uintptr_t next_chunk;
+    //! The value of `next_chunk` that maps to the first chunk of the operation
+    uintptr_t first_chunk;
+    //! The value of `next_chunk` past the last chunk of the operation
+    volatile uintptr_t end_chunk;
+    //! How many chunks are not finished yet
+    volatile uintptr_t pending;
+    //! How many elements passed the test, when counting
+    volatile uintptr_t passed;
+    //! The lowest index of an element that passed the test, when finding
+    volatile uintptr_t found;
+};
+
+/** \brief Initialises a parallel iterator operations runner
+  *
+  * \param par The runner to be initialised
+  * \param group The workgroup whose workers will help running operations. Its
+  * workers must be ticked by their own threads for operations to actually run
+  * in parallel.
+  * \param chunk_size How many elements each chunk is made of. If 0,
+  * `UEL_ITERATOR_PAR_CHUNK_SIZE` is used.
+  */
+UEL_API void uel_iterator_par_init(
+    uel_iterator_par_t *par,
+    uel_workgroup_t *group,
+    size_t chunk_size
+);
+
+/** \brief Applies a closure to each element of an array in parallel and stores
+  * its results
+  *
+  * The closure may be invoked from several threads at once.
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The closure to be invoked with each element as parameter
+  * \param destination An array of void pointers where results are stored. Each
+  * result is stored at the index of the element it was produced from.
+  * \param limit The maximum number of elements to be mapped
+  * \returns The number of mapped elements
+  */
+UEL_API size_t uel_iterator_par_map(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure,
+    void **destination,
+    size_t limit
+);
+
+/** \brief Counts elements of an array that pass the supplied test, in parallel
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The test to be applied against each element
+  * \returns How many elements passed the test
+  */
+UEL_API size_t uel_iterator_par_count(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+);
+
+/** \brief Finds the first element of an array that passes the supplied test,
+  * in parallel
+  *
+  * Once some element passes the test, chunks beyond it are abandoned.
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The test to be applied against each element
+  * \returns The address of the lowest indexed element that passes the test, as
+  * `uel_iterator_find()` would return. If no element passes, returns `NULL`.
+  */
+UEL_API void *uel_iterator_par_find(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+);
+
+/** \brief Determines whether any element of an array passes the supplied test,
+  * in parallel
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The test to be applied against each element
+  * \returns Whether any element passes the test
+  */
+UEL_API bool uel_iterator_par_any(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+);
+
+#endif /* end of include guard: UEL_PARALLEL_ITERATOR_H */
+
+/* ---- uevloop/system/simulation.h ---- */
+/** \file simulation.h
+  *
+  * \brief Defines the simulation driver, a deterministic virtual-time harness
+  * that runs applications as fast as the host allows
+  */
+
+#ifndef UEL_SIMULATION_H
+#define UEL_SIMULATION_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+
+/** \brief A single wakeup of a simulated application
+  */
+typedef struct uel_sim_step uel_sim_step_t;
+struct uel_sim_step {
+    uel_time_t time; //!< The virtual time the application was woken at
+    uintptr_t events; //!< How many events were run until the application went idle
+};
+
+/** \brief The simulation driver
+  *
+  * Instead of waiting for a timer ISR, the driver moves the application's timer
+  * straight to the next deadline and ticks it until it goes idle, skipping
+  * every gap in between. Runs are therefore reproducible and take only as long
+  * as processing the events themselves.
+  *
+  * An application is idle when no events are enqueued and no timers await
+  * scheduling. Closures that keep enqueuing themselves prevent it from ever
+  * going idle.
+  */
+typedef struct uel_sim uel_sim_t;
+struct uel_sim {
+    uel_application_t *app; //!< The simulated application
+    uel_sim_step_t *schedule; //!< Where to record each wakeup. May be `NULL`.
+    size_t capacity; //!< How many wakeups fit in `schedule`
+    uintptr_t steps; //!< How many wakeups happened. May exceed `capacity`.
+    uintptr_t events; //!< How many events were run in total
+    uel_time_t start_time; //!< The virtual time when the simulation started
+    //! Host time spent running the simulation, in instrumentation clock units
+    uel_timestamp_t busy;
+};
+
+/** \brief Initialises a simulation driver
+  *
+  * \param sim The simulation driver to be initialised
+  * \param app The application to be simulated. It must be initialised and is
+  * expected to be driven only by the simulation from now on.
+  * \param schedule A buffer where to record each wakeup. Pass `NULL` if not needed.
+  * \param capacity The number of wakeups `schedule` can hold. Further wakeups
+  * are counted but not recorded.
+  */
+UEL_API void uel_sim_init(
+    uel_sim_t *sim,
+    uel_application_t *app,
+    uel_sim_step_t *schedule,
+    size_t capacity
+);
+
+/** \brief Ticks the application until it goes idle, without advancing time
+  *
+  * \param sim The simulation driver
+  * \returns How many events were run
+  */
+UEL_API uintptr_t uel_sim_run_until_idle(uel_sim_t *sim);
+
+/** \brief Advances time to the next deadline and runs the application until
+  * it goes idle.
+  *
+  * \param sim The simulation driver
+  * \returns Whether there was any deadline to advance to
+  */
+UEL_API bool uel_sim_step(uel_sim_t *sim);
+
+/** \brief Steps the simulation through every deadline up to some point in time.
+  * Afterwards, the application timer is left at `end`.
+  *
+  * \param sim The simulation driver
+  * \param end The virtual time where to stop
+  */
+UEL_API void uel_sim_run_until(uel_sim_t *sim, uel_time_t end);
+
+/** \brief Computes the simulated throughput
+  *
+  * \param sim The simulation driver
+  * \returns How many events were run per simulated second, rounded down. Zero
+  * if no virtual time has passed.
+  */
+UEL_API uint64_t uel_sim_throughput(uel_sim_t *sim);
+
+#endif /* end of include guard: UEL_SIMULATION_H */
+
+/* ---- uevloop/utils/array-kernels.h ---- */
+/** \file array-kernels.h
+  *
+  * \brief Defines typed kernels that test arrays of fixed-width integers against
+  * thresholds, equality and ranges without invoking a closure per element.
+  *
+  * Every supported comparison is reduced to a range filter, so a single kernel
+  * per integer width serves all of them. Kernels process 16 bytes at a time with
+  * SSE2 or NEON, 32 bytes at a time with AVX2, and fall back to scalar loops
+  * elsewhere and for the trailing elements. Define `UEL_ARRAY_NO_SIMD` to force
+  * the scalar loops.
+  */
+
+#ifndef UEL_ARRAY_KERNELS_H
+#define UEL_ARRAY_KERNELS_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+/** \brief A comparison against the elements of an integer array, reduced to an
+  * inclusive range.
+  *
+  * Elements are first XORed with `bias`, which maps signed integers onto
+  * unsigned ones while preserving their order. An element passes when its
+  * biased value minus `low`, wrapped to the element width, is at most `span`.
+  */
+typedef struct uel_array_filter uel_array_filter_t;
+struct uel_array_filter {
+    //! The width of each element in bytes: 1, 2 or 4
+    uint8_t width;
+    //! Whether no element can possibly pass this filter
+    bool empty;
+    //! Maps element values onto unsigned values
+    uint32_t bias;
+    //! The lowest biased value that passes
+    uint32_t low;
+    //! How far above `low` a biased value may be and still pass
+    uint32_t span;
+};
+
+/** \brief Creates a filter from an inclusive range of biased values
+  *
+  * Prefer the typed constructors, such as `uel_array_filter_u16_gt()`.
+  *
+  * \param width The width of each element in bytes: 1, 2 or 4
+  * \param bias The value elements are XORed with. The sign bit for signed types,
+  * 0 for unsigned ones.
+  * \param low The lowest value that passes, before biasing
+  * \param high The highest value that passes, before biasing
+  * \param empty Whether no element can pass
+  * \returns The created filter
+  */
+static inline uel_array_filter_t uel_array_filter_create(
+    uint8_t width,
+    uint32_t bias,
+    uint32_t low,
+    uint32_t high,
+    bool empty
+){
+    uint32_t mask = width == 4 ? UINT32_MAX : ((uint32_t)1 << (width * 8)) - 1;
+    uint32_t biased_low = (low ^ bias) & mask;
+    uint32_t biased_high = (high ^ bias) & mask;
+    uel_array_filter_t filter = {
+        width,
+        empty || biased_low > biased_high,
+        bias,
+        biased_low,
+        biased_high - biased_low
+    };
+    return filter;
+}
+
+/** \brief Counts elements of an array that pass a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns How many elements pass the filter
+  */
+UEL_API size_t uel_array_filter_count(const uel_array_filter_t *filter, const void *array, size_t count);
+
+/** \brief Finds the first element of an array that passes a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns The address of the first element that passes, or `NULL` if none does
+  */
+UEL_API void *uel_array_filter_find(const uel_array_filter_t *filter, const void *array, size_t count);
+
+/** \brief Determines whether any element of an array passes a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns Whether any element passes. Returns as soon as one is found.
+  */
+UEL_API bool uel_array_filter_any(const uel_array_filter_t *filter, const void *array, size_t count);
+
+/** \brief Determines whether all elements of an array pass a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns Whether all elements pass. Returns as soon as one fails.
+  */
+UEL_API bool uel_array_filter_all(const uel_array_filter_t *filter, const void *array, size_t count);
+
+//! \cond
+#define UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, operation, params, filter)  \
+    static inline size_t uel_array_count_##suffix##_##operation(             \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return uel_array_filter_count(&predicate, array, count);             \
+    }                                                                         \
+    static inline type *uel_array_find_##suffix##_##operation(               \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return (type *)uel_array_filter_find(&predicate, array, count);      \
+    }                                                                         \
+    static inline bool uel_array_any_##suffix##_##operation(                 \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return uel_array_filter_any(&predicate, array, count);               \
+    }                                                                         \
+    static inline bool uel_array_all_##suffix##_##operation(                 \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return uel_array_filter_all(&predicate, array, count);               \
+    }
+
+#define UEL_ARRAY_DEFINE_KERNELS(suffix, type, min, max, bias)                \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_gt(type value){ \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)(value + (value != (max))), (uint32_t)(max), value == (max)); \
+    }                                                                         \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_lt(type value){ \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)(min), (uint32_t)(value - (value != (min))), value == (min)); \
+    }                                                                         \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_eq(type value){ \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)value, (uint32_t)value, false);                         \
+    }                                                                         \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_range(       \
+        type low, type high                                                   \
+    ){                                                                        \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)low, (uint32_t)high, low > high);                       \
+    }                                                                         \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, gt, type value,                 \
+        uel_array_filter_##suffix##_gt(value))                                \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, lt, type value,                 \
+        uel_array_filter_##suffix##_lt(value))                                \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, eq, type value,                 \
+        uel_array_filter_##suffix##_eq(value))                                \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, range, type low UEL_ARRAY_COMMA type high, \
+        uel_array_filter_##suffix##_range(low, high))
+
+#define UEL_ARRAY_COMMA ,
+//! \endcond
+
+/** \brief Typed filters and kernels for each supported integer type.
+  *
+  * For each of `u8`, `i8`, `u16`, `i16`, `u32` and `i32`, and each comparison
+  * `gt` (greater than), `lt` (less than), `eq` (equal to) and `range` (within
+  * `[low, high]`), the following are defined, *e.g.* for `u16` and `gt`:
+  *
+  * - `uel_array_filter_t uel_array_filter_u16_gt(uint16_t value)`
+  * - `size_t uel_array_count_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  * - `uint16_t *uel_array_find_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  * - `bool uel_array_any_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  * - `bool uel_array_all_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  *
+  * The `range` variants take `low` and `high` instead of `value`.
+  */
+UEL_ARRAY_DEFINE_KERNELS(u8, uint8_t, 0, UINT8_MAX, 0)
+UEL_ARRAY_DEFINE_KERNELS(i8, int8_t, INT8_MIN, INT8_MAX, 0x80)
+UEL_ARRAY_DEFINE_KERNELS(u16, uint16_t, 0, UINT16_MAX, 0)
+UEL_ARRAY_DEFINE_KERNELS(i16, int16_t, INT16_MIN, INT16_MAX, 0x8000)
+UEL_ARRAY_DEFINE_KERNELS(u32, uint32_t, 0, UINT32_MAX, 0)
+UEL_ARRAY_DEFINE_KERNELS(i32, int32_t, INT32_MIN, INT32_MAX, 0x80000000)
+
+#endif /* end of include guard: UEL_ARRAY_KERNELS_H */
+
+/* ---- uevloop/utils/automatic-pool.h ---- */
+/** \file automatic-pool.h
+  *
+  * \brief Defines automatic pointers and automatic pools, objects that wrap
+  * object pools and objects managed by them. These wrappers provide basic
+  * automatic memory management.
+  */
+
+#ifndef UEL_AUTOMATIC_POOL_H
+#define UEL_AUTOMATIC_POOL_H
+
+
+struct uel_autopool;
+
+/** \brief Automatic pointers are pointers wrapped by information of where they
+  * were issued.
+  *
+  * Upon deallocation, an object wrapped by an autoptr is automatically
+  * returned to its original pool.
+  * Automatic pointers are meant to be pooled themselves.
+  *
+  * The programmer can safely cast a `uel_autoptr_t` to a `void *` or a pointer
+  * to whatever type the wrapped object is.
+  */
+struct uel_autoptr {
+    void *object; //!< A pointer to the wrapped object
+    struct uel_autopool *source; //!< The pool where the autoptr object was issued
+};
+
+/** \brief Aliases `uel_autoptr_t` to `void **` so it can be cast to pointers to
+  * other types
+  */
+typedef void ** uel_autoptr_t;
+
+/** \brief Deallocates an automatic pointer.
+  *
+  * When called, the destructor closure defined at the autopointer's source
+  * autopool is invoked. Afterwards, the autopointer is returned to its pool.
+  *
+  * \see uel_autopool_set_destructor()
+  * \warning The object **must** not be used after it's dealloc'ed.
+  */
+UEL_API void uel_autoptr_dealloc(uel_autoptr_t autoptr);
+
+/** \brief Automatic pools are wrappers to object pools. They manage the
+  * acquisition and release cycle from objects issued at the pool by wrapping
+  * them in automatic pointers.
+  */
+typedef struct uel_autopool uel_autopool_t;
+struct uel_autopool {
+    uel_objpool_t autoptr_pool; //!< The object pool that holds autopointers
+    uint8_t *object_buffer; //!< The buffer that contains each object in the pool
+    size_t item_size; //!< The size of each object in the pool
+    uel_closure_t constructor; //!< The constructor closure
+    uel_closure_t destructor; //!< The destructor closure
+};
+
+/** \brief Initialises an automatic pool
+  *
+  * \param pool The pool to be initialised
+  * \param size_log2n The number of objects in the pool in its log2 form
+  * \param item_size The size of each object in the pool. If special alignment
+  * is required, it must be included in this value.
+  * \param object_buffer The buffer that contains each object in the pool. Must
+  * be `2**size_log2n * item_size` long.
+  * \param autoptr_buffer The buffer that contains each autoptr object to be issued.
+  * Must be `2**size_log2n * item_size` long.
+  * \param queue_buffer A void pointer array that will be used as the buffer to
+  * the object pointer queue. Must be `2**size_log2n` long.
+  */
+UEL_API void uel_autopool_init(
+    uel_autopool_t *pool,
+    size_t size_log2n,
+    size_t item_size,
+    uint8_t *object_buffer,
+    struct uel_autoptr *autoptr_buffer,
+    void **queue_buffer
+);
+
+/** \brief Allocates an object and wrap it in a automatic pointer.
+  *
+  * The allocated object is submited to the contructor closure set in the
+  * autopool.
+  *
+  * \see uel_autopool_set_constructor()
+  *
+  * \param pool The automatic pool from where to acquire the object
+  * \returns An autopointer wrapping the acquired object or NULL if one could
+  * not be acquired.
+  */
+UEL_API uel_autoptr_t uel_autopool_alloc(uel_autopool_t *pool);
+
+
+/** \brief Checks if a pool is depleted
+  *
+  * \param pool The pool to be verified
+  * \return Whether the pool is empty (*i.e.*: All autoptrs have been given out)
+  */
+UEL_API bool uel_autopool_is_empty(uel_autopool_t *pool);
+
+/** \brief Sets the constructor closure of an autopool.
+  *
+  * This closure is invoked when `uel_autoptr_alloc()` is called and takes a
+  * bare pointer to the object being alloc'ed as parameter.
+  *
+  * \see uel_autoptr_alloc()
+  *
+  * \param pool The autopool onto which to attach the constructor
+  * \param constructor The constructor closure
+  */
+UEL_API void uel_autopool_set_constructor(uel_autopool_t *pool, uel_closure_t constructor);
+
+/** \brief Sets the destructor closure of an autopool.
+  *
+  * This closure is invoked when `uel_autoptr_dealloc()` is called and takes a
+  * bare pointer to the object being dealloc'ed as parameter.
+  *
+  * \see uel_autoptr_dealloc()
+  *
+  * \param pool The autopool onto which to attach the destructor
+  * \param destructor The destructor closure
+  */
+UEL_API void uel_autopool_set_destructor(uel_autopool_t *pool, uel_closure_t destructor);
+
+/** \brief Declares the necessary buffers to back an automatic pool, so the
+  * programmer doesn't have to reason much about it.
+  *
+  * Use this macro as a shortcut to create the required buffers for an automatic
+  * pool. This will declare three buffers in the calling scope.
+  *
+  * \param type The type of the objects the pool will contain
+  * \param size_log2n The number of elements the pool will contain in log2 form
+  * \param id A valid identifier for the pools.
+  */
+#define UEL_DECLARE_AUTOPOOL_BUFFERS(type, size_log2n, id)          \
+    type id##_buffer[(1<<size_log2n)];                              \
+    struct uel_autoptr id##_pool_buffer[1<<size_log2n];             \
+    void *id##_pool_queue_buffer[1<<size_log2n];
+
+/** \brief Refers to a previously declared buffer set.
+  *
+  * This is a convenience macro to supply the buffers generated by
+  * `UEL_DECLARE_AUTOPOOL_BUFFERS()` to the `uel_autopool_init()` function.
+  *
+  * \param id The identifier used to declare the pool buffers
+  */
+#define UEL_AUTOPOOL_BUFFERS(id)                                     \
+    (uint8_t *)&id##_buffer, id##_pool_buffer, id##_pool_queue_buffer
+
+/** \brief Refers to a previously declared buffer set.
+  *
+  * This is a convenience macro to supply the buffers generated by
+  * `UEL_DECLARE_AUTOPOOL_BUFFERS()` to the `uel_autopool_init()` function.
+  * Use this if the buffers were defined inside a local object, accessible in the
+  * current scope.
+  *
+  * \param id The identifier used to declare the pool buffers
+  * \param obj The object storing the pool buffers
+  */
+#define UEL_AUTOPOOL_BUFFERS_IN(id, obj)                            \
+    (uint8_t *)&obj.id##_buffer, obj.id##_pool_buffer,              \
+    obj.id##_pool_queue_buffer
+
+/** \brief Refers to a previously declared buffer set.
+  *
+  * This is a convenience macro to supply the buffers generated by
+  * `UEL_DECLARE_AUTOPOOL_BUFFERS()` to the `uel_autopool_init()` function.
+  * Use this if the buffers were defined inside an object whose address is
+  * accessible in the current scope
+  *
+  * \param id The identifier used to declare the pool buffers
+  * \param obj The address of the object storing the pool buffers
+  */
+#define UEL_AUTOPOOL_BUFFERS_AT(id, obj)                            \
+    (uint8_t *)&obj->id##_buffer, obj->id##_pool_buffer,            \
+    obj->id##_pool_queue_buffer
+
+#endif /* end of include guard: UEL_AUTOMATIC_POOL_H */
+
+/* ---- uevloop/utils/conditional.h ---- */
+/** \file conditional.h
+  *
+  * \brief Contains definitions of functional conditionals, structures that act
+  * as if-else constructs.
+  */
+
+#ifndef UEL_CONDITIONAL_H
+#define UEL_CONDITIONAL_H
+
+
+/** \brief Conditionals are constructs that provide functional flow control.
+  *
+  * A conditional is defined by a tuple <test, if_true, if_false> of closures.
+  * When applied to some input, this input is passed to the `test` closure.
+  * Based on its returned value, one of the other closures is invoked.
+  */
+typedef struct uel_conditional uel_conditional_t;
+struct uel_conditional{
+    //! A closure that, based on its input, should return `true` or `false`.
+    uel_closure_t test;
+    //! The closure that will be invoked if the `test` closure returns `true`
+    uel_closure_t if_true;
+    //! The closure that will be invoked if the `test` closure returns `false`
+    uel_closure_t if_false;
+};
+
+/** \brief Initialises a conditional structure
+  *
+  * \param conditional The conditional object to be initialised
+  * \param test The closure to test the input in order to decide what to do next
+  * \param if_true The closure to be invoked when the test closure returns `true`
+  * \param if_false The closure to be invoked when the test closure returns `false`
+  */
+UEL_API void uel_conditional_init(uel_conditional_t *conditional, uel_closure_t test,
+                                uel_closure_t if_true, uel_closure_t if_false);
+
+/** \brief Applies a conditional do some input
+  *
+  * This function takes some input and submits it to the test closure, whose
+  * output will be cast to a boolean value.
+  * According to this value, either `if_true` or `if_false` closures will be called
+  * with the *same value* as parameters.
+  *
+  * \param conditional The conditional to be applied
+  * \param params The parameter that will be tested and provided to the chosen
+  * closure
+  * \returns Whatever the invoked closure returned
+  */
+UEL_API void *uel_conditional_apply(uel_conditional_t *conditional, void *params);
+
+#endif /* end of include guard: UEL_CONDITIONAL_H */
+
+/* ---- uevloop/utils/switch.h ---- */
+/** \file switch.h
+  *
+  * \brief Contains definitions of functional switches, structures that act as
+  * table-driven multiway branches.
+  */
+
+#ifndef UEL_SWITCH_H
+#define UEL_SWITCH_H
+
+/// \cond
+#include <stdint.h>
+#include <stdlib.h>
+/// \endcond
+
+
+/** \brief A single branch of a switch
+  */
+typedef struct uel_switch_case uel_switch_case_t;
+struct uel_switch_case {
+    //! The key that selects this branch
+    uintptr_t key;
+    //! The closure to be invoked when this branch is selected
+    uel_closure_t closure;
+};
+
+/** \brief Defines how a switch looks up its branches
+  */
+enum uel_switch_mode {
+    //! Keys are few and close together. The table is indexed by key directly.
+    UEL_SWITCH_DENSE,
+    //! Keys are sparse. The table is indexed by a perfect hash of the key.
+    UEL_SWITCH_HASHED,
+    //! No table could be built. Cases are searched one by one.
+    UEL_SWITCH_LINEAR
+};
+//! Alias to the `uel_switch_mode` enum
+typedef enum uel_switch_mode uel_switch_mode_t;
+
+/** \brief Switches are constructs that provide multiway functional flow control.
+  *
+  * A switch is defined by a `selector` closure, a list of cases and a default
+  * branch. When applied to some input, the selector maps this input to an
+  * integer key and the case with this key is invoked with the same input. The
+  * default branch is invoked if no case matches.
+  *
+  * When initialised, the switch fills a table of case pointers so lookups take
+  * a single probe. If all keys fit in the table when offset by the lowest one,
+  * they index it directly. Otherwise, multiplicative hashes are tried until one
+  * maps every key to a distinct slot. Tables at least four times larger than
+  * the number of cases make such a hash easy to find.
+  */
+typedef struct uel_switch uel_switch_t;
+struct uel_switch {
+    //! A closure that maps its input to the key of the branch to be taken
+    uel_closure_t selector;
+    //! The closure invoked when no case matches the key
+    uel_closure_t default_branch;
+    //! The cases of this switch
+    uel_switch_case_t *cases;
+    //! The number of cases
+    size_t count;
+    //! The lookup table. Empty slots are `NULL`.
+    uel_switch_case_t **table;
+    //! The base-2 logarithm of the number of slots in the table
+    uint8_t table_size_log2n;
+    //! How the table is indexed
+    uel_switch_mode_t mode;
+    //! The lowest key, subtracted from keys to index dense tables
+    uintptr_t base;
+    //! The multiplier of the perfect hash used by hashed tables
+    uint32_t multiplier;
+};
+
+/** \brief Declares the table a switch needs.
+  *
+  * \param size_log2n The base-2 logarithm of the number of slots in the table
+  * \param id The identifier to base the table name on
+  */
+#define UEL_DECLARE_SWITCH_TABLE(size_log2n, id)                              \
+    uel_switch_case_t *id##_switch_table[1<<(size_log2n)]
+
+/** \brief Initialises a switch and builds its lookup table
+  *
+  * If neither a dense nor a hashed table can be built, the switch falls back
+  * to searching its cases linearly. Check `uel_switch_t::mode` to find out. If
+  * more than one case has the same key, the first one is taken.
+  *
+  * \param sw The switch to be initialised
+  * \param selector The closure that maps inputs to keys
+  * \param cases The cases of the switch. Must outlive the switch.
+  * \param count The number of cases
+  * \param default_branch The closure to be invoked when no case matches
+  * \param table The buffer where to build the lookup table, with
+  * `(1<<table_size_log2n)` slots
+  * \param table_size_log2n The base-2 logarithm of the number of slots in the
+  * table. Must be less than 32.
+  */
+UEL_API void uel_switch_init(
+    uel_switch_t *sw,
+    uel_closure_t selector,
+    uel_switch_case_t *cases,
+    size_t count,
+    uel_closure_t default_branch,
+    uel_switch_case_t **table,
+    uint8_t table_size_log2n
+);
+
+/** \brief Finds the branch taken for some key
+  *
+  * \param sw The switch to be searched
+  * \param key The key to be looked up
+  * \returns The closure of the case with this key, or the default branch
+  */
+UEL_API uel_closure_t *uel_switch_find(uel_switch_t *sw, uintptr_t key);
+
+/** \brief Applies a switch to some input
+  *
+  * The input is passed to the selector closure, whose output is cast to a key.
+  * The branch selected by this key is then invoked with the *same value* as
+  * parameters.
+  *
+  * \param sw The switch to be applied
+  * \param params The parameter that will be mapped to a key and provided to the
+  * chosen closure
+  * \returns Whatever the invoked closure returned
+  */
+UEL_API void *uel_switch_apply(uel_switch_t *sw, void *params);
+
+#endif /* end of include guard: UEL_SWITCH_H */
+
+/* ---- uevloop/utils/functional.h ---- */
+/** \file functional.h
+  *
+  * \brief Contains helpers for composing and augumenting closures
+  */
+
+#ifndef UEL_FUNCTIONAL_H
+#define UEL_FUNCTIONAL_H
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+
+/** \brief Maps elements of an iterator to an area of memory. Each element is
+  * assigned to a `void` pointer slot.
+  */
+typedef struct uel_func_mapper uel_func_mapper_t;
+struct uel_func_mapper{
+    //! The iterator that enumerates the elements to be mapped
+    uel_iterator_t *iterator;
+    //! The area of memory to where elements will be mapped
+    void **destination;
+    //! The maximum size of slots to be mapped to
+    size_t limit;
+};
+
+/** \brief Initialises a mapper object
+  *
+  * \param mapper The mapper instance to be initialised
+  * \param iterator The iterator responsible for enumerating elements
+  * \param destination An array of `void` pointers to where elements will be mapped
+  * \param limit The maximum size of elements that can be mapped
+  */
+UEL_API void uel_func_mapper_init(uel_func_mapper_t *mapper, uel_iterator_t *iterator,
+                                            void **destination, size_t limit);
+
+/** \brief Wraps a pipeline in a closure
+  *
+  * This function wraps a pipeline in a closure. When invoked, the closure's
+  * parameters will be forwarded to the pipeline. Also, the pipeline's returned
+  * value will be returned from the closure.
+  *
+  * \param pipeline The pipeline to be wrapped
+  * \returns A closure that, when invoked, will apply the supplied pipeline
+  */
+UEL_API uel_closure_t uel_func_pipeline(uel_pipeline_t *pipeline);
+
+/** \brief Wraps a conditional in a closure
+  *
+  * This function wraps a conditional in a closure. When invoked, the closure's
+  * parameters will be forwarded to the conditional. Also, the conditional's
+  * returned value will be returned from the closure.
+  *
+  * \param conditional The conditional to be wrapped
+  * \returns A closure that, when invoked, will apply the supplied conditional
+  */
+UEL_API uel_closure_t uel_func_conditional(uel_conditional_t *conditional);
+
+/** \brief Wraps a switch in a closure
+  *
+  * This function wraps a switch in a closure. When invoked, the closure's
+  * parameters will be forwarded to the switch. Also, the returned value of the
+  * branch taken will be returned from the closure.
+  *
+  * \param sw The switch to be wrapped
+  * \returns A closure that, when invoked, will apply the supplied switch
+  */
+UEL_API uel_closure_t uel_func_switch(uel_switch_t *sw);
+
+/** \brief Wraps a closure in a `foreach` construct
+  *
+  * Creates a new closure based on a supplied closure. When invoked, this new
+  * closure takes an  `uel_iterator_t` for parameter and yields each element in
+  * it to the supplied  closure.
+  *
+  * See `uel_iterator_foreach()`.
+  *
+  * \param closure A reference to the closure to be wrapped
+  */
+UEL_API uel_closure_t uel_func_foreach(uel_closure_t *closure);
+
+/** \brief Wraps a closure in a `map` construct
+  *
+  * Creates a new closure based on a supplied closure. This new closure takes an
+  * `uel_func_mapper_t` for parameter describing the mapping relation between
+  * elements yielded from an iterator and a region of memory.
+  *
+  * When invoked, this new closure passes each element enumerated by this mapper
+  * as parameter to the supplied closure and stores its returned value sequentially
+  * in the destination area. It then returns the destination address.
+  *
+  * See `uel_iterator_map()`.
+  *
+  * \param closure A reference to the closure to be wrapped
+  */
+UEL_API uel_closure_t uel_func_map(uel_closure_t *closure);
+
+/** \brief Wraps a closure in a `find` construct
+  *
+  * Creates a new closure based on a supplied closure. This new closure accepts
+  * an `uel_iterator_t` as parameter and applies the supplied closure to each
+  * element yielded by this iterator.
+  *
+  * When some enumerated element causes the supplied closure to return true, its
+  * address is returned by the new closure.
+  *
+  * \param closure The test to be applied against each enumerated element
+  * \returns The address of the first element that passes the supplied test. If
+  * no such element is found, returns `NULL`.
+  */
+UEL_API uel_closure_t uel_func_find(uel_closure_t *closure);
+
+/** \brief Wraps a closure in a `count` construct
+  *
+  * Creates a new closure based on a supplied closure. This new closure accepts
+  * an `uel_iterator_t` as parameter and applies the supplied closure to each
+  * element yielded by this iterator.
+  *
+  * This new closure counts the number of enumerated elements that caused the
+  * test closure to return `true`.
+  *
+  * \param closure The test to be applied against each enumerated element
+  * \returns The number of elements that passed the supplied test closure.
+  */
+UEL_API uel_closure_t uel_func_count(uel_closure_t *closure);
+
+/** \brief Wraps a closure in a `all` construct
+  *
+  * Creates a new closure based on a supplied closure. This new closure accepts
+  * an `uel_iterator_t` as parameter and applies the supplied closure to each
+  * element yielded by this iterator.
+  *
+  * If all enumerate elements cause the supplied closure to return `true`, this
+  * new closure also returns `true`. Otherwise, it returns `false`.
+  *
+  * \param closure The test to be applied against each enumerated element
+  * \returns Whether all elements pass the supplied test closure.
+  */
+UEL_API uel_closure_t uel_func_all(uel_closure_t *closure);
+
+/** \brief Wraps a closure in a `none` construct
+  *
+  * Creates a new closure based on a supplied closure. This new closure accepts
+  * an `uel_iterator_t` as parameter and applies the supplied closure to each
+  * element yielded by this iterator.
+  *
+  * If all enumerate elements cause the supplied closure to return `false`, this
+  * new closure also returns `true`. Otherwise, it returns `false`.
+  *
+  * \param closure The test to be applied against each enumerated element
+  * \returns Whether all elements are reproved in the supplied test closure.
+  */
+UEL_API uel_closure_t uel_func_none(uel_closure_t *closure);
+
+/** \brief Wraps a closure in a all construct
+  *
+  * Creates a new closure based on a supplied closure. This new closure accepts
+  * an `uel_iterator_t` as parameter and applies the supplied closure to each
+  * element yielded by this iterator.
+  *
+  * If any enumerate elements cause the supplied closure to return `true`, this
+  * new closure also returns `true`. Otherwise, it returns `false`.
+  *
+  * \param closure The test to be applied against each enumerated element
+  * \returns Whether any elements pass the supplied test closure.
+  */
+UEL_API uel_closure_t uel_func_any(uel_closure_t *closure);
+
+/** \brief Creates a closure that counts the elements of an integer array that
+  * pass a filter
+  *
+  * The new closure accepts an `uel_iterator_array_t` as parameter and runs the
+  * filter's kernel over its whole array, with no closure invoked per element.
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that returns how many elements pass the filter
+  */
+UEL_API uel_closure_t uel_func_array_count(uel_array_filter_t *filter);
+
+/** \brief Creates a closure that finds the first element of an integer array
+  * that passes a filter
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that, invoked with an `uel_iterator_array_t`, returns the
+  * address of the first element that passes the filter or `NULL`
+  */
+UEL_API uel_closure_t uel_func_array_find(uel_array_filter_t *filter);
+
+/** \brief Creates a closure that determines whether all elements of an integer
+  * array pass a filter
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that, invoked with an `uel_iterator_array_t`, returns
+  * whether all elements pass the filter
+  */
+UEL_API uel_closure_t uel_func_array_all(uel_array_filter_t *filter);
+
+/** \brief Creates a closure that determines whether any element of an integer
+  * array passes a filter
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that, invoked with an `uel_iterator_array_t`, returns
+  * whether any element passes the filter
+  */
+UEL_API uel_closure_t uel_func_array_any(uel_array_filter_t *filter);
+
+#endif /* end of include guard: UEL_FUNCTIONAL_H */
+
+/* ---- src/portability/lock.c ---- */
+/* <unistd.h> only declares syscall() when GNU extensions are enabled. This
+ * must come before any system header is included.
+ */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+
+#ifdef UEL_LOCK_HAS_FUTEX
+/// \cond
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+/// \endcond
+#endif /* UEL_LOCK_HAS_FUTEX */
+
+
+#ifdef UEL_CRITICAL_SECTION_BUILTIN
+UEL_GLOBAL UEL_CRITICAL_SECTION_OBJ_TYPE uel_critical_section = UEL_LOCK_INITIALIZER;
+#endif /* UEL_CRITICAL_SECTION_BUILTIN */
+
+UEL_API void uel_spinlock_init(uel_spinlock_t *lock){
+    UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+}
+
+UEL_API bool uel_spinlock_try_acquire(uel_spinlock_t *lock){
+    int expected = 0;
+    return UEL_ATOMIC_CAS(lock, &expected, 1);
+}
+
+UEL_API void uel_spinlock_acquire(uel_spinlock_t *lock){
+    while(!uel_spinlock_try_acquire(lock)){
+        // Waits on plain loads so the cache line is not bounced between cores
+        while(UEL_ATOMIC_LOAD(lock, UEL_ATOMIC_RELAXED) != 0) UEL_LOCK_RELAX();
+    }
+}
+
+UEL_API void uel_spinlock_release(uel_spinlock_t *lock){
+    UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+}
+
+#ifdef UEL_LOCK_HAS_FUTEX
+static inline void uel__lock_futex_wait(uel_futex_t *lock, int value){
+    syscall(SYS_futex, lock, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static inline void uel__lock_futex_wake(uel_futex_t *lock){
+    syscall(SYS_futex, lock, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+UEL_API void uel_futex_init(uel_futex_t *lock){
+    UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+}
+
+UEL_API bool uel_futex_try_acquire(uel_futex_t *lock){
+    int expected = 0;
+    return UEL_ATOMIC_CAS(lock, &expected, 1);
+}
+
+UEL_API void uel_futex_acquire(uel_futex_t *lock){
+    for(unsigned int i = 0; i < UEL_LOCK_FUTEX_SPIN_COUNT; i++){
+        if(UEL_ATOMIC_LOAD(lock, UEL_ATOMIC_RELAXED) == 0 &&
+            uel_futex_try_acquire(lock)
+        ) return;
+        UEL_LOCK_RELAX();
+    }
+
+    // From now on the lock is taken as contended, as other threads may sleep on it
+    for(;;){
+        int value = 0;
+        if(UEL_ATOMIC_CAS(lock, &value, 2)) return;
+        if(value == 1 && !UEL_ATOMIC_CAS(lock, &value, 2)) continue;
+        uel__lock_futex_wait(lock, 2);
+    }
+}
+
+UEL_API void uel_futex_release(uel_futex_t *lock){
+    if(UEL_ATOMIC_FETCH_ADD(lock, -1, UEL_ATOMIC_RELEASE) != 1){
+        UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+        uel__lock_futex_wake(lock);
+    }
+}
+#endif /* UEL_LOCK_HAS_FUTEX */
+
+#ifdef UEL_LOCK_HAS_PTHREAD
+UEL_API void uel_mutex_init(uel_mutex_t *lock){
+    pthread_mutex_init(lock, NULL);
+}
+
+UEL_API void uel_mutex_acquire(uel_mutex_t *lock){
+    pthread_mutex_lock(lock);
+}
+
+UEL_API bool uel_mutex_try_acquire(uel_mutex_t *lock){
+    return pthread_mutex_trylock(lock) == 0;
+}
+
+UEL_API void uel_mutex_release(uel_mutex_t *lock){
+    pthread_mutex_unlock(lock);
+}
+#endif /* UEL_LOCK_HAS_PTHREAD */
+
+/* ---- src/system/async-pipeline.c ---- */
+
+// Marks uel__async_pipeline_awaiting stages. The context is the closure that returns the promise.
+static void *uel__async_pipeline_awaiting(void *context, void *params){
+    return uel_closure_invoke((uel_closure_t *)context, params);
+}
+
+static void *uel__async_pipeline_resume(void *context, void *params){
+    uel_async_pipeline_t *async_pipeline = (uel_async_pipeline_t *)context;
+    uel_evloop_enqueue_closure(
+        async_pipeline->event_loop,
+        &async_pipeline->step,
+        NULL
+    );
+    return NULL;
+}
+
+static inline void uel__async_pipeline_finish_stage(uel_async_pipeline_t *async_pipeline, void *value){
+    if(async_pipeline->durations != NULL){
+        async_pipeline->durations[async_pipeline->stage] =
+            uel_clock_now() - async_pipeline->started_at;
+    }
+    async_pipeline->value = value;
+    async_pipeline->stage++;
+}
+
+// Runs a single stage and enqueues itself to run the next one
+static void *uel__async_pipeline_step(void *context, void *params){
+    uel_async_pipeline_t *async_pipeline = (uel_async_pipeline_t *)context;
+
+    if(async_pipeline->awaited != NULL){
+        uel_promise_t *awaited = async_pipeline->awaited;
+        uel_promise_state_t state = awaited->state;
+        void *value = awaited->value;
+        async_pipeline->awaited = NULL;
+        uel_promise_destroy(awaited);
+
+        if(state == UEL_PROMISE_REJECTED){
+            uel_promise_reject(async_pipeline->promise, value);
+            return NULL;
+        }
+        uel__async_pipeline_finish_stage(async_pipeline, value);
+    }
+
+    if(async_pipeline->stage == async_pipeline->pipeline->count){
+        uel_promise_resolve(async_pipeline->promise, async_pipeline->value);
+        return NULL;
+    }
+
+    uel_closure_t *closure = &async_pipeline->pipeline->closures[async_pipeline->stage];
+    async_pipeline->started_at = uel_clock_now();
+    if(closure->function == uel__async_pipeline_awaiting){
+        async_pipeline->awaited = (uel_promise_t *)UEL_PROFILED_INVOKE(
+            (uel_closure_t *)closure->context,
+            async_pipeline->value
+        );
+        uel_promise_always(
+            async_pipeline->awaited,
+            uel_closure_create(uel__async_pipeline_resume, (void *)async_pipeline)
+        );
+        return NULL;
+    }
+
+    uel__async_pipeline_finish_stage(async_pipeline, UEL_PROFILED_INVOKE(closure, async_pipeline->value));
+    uel_evloop_enqueue_closure(async_pipeline->event_loop, &async_pipeline->step, NULL);
+    return NULL;
+}
+
+UEL_API void uel_async_pipeline_init(
+    uel_async_pipeline_t *async_pipeline,
+    uel_pipeline_t *pipeline,
+    uel_evloop_t *event_loop,
+    uel_promise_store_t *store,
+    uel_timestamp_t *durations
+){
+    async_pipeline->pipeline = pipeline;
+    async_pipeline->event_loop = event_loop;
+    async_pipeline->store = store;
+    async_pipeline->durations = durations;
+    async_pipeline->step = uel_closure_create(uel__async_pipeline_step, (void *)async_pipeline);
+    async_pipeline->promise = NULL;
+    async_pipeline->awaited = NULL;
+    async_pipeline->stage = 0;
+    async_pipeline->value = NULL;
+    async_pipeline->started_at = 0;
+}
+
+UEL_API uel_promise_t *uel_async_pipeline_apply(
+    uel_async_pipeline_t *async_pipeline,
+    void *params
+){
+    async_pipeline->promise = uel_promise_create(async_pipeline->store, uel_nop());
+    async_pipeline->awaited = NULL;
+    async_pipeline->stage = 0;
+    async_pipeline->value = params;
+    uel_evloop_enqueue_closure(async_pipeline->event_loop, &async_pipeline->step, NULL);
+    return async_pipeline->promise;
+}
+
+UEL_API uel_closure_t uel_async_pipeline_awaiting(uel_closure_t *closure){
+    return uel_closure_create(uel__async_pipeline_awaiting, (void *)closure);
+}
+
+/* ---- src/system/channel.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+
+static inline void uel__channel_enqueue_batch(uel_channel_t *channel, uel_event_t **batch, size_t count){
+    uel_sysqueues_enqueue_events(&channel->target->queues, batch, count);
+}
+
+static void *uel__channel_deliver_messages(void *context, void *params){
+    uel_channel_t *channel = (uel_channel_t *)context;
+    uel_event_t *batch[UEL_CHANNEL_BATCH_SIZE];
+    size_t count = 0;
+    uintptr_t head = UEL_ATOMIC_LOAD(&channel->head, UEL_ATOMIC_ACQUIRE);
+    uintptr_t tail = channel->tail;
+
+    while(tail != head && count < UEL_CHANNEL_BATCH_SIZE){
+        uel_channel_message_t *message = &channel->buffer[tail & channel->mask];
+        if(message->type == UEL_CHANNEL_SIGNAL_MESSAGE){
+            // Keeps ordering between closures and signals
+            uel__channel_enqueue_batch(channel, batch, count);
+            count = 0;
+            uel_signal_emit(
+                message->target.signal.signal,
+                message->target.signal.relay,
+                message->value
+            );
+        }else{
+            uel_event_t *event = uel_syspools_acquire_event(&channel->target->pools);
+            if(event == NULL) break;
+            uel_event_config_closure(event, &message->target.closure, message->value, false);
+            batch[count++] = event;
+        }
+        tail++;
+    }
+    UEL_ATOMIC_STORE(&channel->tail, tail, UEL_ATOMIC_RELEASE);
+    uel__channel_enqueue_batch(channel, batch, count);
+
+    // Pairs with the fence in uel__channel_send_message(): either the producer sees the
+    // channel drained and wakes the target or the target sees the messages
+    // sent meanwhile, which also move the observed head
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    if(tail != head){
+        // Not everything could be delivered; resume on the next runloop
+        channel->backlog++;
+    }
+    return NULL;
+}
+
+static bool uel__channel_send_message(uel_channel_t *channel, uel_channel_message_t *message){
+    uintptr_t head = channel->head;
+    uintptr_t tail = UEL_ATOMIC_LOAD(&channel->tail, UEL_ATOMIC_ACQUIRE);
+    if(head - tail > channel->mask) return false;
+
+    channel->buffer[head & channel->mask] = *message;
+    UEL_ATOMIC_STORE(&channel->head, head + 1, UEL_ATOMIC_RELEASE);
+    // The consumer may have drained the channel since tail was loaded
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    tail = UEL_ATOMIC_LOAD(&channel->tail, UEL_ATOMIC_ACQUIRE);
+    if(head == tail){
+        uel_closure_invoke(&channel->wakeup, (void *)channel);
+    }
+    return true;
+}
+
+UEL_API void uel_channel_init(
+    uel_channel_t *channel,
+    uel_channel_message_t *buffer,
+    uintptr_t size_log2n,
+    uel_application_t *target,
+    uel_closure_t wakeup
+){
+    channel->buffer = buffer;
+    channel->mask = ((uintptr_t)1 << size_log2n) - 1;
+    channel->head = 0;
+    channel->tail = 0;
+    channel->backlog = 0;
+    channel->target = target;
+    channel->wakeup = wakeup;
+
+    uel_closure_t deliver = uel_closure_create(uel__channel_deliver_messages, (void *)channel);
+    // Observers run in registration order, so a backlog left by a delivery is
+    // only seen on the next runloop
+    channel->backlog_observer = uel_app_observe(target, &channel->backlog, &deliver);
+    channel->observer = uel_app_observe(target, &channel->head, &deliver);
+}
+
+UEL_API void uel_channel_close(uel_channel_t *channel){
+    uel_event_observer_cancel(channel->observer);
+    uel_event_observer_cancel(channel->backlog_observer);
+}
+
+UEL_API bool uel_channel_send(uel_channel_t *channel, uel_closure_t *closure, void *value){
+    uel_channel_message_t message;
+    message.type = UEL_CHANNEL_CLOSURE_MESSAGE;
+    message.target.closure = *closure;
+    message.value = value;
+    return uel__channel_send_message(channel, &message);
+}
+
+UEL_API bool uel_channel_emit(
+    uel_channel_t *channel,
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    void *params
+){
+    uel_channel_message_t message;
+    message.type = UEL_CHANNEL_SIGNAL_MESSAGE;
+    message.target.signal.signal = signal;
+    message.target.signal.relay = relay;
+    message.value = params;
+    return uel__channel_send_message(channel, &message);
+}
+
+UEL_API uintptr_t uel_channel_count(uel_channel_t *channel){
+    uintptr_t tail = UEL_ATOMIC_LOAD(&channel->tail, UEL_ATOMIC_ACQUIRE);
+    uintptr_t head = UEL_ATOMIC_LOAD(&channel->head, UEL_ATOMIC_ACQUIRE);
+    return head - tail;
+}
+
+/* ---- src/system/containers/application.c ---- */
+
+// Marks a module and its dependencies, recursively, as due to launch
+static void uel__application_request_launch(uel_application_t *app, size_t id){
+    uel_module_t *module = app->registry[id];
+    if(module->state != UEL_MODULE_IDLE) return;
+
+    module->state = UEL_MODULE_WAITING;
+    for(size_t i = 0; i < module->dependency_count; i++){
+        uel__application_request_launch(app, module->dependencies[i]);
+    }
+}
+
+static bool uel__application_dependencies_launched(uel_application_t *app, uel_module_t *module){
+    for(size_t i = 0; i < module->dependency_count; i++){
+        if(app->registry[module->dependencies[i]]->state != UEL_MODULE_LAUNCHED){
+            return false;
+        }
+    }
+    return true;
+}
+
+// Launches waiting modules whose dependencies are launched until no other
+// module can be. Launch hooks may reenter through `uel_app_require()`.
+static void uel__application_launch_ready_modules(uel_application_t *app){
+    bool launched;
+    do {
+        launched = false;
+        for(size_t i = 0; i < app->registry_size; i++){
+            uel_module_t *module = app->registry[i];
+            if(module->state != UEL_MODULE_WAITING) continue;
+            if(!uel__application_dependencies_launched(app, module)) continue;
+
+            module->state = UEL_MODULE_LAUNCHING;
+            uel_module_launch(module);
+            if(!module->asynchronous){
+                module->state = UEL_MODULE_LAUNCHED;
+                launched = true;
+            }
+        }
+    } while(launched);
+}
+
+UEL_API void uel_app_init(uel_application_t *app){
+    uel_syspools_init(&app->pools);
+    uel_sysqueues_init(&app->queues);
+    uel_sch_init(
+        &app->scheduler,
+        &app->pools,
+        &app->queues
+    );
+    uel_evloop_init(
+        &app->event_loop,
+        &app->pools,
+        &app->queues
+    );
+   uel_signal_relay_init(
+        &app->relay,
+        &app->pools,
+        &app->queues,
+        app->relay_buffer,
+        UEL_APP_EVENT_COUNT
+    );
+    app->run_scheduler = true;
+    app->registry = NULL;
+    app->registry_size = 0;
+    app->loaded = false;
+#if UEL_APP_SCRATCH_SIZE > 0
+    uel_arena_init(&app->scratch, app->scratch_buffer, UEL_APP_SCRATCH_SIZE);
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+}
+
+UEL_API void uel_app_load(uel_application_t *app, uel_module_t **modules, size_t module_count){
+    app->registry_size = module_count;
+    app->registry = modules;
+    app->loaded = false;
+    for (size_t i = 0; i < module_count; i++) {
+        uel_module_config(modules[i]);
+    }
+    app->loaded = true;
+    for (size_t i = 0; i < module_count; i++) {
+        if(!modules[i]->lazy) uel__application_request_launch(app, i);
+    }
+    uel__application_launch_ready_modules(app);
+}
+
+UEL_API uel_module_t *uel_app_require(uel_application_t *app, size_t id){
+    uel_module_t *module = app->registry[id];
+    if(app->loaded && module->state == UEL_MODULE_IDLE){
+        uel_app_launch(app, id);
+    }
+    return module;
+}
+
+UEL_API void uel_app_launch(uel_application_t *app, size_t id){
+    uel__application_request_launch(app, id);
+    uel__application_launch_ready_modules(app);
+}
+
+UEL_API void uel_app_complete_launch(uel_application_t *app, uel_module_t *module){
+    module->state = UEL_MODULE_LAUNCHED;
+    uel__application_launch_ready_modules(app);
+}
+
+UEL_API void uel_app_update_timer(uel_application_t *app, uel_time_t timer){
+    uel_sch_update_timer(&app->scheduler, timer);
+    app->run_scheduler = true;
+}
+
+UEL_API void uel_app_tick(uel_application_t *app){
+    if(app->run_scheduler){
+        app->run_scheduler = false;
+        uel_sch_manage_timers(&app->scheduler);
+    }
+    uel_evloop_run(&app->event_loop);
+#if UEL_APP_SCRATCH_SIZE > 0
+    uel_arena_reset(&app->scratch);
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+}
+
+#if UEL_APP_SCRATCH_SIZE > 0
+UEL_API void *uel_app_scratch_alloc(uel_application_t *app, size_t size, size_t align){
+    return uel_arena_alloc(&app->scratch, size, align);
+}
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+
+UEL_API uel_event_t *uel_app_run_later(
+    uel_application_t *app,
+    uel_timeout_t timeout,
+    uel_closure_t closure,
+    void *value
+){
+    app->run_scheduler = true;
+    return uel_sch_run_later(&app->scheduler, timeout, closure, value);
+}
+
+UEL_API uel_event_t *uel_app_run_at_intervals(
+  uel_application_t *app,
+  uel_timeout_t interval,
+  bool immediate,
+  uel_closure_t closure,
+  void *value
+){
+    app->run_scheduler = true;
+    return uel_sch_run_at_intervals(&app->scheduler, interval, immediate, closure, value);
+}
+
+UEL_API void uel_app_enqueue_closure(
+    uel_application_t *app,
+    uel_closure_t *closure,
+    void *value
+) {
+    uel_evloop_enqueue_closure(&app->event_loop, closure, value);
+}
+
+UEL_API uel_event_t *uel_app_observe(
+    uel_application_t *app,
+    volatile uintptr_t *condition_var,
+    uel_closure_t *closure
+){
+    return uel_evloop_observe(&app->event_loop, condition_var, closure);
+}
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+UEL_API void uel_app_set_latency(uel_application_t *app, uel_latency_t *latency){
+    uel_evloop_set_latency(&app->event_loop, latency);
+    uel_sch_set_latency(&app->scheduler, latency);
+}
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+/* ---- src/system/containers/system-pools.c ---- */
+
+UEL_API void uel_syspools_init(uel_syspools_t *pools){
+    uel_objpool_init(
+        &pools->event_pool,
+        UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N,
+        sizeof(uel_event_t),
+       UEL_OBJPOOL_BUFFERS_AT(event, pools)
+    );
+    uel_objpool_init(
+        &pools->llist_node_pool,
+        UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N,
+        sizeof(uel_llist_node_t),
+       UEL_OBJPOOL_BUFFERS_AT(llist_node, pools)
+    );
+}
+
+UEL_API uel_event_t *uel_syspools_acquire_event(uel_syspools_t *pools){
+    UEL_CRITICAL_ENTER_ON(&pools->event_pool.lock);
+    uel_event_t *event = (uel_event_t *)uel_objpool_acquire(&pools->event_pool);
+    UEL_CRITICAL_EXIT_ON(&pools->event_pool.lock);
+    return event;
+}
+
+UEL_API uel_llist_node_t *uel_syspools_acquire_llist_node(uel_syspools_t *pools){
+    UEL_CRITICAL_ENTER_ON(&pools->llist_node_pool.lock);
+    uel_llist_node_t *node = (uel_llist_node_t *)uel_objpool_acquire(&pools->llist_node_pool);
+    UEL_CRITICAL_EXIT_ON(&pools->llist_node_pool.lock);
+    return node;
+}
+
+UEL_API bool uel_syspools_release_event(uel_syspools_t *pools, uel_event_t *event){
+    UEL_CRITICAL_ENTER_ON(&pools->event_pool.lock);
+    bool released = uel_objpool_release(&pools->event_pool, (void *)event);
+    UEL_CRITICAL_EXIT_ON(&pools->event_pool.lock);
+    return released;
+}
+
+UEL_API bool uel_syspools_release_llist_node(uel_syspools_t *pools, uel_llist_node_t *node){
+    UEL_CRITICAL_ENTER_ON(&pools->llist_node_pool.lock);
+    bool released = uel_objpool_release(&pools->llist_node_pool, (void *)node);
+    UEL_CRITICAL_EXIT_ON(&pools->llist_node_pool.lock);
+    return released;
+}
+
+/* ---- src/system/containers/system-queues.c ---- */
+
+UEL_API void uel_sysqueues_init(uel_sysqueues_t *queues){
+    uel_cqueue_init(
+        &queues->event_queue,
+        queues->event_queue_buffer,
+        UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N
+    );
+    uel_cqueue_init(
+        &queues->schedule_queue,
+        queues->schedule_queue_buffer,
+        UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N
+    );
+    uel_lock_init(&queues->event_queue_lock);
+    uel_lock_init(&queues->schedule_queue_lock);
+}
+
+UEL_API void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event){
+#ifdef UEL_ENABLE_LATENCY_STATS
+    event->enqueued_at = uel_clock_now();
+#endif /* UEL_ENABLE_LATENCY_STATS */
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
+    uel_cqueue_push(&queues->event_queue, (void *)event);
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+}
+
+UEL_API uintptr_t uel_sysqueues_enqueue_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+){
+#ifdef UEL_ENABLE_LATENCY_STATS
+    uel_timestamp_t now = uel_clock_now();
+    for(uintptr_t i = 0; i < count; i++) events[i]->enqueued_at = now;
+#endif /* UEL_ENABLE_LATENCY_STATS */
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
+    count = uel_cqueue_push_many(&queues->event_queue, (void **)events, count);
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+    return count;
+}
+
+UEL_API uel_event_t *uel_sysqueues_get_enqueued_event(uel_sysqueues_t *queues){
+    uel_event_t *event;
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
+    event = (uel_event_t *)uel_cqueue_pop(&queues->event_queue);
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+    return event;
+}
+
+UEL_API uintptr_t uel_sysqueues_get_enqueued_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+){
+    uintptr_t count;
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
+    count = uel_cqueue_pop_many(&queues->event_queue, (void **)events, max);
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+    return count;
+}
+
+UEL_API uintptr_t uel_sysqueues_count_enqueued_events(uel_sysqueues_t *queues){
+    uintptr_t count;
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
+    count = uel_cqueue_count(&queues->event_queue);
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+    return count;
+}
+
+UEL_API void uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event){
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
+    uel_cqueue_push(&queues->schedule_queue, (void *)event);
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+}
+
+UEL_API uintptr_t uel_sysqueues_schedule_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+){
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
+    count = uel_cqueue_push_many(&queues->schedule_queue, (void **)events, count);
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+    return count;
+}
+
+UEL_API uel_event_t *uel_sysqueues_get_scheduled_event(uel_sysqueues_t *queues){
+    uel_event_t *event;
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
+    event = (uel_event_t *)uel_cqueue_pop(&queues->schedule_queue);
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+    return event;
+}
+
+UEL_API uintptr_t uel_sysqueues_get_scheduled_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+){
+    uintptr_t count;
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
+    count = uel_cqueue_pop_many(&queues->schedule_queue, (void **)events, max);
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+    return count;
+}
+
+UEL_API uintptr_t uel_sysqueues_count_scheduled_events(uel_sysqueues_t *queues){
+    uintptr_t count;
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
+    count = uel_cqueue_count(&queues->schedule_queue);
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+    return count;
+}
+
+/* ---- src/system/containers/workgroup.c ---- */
+
+static inline void uel__workgroup_run_task(uel_event_t *task){
+    uel_closure_invoke(&task->closure, task->value);
+}
+
+static bool uel__workgroup_run_injected_task(uel_workgroup_t *group){
+    UEL_CRITICAL_ENTER_ON(&group->inject_queue_lock);
+    uel_event_t *task = (uel_event_t *)uel_cqueue_pop(&group->inject_queue);
+    UEL_CRITICAL_EXIT_ON(&group->inject_queue_lock);
+    if(task == NULL) return false;
+
+    uel__workgroup_run_task(task);
+    UEL_CRITICAL_ENTER_ON(&group->task_pool.lock);
+    uel_objpool_release(&group->task_pool, (void *)task);
+    UEL_CRITICAL_EXIT_ON(&group->task_pool.lock);
+    return true;
+}
+
+static bool uel__workgroup_run_stolen_task(uel_workgroup_t *group, size_t worker_id){
+    for(size_t i = 1; i < group->count; i++){
+        uel_worker_t *victim = &group->workers[(worker_id + i) % group->count];
+        uel_event_t *task = (uel_event_t *)uel_wsdeque_steal(&victim->deque);
+        if(task != NULL){
+            uel__workgroup_run_task(task);
+            uel_syspools_release_event(&victim->app.pools, task);
+            return true;
+        }
+    }
+    return false;
+}
+
+UEL_API void uel_workgroup_init(uel_workgroup_t *group, uel_worker_t *workers, size_t count){
+    group->workers = workers;
+    group->count = count;
+    uel_objpool_init(
+        &group->task_pool,
+        UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N,
+        sizeof(uel_event_t),
+        UEL_OBJPOOL_BUFFERS_AT(task, group)
+    );
+    uel_cqueue_init(
+        &group->inject_queue,
+        group->inject_queue_buffer,
+        UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N
+    );
+    uel_lock_init(&group->inject_queue_lock);
+    for(size_t i = 0; i < count; i++){
+        uel_app_init(&workers[i].app);
+        uel_wsdeque_init(
+            &workers[i].deque,
+            workers[i].deque_buffer,
+            UEL_WORKGROUP_DEQUE_SIZE_LOG2N
+        );
+    }
+}
+
+UEL_API uel_application_t *uel_workgroup_app(uel_workgroup_t *group, size_t worker_id){
+    return &group->workers[worker_id].app;
+}
+
+UEL_API bool uel_workgroup_enqueue_closure(
+    uel_workgroup_t *group,
+    uel_closure_t *closure,
+    void *value,
+    size_t affinity
+){
+    if(affinity != UEL_WORKGROUP_ANY){
+        uel_app_enqueue_closure(&group->workers[affinity].app, closure, value);
+        return true;
+    }
+
+    UEL_CRITICAL_ENTER_ON(&group->task_pool.lock);
+    uel_event_t *task = (uel_event_t *)uel_objpool_acquire(&group->task_pool);
+    UEL_CRITICAL_EXIT_ON(&group->task_pool.lock);
+    if(task == NULL) return false;
+
+    uel_event_config_closure(task, closure, value, false);
+    UEL_CRITICAL_ENTER_ON(&group->inject_queue_lock);
+    uel_cqueue_push(&group->inject_queue, (void *)task);
+    UEL_CRITICAL_EXIT_ON(&group->inject_queue_lock);
+    return true;
+}
+
+UEL_API void uel_workgroup_spawn(
+    uel_workgroup_t *group,
+    size_t worker_id,
+    uel_closure_t *closure,
+    void *value
+){
+    uel_worker_t *worker = &group->workers[worker_id];
+    uel_event_t *task = uel_syspools_acquire_event(&worker->app.pools);
+    uel_event_config_closure(task, closure, value, false);
+    if(!uel_wsdeque_push(&worker->deque, (void *)task)){
+        uel_sysqueues_enqueue_event(&worker->app.queues, task);
+    }
+}
+
+UEL_API bool uel_workgroup_tick(uel_workgroup_t *group, size_t worker_id){
+    uel_worker_t *worker = &group->workers[worker_id];
+    bool ran = false;
+
+    uel_app_tick(&worker->app);
+
+    // Closures spawned meanwhile wait for the next tick, so self-respawning
+    // closures cannot starve the application or the injection queue
+    uintptr_t count = uel_wsdeque_count(&worker->deque);
+    uel_event_t *task;
+    while(count-- > 0 && (task = (uel_event_t *)uel_wsdeque_pop(&worker->deque)) != NULL){
+        uel__workgroup_run_task(task);
+        uel_syspools_release_event(&worker->app.pools, task);
+        ran = true;
+    }
+    if(ran) return true;
+
+    return uel__workgroup_run_injected_task(group) || uel__workgroup_run_stolen_task(group, worker_id);
+}
+
+/* ---- src/system/event-loop.c ---- */
+
+/// \cond
+#include <stdlib.h>
+#include <stdbool.h>
+/// \endcond
+
+
+#ifdef UEL_ENABLE_TRACE
+static inline uintptr_t uel__event_loop_trace_subject(uel_event_t *event){
+    if(event->type == UEL_SIGNAL_EVENT) return event->detail.signal.value;
+    return (uintptr_t)event->closure.function;
+}
+#endif /* UEL_ENABLE_TRACE */
+
+static inline bool uel__event_loop_run_closure_event(uel_evloop_t *event_loop, uel_event_t *event){
+    UEL_PROFILED_INVOKE(&event->closure, event->value);
+    return event->repeating;
+}
+
+// Timers to be sent back to the scheduler are collected in `reschedule` so they
+// can be scheduled in bulk
+static inline bool uel__event_loop_run_timer_event(
+    uel_evloop_t *event_loop,
+    uel_event_t *event,
+    uel_event_t **reschedule,
+    uintptr_t *reschedule_count
+){
+    switch (event->detail.timer.status) {
+        case UEL_TIMER_CANCELLED:
+            return false;
+        case UEL_TIMER_PAUSED:
+            reschedule[(*reschedule_count)++] = event;
+            return true;
+        default: break;
+    }
+    UEL_PROFILED_INVOKE(&event->closure, event->value);
+    if (event->repeating) {
+        event->detail.timer.due_time += event->detail.timer.timeout;
+        reschedule[(*reschedule_count)++] = event;
+        return true;
+    }
+    return false;
+}
+
+static inline void uel__event_loop_run_signal_event(uel_evloop_t *event_loop, uel_event_t *signal){
+    uel_closure_t closures[UEL_SIGNAL_MAX_LISTENERS];
+    uel_llist_node_t *removed_nodes[UEL_SIGNAL_MAX_LISTENERS];
+    uel_llist_t *listeners = signal->detail.signal.listeners;
+    unsigned int i = 0, j =  0;
+
+    UEL_CRITICAL_ENTER_ON(signal->detail.signal.lock);
+    for(uel_llist_node_t *current = listeners->tail;
+        current != NULL && i < UEL_SIGNAL_MAX_LISTENERS;
+        current = current->next
+    ){
+        uel_event_t *listener = (uel_event_t *)current->value;
+        if(!listener->repeating || listener->detail.listener.unlistened){
+            uel_llist_remove(listeners, current);
+            removed_nodes[j++] = current;
+        }
+        if(!listener->detail.listener.unlistened){
+            closures[i++] = listener->closure;
+        }
+    }
+    UEL_CRITICAL_EXIT_ON(signal->detail.signal.lock);
+
+    for(unsigned int uel_closure_count = i, i = 0; i < uel_closure_count; i++){
+        uel_closure_t *closure = &closures[i];
+        UEL_PROFILED_INVOKE(closure, signal->value);
+    }
+    for(unsigned int node_count = j, j = 0; j < node_count; j++){
+        uel_event_t *event = removed_nodes[j]->value;
+        uel_syspools_release_event(event_loop->pools, event);
+        uel_syspools_release_llist_node(event_loop->pools, removed_nodes[j]);
+    }
+}
+
+static void *uel__event_loop_run_observer_event(void *context, void *params){
+    uel_evloop_t *event_loop = (uel_evloop_t *)context;
+    uel_llist_node_t *node = (uel_llist_node_t *)params;
+    uel_event_t *event = (uel_event_t *)node->value;
+    struct uel_event_observer *observer = &event->detail.observer;
+
+    if(!observer->cancelled){
+        // Observed values may be written from other threads
+        uintptr_t value = UEL_ATOMIC_LOAD(observer->condition_var, UEL_ATOMIC_ACQUIRE);
+
+        if(value != observer->last_value){
+            UEL_PROFILED_INVOKE(&event->closure, (void *)value);
+            observer->last_value = value;
+        }
+    }
+
+    if (observer->cancelled || !event->repeating) {
+        UEL_CRITICAL_ENTER_ON(&event_loop->observers_lock);
+        uel_llist_remove(&event_loop->observers, node);
+        UEL_CRITICAL_EXIT_ON(&event_loop->observers_lock);
+        uel_syspools_release_event(event_loop->pools, event);
+        uel_syspools_release_llist_node(event_loop->pools, node);
+    }
+
+    return (void *)true;
+}
+
+static void uel__event_loop_register_observer(uel_evloop_t *event_loop, uel_event_t *observer){
+    uel_llist_node_t *node = uel_syspools_acquire_llist_node(event_loop->pools);
+    node->value = (void *)observer;
+    UEL_CRITICAL_ENTER_ON(&event_loop->observers_lock);
+    uel_llist_push_head(&event_loop->observers, node);
+    UEL_CRITICAL_EXIT_ON(&event_loop->observers_lock);
+}
+
+UEL_API void uel_evloop_init(
+    uel_evloop_t *event_loop,
+    uel_syspools_t *pools,
+    uel_sysqueues_t *queues
+){
+    event_loop->pools = pools;
+    event_loop->queues = queues;
+    uel_llist_init(&event_loop->observers);
+    uel_lock_init(&event_loop->observers_lock);
+    event_loop->dispatched = 0;
+#ifdef UEL_ENABLE_LATENCY_STATS
+    event_loop->latency = NULL;
+#endif /* UEL_ENABLE_LATENCY_STATS */
+}
+
+UEL_API void uel_evloop_run(uel_evloop_t *event_loop){
+    uel_event_t *batch[UEL_SYSQUEUES_BATCH_SIZE];
+    uel_event_t *reschedule[UEL_SYSQUEUES_BATCH_SIZE];
+    uintptr_t count;
+    while((count = uel_sysqueues_get_enqueued_events(
+        event_loop->queues,
+        batch,
+        UEL_SYSQUEUES_BATCH_SIZE
+    )) > 0){
+        uintptr_t reschedule_count = 0;
+        event_loop->dispatched += count;
+        for(uintptr_t i = 0; i < count; i++){
+            uel_event_t *event = batch[i];
+#ifdef UEL_ENABLE_LATENCY_STATS
+            if(event_loop->latency != NULL){
+                uel_latency_record_queueing(event_loop->latency, event);
+            }
+#endif /* UEL_ENABLE_LATENCY_STATS */
+            UEL_TRACE(UEL_TRACE_DISPATCH_BEGIN, uel__event_loop_trace_subject(event), event->type);
+            bool keep = true;
+            switch(event->type){
+                case UEL_CLOSURE_EVENT:
+                    keep = uel__event_loop_run_closure_event(event_loop, event);
+                    break;
+                case UEL_TIMER_EVENT:
+                    keep = uel__event_loop_run_timer_event(event_loop, event, reschedule, &reschedule_count);
+                    break;
+                case UEL_SIGNAL_EVENT:
+                    uel__event_loop_run_signal_event(event_loop, event);
+                    keep = false;
+                    break;
+                default: break;
+            }
+            UEL_TRACE(UEL_TRACE_DISPATCH_END, uel__event_loop_trace_subject(event), event->type);
+            if(!keep){
+                uel_syspools_release_event(event_loop->pools, event);
+            }
+        }
+        uel_sysqueues_schedule_events(event_loop->queues, reschedule, reschedule_count);
+    }
+
+    uel_closure_t observe =
+        uel_closure_create(uel__event_loop_run_observer_event, (void *)event_loop);
+    uel_iterator_llist_t observer_it =
+        uel_iterator_llist_create(&event_loop->observers);
+    uel_iterator_foreach(&observer_it, &observe);
+}
+
+UEL_API void uel_evloop_enqueue_closure(
+    uel_evloop_t *event_loop,
+    uel_closure_t *closure,
+    void *value
+){
+    uel_event_t *event = uel_syspools_acquire_event(event_loop->pools);
+    uel_event_config_closure(event, closure, value, false);
+    uel_sysqueues_enqueue_event(event_loop->queues, event);
+}
+
+
+UEL_API uel_event_t *uel_evloop_observe(
+  uel_evloop_t *event_loop,
+  volatile uintptr_t *condition_var,
+  uel_closure_t *closure
+){
+    uel_event_t *observer = uel_syspools_acquire_event(event_loop->pools);
+    uel_event_config_observer(observer, closure, condition_var, true);
+    uel__event_loop_register_observer(event_loop, observer);
+
+    return observer;
+}
+
+UEL_API uel_event_t *uel_evloop_observe_once(
+  uel_evloop_t *event_loop,
+  volatile uintptr_t *condition_var,
+  uel_closure_t *closure
+){
+    uel_event_t *observer = uel_syspools_acquire_event(event_loop->pools);
+    uel_event_config_observer(observer, closure, condition_var, false);
+    uel__event_loop_register_observer(event_loop, observer);
+
+    return observer;
+}
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+UEL_API void uel_evloop_set_latency(uel_evloop_t *event_loop, uel_latency_t *latency){
+    event_loop->latency = latency;
+}
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+/* ---- src/system/event.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+UEL_API void uel_event_config_closure(
+    uel_event_t *event,
+    uel_closure_t *closure,
+    void *value,
+    bool repeating
+) {
+    event->type = UEL_CLOSURE_EVENT;
+    event->closure = *closure;
+    event->value = value;
+    event->repeating = repeating;
+}
+
+UEL_API void uel_event_config_signal(
+    uel_event_t *event,
+    uintptr_t signal,
+    uel_llist_t *listeners,
+    uel_lock_t *lock,
+    void *params
+){
+    event->closure = uel_closure_create(NULL, NULL);
+    event->type = UEL_SIGNAL_EVENT;
+    event->detail.signal.value = signal;
+    event->detail.signal.listeners = listeners;
+    event->detail.signal.lock = lock;
+    event->value = params;
+}
+
+UEL_API void uel_event_config_signal_listener(uel_event_t *event, uel_closure_t *closure, bool repeating){
+    event->type = UEL_SIGNAL_LISTENER_EVENT;
+    event->closure = *closure;
+    event->repeating = repeating;
+    event->detail.listener.unlistened = false;
+}
+
+UEL_API void uel_event_config_observer(
+    uel_event_t *event,
+    uel_closure_t *closure,
+    volatile uintptr_t *condition_var,
+    bool repeating
+){
+    event->type = UEL_OBSERVER_EVENT;
+    event->closure = *closure;
+    event->repeating = repeating;
+    event->detail.observer.last_value = *condition_var;
+    event->detail.observer.condition_var = condition_var;
+    event->detail.observer.cancelled = false;
+}
+
+UEL_API void uel_event_observer_cancel(uel_event_t *event){
+    event->detail.observer.cancelled = true;
+}
+
+UEL_API void uel_event_config_timer(
+    uel_event_t *event,
+    uel_timeout_t timeout,
+    bool repeating,
+    bool immediate,
+    uel_closure_t *closure,
+    void *value,
+    uel_time_t current_time
+) {
+    event->type = UEL_TIMER_EVENT;
+    event->closure = *closure;
+    event->value = value;
+    event->repeating = repeating;
+    event->detail.timer.due_time = immediate ?
+        current_time :
+        current_time + timeout;
+    event->detail.timer.expires_at = event->detail.timer.due_time;
+    event->detail.timer.timeout = timeout;
+    event->detail.timer.slack = 0;
+    event->detail.timer.overrun = UEL_TIMER_CATCH_UP;
+    event->detail.timer.missed = 0;
+    event->detail.timer.status = UEL_TIMER_RUNNING;
+}
+
+UEL_API void uel_event_timer_set_slack(uel_event_t *event, uel_timeout_t slack){
+    event->detail.timer.slack = slack;
+}
+
+UEL_API void uel_event_timer_set_overrun(uel_event_t *event, uel_event_timer_overrun_t overrun){
+    event->detail.timer.overrun = overrun;
+}
+
+UEL_API uint16_t uel_event_timer_get_missed(uel_event_t *event){
+    return event->detail.timer.missed;
+}
+
+UEL_API void uel_event_timer_pause(uel_event_t *event){
+    event->detail.timer.status = UEL_TIMER_PAUSED;
+}
+
+UEL_API void uel_event_timer_resume(uel_event_t *event){
+    event->detail.timer.status = UEL_TIMER_RUNNING;
+}
+
+UEL_API void uel_event_timer_cancel(uel_event_t *event){
+    event->detail.timer.status = UEL_TIMER_CANCELLED;
+}
+
+/* ---- src/system/latency.c ---- */
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+
+
+UEL_API void uel_latency_init(uel_latency_t *latency){
+    for(size_t i = 0; i < UEL_EVENT_TYPE_COUNT; i++){
+        uel_histogram_init(&latency->queueing_delay[i]);
+    }
+    uel_histogram_init(&latency->timer_lateness);
+}
+
+UEL_API void uel_latency_record_queueing(uel_latency_t *latency, uel_event_t *event){
+    uel_timestamp_t delay = uel_clock_now() - event->enqueued_at;
+    uel_histogram_record(&latency->queueing_delay[event->type], delay);
+}
+
+UEL_API void uel_latency_record_lateness(
+    uel_latency_t *latency,
+    uel_event_t *timer,
+    uel_time_t current_time
+){
+    uel_time_t lateness = current_time - timer->detail.timer.expires_at;
+    uel_histogram_record(
+        &latency->timer_lateness,
+        lateness > UINT32_MAX ? UINT32_MAX : (uint32_t)lateness
+    );
+}
+
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+/* ---- src/system/parallel-iterator.c ---- */
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+
+static void uel__parallel_iterator_find_in_chunk(uel_iterator_par_t *par, size_t start, size_t end){
+    for(size_t i = start; i < end; i++){
+        if(i >= UEL_ATOMIC_LOAD(&par->found, UEL_ATOMIC_RELAXED)) return;
+        if(uel_closure_invoke(&par->closure, par->collection + i * par->item_size)){
+            uintptr_t found = UEL_ATOMIC_LOAD(&par->found, UEL_ATOMIC_RELAXED);
+            while(i < found && !UEL_ATOMIC_CAS(&par->found, &found, i));
+            return;
+        }
+    }
+}
+
+static void uel__parallel_iterator_run_chunk(uel_iterator_par_t *par, size_t chunk){
+    size_t start = chunk * par->chunk_size;
+    size_t end = start + par->chunk_size;
+    if(end > par->item_count) end = par->item_count;
+
+    switch(par->operation){
+        case UEL_ITERATOR_PAR_MAP:
+            for(size_t i = start; i < end; i++){
+                par->destination[i] = uel_closure_invoke(
+                    &par->closure,
+                    par->collection + i * par->item_size
+                );
+            }
+            break;
+
+        case UEL_ITERATOR_PAR_COUNT: {
+            uintptr_t passed = 0;
+            for(size_t i = start; i < end; i++){
+                if(uel_closure_invoke(&par->closure, par->collection + i * par->item_size)){
+                    passed++;
+                }
+            }
+            UEL_ATOMIC_FETCH_ADD(&par->passed, passed, UEL_ATOMIC_RELAXED);
+            break;
+        }
+
+        case UEL_ITERATOR_PAR_FIND:
+            uel__parallel_iterator_find_in_chunk(par, start, end);
+            break;
+    }
+}
+
+// Claims and runs chunks until there are none left. Chunk numbers keep growing
+// across operations, so helpers left over from a finished operation can never
+// claim a chunk before the next operation is fully set up.
+static void uel__parallel_iterator_run_chunks(uel_iterator_par_t *par){
+    while(1){
+        uintptr_t end = UEL_ATOMIC_LOAD(&par->end_chunk, UEL_ATOMIC_ACQUIRE);
+        uintptr_t chunk = UEL_ATOMIC_LOAD(&par->next_chunk, UEL_ATOMIC_ACQUIRE);
+        if(chunk >= end) return;
+        if(!UEL_ATOMIC_CAS(&par->next_chunk, &chunk, chunk + 1)) continue;
+
+        uel__parallel_iterator_run_chunk(par, chunk - par->first_chunk);
+        UEL_ATOMIC_FETCH_ADD(&par->pending, (uintptr_t)-1, UEL_ATOMIC_RELEASE);
+    }
+}
+
+static void *uel__parallel_iterator_help(void *context, void *params){
+    uel__parallel_iterator_run_chunks((uel_iterator_par_t *)context);
+    return NULL;
+}
+
+static void uel__parallel_iterator_run_operation(
+    uel_iterator_par_t *par,
+    uel_iterator_par_operation_t operation,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure,
+    size_t count
+){
+    // Nothing can be claimed until `end_chunk` is moved forward
+    par->operation = operation;
+    par->collection = (char *)iterator->base.collection;
+    par->item_count = count;
+    par->item_size = iterator->item_size;
+    par->closure = *closure;
+    par->passed = 0;
+    par->found = UINTPTR_MAX;
+
+    uintptr_t chunk_count = (count + par->chunk_size - 1) / par->chunk_size;
+    par->pending = chunk_count;
+    par->first_chunk = UEL_ATOMIC_LOAD(&par->next_chunk, UEL_ATOMIC_ACQUIRE);
+    UEL_ATOMIC_STORE(&par->end_chunk, par->first_chunk + chunk_count, UEL_ATOMIC_RELEASE);
+
+    size_t helpers = chunk_count - 1;
+    if(helpers > par->group->count) helpers = par->group->count;
+    for(size_t i = 0; i < helpers; i++){
+        if(!uel_workgroup_enqueue_closure(par->group, &par->helper, NULL, UEL_WORKGROUP_ANY)){
+            break;
+        }
+    }
+
+    uel__parallel_iterator_run_chunks(par);
+    while(UEL_ATOMIC_LOAD(&par->pending, UEL_ATOMIC_ACQUIRE) != 0){
+        UEL_LOCK_RELAX();
+    }
+}
+
+UEL_API void uel_iterator_par_init(
+    uel_iterator_par_t *par,
+    uel_workgroup_t *group,
+    size_t chunk_size
+){
+    par->group = group;
+    par->chunk_size = chunk_size != 0 ? chunk_size : UEL_ITERATOR_PAR_CHUNK_SIZE;
+    par->helper = uel_closure_create(uel__parallel_iterator_help, (void *)par);
+    par->next_chunk = 0;
+    par->first_chunk = 0;
+    par->end_chunk = 0;
+    par->pending = 0;
+}
+
+UEL_API size_t uel_iterator_par_map(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure,
+    void **destination,
+    size_t limit
+){
+    size_t count = iterator->item_count < limit ? iterator->item_count : limit;
+    if(count == 0) return 0;
+
+    par->destination = destination;
+    uel__parallel_iterator_run_operation(par, UEL_ITERATOR_PAR_MAP, iterator, closure, count);
+    return count;
+}
+
+UEL_API size_t uel_iterator_par_count(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+){
+    if(iterator->item_count == 0) return 0;
+
+    uel__parallel_iterator_run_operation(par, UEL_ITERATOR_PAR_COUNT, iterator, closure, iterator->item_count);
+    return UEL_ATOMIC_LOAD(&par->passed, UEL_ATOMIC_ACQUIRE);
+}
+
+UEL_API void *uel_iterator_par_find(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+){
+    if(iterator->item_count == 0) return NULL;
+
+    uel__parallel_iterator_run_operation(par, UEL_ITERATOR_PAR_FIND, iterator, closure, iterator->item_count);
+    uintptr_t found = UEL_ATOMIC_LOAD(&par->found, UEL_ATOMIC_ACQUIRE);
+    if(found == UINTPTR_MAX) return NULL;
+    return par->collection + found * par->item_size;
+}
+
+UEL_API bool uel_iterator_par_any(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+){
+    return uel_iterator_par_find(par, iterator, closure) != NULL;
+}
+
+/* ---- src/system/scheduler.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+
+static void *uel__scheduler_is_past_due_time(void *context, void *params){
+    uel_time_t current_time = *(uel_time_t *)context;
+    uel_llist_node_t *node = (uel_llist_node_t *)params;
+    uel_event_t *event = (uel_event_t *)node->value;
+    bool fit_for_removal = event->detail.timer.expires_at <= current_time;
+    return (void *)fit_for_removal;
+}
+
+static void *uel__scheduler_place_in_order(void *context, void *params){
+    uel_time_t expires_at = *(uel_time_t *)context;
+    uel_llist_node_t **nodes = (uel_llist_node_t **)params;
+
+    bool fits = false;
+    if(nodes[1] == NULL){
+        fits = true;
+    }else if(nodes[0] == NULL){
+        uel_event_t *next = (uel_event_t *)nodes[1]->value;
+        fits = next->detail.timer.expires_at > expires_at;
+    }else{
+        uel_event_t *prev = (uel_event_t *)nodes[0]->value;
+        uel_event_t *next = (uel_event_t *)nodes[1]->value;
+
+        fits = prev->detail.timer.expires_at <= expires_at &&
+            next->detail.timer.expires_at > expires_at;
+    }
+
+    return (void *)(uintptr_t)fits;
+}
+
+// Defers a timer to expire together with the earliest timer already scheduled
+// within its slack window, if any. The nominal due time is kept so recurring
+// timers stay on their own period grid.
+static void uel__scheduler_coalesce_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    detail->expires_at = detail->due_time;
+    if(detail->slack == 0) return;
+
+    uel_time_t latest = detail->due_time + detail->slack;
+    for(uel_llist_node_t *current = scheduler->timer_list.tail;
+        current != NULL;
+        current = current->next
+    ){
+        uel_time_t expires_at = ((uel_event_t *)current->value)->detail.timer.expires_at;
+        if(expires_at > latest) break;
+        if(expires_at >= detail->due_time){
+            detail->expires_at = expires_at;
+            break;
+        }
+    }
+}
+
+// Counts the period boundaries of a recurring timer that lie between its due
+// time (exclusive) and the current time (inclusive)
+static inline uel_time_t uel__scheduler_count_overdue_periods(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    if(!timer->repeating || detail->timeout == 0) return 0;
+    if(detail->due_time > scheduler->timer) return 0;
+    return (scheduler->timer - detail->due_time) / detail->timeout;
+}
+
+static inline void uel__scheduler_skip_periods(struct uel_event_timer *detail, uel_time_t periods){
+    detail->due_time += periods * detail->timeout;
+    detail->missed = periods > UINT16_MAX ? UINT16_MAX : (uint16_t)periods;
+}
+
+// Skipping timers that come back from the event loop already late drop every
+// period up to the current time
+static void uel__scheduler_skip_missed_periods(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    if(detail->overrun != UEL_TIMER_SKIP) return;
+    if(!timer->repeating || detail->due_time > scheduler->timer){
+        detail->missed = 0;
+        return;
+    }
+    uel__scheduler_skip_periods(detail, uel__scheduler_count_overdue_periods(scheduler, timer) + 1);
+}
+
+// Coalescing timers that expire late fold every missed period into this expiration
+static void uel__scheduler_coalesce_missed_periods(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    if(detail->overrun != UEL_TIMER_COALESCE) return;
+    uel__scheduler_skip_periods(detail, uel__scheduler_count_overdue_periods(scheduler, timer));
+}
+
+static void uel__scheduler_enqueue_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    uel__scheduler_skip_missed_periods(scheduler, timer);
+    uel__scheduler_coalesce_timer(scheduler, timer);
+    uel_llist_node_t *node = uel_syspools_acquire_llist_node(scheduler->pools);
+    node->value = (void *)timer;
+    uel_closure_t in_order = uel_closure_create(
+        uel__scheduler_place_in_order,
+        (void *)&timer->detail.timer.expires_at
+    );
+    uel_llist_insert_at(&scheduler->timer_list, node, &in_order);
+}
+
+static void uel__scheduler_reschedule_resumed_timers(uel_scheduer_t *scheduler){
+    uel_llist_node_t *current = scheduler->pause_list.tail;
+    while(current != NULL){
+        uel_event_t *timer = (uel_event_t *)current->value;
+        if (timer->detail.timer.status != UEL_TIMER_PAUSED) {
+            uel_llist_remove(&scheduler->pause_list, current);
+            timer->detail.timer.due_time =
+                scheduler->timer + timer->detail.timer.timeout;
+            uel__scheduler_coalesce_timer(scheduler, timer);
+            uel_closure_t in_order = uel_closure_create(
+                uel__scheduler_place_in_order,
+                (void *)&timer->detail.timer.expires_at
+            );
+            uel_llist_insert_at(&scheduler->timer_list, current, &in_order);
+        }
+        current = current->next;
+    }
+}
+
+static void uel__scheduler_enqueue_expired_timers(uel_scheduer_t *scheduler){
+    uel_closure_t closure =
+        uel_closure_create(&uel__scheduler_is_past_due_time, (void *)&scheduler->timer);
+    uel_llist_t expired_timers = uel_llist_remove_while(&scheduler->timer_list, &closure);
+    uel_llist_node_t *current = expired_timers.tail;
+    uel_event_t *batch[UEL_SYSQUEUES_BATCH_SIZE];
+    uintptr_t count = 0;
+    while(current != NULL){
+        uel_event_t *timer = (uel_event_t *)current->value;
+        if (timer->detail.timer.status == UEL_TIMER_PAUSED) {
+            uel_llist_push_head(&scheduler->pause_list, current);
+        }else{
+            UEL_TRACE(
+                UEL_TRACE_TIMER_EXPIRED,
+                timer->closure.function,
+                timer->detail.timer.due_time
+            );
+#ifdef UEL_ENABLE_LATENCY_STATS
+            if(scheduler->latency != NULL){
+                uel_latency_record_lateness(scheduler->latency, timer, scheduler->timer);
+            }
+#endif /* UEL_ENABLE_LATENCY_STATS */
+            uel__scheduler_coalesce_missed_periods(scheduler, timer);
+            uel_syspools_release_llist_node(scheduler->pools, current);
+            batch[count++] = timer;
+            if(count == UEL_SYSQUEUES_BATCH_SIZE){
+                uel_sysqueues_enqueue_events(scheduler->queues, batch, count);
+                count = 0;
+            }
+        }
+        current = current->next;
+    }
+    uel_sysqueues_enqueue_events(scheduler->queues, batch, count);
+}
+
+UEL_API void uel_sch_init(
+    uel_scheduer_t *scheduler,
+    uel_syspools_t *pools,
+    uel_sysqueues_t *queues
+){
+    uel_llist_init(&scheduler->timer_list);
+    uel_llist_init(&scheduler->pause_list);
+    scheduler->pools = pools;
+    scheduler->queues = queues;
+    scheduler->timer = 0;
+#ifdef UEL_ENABLE_LATENCY_STATS
+    scheduler->latency = NULL;
+#endif /* UEL_ENABLE_LATENCY_STATS */
+}
+
+UEL_API uel_event_t *uel_sch_run_later(
+    uel_scheduer_t *scheduler,
+    uel_timeout_t timeout,
+    uel_closure_t closure,
+    void *value
+){
+    uel_event_t *event = uel_syspools_acquire_event(scheduler->pools);
+    uel_event_config_timer(event, timeout, false, false, &closure,
+                                                    value, scheduler->timer);
+                                                    
+    uel_sysqueues_schedule_event(scheduler->queues, event);
+    return event;
+}
+
+UEL_API uel_event_t *uel_sch_run_at_intervals(
+    uel_scheduer_t *scheduler,
+    uel_timeout_t interval,
+    bool immediate,
+    uel_closure_t closure,
+    void *value
+){
+    uel_event_t *event = uel_syspools_acquire_event(scheduler->pools);
+    uel_event_config_timer(event, interval, true, immediate, &closure,
+                                                    value, scheduler->timer);
+                                                    
+    if(immediate){
+        uel_sysqueues_enqueue_event(scheduler->queues, event);
+    }else{
+        uel_sysqueues_schedule_event(scheduler->queues, event);
+    }
+    return event;
+}
+
+UEL_API void uel_sch_manage_timers(uel_scheduer_t *scheduler){
+    uel_event_t *batch[UEL_SYSQUEUES_BATCH_SIZE];
+    uintptr_t count;
+    while((count = uel_sysqueues_get_scheduled_events(
+        scheduler->queues,
+        batch,
+        UEL_SYSQUEUES_BATCH_SIZE
+    )) > 0){
+        for(uintptr_t i = 0; i < count; i++){
+            uel__scheduler_enqueue_timer(scheduler, batch[i]);
+        }
+    }
+
+    uel__scheduler_reschedule_resumed_timers(scheduler);
+    uel__scheduler_enqueue_expired_timers(scheduler);
+}
+
+UEL_API bool uel_sch_next_deadline(uel_scheduer_t *scheduler, uel_time_t *deadline){
+    uel_llist_node_t *next = scheduler->timer_list.tail;
+    if(next == NULL) return false;
+
+    *deadline = ((uel_event_t *)next->value)->detail.timer.expires_at;
+    return true;
+}
+
+UEL_API void uel_sch_update_timer(uel_scheduer_t *scheduler, uel_time_t timer){
+    scheduler->timer = timer;
+}
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+UEL_API void uel_sch_set_latency(uel_scheduer_t *scheduler, uel_latency_t *latency){
+    scheduler->latency = latency;
+}
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+/* ---- src/system/signal.c ---- */
+
+/// \cond
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+
+static void uel__signal_register_listener(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_event_t *listener
+){
+    uel_llist_t *listeners = &relay->signal_vector[signal];
+    uel_llist_node_t *node = uel_syspools_acquire_llist_node(relay->pools);
+    node->value = (void *)listener;
+
+    UEL_CRITICAL_ENTER_ON(&relay->lock);
+    uel_llist_push_head(listeners, node);
+    UEL_CRITICAL_EXIT_ON(&relay->lock);
+}
+
+UEL_API void uel_signal_relay_init(
+    uel_signal_relay_t *relay,
+    uel_syspools_t *pools,
+    uel_sysqueues_t *queues,
+    uel_llist_t *buffer,
+    uintptr_t width
+){
+    relay->pools = pools;
+    relay->queues = queues;
+    relay->signal_vector = buffer;
+    relay->width = width;
+    uel_lock_init(&relay->lock);
+
+    for (uintptr_t i = 0; i < width; i++) {
+        uel_llist_init(&relay->signal_vector[i]);
+    }
+}
+UEL_API uel_signal_listener_t uel_signal_listen(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+){
+    uel_event_t *listener = uel_syspools_acquire_event(relay->pools);
+    uel_event_config_signal_listener(listener, closure, true);
+    uel__signal_register_listener(signal, relay, listener);
+    return &listener->detail.listener;
+}
+UEL_API uel_signal_listener_t uel_signal_listen_once(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+){
+    uel_event_t *listener = uel_syspools_acquire_event(relay->pools);
+    uel_event_config_signal_listener(listener, closure, false);
+    uel__signal_register_listener(signal, relay, listener);
+    return &listener->detail.listener;
+}
+
+UEL_API void uel_signal_unlisten(uel_signal_listener_t listener){
+    listener->unlistened = true;
+}
+
+UEL_API void uel_signal_emit(uel_signal_t signal, uel_signal_relay_t *relay, void *params){
+    UEL_TRACE(UEL_TRACE_SIGNAL_EMITTED, signal, relay);
+    uel_llist_t *listeners = &relay->signal_vector[signal];
+    bool has_listeners = false;
+    UEL_CRITICAL_ENTER_ON(&relay->lock);
+    has_listeners = listeners->count > 0;
+    UEL_CRITICAL_EXIT_ON(&relay->lock);
+    if (has_listeners) {
+        uel_event_t *event = uel_syspools_acquire_event(relay->pools);
+        uel_event_config_signal(event, signal, listeners, &relay->lock, params);
+        uel_sysqueues_enqueue_event(relay->queues, event);
+    }
+}
+
+UEL_API uel_signal_listener_t uel_signal_resolve_promise(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_promise_t *promise
+) {
+    uel_closure_t resolver = uel_promise_resolver(promise);
+    return uel_signal_listen_once(signal, relay, &resolver);
+}
+
+
+UEL_API uel_signal_listener_t uel_signal_reject_promise(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_promise_t *promise
+) {
+    uel_closure_t rejecter = uel_promise_rejecter(promise);
+    return uel_signal_listen_once(signal, relay, &rejecter);
+}
+
+/* ---- src/system/simulation.c ---- */
+
+static inline bool uel__simulation_is_idle(uel_application_t *app){
+    return uel_sysqueues_count_enqueued_events(&app->queues) == 0 &&
+        uel_sysqueues_count_scheduled_events(&app->queues) == 0;
+}
+
+static void uel__simulation_record_step(uel_sim_t *sim, uintptr_t events){
+    if(sim->schedule != NULL && sim->steps < sim->capacity){
+        uel_sim_step_t *step = &sim->schedule[sim->steps];
+        step->time = sim->app->scheduler.timer;
+        step->events = events;
+    }
+    sim->steps++;
+}
+
+UEL_API void uel_sim_init(
+    uel_sim_t *sim,
+    uel_application_t *app,
+    uel_sim_step_t *schedule,
+    size_t capacity
+){
+    sim->app = app;
+    sim->schedule = schedule;
+    sim->capacity = capacity;
+    sim->steps = 0;
+    sim->events = 0;
+    sim->start_time = app->scheduler.timer;
+    sim->busy = 0;
+}
+
+UEL_API uintptr_t uel_sim_run_until_idle(uel_sim_t *sim){
+    uel_application_t *app = sim->app;
+    uintptr_t dispatched = app->event_loop.dispatched;
+    uel_timestamp_t started_at = uel_clock_now();
+
+    do{
+        // Timers rescheduled by the last runloop must be managed right away
+        app->run_scheduler = true;
+        uel_app_tick(app);
+    } while(!uel__simulation_is_idle(app));
+
+    uintptr_t events = app->event_loop.dispatched - dispatched;
+    sim->busy += uel_clock_now() - started_at;
+    sim->events += events;
+    return events;
+}
+
+UEL_API bool uel_sim_step(uel_sim_t *sim){
+    uel_time_t deadline;
+    uel_sim_run_until_idle(sim);
+    if(!uel_sch_next_deadline(&sim->app->scheduler, &deadline)) return false;
+
+    if(deadline > sim->app->scheduler.timer){
+        uel_app_update_timer(sim->app, deadline);
+    }
+    uel__simulation_record_step(sim, uel_sim_run_until_idle(sim));
+    return true;
+}
+
+UEL_API void uel_sim_run_until(uel_sim_t *sim, uel_time_t end){
+    uel_time_t deadline;
+    uel_sim_run_until_idle(sim);
+    while(uel_sch_next_deadline(&sim->app->scheduler, &deadline) && deadline <= end){
+        uel_sim_step(sim);
+    }
+    if(end > sim->app->scheduler.timer){
+        uel_app_update_timer(sim->app, end);
+    }
+    uel_sim_run_until_idle(sim);
+}
+
+UEL_API uint64_t uel_sim_throughput(uel_sim_t *sim){
+    uel_time_t elapsed = sim->app->scheduler.timer - sim->start_time;
+    if(elapsed == 0) return 0;
+    return (uint64_t)sim->events * UEL_SCH_TICKS_PER_SECOND / elapsed;
+}
+
+/* ---- src/utils/arena.c ---- */
+
+UEL_API void uel_arena_init(uel_arena_t *arena, uint8_t *buffer, size_t size){
+    arena->buffer = buffer;
+    arena->size = size;
+    arena->used = 0;
+    arena->peak = 0;
+}
+
+UEL_API void *uel_arena_alloc(uel_arena_t *arena, size_t size, size_t align){
+    if(align == 0) align = 1;
+    uintptr_t address = (uintptr_t)(arena->buffer + arena->used);
+    size_t padding = (size_t)(-address & (align - 1));
+    size_t available = arena->size - arena->used;
+    if(padding > available || size > available - padding) return NULL;
+
+    void *memory = arena->buffer + arena->used + padding;
+    arena->used += padding + size;
+    if(arena->used > arena->peak) arena->peak = arena->used;
+    return memory;
+}
+
+UEL_API void uel_arena_reset(uel_arena_t *arena){
+    arena->used = 0;
+}
+
+UEL_API size_t uel_arena_count_available(uel_arena_t *arena){
+    return arena->size - arena->used;
+}
+
+/* ---- src/utils/array-kernels.c ---- */
+
+#if !defined(UEL_ARRAY_NO_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UEL_ARRAY_AVX2
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define UEL_ARRAY_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define UEL_ARRAY_NEON
+#endif
+#endif
+
+// Each kernel tests `((element ^ bias) - low) <= span`, wrapped to the element
+// width. Vector loops handle whole blocks; `find` loops stop at the first block
+// holding a match and leave locating it to the scalar loop.
+
+static size_t uel__array_kernels_count8(const uint8_t *array, size_t count, uint8_t bias, uint8_t low, uint8_t span){
+    size_t i = 0, passed = 0;
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi8((char)bias);
+    __m256i low32 = _mm256_set1_epi8((char)low);
+    __m256i span32 = _mm256_set1_epi8((char)span);
+    for(; i + 32 <= count; i += 32){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_sub_epi8(_mm256_xor_si256(x, bias32), low32);
+        __m256i in = _mm256_cmpeq_epi8(_mm256_min_epu8(x, span32), x);
+        passed += __builtin_popcount((uint32_t)_mm256_movemask_epi8(in));
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi8((char)bias);
+    __m128i low16 = _mm_set1_epi8((char)low);
+    __m128i span16 = _mm_set1_epi8((char)span);
+    for(; i + 16 <= count; i += 16){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_sub_epi8(_mm_xor_si128(x, bias16), low16);
+        __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(x, span16), x);
+        passed += __builtin_popcount(_mm_movemask_epi8(in));
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint8x16_t bias16 = vdupq_n_u8(bias), low16 = vdupq_n_u8(low), span16 = vdupq_n_u8(span);
+    for(; i + 16 <= count; i += 16){
+        uint8x16_t x = vsubq_u8(veorq_u8(vld1q_u8(array + i), bias16), low16);
+        passed += vaddvq_u8(vshrq_n_u8(vcleq_u8(x, span16), 7));
+    }
+#endif
+    for(; i < count; i++){
+        passed += (uint8_t)((array[i] ^ bias) - low) <= span;
+    }
+    return passed;
+}
+
+static size_t uel__array_kernels_find8(const uint8_t *array, size_t count, uint8_t bias, uint8_t low, uint8_t span, bool pass){
+    size_t i = 0;
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi8((char)bias);
+    __m256i low32 = _mm256_set1_epi8((char)low);
+    __m256i span32 = _mm256_set1_epi8((char)span);
+    uint32_t expected = pass ? 0 : UINT32_MAX;
+    for(; i + 32 <= count; i += 32){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_sub_epi8(_mm256_xor_si256(x, bias32), low32);
+        __m256i in = _mm256_cmpeq_epi8(_mm256_min_epu8(x, span32), x);
+        if((uint32_t)_mm256_movemask_epi8(in) != expected) break;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi8((char)bias);
+    __m128i low16 = _mm_set1_epi8((char)low);
+    __m128i span16 = _mm_set1_epi8((char)span);
+    int expected16 = pass ? 0 : 0xFFFF;
+    for(; i + 16 <= count; i += 16){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_sub_epi8(_mm_xor_si128(x, bias16), low16);
+        __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(x, span16), x);
+        if(_mm_movemask_epi8(in) != expected16) break;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint8x16_t bias16 = vdupq_n_u8(bias), low16 = vdupq_n_u8(low), span16 = vdupq_n_u8(span);
+    for(; i + 16 <= count; i += 16){
+        uint8x16_t x = vsubq_u8(veorq_u8(vld1q_u8(array + i), bias16), low16);
+        uint8x16_t in = vcleq_u8(x, span16);
+        if(vmaxvq_u8(pass ? in : vmvnq_u8(in)) != 0) break;
+    }
+#endif
+    for(; i < count; i++){
+        if(((uint8_t)((array[i] ^ bias) - low) <= span) == pass) return i;
+    }
+    return count;
+}
+
+static size_t uel__array_kernels_count16(const uint16_t *array, size_t count, uint16_t bias, uint16_t low, uint16_t span){
+    size_t i = 0, passed = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    // There are no unsigned 16 bit comparisons, so values are flipped around
+    // the sign bit and compared as signed ones
+    uint16_t flip = 0x8000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi16((short)bias);
+    __m256i low32 = _mm256_set1_epi16((short)low);
+    __m256i flip32 = _mm256_set1_epi16((short)flip);
+    __m256i span32 = _mm256_set1_epi16((short)(span ^ flip));
+    for(; i + 16 <= count; i += 16){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi16(_mm256_xor_si256(x, bias32), low32), flip32);
+        uint32_t out = (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi16(x, span32));
+        passed += __builtin_popcount(~out) / 2;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi16((short)bias);
+    __m128i low16 = _mm_set1_epi16((short)low);
+    __m128i flip16 = _mm_set1_epi16((short)flip);
+    __m128i span16 = _mm_set1_epi16((short)(span ^ flip));
+    for(; i + 8 <= count; i += 8){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi16(_mm_xor_si128(x, bias16), low16), flip16);
+        int out = _mm_movemask_epi8(_mm_cmpgt_epi16(x, span16));
+        passed += __builtin_popcount(~out & 0xFFFF) / 2;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint16x8_t bias16 = vdupq_n_u16(bias), low16 = vdupq_n_u16(low), span16 = vdupq_n_u16(span);
+    for(; i + 8 <= count; i += 8){
+        uint16x8_t x = vsubq_u16(veorq_u16(vld1q_u16(array + i), bias16), low16);
+        passed += vaddvq_u16(vshrq_n_u16(vcleq_u16(x, span16), 15));
+    }
+#endif
+    for(; i < count; i++){
+        passed += (uint16_t)((array[i] ^ bias) - low) <= span;
+    }
+    return passed;
+}
+
+static size_t uel__array_kernels_find16(const uint16_t *array, size_t count, uint16_t bias, uint16_t low, uint16_t span, bool pass){
+    size_t i = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    uint16_t flip = 0x8000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi16((short)bias);
+    __m256i low32 = _mm256_set1_epi16((short)low);
+    __m256i flip32 = _mm256_set1_epi16((short)flip);
+    __m256i span32 = _mm256_set1_epi16((short)(span ^ flip));
+    uint32_t expected = pass ? UINT32_MAX : 0;
+    for(; i + 16 <= count; i += 16){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi16(_mm256_xor_si256(x, bias32), low32), flip32);
+        if((uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi16(x, span32)) != expected) break;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi16((short)bias);
+    __m128i low16 = _mm_set1_epi16((short)low);
+    __m128i flip16 = _mm_set1_epi16((short)flip);
+    __m128i span16 = _mm_set1_epi16((short)(span ^ flip));
+    int expected16 = pass ? 0xFFFF : 0;
+    for(; i + 8 <= count; i += 8){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi16(_mm_xor_si128(x, bias16), low16), flip16);
+        if(_mm_movemask_epi8(_mm_cmpgt_epi16(x, span16)) != expected16) break;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint16x8_t bias16 = vdupq_n_u16(bias), low16 = vdupq_n_u16(low), span16 = vdupq_n_u16(span);
+    for(; i + 8 <= count; i += 8){
+        uint16x8_t x = vsubq_u16(veorq_u16(vld1q_u16(array + i), bias16), low16);
+        uint16x8_t in = vcleq_u16(x, span16);
+        if(vmaxvq_u16(pass ? in : vmvnq_u16(in)) != 0) break;
+    }
+#endif
+    for(; i < count; i++){
+        if(((uint16_t)((array[i] ^ bias) - low) <= span) == pass) return i;
+    }
+    return count;
+}
+
+static size_t uel__array_kernels_count32(const uint32_t *array, size_t count, uint32_t bias, uint32_t low, uint32_t span){
+    size_t i = 0, passed = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    uint32_t flip = 0x80000000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi32((int)bias);
+    __m256i low32 = _mm256_set1_epi32((int)low);
+    __m256i flip32 = _mm256_set1_epi32((int)flip);
+    __m256i span32 = _mm256_set1_epi32((int)(span ^ flip));
+    for(; i + 8 <= count; i += 8){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi32(_mm256_xor_si256(x, bias32), low32), flip32);
+        uint32_t out = (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi32(x, span32));
+        passed += __builtin_popcount(~out) / 4;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi32((int)bias);
+    __m128i low16 = _mm_set1_epi32((int)low);
+    __m128i flip16 = _mm_set1_epi32((int)flip);
+    __m128i span16 = _mm_set1_epi32((int)(span ^ flip));
+    for(; i + 4 <= count; i += 4){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi32(_mm_xor_si128(x, bias16), low16), flip16);
+        int out = _mm_movemask_epi8(_mm_cmpgt_epi32(x, span16));
+        passed += __builtin_popcount(~out & 0xFFFF) / 4;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint32x4_t bias16 = vdupq_n_u32(bias), low16 = vdupq_n_u32(low), span16 = vdupq_n_u32(span);
+    for(; i + 4 <= count; i += 4){
+        uint32x4_t x = vsubq_u32(veorq_u32(vld1q_u32(array + i), bias16), low16);
+        passed += vaddvq_u32(vshrq_n_u32(vcleq_u32(x, span16), 31));
+    }
+#endif
+    for(; i < count; i++){
+        passed += (uint32_t)((array[i] ^ bias) - low) <= span;
+    }
+    return passed;
+}
+
+static size_t uel__array_kernels_find32(const uint32_t *array, size_t count, uint32_t bias, uint32_t low, uint32_t span, bool pass){
+    size_t i = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    uint32_t flip = 0x80000000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi32((int)bias);
+    __m256i low32 = _mm256_set1_epi32((int)low);
+    __m256i flip32 = _mm256_set1_epi32((int)flip);
+    __m256i span32 = _mm256_set1_epi32((int)(span ^ flip));
+    uint32_t expected = pass ? UINT32_MAX : 0;
+    for(; i + 8 <= count; i += 8){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi32(_mm256_xor_si256(x, bias32), low32), flip32);
+        if((uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi32(x, span32)) != expected) break;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi32((int)bias);
+    __m128i low16 = _mm_set1_epi32((int)low);
+    __m128i flip16 = _mm_set1_epi32((int)flip);
+    __m128i span16 = _mm_set1_epi32((int)(span ^ flip));
+    int expected16 = pass ? 0xFFFF : 0;
+    for(; i + 4 <= count; i += 4){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi32(_mm_xor_si128(x, bias16), low16), flip16);
+        if(_mm_movemask_epi8(_mm_cmpgt_epi32(x, span16)) != expected16) break;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint32x4_t bias16 = vdupq_n_u32(bias), low16 = vdupq_n_u32(low), span16 = vdupq_n_u32(span);
+    for(; i + 4 <= count; i += 4){
+        uint32x4_t x = vsubq_u32(veorq_u32(vld1q_u32(array + i), bias16), low16);
+        uint32x4_t in = vcleq_u32(x, span16);
+        if(vmaxvq_u32(pass ? in : vmvnq_u32(in)) != 0) break;
+    }
+#endif
+    for(; i < count; i++){
+        if(((uint32_t)((array[i] ^ bias) - low) <= span) == pass) return i;
+    }
+    return count;
+}
+
+// Finds the index of the first element whose test result equals `pass`
+static size_t uel__array_kernels_find_index(const uel_array_filter_t *filter, const void *array, size_t count, bool pass){
+    switch(filter->width){
+        case 1:
+            return uel__array_kernels_find8((const uint8_t *)array, count,
+                (uint8_t)filter->bias, (uint8_t)filter->low, (uint8_t)filter->span, pass);
+        case 2:
+            return uel__array_kernels_find16((const uint16_t *)array, count,
+                (uint16_t)filter->bias, (uint16_t)filter->low, (uint16_t)filter->span, pass);
+        default:
+            return uel__array_kernels_find32((const uint32_t *)array, count,
+                filter->bias, filter->low, filter->span, pass);
+    }
+}
+
+UEL_API size_t uel_array_filter_count(const uel_array_filter_t *filter, const void *array, size_t count){
+    if(filter->empty) return 0;
+    switch(filter->width){
+        case 1:
+            return uel__array_kernels_count8((const uint8_t *)array, count,
+                (uint8_t)filter->bias, (uint8_t)filter->low, (uint8_t)filter->span);
+        case 2:
+            return uel__array_kernels_count16((const uint16_t *)array, count,
+                (uint16_t)filter->bias, (uint16_t)filter->low, (uint16_t)filter->span);
+        default:
+            return uel__array_kernels_count32((const uint32_t *)array, count,
+                filter->bias, filter->low, filter->span);
+    }
+}
+
+UEL_API void *uel_array_filter_find(const uel_array_filter_t *filter, const void *array, size_t count){
+    if(filter->empty) return NULL;
+    size_t index = uel__array_kernels_find_index(filter, array, count, true);
+    if(index == count) return NULL;
+    return (char *)array + index * filter->width;
+}
+
+UEL_API bool uel_array_filter_any(const uel_array_filter_t *filter, const void *array, size_t count){
+    return uel_array_filter_find(filter, array, count) != NULL;
+}
+
+UEL_API bool uel_array_filter_all(const uel_array_filter_t *filter, const void *array, size_t count){
+    if(filter->empty) return count == 0;
+    return uel__array_kernels_find_index(filter, array, count, false) == count;
+}
+
+/* ---- src/utils/automatic-pool.c ---- */
+
+UEL_API void uel_autoptr_dealloc(uel_autoptr_t autoptr) {
+    struct uel_autoptr *ptr = (struct uel_autoptr *)autoptr;
+    uel_closure_invoke(&ptr->source->destructor, *autoptr);
+    uel_objpool_release(&ptr->source->autoptr_pool, autoptr);
+}
+
+UEL_API void uel_autopool_init(
+    uel_autopool_t *pool,
+    size_t size_log2n,
+    size_t item_size,
+    uint8_t *object_buffer,
+    struct uel_autoptr *autoptr_buffer,
+    void **queue_buffer
+){
+    pool->object_buffer = object_buffer;
+    pool->item_size = item_size;
+    uel_objpool_init(
+        &pool->autoptr_pool,
+        size_log2n,
+        sizeof(struct uel_autoptr),
+        (uint8_t *)autoptr_buffer,
+        queue_buffer
+    );
+    pool->constructor = uel_nop();
+    pool->destructor = uel_nop();
+}
+
+UEL_API uel_autoptr_t uel_autopool_alloc(uel_autopool_t *pool){
+    struct uel_autoptr *autoptr =
+        (struct uel_autoptr *)uel_objpool_acquire(&pool->autoptr_pool);
+    if(autoptr == NULL) return NULL;
+
+    // Autopointers are bound to their objects when acquired, so
+    // initialisation does not have to visit each of them
+    size_t index = autoptr - (struct uel_autoptr *)pool->autoptr_pool.buffer;
+    autoptr->object = (void *)(pool->object_buffer + index * pool->item_size);
+    autoptr->source = pool;
+    uel_closure_invoke(&pool->constructor, autoptr->object);
+    return (uel_autoptr_t)autoptr;
+}
+
+UEL_API bool uel_autopool_is_empty(uel_autopool_t *pool){
+    return uel_objpool_is_empty(&pool->autoptr_pool);
+}
+
+UEL_API void uel_autopool_set_constructor(uel_autopool_t *pool, uel_closure_t constructor) {
+    pool->constructor = constructor;
+}
+
+UEL_API void uel_autopool_set_destructor(uel_autopool_t *pool, uel_closure_t destructor) {
+    pool->destructor = destructor;
+}
+
+/* ---- src/utils/circular-queue.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+UEL_API void uel_cqueue_init(uel_cqueue_t *queue, void **buffer, uintptr_t size_log2n){
+    queue->buffer = buffer;
+    queue->size = 1<<size_log2n;
+    queue->mask = queue->size - 1;
+    uel_cqueue_clear(queue, false);
+}
+
+UEL_API void uel_cqueue_clear(uel_cqueue_t *queue, bool clear_buffer){
+    queue->tail = 0;
+    queue->count = 0;
+    if(clear_buffer){
+        queue->buffer = NULL;
+        queue->size = 0;
+        queue->mask = 0;
+    }
+}
+
+UEL_API bool uel_cqueue_push(uel_cqueue_t *queue, void *element){
+    if(uel_cqueue_is_full(queue)) return false;
+
+    const uintptr_t head = (++queue->count + queue->tail) & queue->mask;
+    queue->buffer[head] = element;
+    return true;
+}
+
+UEL_API void *uel_cqueue_pop(uel_cqueue_t *queue){
+    if(uel_cqueue_is_empty(queue)) return NULL;
+
+    queue->count--;
+    queue->tail = (queue->tail + 1) & queue->mask;
+    void *element = queue->buffer[queue->tail];
+    queue->buffer[queue->tail] = NULL;
+    return element;
+}
+
+UEL_API uintptr_t uel_cqueue_push_many(uel_cqueue_t *queue, void **elements, uintptr_t count){
+    uintptr_t available = queue->size - queue->count;
+    if(count > available) count = available;
+
+    uintptr_t head = queue->tail + queue->count;
+    for(uintptr_t i = 0; i < count; i++){
+        queue->buffer[++head & queue->mask] = elements[i];
+    }
+    queue->count += count;
+    return count;
+}
+
+UEL_API uintptr_t uel_cqueue_pop_many(uel_cqueue_t *queue, void **elements, uintptr_t max){
+    if(max > queue->count) max = queue->count;
+
+    for(uintptr_t i = 0; i < max; i++){
+        queue->tail = (queue->tail + 1) & queue->mask;
+        elements[i] = queue->buffer[queue->tail];
+        queue->buffer[queue->tail] = NULL;
+    }
+    queue->count -= max;
+    return max;
+}
+
+UEL_API void *uel_cqueue_peek_tail(uel_cqueue_t *queue){
+    if(uel_cqueue_is_empty(queue)) return NULL;
+
+    return queue->buffer[(queue->tail + 1) & queue->mask];
+}
+
+UEL_API void *uel_cqueue_peek_head(uel_cqueue_t *queue){
+    if(uel_cqueue_is_empty(queue)) return NULL;
+
+    return queue->buffer[(queue->tail + queue->count) & queue->mask];
+}
+
+UEL_API bool uel_cqueue_is_full(uel_cqueue_t *queue){
+    return queue->size <= queue->count;
+}
+
+UEL_API bool uel_cqueue_is_empty(uel_cqueue_t *queue){
+    return queue->count == 0;
+}
+
+UEL_API uintptr_t uel_cqueue_count(uel_cqueue_t *queue){
+    return queue->count;
+}
+
+/* ---- src/utils/clock.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+static uel_closure_t uel__clock_clock_source = { NULL, NULL };
+
+UEL_API void uel_clock_set_source(uel_closure_t source){
+    uel__clock_clock_source = source;
+}
+
+UEL_API uel_timestamp_t uel_clock_now(){
+    if(uel__clock_clock_source.function == NULL) return 0;
+    return (uel_timestamp_t)(uintptr_t)uel_closure_invoke(&uel__clock_clock_source, NULL);
+}
+
+/* ---- src/utils/closure.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+static void *uel__closure_nop(void *context, void *params) { return NULL; }
+
+UEL_API uel_closure_t uel_closure_create(uel_closure_function_t function, void *context) {
+    uel_closure_t closure = { function, context };
+    return closure;
+}
+
+UEL_API void *uel_closure_invoke(uel_closure_t *closure, void *params) {
+    return closure->function(closure->context, params);
+}
+
+UEL_API uel_closure_t uel_nop() {
+    return uel_closure_create(uel__closure_nop, NULL);
+}
+
+/* ---- src/utils/conditional.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+UEL_API void uel_conditional_init(uel_conditional_t *conditional, uel_closure_t test,
+                                uel_closure_t if_true, uel_closure_t if_false){
+    conditional->test = test;
+    conditional->if_true = if_true;
+    conditional->if_false = if_false;
+}
+
+UEL_API void *uel_conditional_apply(uel_conditional_t *conditional, void *params){
+    if(uel_closure_invoke(&conditional->test, params)){
+        return uel_closure_invoke(&conditional->if_true, params);
+    }else{
+        return uel_closure_invoke(&conditional->if_false, params);
+    }
+}
+
+/* ---- src/utils/functional.c ---- */
+
+/// \cond
+#include <stdbool.h>
+/// \endcond
+
+static void *uel_func_unwrap_pipeline(void *context, void *params){
+    uel_pipeline_t *pipeline = (uel_pipeline_t *)context;
+    return uel_pipeline_apply(pipeline, params);
+}
+
+static void *uel_func_unwrap_conditional(void *context, void *params){
+    uel_conditional_t *conditional = (uel_conditional_t *)context;
+    return uel_conditional_apply(conditional, params);
+}
+
+static void *uel_func_unwrap_switch(void *context, void *params){
+    uel_switch_t *sw = (uel_switch_t *)context;
+    return uel_switch_apply(sw, params);
+}
+
+static void *uel_func_unwrap_foreach(void *context, void *params){
+    uel_iterator_t *iterator = (uel_iterator_t *)params;
+    uel_closure_t *wrapped = (uel_closure_t *)context;
+    bool completed = uel_iterator_foreach(iterator, wrapped);
+    return (void *)completed;
+}
+
+static void *uel_func_unwrap_map(void *context, void *params){
+    uel_func_mapper_t *mapper = (uel_func_mapper_t *)params;
+    uel_closure_t *wrapped = (uel_closure_t *)context;
+    uel_iterator_map(mapper->iterator, wrapped, mapper->destination, mapper->limit);
+    return (void *)mapper->destination;
+}
+
+static void *uel_func_unwrap_find(void *context, void *params){
+    uel_iterator_t *iterator = (uel_iterator_t *)params;
+    uel_closure_t *wrapped = (uel_closure_t *)context;
+    return uel_iterator_find(iterator, wrapped);
+}
+
+static void *uel_func_unwrap_count(void *context, void *params){
+    uel_iterator_t *iterator = (uel_iterator_t *)params;
+    uel_closure_t *wrapped = (uel_closure_t *)context;
+    return (void *)(uintptr_t)uel_iterator_count(iterator, wrapped);
+}
+
+static void *uel_func_unwrap_all(void *context, void *params){
+    uel_iterator_t *iterator = (uel_iterator_t *)params;
+    uel_closure_t *wrapped = (uel_closure_t *)context;
+    return (void *)uel_iterator_all(iterator, wrapped);
+}
+
+static void *uel_func_unwrap_none(void *context, void *params){
+    uel_iterator_t *iterator = (uel_iterator_t *)params;
+    uel_closure_t *wrapped = (uel_closure_t *)context;
+    return (void *)uel_iterator_none(iterator, wrapped);
+}
+
+static void *uel_func_unwrap_any(void *context, void *params){
+    uel_iterator_t *iterator = (uel_iterator_t *)params;
+    uel_closure_t *wrapped = (uel_closure_t *)context;
+    return (void *)uel_iterator_any(iterator, wrapped);
+}
+
+static void *uel_func_unwrap_array_count(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return (void *)(uintptr_t)uel_array_filter_count(
+        filter, iterator->base.collection, iterator->item_count
+    );
+}
+
+static void *uel_func_unwrap_array_find(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return uel_array_filter_find(filter, iterator->base.collection, iterator->item_count);
+}
+
+static void *uel_func_unwrap_array_all(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return (void *)uel_array_filter_all(
+        filter, iterator->base.collection, iterator->item_count
+    );
+}
+
+static void *uel_func_unwrap_array_any(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return (void *)uel_array_filter_any(
+        filter, iterator->base.collection, iterator->item_count
+    );
+}
+
+UEL_API void uel_func_mapper_init(uel_func_mapper_t *mapper, uel_iterator_t *iterator,
+                                          void **destination, size_t limit){
+    mapper->iterator = iterator;
+    mapper->destination = destination;
+    mapper->limit = limit;
+}
+
+UEL_API uel_closure_t uel_func_pipeline(uel_pipeline_t *pipeline){
+    uel_closure_t closure =
+        uel_closure_create(uel_func_unwrap_pipeline, (void *)pipeline);
+    return closure;
+}
+
+UEL_API uel_closure_t uel_func_conditional(uel_conditional_t *conditional){
+    uel_closure_t closure =
+        uel_closure_create(uel_func_unwrap_conditional, (void *)conditional);
+    return closure;
+}
+
+UEL_API uel_closure_t uel_func_switch(uel_switch_t *sw){
+    return uel_closure_create(uel_func_unwrap_switch, (void *)sw);
+}
+
+UEL_API uel_closure_t uel_func_foreach(uel_closure_t *closure){
+    return uel_closure_create( uel_func_unwrap_foreach, (void *)closure);
+}
+
+UEL_API uel_closure_t uel_func_map(uel_closure_t *closure){
+    return uel_closure_create(uel_func_unwrap_map, (void *)closure);
+}
+
+UEL_API uel_closure_t uel_func_find(uel_closure_t *closure){
+    return uel_closure_create(uel_func_unwrap_find, (void *)closure);
+}
+
+UEL_API uel_closure_t uel_func_count(uel_closure_t *closure){
+    return uel_closure_create(uel_func_unwrap_count, (void *)closure);
+}
+
+UEL_API uel_closure_t uel_func_all(uel_closure_t *closure){
+    return uel_closure_create(uel_func_unwrap_all, (void *)closure);
+}
+
+UEL_API uel_closure_t uel_func_none(uel_closure_t *closure){
+    return uel_closure_create(uel_func_unwrap_none, (void *)closure);
+}
+
+UEL_API uel_closure_t uel_func_any(uel_closure_t *closure){
+    return uel_closure_create(uel_func_unwrap_any, (void *)closure);
+}
+
+UEL_API uel_closure_t uel_func_array_count(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_count, (void *)filter);
+}
+
+UEL_API uel_closure_t uel_func_array_find(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_find, (void *)filter);
+}
+
+UEL_API uel_closure_t uel_func_array_all(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_all, (void *)filter);
+}
+
+UEL_API uel_closure_t uel_func_array_any(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_any, (void *)filter);
+}
+
+/* ---- src/utils/histogram.c ---- */
+
+static inline unsigned int uel__histogram_most_significant_bit(uint32_t value){
+#if defined(__GNUC__) || defined(__clang__)
+    return 31 - __builtin_clz(value);
+#else
+    unsigned int msb = 0;
+    while(value >>= 1) msb++;
+    return msb;
+#endif
+}
+
+UEL_API void uel_histogram_init(uel_histogram_t *histogram){
+    for(size_t i = 0; i < UEL_HISTOGRAM_BUCKET_COUNT; i++){
+        histogram->buckets[i] = 0;
+    }
+    histogram->count = 0;
+    histogram->min = UINT32_MAX;
+    histogram->max = 0;
+    histogram->sum = 0;
+}
+
+UEL_API size_t uel_histogram_bucket_index(uint32_t value){
+    if(value < UEL_HISTOGRAM_SUB_BUCKET_COUNT) return value;
+
+    unsigned int shift = uel__histogram_most_significant_bit(value) - UEL_HISTOGRAM_PRECISION_BITS;
+    return shift * UEL_HISTOGRAM_SUB_BUCKET_COUNT + (value >> shift);
+}
+
+UEL_API uint32_t uel_histogram_bucket_floor(size_t index){
+    if(index < 2 * UEL_HISTOGRAM_SUB_BUCKET_COUNT) return (uint32_t)index;
+
+    unsigned int shift = (index >> UEL_HISTOGRAM_PRECISION_BITS) - 1;
+    uint32_t mantissa = index - shift * UEL_HISTOGRAM_SUB_BUCKET_COUNT;
+    return mantissa << shift;
+}
+
+UEL_API void uel_histogram_record(uel_histogram_t *histogram, uint32_t value){
+    histogram->buckets[uel_histogram_bucket_index(value)]++;
+    histogram->count++;
+    histogram->sum += value;
+    if(value < histogram->min) histogram->min = value;
+    if(value > histogram->max) histogram->max = value;
+}
+
+UEL_API uint32_t uel_histogram_quantile(uel_histogram_t *histogram, uint16_t permille){
+    if(histogram->count == 0) return 0;
+
+    uint64_t rank = ((uint64_t)histogram->count * permille + 999) / 1000;
+    if(rank == 0) rank = 1;
+    uint64_t seen = 0;
+    for(size_t i = 0; i < UEL_HISTOGRAM_BUCKET_COUNT; i++){
+        seen += histogram->buckets[i];
+        if(seen >= rank) return uel_histogram_bucket_floor(i);
+    }
+    return histogram->max;
+}
+
+/* ---- src/utils/iterator.c ---- */
+
+UEL_API size_t uel_iterator_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(iterator->next_batch != NULL){
+        return iterator->next_batch(iterator, last, batch, capacity);
+    }
+    batch[0] = iterator->next(iterator, last);
+    return batch[0] != NULL;
+}
+
+UEL_API bool uel_iterator_foreach(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
+    void *last = NULL;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(!uel_closure_invoke(closure, batch[i])) return false;
+        }
+        last = batch[count - 1];
+    }
+    return true;
+}
+
+UEL_API size_t uel_iterator_map(uel_iterator_t *iterator, uel_closure_t *closure, void **destination, size_t limit){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
+    void *last = NULL;
+    size_t mapped = 0;
+    while(mapped < limit){
+        size_t capacity = limit - mapped;
+        if(capacity > UEL_ITERATOR_BATCH_SIZE) capacity = UEL_ITERATOR_BATCH_SIZE;
+        size_t count = uel_iterator_next_batch(iterator, last, batch, capacity);
+        if(count == 0) break;
+        for(size_t i = 0; i < count; i++){
+            destination[mapped++] = uel_closure_invoke(closure, batch[i]);
+        }
+        last = batch[count - 1];
+    }
+    return mapped;
+}
+
+UEL_API void *uel_iterator_find(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
+    void *last = NULL;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(uel_closure_invoke(closure, batch[i])) return batch[i];
+        }
+        last = batch[count - 1];
+    }
+    return NULL;
+}
+
+UEL_API size_t uel_iterator_count(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
+    void *last = NULL;
+    size_t passed = 0;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(uel_closure_invoke(closure, batch[i])) passed++;
+        }
+        last = batch[count - 1];
+    }
+    return passed;
+}
+
+UEL_API bool uel_iterator_all(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
+    void *last = NULL;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(!uel_closure_invoke(closure, batch[i])) return false;
+        }
+        last = batch[count - 1];
+    }
+    return true;
+}
+
+UEL_API bool uel_iterator_none(uel_iterator_t *iterator, uel_closure_t *closure){
+    return !uel_iterator_any(iterator, closure);
+}
+
+UEL_API bool uel_iterator_any(uel_iterator_t *iterator, uel_closure_t *closure){
+    return uel_iterator_find(iterator, closure) != NULL;
+}
+
+UEL_API void *uel_iterator_array_next(uel_iterator_array_t *iterator, void *last){
+    if(last == NULL){
+        return iterator->base.collection;
+    }else{
+        void *boundary =
+            (char *)iterator->base.collection +
+            (iterator->item_count - 1) * iterator->item_size;
+        if(last == boundary){
+            return NULL;
+        }
+        return (char *)last + iterator->item_size;
+    }
+}
+
+UEL_API size_t uel_iterator_array_next_batch(
+    uel_iterator_array_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    char *collection = (char *)iterator->base.collection;
+    size_t index = 0;
+    if(last != NULL){
+        index = ((char *)last - collection) / iterator->item_size + 1;
+    }
+
+    size_t count = iterator->item_count - index;
+    if(count > capacity) count = capacity;
+    char *item = collection + index * iterator->item_size;
+    for(size_t i = 0; i < count; i++){
+        batch[i] = (void *)item;
+        item += iterator->item_size;
+    }
+    return count;
+}
+
+UEL_API uel_iterator_array_t uel_iterator_array_create(void *collection, size_t count, size_t size){
+    uel_iterator_array_t iterator = {
+        {
+            (uel_iterator_next_t)&uel_iterator_array_next,
+            collection,
+            (uel_iterator_next_batch_t)&uel_iterator_array_next_batch
+        },
+        count,
+        size
+    };
+    return iterator;
+}
+
+UEL_API void *uel_iterator_llist_next(uel_iterator_t *iterator, void *last){
+    if(last == NULL){
+        uel_llist_t *list = (uel_llist_t *)iterator->collection;
+        return (void *)list->tail;
+    }else{
+        uel_llist_node_t *node = (uel_llist_node_t *)last;
+        return (void *)node->next;
+    }
+}
+
+UEL_API size_t uel_iterator_llist_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    uel_llist_node_t *node = (uel_llist_node_t *)uel_iterator_llist_next(iterator, last);
+    size_t count = 0;
+    while(node != NULL && count < capacity){
+        batch[count++] = (void *)node;
+        node = node->next;
+    }
+    return count;
+}
+
+UEL_API uel_iterator_llist_t uel_iterator_llist_create(uel_llist_t *list){
+    uel_iterator_llist_t iterator = {
+        uel_iterator_llist_next,
+        (void *)list,
+        uel_iterator_llist_next_batch
+    };
+    return iterator;
+}
+
+static inline size_t uel__iterator_adapter_capacity(size_t capacity){
+    return capacity < UEL_ITERATOR_BATCH_SIZE ? capacity : UEL_ITERATOR_BATCH_SIZE;
+}
+
+static void *uel__iterator_adapter_next(uel_iterator_t *iterator, void *last){
+    void *element;
+    return iterator->next_batch(iterator, last, &element, 1) ? element : NULL;
+}
+
+static size_t uel__iterator_map_adapter_next_batch(
+    uel_iterator_map_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL) iterator->source_last = NULL;
+    size_t count = uel_iterator_next_batch(
+        (uel_iterator_t *)iterator->base.collection,
+        iterator->source_last,
+        batch,
+        uel__iterator_adapter_capacity(capacity)
+    );
+    if(count == 0) return 0;
+
+    iterator->source_last = batch[count - 1];
+    for(size_t i = 0; i < count; i++){
+        iterator->values[i] = uel_closure_invoke(&iterator->closure, batch[i]);
+        batch[i] = (void *)&iterator->values[i];
+    }
+    return count;
+}
+
+UEL_API uel_iterator_map_adapter_t uel_iterator_map_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+){
+    uel_iterator_map_adapter_t iterator = {
+        {
+            uel__iterator_adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&uel__iterator_map_adapter_next_batch
+        },
+        *closure,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t uel__iterator_filter_adapter_next_batch(
+    uel_iterator_filter_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL) iterator->source_last = NULL;
+    size_t passed = 0;
+    while(passed == 0){
+        size_t count = uel_iterator_next_batch(
+            (uel_iterator_t *)iterator->base.collection,
+            iterator->source_last,
+            batch,
+            capacity
+        );
+        if(count == 0) return 0;
+
+        iterator->source_last = batch[count - 1];
+        for(size_t i = 0; i < count; i++){
+            if(uel_closure_invoke(&iterator->closure, batch[i])){
+                batch[passed++] = batch[i];
+            }
+        }
+    }
+    return passed;
+}
+
+UEL_API uel_iterator_filter_adapter_t uel_iterator_filter_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+){
+    uel_iterator_filter_adapter_t iterator = {
+        {
+            uel__iterator_adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&uel__iterator_filter_adapter_next_batch
+        },
+        *closure,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t uel__iterator_take_adapter_next_batch(
+    uel_iterator_take_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL){
+        iterator->source_last = NULL;
+        iterator->taken = 0;
+    }
+    size_t remaining = iterator->count - iterator->taken;
+    if(remaining == 0) return 0;
+
+    size_t count = uel_iterator_next_batch(
+        (uel_iterator_t *)iterator->base.collection,
+        iterator->source_last,
+        batch,
+        capacity < remaining ? capacity : remaining
+    );
+    if(count != 0) iterator->source_last = batch[count - 1];
+    iterator->taken += count;
+    return count;
+}
+
+UEL_API uel_iterator_take_adapter_t uel_iterator_take_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+){
+    uel_iterator_take_adapter_t iterator = {
+        {
+            uel__iterator_adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&uel__iterator_take_adapter_next_batch
+        },
+        count,
+        0,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t uel__iterator_skip_adapter_next_batch(
+    uel_iterator_skip_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    uel_iterator_t *source = (uel_iterator_t *)iterator->base.collection;
+    if(last == NULL){
+        iterator->source_last = NULL;
+        for(size_t skipped = 0; skipped < iterator->count;){
+            size_t remaining = iterator->count - skipped;
+            size_t count = uel_iterator_next_batch(
+                source,
+                iterator->source_last,
+                batch,
+                capacity < remaining ? capacity : remaining
+            );
+            if(count == 0) return 0;
+            iterator->source_last = batch[count - 1];
+            skipped += count;
+        }
+    }
+
+    size_t count =
+        uel_iterator_next_batch(source, iterator->source_last, batch, capacity);
+    if(count != 0) iterator->source_last = batch[count - 1];
+    return count;
+}
+
+UEL_API uel_iterator_skip_adapter_t uel_iterator_skip_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+){
+    uel_iterator_skip_adapter_t iterator = {
+        {
+            uel__iterator_adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&uel__iterator_skip_adapter_next_batch
+        },
+        count,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t uel__iterator_zip_adapter_next_batch(
+    uel_iterator_zip_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL){
+        iterator->source_last = NULL;
+        iterator->other_last = NULL;
+    }
+    size_t count = uel_iterator_next_batch(
+        (uel_iterator_t *)iterator->base.collection,
+        iterator->source_last,
+        batch,
+        uel__iterator_adapter_capacity(capacity)
+    );
+    if(count == 0) return 0;
+    iterator->source_last = batch[count - 1];
+
+    // The other source may yield shorter batches, so it is drained until it
+    // matches the first one or is exhausted
+    void *others[UEL_ITERATOR_BATCH_SIZE];
+    size_t paired = 0;
+    while(paired < count){
+        size_t fetched = uel_iterator_next_batch(
+            iterator->other,
+            iterator->other_last,
+            &others[paired],
+            count - paired
+        );
+        if(fetched == 0) break;
+        paired += fetched;
+        iterator->other_last = others[paired - 1];
+    }
+
+    for(size_t i = 0; i < paired; i++){
+        iterator->pairs[i][0] = batch[i];
+        iterator->pairs[i][1] = others[i];
+        batch[i] = (void *)iterator->pairs[i];
+    }
+    return paired;
+}
+
+UEL_API uel_iterator_zip_adapter_t uel_iterator_zip_adapter_create(
+    uel_iterator_t *source,
+    uel_iterator_t *other
+){
+    uel_iterator_zip_adapter_t iterator = {
+        {
+            uel__iterator_adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&uel__iterator_zip_adapter_next_batch
+        },
+        other,
+        NULL,
+        NULL
+    };
+    return iterator;
+}
+
+/* ---- src/utils/linked-list.c ---- */
+
+/// \cond
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+UEL_API void uel_llist_init(uel_llist_t *list){
+    list->head = list->tail = NULL;
+    list->count = 0;
+}
+
+UEL_API void uel_llist_push_head(uel_llist_t *list, uel_llist_node_t *node){
+    node->next = NULL;
+    if(list->head != NULL){
+        list->head->next = node;
+    }
+    if(list->tail == NULL){
+       list->tail = node;
+    }
+    list->head = node;
+    list->count++;
+}
+
+UEL_API void uel_llist_push_tail(uel_llist_t *list, uel_llist_node_t *node){
+    node->next = list->tail;
+    if(list->head == NULL){
+        list->head = node;
+    }
+    list->tail = node;
+    list->count++;
+}
+
+UEL_API uel_llist_node_t *uel_llist_pop_head(uel_llist_t *list){
+    if(list->head == NULL) return NULL;
+
+    uel_llist_node_t *current = list->tail, *head = list->head;
+    while(current->next != head && current->next != NULL){
+        current = current->next;
+    }
+    current->next = NULL;
+    list->head = current;
+    list->count--;
+    return head;
+}
+
+UEL_API uel_llist_node_t *uel_llist_pop_tail(uel_llist_t *list){
+    if(list->tail == NULL) return NULL;
+
+    uel_llist_node_t *tail = list->tail;
+    list->tail = list->tail->next;
+    list->count--;
+    return tail;
+}
+
+UEL_API uel_llist_node_t *uel_llist_peek_head(uel_llist_t *list){
+    return list->head;
+}
+UEL_API uel_llist_node_t *uel_llist_peek_tail(uel_llist_t *list){
+    return list->tail;
+}
+
+UEL_API bool uel_llist_remove(uel_llist_t *list, uel_llist_node_t *node){
+    if(node == list->tail){
+        list->tail = node->next;
+        if(node == list->head) list->head = NULL;
+        list->count--;
+        return true;
+    }
+
+    uel_llist_node_t *current = list->tail;
+    while(current != NULL){
+        if(current->next == node){
+            current->next = node->next;
+            if(node == list->head) list->head = current;
+            list->count--;
+            return true;
+        }
+        current = current->next;
+    }
+
+    return false;
+}
+
+UEL_API uel_llist_t uel_llist_remove_while(uel_llist_t *list, uel_closure_t *should_remove){
+    uel_llist_t removed;
+    uel_llist_init(&removed);
+
+    uel_llist_node_t *current;
+    while((current = uel_llist_peek_tail(list)) != NULL){
+        bool fit_for_removal = (bool)uel_closure_invoke(should_remove, current);
+        if(fit_for_removal){
+            current = uel_llist_pop_tail(list);
+            uel_llist_push_head(&removed, current);
+        }else break;
+    }
+    return removed;
+}
+
+UEL_API void uel_llist_insert_at(uel_llist_t *list, uel_llist_node_t *node, uel_closure_t *should_insert){
+    uel_llist_node_t *current = uel_llist_peek_tail(list);
+
+    if(current == NULL){
+        uel_llist_push_tail(list, node);
+    }else{
+        uel_llist_node_t *nodes[2] = { NULL, current };
+        bool fit_for_insertion = (bool)uel_closure_invoke(should_insert, (void *)&nodes);
+
+        if(fit_for_insertion){
+            uel_llist_push_tail(list, node);
+        }else{
+            while(current != NULL && !fit_for_insertion){
+                nodes[0] = current;
+                nodes[1] = current->next;
+                fit_for_insertion = (bool)uel_closure_invoke(should_insert, (void *)&nodes);
+                if(fit_for_insertion){
+                    node->next = current->next;
+                    current->next = node;
+                    list->count++;
+                    return;
+                }
+                current = current->next;
+            }
+        }
+    }
+
+}
+
+/* ---- src/utils/module.c ---- */
+
+static void *uel__module_complete_launch(void *context, void *params){
+    uel_module_t *module = (uel_module_t *)context;
+    uel_app_complete_launch(module->app, module);
+    return NULL;
+}
+
+UEL_API void uel_module_init(
+    uel_module_t *module,
+    uel_module_hook_t config,
+    uel_module_hook_t launch,
+    struct uel_application *app
+){
+    module->config = config;
+    module->launch = launch;
+    module->app = app;
+    module->dependencies = NULL;
+    module->dependency_count = 0;
+    module->lazy = false;
+    module->asynchronous = false;
+    module->state = UEL_MODULE_IDLE;
+}
+
+UEL_API void uel_module_config(uel_module_t *module){
+    module->config(module);
+}
+
+UEL_API void uel_module_launch(uel_module_t *module){
+    module->launch(module);
+}
+
+UEL_API void uel_module_set_dependencies(
+    uel_module_t *module,
+    const size_t *dependencies,
+    size_t count
+){
+    module->dependencies = dependencies;
+    module->dependency_count = count;
+}
+
+UEL_API void uel_module_set_lazy(uel_module_t *module, bool lazy){
+    module->lazy = lazy;
+}
+
+UEL_API void uel_module_set_async(uel_module_t *module, bool asynchronous){
+    module->asynchronous = asynchronous;
+}
+
+UEL_API void uel_module_launched(uel_module_t *module){
+    uel_closure_t closure = uel_closure_create(uel__module_complete_launch, (void *)module);
+    uel_app_enqueue_closure(module->app, &closure, NULL);
+}
+
+/* ---- src/utils/object-pool.c ---- */
+
+UEL_API void uel_objpool_init(
+    uel_objpool_t *pool,
+    size_t size_log2n,
+    size_t item_size,
+    uint8_t *buffer,
+    void **queue_buffer
+){
+    pool->buffer = buffer;
+    uel_cqueue_init(&pool->queue, queue_buffer, size_log2n);
+    pool->item_size = item_size;
+    pool->untouched = 0;
+    uel_lock_init(&pool->lock);
+}
+
+UEL_API void *uel_objpool_acquire(uel_objpool_t *pool){
+    if(!uel_cqueue_is_empty(&pool->queue)){
+        return uel_cqueue_pop(&pool->queue);
+    }
+    if(pool->untouched == pool->queue.size) return NULL;
+    return (void *)(pool->buffer + pool->untouched++ * pool->item_size);
+}
+
+UEL_API bool uel_objpool_release(uel_objpool_t *pool, void *element){
+    return uel_cqueue_push(&pool->queue, element);
+}
+
+UEL_API bool uel_objpool_is_empty(uel_objpool_t *pool){
+    return uel_cqueue_is_empty(&pool->queue) && pool->untouched == pool->queue.size;
+}
+
+UEL_API size_t uel_objpool_count_available(uel_objpool_t *pool){
+    return pool->queue.count + (pool->queue.size - pool->untouched);
+}
+
+/* ---- src/utils/pipeline.c ---- */
+
+UEL_API void uel_pipeline_init(uel_pipeline_t *pipeline, uel_closure_t *closures, size_t count){
+    pipeline->closures = closures;
+    pipeline->count = count;
+}
+
+UEL_API void *uel_pipeline_apply(uel_pipeline_t *pipeline, void *params){
+    void *value = params;
+    for(size_t i = 0; i < pipeline->count; i++){
+        value = uel_closure_invoke(&pipeline->closures[i], value);
+    }
+    return value;
+}
+
+/* ---- src/utils/profiler.c ---- */
+
+/// \cond
+#include <stdlib.h>
+#include <stdbool.h>
+/// \endcond
+
+static uel_profiler_t *uel__profiler_attached_profiler = NULL;
+
+static inline uintptr_t uel__profiler_hash_function(uel_closure_function_t function){
+    // Fibonacci hashing; low bits of code addresses carry little entropy
+    uintptr_t address = (uintptr_t)function;
+    return (uintptr_t)((uint32_t)(address >> 2) * UINT32_C(2654435769)) >>
+        (32 - UEL_PROFILER_TABLE_SIZE_LOG2N);
+}
+
+static uel_profile_entry_t *uel__profiler_probe(
+    uel_profiler_t *profiler,
+    uel_closure_function_t function,
+    bool claim
+){
+    uintptr_t index = uel__profiler_hash_function(function);
+    for(uintptr_t i = 0; i < UEL_PROFILER_TABLE_SIZE; i++){
+        uel_profile_entry_t *entry =
+            &profiler->entries[(index + i) & (UEL_PROFILER_TABLE_SIZE - 1)];
+        uel_closure_function_t current =
+            UEL_ATOMIC_LOAD(&entry->function, UEL_ATOMIC_ACQUIRE);
+        if(current == function) return entry;
+        if(current == NULL){
+            if(!claim) return NULL;
+            // Another thread may claim the same entry meanwhile
+            if(UEL_ATOMIC_CAS(&entry->function, &current, function)) return entry;
+            if(current == function) return entry;
+        }
+    }
+    return NULL;
+}
+
+UEL_API void uel_profiler_init(
+    uel_profiler_t *profiler,
+    uel_timestamp_t threshold,
+    uel_closure_t watchdog
+){
+    for(size_t i = 0; i < UEL_PROFILER_TABLE_SIZE; i++){
+        uel_profile_entry_t *entry = &profiler->entries[i];
+        entry->function = NULL;
+        entry->calls = 0;
+        entry->total = 0;
+        entry->max = 0;
+    }
+    profiler->dropped = 0;
+    profiler->threshold = threshold;
+    profiler->watchdog = watchdog;
+}
+
+UEL_API void uel_profiler_attach(uel_profiler_t *profiler){
+    UEL_ATOMIC_STORE(&uel__profiler_attached_profiler, profiler, UEL_ATOMIC_RELEASE);
+}
+
+UEL_API void uel_profiler_record(
+    uel_profiler_t *profiler,
+    uel_closure_t *closure,
+    uel_timestamp_t elapsed
+){
+    uel_profile_entry_t *entry = uel__profiler_probe(profiler, closure->function, true);
+    if(entry == NULL){
+        UEL_ATOMIC_FETCH_ADD(&profiler->dropped, 1, UEL_ATOMIC_RELAXED);
+    }else{
+        UEL_ATOMIC_FETCH_ADD(&entry->calls, 1, UEL_ATOMIC_RELAXED);
+        UEL_ATOMIC_FETCH_ADD(&entry->total, elapsed, UEL_ATOMIC_RELAXED);
+        uel_timestamp_t max = UEL_ATOMIC_LOAD(&entry->max, UEL_ATOMIC_RELAXED);
+        while(elapsed > max && !UEL_ATOMIC_CAS(&entry->max, &max, elapsed));
+    }
+
+    if(elapsed > profiler->threshold){
+        uel_profile_sample_t sample = { closure, elapsed };
+        uel_closure_invoke(&profiler->watchdog, (void *)&sample);
+    }
+}
+
+UEL_API uel_profile_entry_t *uel_profiler_find(
+    uel_profiler_t *profiler,
+    uel_closure_function_t function
+){
+    return uel__profiler_probe(profiler, function, false);
+}
+
+UEL_API void *uel_profiler_invoke(uel_closure_t *closure, void *params){
+    uel_profiler_t *profiler = UEL_ATOMIC_LOAD(&uel__profiler_attached_profiler, UEL_ATOMIC_ACQUIRE);
+    if(profiler == NULL) return uel_closure_invoke(closure, params);
+
+    uel_timestamp_t start = uel_clock_now();
+    void *result = uel_closure_invoke(closure, params);
+    uel_profiler_record(profiler, closure, uel_clock_now() - start);
+    return result;
+}
+
+/* ---- src/utils/promise.c ---- */
+
+#include <stddef.h>
+
+static void *uel__promise_rejecter(void *context, void *params) {
+    uel_promise_t *promise = (uel_promise_t *)context;
+    uel_promise_reject(promise, params);
+
+    return NULL;
+}
+
+static void *uel__promise_resolver(void *context, void *params) {
+    uel_promise_t *promise = (uel_promise_t *)context;
+    uel_promise_resolve(promise, params);
+
+    return NULL;
+}
+
+static void *uel__promise_destroyer(void *context, void *params) {
+    uel_promise_t *promise = (uel_promise_t *)context;
+
+    UEL_CRITICAL_ENTER_ON(&promise->source->promise_pool->lock);
+    uel_objpool_release(promise->source->promise_pool, (void *)promise);
+    UEL_CRITICAL_EXIT_ON(&promise->source->promise_pool->lock);
+
+    return NULL;
+}
+
+static inline void uel__promise_push_segment(uel_promise_t *promise, uel_promise_segment_t *segment) {
+    if (promise->first_segment == NULL) {
+        promise->first_segment = segment;
+    } else {
+        promise->last_segment->next = segment;
+    }
+    promise->last_segment = segment;
+}
+
+static inline void uel__promise_await_promise(uel_promise_t *promise, uel_promise_t *other) {
+    promise->state = UEL_PROMISE_PENDING;
+
+    UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
+    uel_promise_segment_t *segment =
+        (uel_promise_segment_t *)uel_objpool_acquire(promise->source->segment_pool);
+    UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
+
+    segment->next = promise->first_segment;
+    segment->reject = uel_promise_destroyer(promise);
+    segment->resolve = uel_promise_destroyer(promise);
+    promise->first_segment = segment;
+    if(promise->last_segment == NULL) {
+        promise->last_segment = segment;
+    }
+
+    uel_promise_after(
+        other,
+        uel_promise_resolver(promise),
+        uel_promise_rejecter(promise)
+    );
+}
+
+static inline void uel__promise_process_segment(uel_promise_t *promise) {
+    uel_promise_segment_t *segment = promise->first_segment;
+    promise->first_segment = segment->next;
+    if(!promise->first_segment) promise->last_segment = NULL;
+
+    uel_promise_t *other = NULL;
+    switch (promise->state) {
+        case UEL_PROMISE_RESOLVED:
+            other = (uel_promise_t *)UEL_PROFILED_INVOKE(&segment->resolve, (void *)promise);
+            break;
+        case UEL_PROMISE_REJECTED:
+            other = (uel_promise_t *)UEL_PROFILED_INVOKE(&segment->reject, (void *)promise);
+            break;
+        default: break;
+    }
+    if (other) {
+        uel__promise_await_promise(promise, other);
+    }
+
+    UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
+    uel_objpool_release(promise->source->segment_pool, (void *)segment);
+    UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
+}
+
+static inline void uel__promise_flush_segments(uel_promise_t *promise) {
+    while (promise->state != UEL_PROMISE_PENDING && promise->first_segment) {
+        uel__promise_process_segment(promise);
+    }
+}
+
+UEL_API uel_promise_store_t uel_promise_store_create(
+    uel_objpool_t *promise_pool,
+    uel_objpool_t *segment_pool
+) {
+    uel_promise_store_t store = {
+        .promise_pool = promise_pool,
+        .segment_pool = segment_pool
+    };
+    return store;
+}
+UEL_API uel_promise_t *uel_promise_create(uel_promise_store_t *store, uel_closure_t closure) {
+    UEL_CRITICAL_ENTER_ON(&store->promise_pool->lock);
+    uel_promise_t *promise =
+        (uel_promise_t *)uel_objpool_acquire(store->promise_pool);
+    UEL_CRITICAL_EXIT_ON(&store->promise_pool->lock);
+
+    promise->source = store;
+    promise->state = UEL_PROMISE_PENDING;
+    promise->value = NULL;
+    promise->first_segment = NULL;
+    promise->last_segment = NULL;
+    uel_closure_invoke(&closure, promise);
+
+    return promise;
+}
+
+UEL_API void uel_promise_destroy(uel_promise_t *promise) {
+    uel_promise_segment_t *segment = promise->first_segment;
+    while(segment) {
+        uel_promise_segment_t *next = segment->next;
+        UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
+        uel_objpool_release(promise->source->segment_pool, (void *)segment);
+        UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
+        segment = next;
+    }
+    UEL_CRITICAL_ENTER_ON(&promise->source->promise_pool->lock);
+    uel_objpool_release(promise->source->promise_pool, (void *)promise);
+    UEL_CRITICAL_EXIT_ON(&promise->source->promise_pool->lock);
+}
+
+UEL_API void uel_promise_then(uel_promise_t *promise, uel_closure_t resolve) {
+    uel_promise_after(promise, resolve, uel_nop());
+}
+
+UEL_API void uel_promise_catch(uel_promise_t *promise, uel_closure_t reject) {
+    uel_promise_after(promise, uel_nop(), reject);
+}
+
+UEL_API void uel_promise_always(uel_promise_t *promise, uel_closure_t always) {
+    uel_promise_after(promise, always, always);
+}
+
+UEL_API void uel_promise_after(
+    uel_promise_t *promise,
+    uel_closure_t resolve,
+    uel_closure_t reject
+) {
+    UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
+    uel_promise_segment_t *segment =
+        (uel_promise_segment_t *)uel_objpool_acquire(promise->source->segment_pool);
+    UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
+
+    segment ->next = NULL;
+    segment->resolve = resolve;
+    segment->reject = reject;
+    uel__promise_push_segment(promise, segment);
+    uel__promise_flush_segments(promise);
+}
+
+UEL_API void uel_promise_resolve(uel_promise_t *promise, void *value) {
+    UEL_TRACE(UEL_TRACE_PROMISE_RESOLVED, promise, value);
+    promise->value = value;
+    promise->state = UEL_PROMISE_RESOLVED;
+    uel__promise_flush_segments(promise);
+}
+
+UEL_API void uel_promise_reject(uel_promise_t *promise, void *value) {
+    UEL_TRACE(UEL_TRACE_PROMISE_REJECTED, promise, value);
+    promise->value = value;
+    promise->state = UEL_PROMISE_REJECTED;
+    uel__promise_flush_segments(promise);
+}
+
+UEL_API void uel_promise_resettle(
+    uel_promise_t *promise,
+    uel_promise_state_t state,
+    void *value
+) {
+    promise->state = state;
+    promise->value = value;
+}
+
+UEL_API uel_closure_t uel_promise_resolver(uel_promise_t *promise) {
+    return uel_closure_create(uel__promise_resolver, (void *)promise);
+}
+
+UEL_API uel_closure_t uel_promise_rejecter(uel_promise_t *promise) {
+    return uel_closure_create(uel__promise_rejecter, (void *)promise);
+}
+UEL_API uel_closure_t uel_promise_destroyer(uel_promise_t *promise) {
+    return uel_closure_create(uel__promise_destroyer, (void *)promise);
+}
+
+/* ---- src/utils/switch.c ---- */
+
+/// \cond
+#include <stdbool.h>
+/// \endcond
+
+static inline uint32_t uel__switch_fold_key(uintptr_t key){
+    uint32_t folded = (uint32_t)key;
+#if UINTPTR_MAX > UINT32_MAX
+    folded ^= (uint32_t)(key >> 32);
+#endif
+    return folded;
+}
+
+static inline size_t uel__switch_hash_key(uel_switch_t *sw, uintptr_t key){
+    if(sw->table_size_log2n == 0) return 0;
+    return (uel__switch_fold_key(key) * sw->multiplier) >> (32 - sw->table_size_log2n);
+}
+
+static inline size_t uel__switch_table_index(uel_switch_t *sw, uintptr_t key){
+    return sw->mode == UEL_SWITCH_DENSE ? key - sw->base : uel__switch_hash_key(sw, key);
+}
+
+static void uel__switch_clear_table(uel_switch_t *sw){
+    for(size_t i = 0; i < ((size_t)1 << sw->table_size_log2n); i++){
+        sw->table[i] = NULL;
+    }
+}
+
+// Fills the table, keeping the first of any repeated keys. Fails if two
+// distinct keys share a slot.
+static bool uel__switch_fill_table(uel_switch_t *sw){
+    uel__switch_clear_table(sw);
+    for(size_t i = 0; i < sw->count; i++){
+        uel_switch_case_t **slot = &sw->table[uel__switch_table_index(sw, sw->cases[i].key)];
+        if(*slot == NULL){
+            *slot = &sw->cases[i];
+        }else if((*slot)->key != sw->cases[i].key){
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool uel__switch_build_dense_table(uel_switch_t *sw){
+    uintptr_t min = sw->cases[0].key, max = sw->cases[0].key;
+    for(size_t i = 1; i < sw->count; i++){
+        if(sw->cases[i].key < min) min = sw->cases[i].key;
+        if(sw->cases[i].key > max) max = sw->cases[i].key;
+    }
+    if(max - min >= ((uintptr_t)1 << sw->table_size_log2n)) return false;
+
+    sw->mode = UEL_SWITCH_DENSE;
+    sw->base = min;
+    return uel__switch_fill_table(sw);
+}
+
+static bool uel__switch_build_hashed_table(uel_switch_t *sw){
+    if(sw->count > ((size_t)1 << sw->table_size_log2n)) return false;
+
+    sw->mode = UEL_SWITCH_HASHED;
+    uint32_t multiplier = 0x9E3779B1u;
+    for(unsigned int attempt = 0; attempt < UEL_SWITCH_MAX_ATTEMPTS; attempt++){
+        sw->multiplier = multiplier | 1;
+        if(uel__switch_fill_table(sw)) return true;
+        multiplier += 0x7F4A7C16u;
+    }
+    return false;
+}
+
+UEL_API void uel_switch_init(
+    uel_switch_t *sw,
+    uel_closure_t selector,
+    uel_switch_case_t *cases,
+    size_t count,
+    uel_closure_t default_branch,
+    uel_switch_case_t **table,
+    uint8_t table_size_log2n
+){
+    sw->selector = selector;
+    sw->default_branch = default_branch;
+    sw->cases = cases;
+    sw->count = count;
+    sw->table = table;
+    sw->table_size_log2n = table_size_log2n;
+    sw->base = 0;
+    sw->multiplier = 0;
+
+    if(count != 0 && (uel__switch_build_dense_table(sw) || uel__switch_build_hashed_table(sw))) return;
+    sw->mode = UEL_SWITCH_LINEAR;
+}
+
+UEL_API uel_closure_t *uel_switch_find(uel_switch_t *sw, uintptr_t key){
+    if(sw->mode == UEL_SWITCH_LINEAR){
+        for(size_t i = 0; i < sw->count; i++){
+            if(sw->cases[i].key == key) return &sw->cases[i].closure;
+        }
+        return &sw->default_branch;
+    }
+
+    size_t index = uel__switch_table_index(sw, key);
+    if(index >= ((size_t)1 << sw->table_size_log2n)) return &sw->default_branch;
+    uel_switch_case_t *branch = sw->table[index];
+    if(branch == NULL || branch->key != key) return &sw->default_branch;
+    return &branch->closure;
+}
+
+UEL_API void *uel_switch_apply(uel_switch_t *sw, void *params){
+    uintptr_t key = (uintptr_t)uel_closure_invoke(&sw->selector, params);
+    return uel_closure_invoke(uel_switch_find(sw, key), params);
+}
+
+/* ---- src/utils/trace.c ---- */
+
+
+//! Unrolls `UEL_TRACE_BUFFER_SIZE_LOG2N` into its power-of-two form
+#define UEL_TRACE_BUFFER_SIZE (1<<UEL_TRACE_BUFFER_SIZE_LOG2N)
+
+static uel_trace_record_t uel__trace_trace_buffer[UEL_TRACE_BUFFER_SIZE];
+static volatile uintptr_t uel__trace_trace_head = 0;
+static volatile bool uel__trace_trace_enabled = true;
+
+UEL_API void uel_trace_record(uel_trace_record_type_t type, uintptr_t subject, uintptr_t detail){
+    if(!uel__trace_trace_enabled) return;
+
+    uintptr_t slot = UEL_ATOMIC_FETCH_ADD(&uel__trace_trace_head, 1, UEL_ATOMIC_RELAXED);
+    uel_trace_record_t *record = &uel__trace_trace_buffer[slot & (UEL_TRACE_BUFFER_SIZE - 1)];
+    record->timestamp = uel_clock_now();
+    record->type = (uint32_t)type;
+    record->subject = subject;
+    record->detail = detail;
+}
+
+UEL_API void uel_trace_set_enabled(bool enabled){
+    uel__trace_trace_enabled = enabled;
+}
+
+UEL_API void uel_trace_reset(){
+    UEL_ATOMIC_STORE(&uel__trace_trace_head, 0, UEL_ATOMIC_RELEASE);
+}
+
+UEL_API uintptr_t uel_trace_dump(uel_closure_t *writer){
+    uintptr_t head = UEL_ATOMIC_LOAD(&uel__trace_trace_head, UEL_ATOMIC_ACQUIRE);
+    uintptr_t first = head > UEL_TRACE_BUFFER_SIZE ? head - UEL_TRACE_BUFFER_SIZE : 0;
+    for(uintptr_t i = first; i < head; i++){
+        uel_closure_invoke(writer, (void *)&uel__trace_trace_buffer[i & (UEL_TRACE_BUFFER_SIZE - 1)]);
+    }
+    return head - first;
+}
+
+/* ---- src/utils/work-stealing-deque.c ---- */
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+
+UEL_API void uel_wsdeque_init(uel_wsdeque_t *deque, void **buffer, uintptr_t size_log2n){
+    deque->buffer = buffer;
+    deque->mask = ((intptr_t)1 << size_log2n) - 1;
+    deque->top = 0;
+    deque->bottom = 0;
+}
+
+UEL_API bool uel_wsdeque_push(uel_wsdeque_t *deque, void *element){
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_RELAXED);
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_ACQUIRE);
+    if(bottom - top > deque->mask) return false;
+
+    UEL_ATOMIC_STORE(&deque->buffer[bottom & deque->mask], element, UEL_ATOMIC_RELAXED);
+    UEL_ATOMIC_STORE(&deque->bottom, bottom + 1, UEL_ATOMIC_RELEASE);
+    return true;
+}
+
+UEL_API void *uel_wsdeque_pop(uel_wsdeque_t *deque){
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_RELAXED) - 1;
+    UEL_ATOMIC_STORE(&deque->bottom, bottom, UEL_ATOMIC_RELAXED);
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_RELAXED);
+
+    if(top > bottom){
+        // Deque was already empty
+        UEL_ATOMIC_STORE(&deque->bottom, bottom + 1, UEL_ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    void *element =
+        UEL_ATOMIC_LOAD(&deque->buffer[bottom & deque->mask], UEL_ATOMIC_RELAXED);
+    if(top == bottom){
+        // Last element: race against thieves for it
+        if(!UEL_ATOMIC_CAS(&deque->top, &top, top + 1)){
+            element = NULL;
+        }
+        UEL_ATOMIC_STORE(&deque->bottom, bottom + 1, UEL_ATOMIC_RELAXED);
+    }
+    return element;
+}
+
+UEL_API void *uel_wsdeque_steal(uel_wsdeque_t *deque){
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_ACQUIRE);
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_ACQUIRE);
+    if(top >= bottom) return NULL;
+
+    void *element =
+        UEL_ATOMIC_LOAD(&deque->buffer[top & deque->mask], UEL_ATOMIC_RELAXED);
+    if(!UEL_ATOMIC_CAS(&deque->top, &top, top + 1)){
+        return NULL;
+    }
+    return element;
+}
+
+UEL_API uintptr_t uel_wsdeque_count(uel_wsdeque_t *deque){
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_ACQUIRE);
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_ACQUIRE);
+    return bottom > top ? (uintptr_t)(bottom - top) : 0;
+}
+
+#endif /* end of include guard: UEL_AMALGAMATED_H */
@@ -1,7 +0,0 @@
-var searchData=
-[
-  ['app_0',['app',['../structuel__module.html#a05f6845722afabe30337e1d294fb0a9e',1,'uel_module']]],
-  ['application_2eh_1',['application.h',['../application_8h.html',1,'']]],
-  ['automatic_2dpool_2eh_2',['automatic-pool.h',['../automatic-pool_8h.html',1,'']]],
-  ['autoptr_5fpool_3',['autoptr_pool',['../structuel__autopool.html#aa0f1f8622a0ba1f1d2d15d94eb5cbc71',1,'uel_autopool']]]
-];
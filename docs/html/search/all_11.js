@@ -1,188 +0,0 @@
-var searchData=
-[
-  ['uel_5fapp_5fenqueue_5fclosure_97',['uel_app_enqueue_closure',['../application_8h.html#a0ccd5d564ff573bcf157a0b21f58cca7',1,'application.h']]],
-  ['uel_5fapp_5fevent_98',['uel_app_event',['../application_8h.html#a335ab53567298b8918257c2970b388f2',1,'application.h']]],
-  ['uel_5fapp_5fevent_5ft_99',['uel_app_event_t',['../application_8h.html#a138e72d6aced8d43e9a2d0c63c830080',1,'application.h']]],
-  ['uel_5fapp_5finit_100',['uel_app_init',['../application_8h.html#ab221d8fc71af4fbf92525a7691b039ae',1,'application.h']]],
-  ['uel_5fapp_5fload_101',['uel_app_load',['../application_8h.html#aed8a446de669fcab5bc591fb28d3b5f6',1,'application.h']]],
-  ['uel_5fapp_5fobserve_102',['uel_app_observe',['../application_8h.html#ab581cf79189c8c2bdbb6b476ee91c761',1,'application.h']]],
-  ['uel_5fapp_5frequire_103',['uel_app_require',['../application_8h.html#a66ccab648cf052380fd7459748316e29',1,'application.h']]],
-  ['uel_5fapp_5frun_5fat_5fintervals_104',['uel_app_run_at_intervals',['../application_8h.html#a5f9d6a430845dc9bc6150346f8bb00ef',1,'application.h']]],
-  ['uel_5fapp_5frun_5flater_105',['uel_app_run_later',['../application_8h.html#a662ad4bd4836fe3790eefe21fd38ba0e',1,'application.h']]],
-  ['uel_5fapp_5ftick_106',['uel_app_tick',['../application_8h.html#adbbe5a9f65d8b1168d00c270cff52085',1,'application.h']]],
-  ['uel_5fapp_5fupdate_5ftimer_107',['uel_app_update_timer',['../application_8h.html#aac33288da9d190eda72d9598b877b7f7',1,'application.h']]],
-  ['uel_5fapplication_108',['uel_application',['../structuel__application.html',1,'']]],
-  ['uel_5fautopool_109',['uel_autopool',['../structuel__autopool.html',1,'']]],
-  ['uel_5fautopool_5falloc_110',['uel_autopool_alloc',['../automatic-pool_8h.html#aa4824c8fb0acb2059ee3c1ebf327712f',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fbuffers_111',['UEL_AUTOPOOL_BUFFERS',['../automatic-pool_8h.html#a956766ef0a875886ce9cee1751fed842',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fbuffers_5fat_112',['UEL_AUTOPOOL_BUFFERS_AT',['../automatic-pool_8h.html#a06ddb8294f2f7ff72a458684df783479',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fbuffers_5fin_113',['UEL_AUTOPOOL_BUFFERS_IN',['../automatic-pool_8h.html#aed55c3bfece785d4bc440359c4a84697',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5finit_114',['uel_autopool_init',['../automatic-pool_8h.html#a32b26c65f4e2c7dfc733e14a0c06b746',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fis_5fempty_115',['uel_autopool_is_empty',['../automatic-pool_8h.html#aa94c4ff64e887bff5dfc5c8ef3fcd380',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fset_5fconstructor_116',['uel_autopool_set_constructor',['../automatic-pool_8h.html#ab00201d7a847f7844ba6a1aebe38384d',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fset_5fdestructor_117',['uel_autopool_set_destructor',['../automatic-pool_8h.html#a7f57eb19fffa1865c2a8b69aa61acc2b',1,'automatic-pool.h']]],
-  ['uel_5fautoptr_118',['uel_autoptr',['../structuel__autoptr.html',1,'']]],
-  ['uel_5fautoptr_5fdealloc_119',['uel_autoptr_dealloc',['../automatic-pool_8h.html#affb23d5f2209456cfcb4228ae258f409',1,'automatic-pool.h']]],
-  ['uel_5fautoptr_5ft_120',['uel_autoptr_t',['../automatic-pool_8h.html#a83a2aef2df919bea22dd489c0a5403fd',1,'automatic-pool.h']]],
-  ['uel_5fclosure_121',['uel_closure',['../structuel__closure.html',1,'']]],
-  ['uel_5fclosure_5fcreate_122',['uel_closure_create',['../closure_8h.html#adbc9cc1a9562693b06bfacd82d8ac978',1,'closure.h']]],
-  ['uel_5fclosure_5ffunction_5ft_123',['uel_closure_function_t',['../closure_8h.html#a04cc5d51a9c86aeedcd6641b43dd8564',1,'closure.h']]],
-  ['uel_5fclosure_5finvoke_124',['uel_closure_invoke',['../closure_8h.html#adcd44820dd3715e206fdf71800e8926c',1,'closure.h']]],
-  ['uel_5fconditional_125',['uel_conditional',['../structuel__conditional.html',1,'']]],
-  ['uel_5fconditional_5fapply_126',['uel_conditional_apply',['../conditional_8h.html#a09ded07bf4d8645615a25557a87c996d',1,'conditional.h']]],
-  ['uel_5fconditional_5finit_127',['uel_conditional_init',['../conditional_8h.html#acb6e7aa5cd25863e7a628d233a967412',1,'conditional.h']]],
-  ['uel_5fcqueue_128',['uel_cqueue',['../structuel__cqueue.html',1,'']]],
-  ['uel_5fcqueue_5fclear_129',['uel_cqueue_clear',['../circular-queue_8h.html#a8df6047e956a849653bc6fe980706a07',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5fcount_130',['uel_cqueue_count',['../circular-queue_8h.html#ad5efb7d3f6579abf94ae15c83cbcde40',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5finit_131',['uel_cqueue_init',['../circular-queue_8h.html#acf451cae31642c456faada2501a4977e',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5fis_5fempty_132',['uel_cqueue_is_empty',['../circular-queue_8h.html#abcd173ac88be8796deacdff15aa0e964',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5fis_5ffull_133',['uel_cqueue_is_full',['../circular-queue_8h.html#a8ab1a212bf38b1578f9df769b65437e3',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5fpeek_5fhead_134',['uel_cqueue_peek_head',['../circular-queue_8h.html#a8d23ce639b076f853247a62670cfae30',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5fpeek_5ftail_135',['uel_cqueue_peek_tail',['../circular-queue_8h.html#aaf2d52fbe078fc80ef8e6119d12155ff',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5fpop_136',['uel_cqueue_pop',['../circular-queue_8h.html#a818331aa6bf56e977f7a95d996e9009d',1,'circular-queue.h']]],
-  ['uel_5fcqueue_5fpush_137',['uel_cqueue_push',['../circular-queue_8h.html#ae65acd13845cdd8e2492201538c2e968',1,'circular-queue.h']]],
-  ['uel_5fcritical_5fenter_138',['UEL_CRITICAL_ENTER',['../critical-section_8h.html#a7c0f97308e835939cf0404b167cc188a',1,'critical-section.h']]],
-  ['uel_5fcritical_5fexit_139',['UEL_CRITICAL_EXIT',['../critical-section_8h.html#aebdb2b9597df1dac79b2fd88d58d6539',1,'critical-section.h']]],
-  ['uel_5fdeclare_5fautopool_5fbuffers_140',['UEL_DECLARE_AUTOPOOL_BUFFERS',['../automatic-pool_8h.html#a59c59798394f60a6e567954997cc8176',1,'automatic-pool.h']]],
-  ['uel_5fdeclare_5fobjpool_5fbuffers_141',['UEL_DECLARE_OBJPOOL_BUFFERS',['../object-pool_8h.html#a6f94946d39d323f7ea0f409962c59f1e',1,'object-pool.h']]],
-  ['uel_5fevent_5fconfig_5fclosure_142',['uel_event_config_closure',['../event_8h.html#a39a1530d0b0a93a8d810d0e37fe03160',1,'event.h']]],
-  ['uel_5fevent_5fconfig_5fobserver_143',['uel_event_config_observer',['../event_8h.html#afc174dfecb1d892499c2edd5a1f5f879',1,'event.h']]],
-  ['uel_5fevent_5fconfig_5fsignal_144',['uel_event_config_signal',['../event_8h.html#a2345bf8b0ddb2f59b4d5f35f0442d3cf',1,'event.h']]],
-  ['uel_5fevent_5fconfig_5fsignal_5flistener_145',['uel_event_config_signal_listener',['../event_8h.html#a4f2472662aa1378f437ac46dd85088e8',1,'event.h']]],
-  ['uel_5fevent_5fconfig_5ftimer_146',['uel_event_config_timer',['../event_8h.html#ac5daec069fa7e1e98044307c06e7bc85',1,'event.h']]],
-  ['uel_5fevent_5fdetail_147',['uel_event_detail',['../unionevent_1_1uel__event__detail.html',1,'event']]],
-  ['uel_5fevent_5flistener_148',['uel_event_listener',['../structevent_1_1uel__event__detail_1_1uel__event__listener.html',1,'event::uel_event_detail']]],
-  ['uel_5fevent_5fobserver_149',['uel_event_observer',['../structevent_1_1uel__event__detail_1_1uel__event__observer.html',1,'event::uel_event_detail']]],
-  ['uel_5fevent_5fobserver_5fcancel_150',['uel_event_observer_cancel',['../event_8h.html#ad3ebbe62dc7e5749c447b28238499af6',1,'event.h']]],
-  ['uel_5fevent_5fsignal_151',['uel_event_signal',['../structevent_1_1uel__event__detail_1_1uel__event__signal.html',1,'event::uel_event_detail']]],
-  ['uel_5fevent_5ftimer_152',['uel_event_timer',['../structevent_1_1uel__event__detail_1_1uel__event__timer.html',1,'event::uel_event_detail']]],
-  ['uel_5fevent_5ftimer_5fcancel_153',['uel_event_timer_cancel',['../event_8h.html#a306a18151beee2907b06895f86f8837d',1,'event.h']]],
-  ['uel_5fevent_5ftimer_5fpause_154',['uel_event_timer_pause',['../event_8h.html#af7fa468eacdeaf628daa64808721dabd',1,'event.h']]],
-  ['uel_5fevent_5ftimer_5fresume_155',['uel_event_timer_resume',['../event_8h.html#ae876c8b387f90c2a05a78a922ed8c9fb',1,'event.h']]],
-  ['uel_5fevent_5ftimer_5fstatus_156',['uel_event_timer_status',['../event_8h.html#ae586ca82fed67108457450a49661a4aa',1,'event.h']]],
-  ['uel_5fevent_5ftimer_5fstatus_5ft_157',['uel_event_timer_status_t',['../event_8h.html#ada757ae763328a1774f87efe179e0d0d',1,'event.h']]],
-  ['uel_5fevent_5ftype_158',['uel_event_type',['../event_8h.html#a0a3805dfccf139ba6521d57e0b79fb60',1,'event.h']]],
-  ['uel_5fevent_5ftype_5ft_159',['uel_event_type_t',['../event_8h.html#a04647f8821482fc8f635924fc2f1539b',1,'event.h']]],
-  ['uel_5fevloop_160',['uel_evloop',['../structuel__evloop.html',1,'']]],
-  ['uel_5fevloop_5fenqueue_5fclosure_161',['uel_evloop_enqueue_closure',['../event-loop_8h.html#a1d3464894f0281c7b1f4c9c18dddcaf4',1,'event-loop.h']]],
-  ['uel_5fevloop_5finit_162',['uel_evloop_init',['../event-loop_8h.html#abb6102256fd588588045a5743f07247d',1,'event-loop.h']]],
-  ['uel_5fevloop_5fobserve_163',['uel_evloop_observe',['../event-loop_8h.html#af08a755b11d666cdfa0b35446d007d13',1,'event-loop.h']]],
-  ['uel_5fevloop_5fobserve_5fonce_164',['uel_evloop_observe_once',['../event-loop_8h.html#a67264e6232817d1f23288856dbd1a3bb',1,'event-loop.h']]],
-  ['uel_5fevloop_5frun_165',['uel_evloop_run',['../event-loop_8h.html#ad5371df9faa7072e1fd11470448de901',1,'event-loop.h']]],
-  ['uel_5ffunc_5fall_166',['uel_func_all',['../functional_8h.html#a27004669ef5f883bdf911b6d3ec28995',1,'functional.h']]],
-  ['uel_5ffunc_5fany_167',['uel_func_any',['../functional_8h.html#ab04a6190af8139356acde68fbfa36d19',1,'functional.h']]],
-  ['uel_5ffunc_5fconditional_168',['uel_func_conditional',['../functional_8h.html#a97c901138cf1de87f9c5675d525d9842',1,'functional.h']]],
-  ['uel_5ffunc_5fcount_169',['uel_func_count',['../functional_8h.html#a8c8014f63f6b20972697e867734034d4',1,'functional.h']]],
-  ['uel_5ffunc_5ffind_170',['uel_func_find',['../functional_8h.html#ac70b7b1e40d33fc05249d800361d4303',1,'functional.h']]],
-  ['uel_5ffunc_5fforeach_171',['uel_func_foreach',['../functional_8h.html#abe102286c62fd56e5f16014282144467',1,'functional.h']]],
-  ['uel_5ffunc_5fmap_172',['uel_func_map',['../functional_8h.html#a03c3cc3260a99348d50c6f8de16248ba',1,'functional.h']]],
-  ['uel_5ffunc_5fmapper_173',['uel_func_mapper',['../structuel__func__mapper.html',1,'']]],
-  ['uel_5ffunc_5fmapper_5finit_174',['uel_func_mapper_init',['../functional_8h.html#a6623a1b2cdf37983fd6bebf2fd3570c4',1,'functional.h']]],
-  ['uel_5ffunc_5fnone_175',['uel_func_none',['../functional_8h.html#a0f10f9a3f9d0131952d3ffc6ff6cdac0',1,'functional.h']]],
-  ['uel_5ffunc_5fpipeline_176',['uel_func_pipeline',['../functional_8h.html#a59ef21c6c45d7f95955f2b49f7ebc241',1,'functional.h']]],
-  ['uel_5fiterator_177',['uel_iterator',['../structuel__iterator.html',1,'']]],
-  ['uel_5fiterator_5fall_178',['uel_iterator_all',['../iterator_8h.html#add9308f85bc2ecf781bca558c3e0ce50',1,'iterator.h']]],
-  ['uel_5fiterator_5fany_179',['uel_iterator_any',['../iterator_8h.html#a354f1f9b00d7033338dd2e5bd078da19',1,'iterator.h']]],
-  ['uel_5fiterator_5farray_180',['uel_iterator_array',['../structuel__iterator__array.html',1,'']]],
-  ['uel_5fiterator_5farray_5fcreate_181',['uel_iterator_array_create',['../iterator_8h.html#a0acc2751d0a555963f923fca73c0200a',1,'iterator.h']]],
-  ['uel_5fiterator_5farray_5fnext_182',['uel_iterator_array_next',['../iterator_8h.html#ae527f0990ab89f4f2e5ad26fd6fd90b6',1,'iterator.h']]],
-  ['uel_5fiterator_5fcount_183',['uel_iterator_count',['../iterator_8h.html#ae415aaa0c760c504717fcacfca3b294d',1,'iterator.h']]],
-  ['uel_5fiterator_5ffind_184',['uel_iterator_find',['../iterator_8h.html#ae77e788e5eae4d1ef812005ccc6d83e9',1,'iterator.h']]],
-  ['uel_5fiterator_5fforeach_185',['uel_iterator_foreach',['../iterator_8h.html#a590b4d91255d67d8878675503ec235f0',1,'iterator.h']]],
-  ['uel_5fiterator_5fllist_5fcreate_186',['uel_iterator_llist_create',['../iterator_8h.html#ae6d556c0d69311f1ea8deb05ddb722a4',1,'iterator.h']]],
-  ['uel_5fiterator_5fllist_5fnext_187',['uel_iterator_llist_next',['../iterator_8h.html#a52d44b593487736766981844ab9c381f',1,'iterator.h']]],
-  ['uel_5fiterator_5fllist_5ft_188',['uel_iterator_llist_t',['../iterator_8h.html#a0646f93de558b7d6c5c312c010cf7254',1,'iterator.h']]],
-  ['uel_5fiterator_5fmap_189',['uel_iterator_map',['../iterator_8h.html#a6ca0083f388164973c9d6f9518799b03',1,'iterator.h']]],
-  ['uel_5fiterator_5fmap_5fboundless_190',['UEL_ITERATOR_MAP_BOUNDLESS',['../iterator_8h.html#a6f1cacb4e55d7a7e1b7d1a4ae9f8c2bb',1,'iterator.h']]],
-  ['uel_5fiterator_5fnone_191',['uel_iterator_none',['../iterator_8h.html#a51d3573756956d42f7b67b5b9acc27a3',1,'iterator.h']]],
-  ['uel_5fllist_192',['uel_llist',['../structuel__llist.html',1,'']]],
-  ['uel_5fllist_5finit_193',['uel_llist_init',['../linked-list_8h.html#a636d9d433df7fd53fc3138b6c77df75a',1,'linked-list.h']]],
-  ['uel_5fllist_5finsert_5fat_194',['uel_llist_insert_at',['../linked-list_8h.html#a2486cc91fa52a2fac1f0b0e7dc9a4562',1,'linked-list.h']]],
-  ['uel_5fllist_5fnode_195',['uel_llist_node',['../structuel__llist__node.html',1,'']]],
-  ['uel_5fllist_5fpeek_5fhead_196',['uel_llist_peek_head',['../linked-list_8h.html#ab663ff1457ec2ddbcba9a8f1c7399163',1,'linked-list.h']]],
-  ['uel_5fllist_5fpeek_5ftail_197',['uel_llist_peek_tail',['../linked-list_8h.html#a33fca34e728f3524f6ebd328b96a1c80',1,'linked-list.h']]],
-  ['uel_5fllist_5fpop_5fhead_198',['uel_llist_pop_head',['../linked-list_8h.html#aeb330b9c1971e23248fc39d918979503',1,'linked-list.h']]],
-  ['uel_5fllist_5fpop_5ftail_199',['uel_llist_pop_tail',['../linked-list_8h.html#ac4f27f948e355936eede9ef5ef808d43',1,'linked-list.h']]],
-  ['uel_5fllist_5fpush_5fhead_200',['uel_llist_push_head',['../linked-list_8h.html#a0a98f53f55f86adb45e4f0f357d748a8',1,'linked-list.h']]],
-  ['uel_5fllist_5fpush_5ftail_201',['uel_llist_push_tail',['../linked-list_8h.html#a2ab3add326e3c3a382386786fa5bbf63',1,'linked-list.h']]],
-  ['uel_5fllist_5fremove_202',['uel_llist_remove',['../linked-list_8h.html#acdb87dcd0d23db28be24297a7f7db7b0',1,'linked-list.h']]],
-  ['uel_5fllist_5fremove_5fwhile_203',['uel_llist_remove_while',['../linked-list_8h.html#a55def6b7dd819e8e9798787f781d00b7',1,'linked-list.h']]],
-  ['uel_5fmodule_204',['uel_module',['../structuel__module.html',1,'']]],
-  ['uel_5fmodule_5fconfig_205',['uel_module_config',['../module_8h.html#aa20d61157d25ebdb6abd2d774e2035d9',1,'module.h']]],
-  ['uel_5fmodule_5fhook_5ft_206',['uel_module_hook_t',['../module_8h.html#ad589448a7bcdb1d7cce57f42346a1657',1,'module.h']]],
-  ['uel_5fmodule_5finit_207',['uel_module_init',['../module_8h.html#a3a1d7dc04cf2b7c5c84a61cfd5056772',1,'module.h']]],
-  ['uel_5fmodule_5flaunch_208',['uel_module_launch',['../module_8h.html#a144a21cefd8d58d672b02b21def8c627',1,'module.h']]],
-  ['uel_5fnop_209',['uel_nop',['../closure_8h.html#a1f88fc773dbcea710594c7175d3a4ac3',1,'closure.h']]],
-  ['uel_5fobjpool_210',['uel_objpool',['../structuel__objpool.html',1,'']]],
-  ['uel_5fobjpool_5facquire_211',['uel_objpool_acquire',['../object-pool_8h.html#a54248e0810ccb791a8ff82d3de8fc6c5',1,'object-pool.h']]],
-  ['uel_5fobjpool_5fbuffers_212',['UEL_OBJPOOL_BUFFERS',['../object-pool_8h.html#a623ea70a0df4cc76d0e65a99bc5c26c9',1,'object-pool.h']]],
-  ['uel_5fobjpool_5fbuffers_5fat_213',['UEL_OBJPOOL_BUFFERS_AT',['../object-pool_8h.html#aa3a5c0e14ab186fffed61c2b3d67405e',1,'object-pool.h']]],
-  ['uel_5fobjpool_5fbuffers_5fin_214',['UEL_OBJPOOL_BUFFERS_IN',['../object-pool_8h.html#ae25ae5d897163fb9104f4295f6fdf84b',1,'object-pool.h']]],
-  ['uel_5fobjpool_5finit_215',['uel_objpool_init',['../object-pool_8h.html#ab49dd047b6e4fcc0939dfd651e3b3666',1,'object-pool.h']]],
-  ['uel_5fobjpool_5fis_5fempty_216',['uel_objpool_is_empty',['../object-pool_8h.html#ae116db7f19b0971e6781e375361265ce',1,'object-pool.h']]],
-  ['uel_5fobjpool_5frelease_217',['uel_objpool_release',['../object-pool_8h.html#af4370a164b82e436749fbc9f8af9a114',1,'object-pool.h']]],
-  ['uel_5fpipeline_218',['uel_pipeline',['../structuel__pipeline.html',1,'']]],
-  ['uel_5fpipeline_5fapply_219',['uel_pipeline_apply',['../pipeline_8h.html#a54df79756518430d753961735c93d270',1,'pipeline.h']]],
-  ['uel_5fpipeline_5fdeclare_220',['UEL_PIPELINE_DECLARE',['../pipeline_8h.html#a64c47a347b70a55627e1a66a9972890c',1,'pipeline.h']]],
-  ['uel_5fpipeline_5finit_221',['uel_pipeline_init',['../pipeline_8h.html#ad7cfa65777a90f537ab031b6d8dac028',1,'pipeline.h']]],
-  ['uel_5fpromise_222',['uel_promise',['../structuel__promise.html',1,'']]],
-  ['uel_5fpromise_5fafter_223',['uel_promise_after',['../promise_8h.html#a4b1b8ee1101104f1beaa782ef630767f',1,'promise.h']]],
-  ['uel_5fpromise_5falways_224',['uel_promise_always',['../promise_8h.html#a6a932817fcd43d5eaa2723b8c34132ff',1,'promise.h']]],
-  ['uel_5fpromise_5fcatch_225',['uel_promise_catch',['../promise_8h.html#a550561c65f5abb38bc5c3b25083dd468',1,'promise.h']]],
-  ['uel_5fpromise_5fcreate_226',['uel_promise_create',['../promise_8h.html#a5c0cdf2e971bf738362af1761c729bd4',1,'promise.h']]],
-  ['uel_5fpromise_5fdestroy_227',['uel_promise_destroy',['../promise_8h.html#ac43ce3e3316581da32cf3e21c15901f0',1,'promise.h']]],
-  ['uel_5fpromise_5fdestroyer_228',['uel_promise_destroyer',['../promise_8h.html#a9b68547bf7ac1a5860b165a4638bcc51',1,'promise.h']]],
-  ['uel_5fpromise_5fpending_229',['UEL_PROMISE_PENDING',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856ae619a3bfec8234d4302fbec8c2dfe6d2',1,'promise.h']]],
-  ['uel_5fpromise_5freject_230',['uel_promise_reject',['../promise_8h.html#a2e904cfb182cb5619b0a31790fca697e',1,'promise.h']]],
-  ['uel_5fpromise_5frejected_231',['UEL_PROMISE_REJECTED',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856ae137a12a3c564815d59e2548e304ab39',1,'promise.h']]],
-  ['uel_5fpromise_5frejecter_232',['uel_promise_rejecter',['../promise_8h.html#a09b820cf5093f6979da34cbe6faa1787',1,'promise.h']]],
-  ['uel_5fpromise_5fresettle_233',['uel_promise_resettle',['../promise_8h.html#a2d226c4ed1a94964db50dbb5a7f958df',1,'promise.h']]],
-  ['uel_5fpromise_5fresolve_234',['uel_promise_resolve',['../promise_8h.html#abe5aae85467a9af06b580df74aeedb8c',1,'promise.h']]],
-  ['uel_5fpromise_5fresolved_235',['UEL_PROMISE_RESOLVED',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856a5ef1eb9b1cdf442f77a5844d9cca3ce0',1,'promise.h']]],
-  ['uel_5fpromise_5fresolver_236',['uel_promise_resolver',['../promise_8h.html#acffa84389150a36442905a6f89cb827b',1,'promise.h']]],
-  ['uel_5fpromise_5fsegment_237',['uel_promise_segment',['../structuel__promise__segment.html',1,'']]],
-  ['uel_5fpromise_5fshortcuts_238',['UEL_PROMISE_SHORTCUTS',['../config_8h.html#a815cda45b611ac94d7b7b56bbeb12e1c',1,'config.h']]],
-  ['uel_5fpromise_5fstate_239',['uel_promise_state',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856',1,'promise.h']]],
-  ['uel_5fpromise_5fstate_5ft_240',['uel_promise_state_t',['../promise_8h.html#a95fdddb2c4ccf80657feebb0d4c9adfb',1,'promise.h']]],
-  ['uel_5fpromise_5fstore_241',['uel_promise_store',['../structuel__promise__store.html',1,'']]],
-  ['uel_5fpromise_5fstore_5fcreate_242',['uel_promise_store_create',['../promise_8h.html#a4e3a7f9f0d154d4a2fa1c17520bd5561',1,'promise.h']]],
-  ['uel_5fpromise_5fthen_243',['uel_promise_then',['../promise_8h.html#abb34042cccffccafefb813a902ec8389',1,'promise.h']]],
-  ['uel_5fsch_5finit_244',['uel_sch_init',['../scheduler_8h.html#a7f4ae225987bb741ca824c83a96ce138',1,'scheduler.h']]],
-  ['uel_5fsch_5fmanage_5ftimers_245',['uel_sch_manage_timers',['../scheduler_8h.html#a2666a61c55a518fd602cee03a014ed10',1,'scheduler.h']]],
-  ['uel_5fsch_5frun_5fat_5fintervals_246',['uel_sch_run_at_intervals',['../scheduler_8h.html#a6a993056042a7649e1e7375eb2bb588d',1,'scheduler.h']]],
-  ['uel_5fsch_5frun_5flater_247',['uel_sch_run_later',['../scheduler_8h.html#ad5909fddc1856cc1b980a0445602c67c',1,'scheduler.h']]],
-  ['uel_5fsch_5fupdate_5ftimer_248',['uel_sch_update_timer',['../scheduler_8h.html#a0a5a89adf45a470aed0e39925a256ea2',1,'scheduler.h']]],
-  ['uel_5fscheduler_249',['uel_scheduler',['../structuel__scheduler.html',1,'']]],
-  ['uel_5fsignal_5femit_250',['uel_signal_emit',['../signal_8h.html#af849f4effe2577efe439387d3a8a710a',1,'signal.h']]],
-  ['uel_5fsignal_5flisten_251',['uel_signal_listen',['../signal_8h.html#ac11a6acd9237d30551bc0dc8ba406189',1,'signal.h']]],
-  ['uel_5fsignal_5flisten_5fonce_252',['uel_signal_listen_once',['../signal_8h.html#a6d59d4a7b4c0c5f6b1d271ed6e8a8212',1,'signal.h']]],
-  ['uel_5fsignal_5flistener_5ft_253',['uel_signal_listener_t',['../signal_8h.html#acf4ce9806bae5489706f0409f0a58067',1,'signal.h']]],
-  ['uel_5fsignal_5fmax_5flisteners_254',['UEL_SIGNAL_MAX_LISTENERS',['../config_8h.html#a7dec29ef683393c228642729b534fbf5',1,'config.h']]],
-  ['uel_5fsignal_5freject_5fpromise_255',['uel_signal_reject_promise',['../signal_8h.html#a9dafdd735ff9f06ddc2b0c80862e8af6',1,'signal.h']]],
-  ['uel_5fsignal_5frelay_256',['uel_signal_relay',['../structuel__signal__relay.html',1,'']]],
-  ['uel_5fsignal_5frelay_5finit_257',['uel_signal_relay_init',['../signal_8h.html#a8eaa68abe3e288c96eb0ae88d244364f',1,'signal.h']]],
-  ['uel_5fsignal_5fresolve_5fpromise_258',['uel_signal_resolve_promise',['../signal_8h.html#a1b208dd90b74c52c2775518c242f7c8a',1,'signal.h']]],
-  ['uel_5fsignal_5ft_259',['uel_signal_t',['../signal_8h.html#a4321d8b0f2c6bc3c0cc143e1bb1d1a2b',1,'signal.h']]],
-  ['uel_5fsignal_5funlisten_260',['uel_signal_unlisten',['../signal_8h.html#a3fb31014f6cec7acf29e7de4b66fe531',1,'signal.h']]],
-  ['uel_5fsyspools_5facquire_5fevent_261',['uel_syspools_acquire_event',['../system-pools_8h.html#afa790328d17062994bc3f958b9e96ea4',1,'system-pools.h']]],
-  ['uel_5fsyspools_5facquire_5fllist_5fnode_262',['uel_syspools_acquire_llist_node',['../system-pools_8h.html#a11d44d4872dd5110c3573e0dd8cfc9d3',1,'system-pools.h']]],
-  ['uel_5fsyspools_5fevent_5fpool_5fsize_263',['UEL_SYSPOOLS_EVENT_POOL_SIZE',['../system-pools_8h.html#a338ddcefe15ac9790e2c246817b2bd86',1,'system-pools.h']]],
-  ['uel_5fsyspools_5fevent_5fpool_5fsize_5flog2n_264',['UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N',['../config_8h.html#aacb6827b910a09fe40f49dfc22bc3a9b',1,'config.h']]],
-  ['uel_5fsyspools_5finit_265',['uel_syspools_init',['../system-pools_8h.html#a737df9d7ca7c587711dc8c59d9f1c277',1,'system-pools.h']]],
-  ['uel_5fsyspools_5fllist_5fnode_5fpool_5fsize_266',['UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE',['../system-pools_8h.html#a5015b8b98a72b1642be11223dfd4b400',1,'system-pools.h']]],
-  ['uel_5fsyspools_5fllist_5fnode_5fpool_5fsize_5flog2n_267',['UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N',['../config_8h.html#ab3932a51e5254319c1d0feb178a5b164',1,'config.h']]],
-  ['uel_5fsyspools_5frelease_5fevent_268',['uel_syspools_release_event',['../system-pools_8h.html#a52991a37f5e0da28ecc6161ed8932911',1,'system-pools.h']]],
-  ['uel_5fsyspools_5frelease_5fllist_5fnode_269',['uel_syspools_release_llist_node',['../system-pools_8h.html#ae392a6e20954e33629d67a5729c9de02',1,'system-pools.h']]],
-  ['uel_5fsysqueues_5fcount_5fenqueued_5fevents_270',['uel_sysqueues_count_enqueued_events',['../system-queues_8h.html#a7caa3edc1266d927d334b6b85af5ec95',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fcount_5fscheduled_5fevents_271',['uel_sysqueues_count_scheduled_events',['../system-queues_8h.html#a50a5ee20919b0362d640b3816a2ed191',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fenqueue_5fevent_272',['uel_sysqueues_enqueue_event',['../system-queues_8h.html#ac58c61b4b8d432898a6c5b2a47b7d197',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fevent_5fqueue_5fsize_273',['UEL_SYSQUEUES_EVENT_QUEUE_SIZE',['../system-queues_8h.html#a1d616ec92aac7c521870c1ddfbfecba9',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fevent_5fqueue_5fsize_5flog2n_274',['UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N',['../config_8h.html#a89c8fac6285ec1a2ad001ee55d131e90',1,'config.h']]],
-  ['uel_5fsysqueues_5fget_5fenqueued_5fevent_275',['uel_sysqueues_get_enqueued_event',['../system-queues_8h.html#a897b9899eefbe90ac11e651b5117bfd3',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fget_5fscheduled_5fevent_276',['uel_sysqueues_get_scheduled_event',['../system-queues_8h.html#a1730d1f7a7e86a3a79df40938fa9d735',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5finit_277',['uel_sysqueues_init',['../system-queues_8h.html#aa988e6daddfd00129d56c1db350edc5a',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fschedule_5fevent_278',['uel_sysqueues_schedule_event',['../system-queues_8h.html#ac14ac33abf67b93d8904e5ebb1218028',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fschedule_5fqueue_5fsize_279',['UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE',['../system-queues_8h.html#a0a913dc860f0136e0633381c33d1821e',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fschedule_5fqueue_5fsize_5flog2n_280',['UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N',['../config_8h.html#af83cc01ed7c71a81a08be6340bff7f4b',1,'config.h']]],
-  ['unlistened_281',['unlistened',['../structevent_1_1uel__event__detail_1_1uel__event__listener.html#a7c68240052221e1ebbab4a9c1c096512',1,'event::uel_event_detail::uel_event_listener']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['value_282',['value',['../structevent.html#af86fbbe00fa2851d24d29ba9b39f3ee2',1,'event::value()'],['../structevent_1_1uel__event__detail_1_1uel__event__signal.html#a74bcb07d316f77b7a2ec6efc3a62fe31',1,'event::uel_event_detail::uel_event_signal::value()'],['../structuel__llist__node.html#a1be7a63ce1a37b1bbb18bef46b8eae58',1,'uel_llist_node::value()'],['../structuel__promise.html#afca1c89f5e4903aa9df56416e0ae0f98',1,'uel_promise::value()']]]
-];
@@ -1,17 +0,0 @@
-var searchData=
-[
-  ['cancelled_6',['cancelled',['../structevent_1_1uel__event__detail_1_1uel__event__observer.html#a1bd55787112aae874e8b4c906a37614e',1,'event::uel_event_detail::uel_event_observer']]],
-  ['circular_2dqueue_2eh_7',['circular-queue.h',['../circular-queue_8h.html',1,'']]],
-  ['closure_8',['closure',['../structevent.html#aac834e055b38447126d27c0dec51498c',1,'event']]],
-  ['closure_2eh_9',['closure.h',['../closure_8h.html',1,'']]],
-  ['closures_10',['closures',['../structuel__pipeline.html#a5dafb55ed93d4b7a6e8c7a9cfc50af4c',1,'uel_pipeline']]],
-  ['collection_11',['collection',['../structuel__iterator.html#a37bae427d28c271a3e9fbdc0c3a70b8d',1,'uel_iterator']]],
-  ['condition_5fvar_12',['condition_var',['../structevent_1_1uel__event__detail_1_1uel__event__observer.html#ac17e9951df24dfb12fa6a7824f65c311',1,'event::uel_event_detail::uel_event_observer']]],
-  ['conditional_2eh_13',['conditional.h',['../conditional_8h.html',1,'']]],
-  ['config_14',['config',['../structuel__module.html#a9b066ffb62e47bf3fac7e0d70623eb15',1,'uel_module']]],
-  ['config_2eh_15',['config.h',['../config_8h.html',1,'']]],
-  ['constructor_16',['constructor',['../structuel__autopool.html#a7890d66a262f1c057598b5cf281df2c2',1,'uel_autopool']]],
-  ['context_17',['context',['../structuel__closure.html#ae22a9c4275f31ab9741ef42479ce59cf',1,'uel_closure']]],
-  ['count_18',['count',['../structuel__cqueue.html#a0ef8883068b2d0b6d37e03cd33c46628',1,'uel_cqueue::count()'],['../structuel__llist.html#abd8b53084233e30e2dd36e1e2e7538f0',1,'uel_llist::count()'],['../structuel__pipeline.html#a6b52ff1fecb520e604f0b167e9c85a46',1,'uel_pipeline::count()']]],
-  ['critical_2dsection_2eh_19',['critical-section.h',['../critical-section_8h.html',1,'']]]
-];
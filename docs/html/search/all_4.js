@@ -1,12 +0,0 @@
-var searchData=
-[
-  ['event_24',['event',['../structevent.html',1,'']]],
-  ['event_2dloop_2eh_25',['event-loop.h',['../event-loop_8h.html',1,'']]],
-  ['event_2eh_26',['event.h',['../event_8h.html',1,'']]],
-  ['event_5floop_27',['event_loop',['../structuel__application.html#a206cef9bc1164781d91a883a38b0f0d9',1,'uel_application']]],
-  ['event_5fpool_28',['event_pool',['../structsyspools.html#ade1008e5647b9da5d4497d1d3dceadf1',1,'syspools']]],
-  ['event_5fpool_5fbuffer_29',['event_pool_buffer',['../structsyspools.html#a1a9c8bec00f4b19a1cea2d220860b89c',1,'syspools']]],
-  ['event_5fpool_5fqueue_5fbuffer_30',['event_pool_queue_buffer',['../structsyspools.html#ab54b76b022a0bff944791ca2ed3e157a',1,'syspools']]],
-  ['event_5fqueue_31',['event_queue',['../structsysqueues.html#a8ee3a87dc51095191300b5e90658d690',1,'sysqueues']]],
-  ['event_5fqueue_5fbuffer_32',['event_queue_buffer',['../structsysqueues.html#ae98fcac9a2822f2b2394a4c044f148a9',1,'sysqueues']]]
-];
@@ -1,6 +0,0 @@
-var searchData=
-[
-  ['first_5fsegment_33',['first_segment',['../structuel__promise.html#a6f892488ff6d7f0a6b90b128306c8498',1,'uel_promise']]],
-  ['function_34',['function',['../structuel__closure.html#a53af2a72baa02fe3d0b18e20aff59a66',1,'uel_closure']]],
-  ['functional_2eh_35',['functional.h',['../functional_8h.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['head_36',['head',['../structuel__llist.html#ab2e05ae8e0b0d0193011f8e5a4f903b6',1,'uel_llist']]]
-];
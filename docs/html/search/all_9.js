@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['mask_53',['mask',['../structuel__cqueue.html#a3f0a994df09bb73f3545024a857dca78',1,'uel_cqueue']]],
-  ['module_2eh_54',['module.h',['../module_8h.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['next_55',['next',['../structuel__iterator.html#a034411056043f9316d2b7458c2bcfdc3',1,'uel_iterator::next()'],['../structuel__llist__node.html#a7976a89a4700768e540bf5b164f2dc68',1,'uel_llist_node::next()'],['../structuel__promise__segment.html#aa2c791377649da1fa8bcfb73beff2b48',1,'uel_promise_segment::next()']]]
-];
@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['queue_65',['queue',['../structuel__objpool.html#a36c2a4bcb0eda229680daa4a03960506',1,'uel_objpool']]],
-  ['queues_66',['queues',['../structuel__application.html#a461dd6893eb70ee86bac7c43a9a86578',1,'uel_application::queues()'],['../structuel__evloop.html#aec967394710dd0b4b5184a8fd02d61a5',1,'uel_evloop::queues()'],['../structuel__scheduler.html#a962da3ed7102999d7379d2d26599160d',1,'uel_scheduler::queues()'],['../structuel__signal__relay.html#ae9438f0506aa721cbf56e917f58e0390',1,'uel_signal_relay::queues()']]]
-];
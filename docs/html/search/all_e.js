@@ -1,11 +0,0 @@
-var searchData=
-[
-  ['registry_67',['registry',['../structuel__application.html#aa02469024d8619255c81f6aace13e36e',1,'uel_application']]],
-  ['registry_5fsize_68',['registry_size',['../structuel__application.html#a5f7f83e74289e75c9e54b26e67bae14d',1,'uel_application']]],
-  ['reject_69',['reject',['../structuel__promise__segment.html#af38e4bf5f784ba283e91657b7b483c22',1,'uel_promise_segment']]],
-  ['relay_70',['relay',['../structuel__application.html#a5f1ffb5e716efc10ffd63968098ce2eb',1,'uel_application']]],
-  ['relay_5fbuffer_71',['relay_buffer',['../structuel__application.html#a4dc1aab92e88e5776d1013b4eb35ec5e',1,'uel_application']]],
-  ['repeating_72',['repeating',['../structevent.html#a67fa1b9a469d09599d2931769862d07b',1,'event']]],
-  ['resolve_73',['resolve',['../structuel__promise__segment.html#acd843866b15e8f0b035189404d002044',1,'uel_promise_segment']]],
-  ['run_5fscheduler_74',['run_scheduler',['../structuel__application.html#ad66b5adaa8603cec1f8072d43cc582f5',1,'uel_application']]]
-];
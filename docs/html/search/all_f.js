@@ -1,19 +0,0 @@
-var searchData=
-[
-  ['schedule_5fqueue_75',['schedule_queue',['../structsysqueues.html#a92e5df8975b6c6b1aa7f79df54da8565',1,'sysqueues']]],
-  ['schedule_5fqueue_5fbuffer_76',['schedule_queue_buffer',['../structsysqueues.html#a3f90eebf85af0e239358c276ea741917',1,'sysqueues']]],
-  ['scheduler_77',['scheduler',['../structuel__application.html#a977b88c48d61a8688773b062f74fc78c',1,'uel_application']]],
-  ['scheduler_2eh_78',['scheduler.h',['../scheduler_8h.html',1,'']]],
-  ['segment_5fpool_79',['segment_pool',['../structuel__promise__store.html#ae08a8b8b4a72f9e1d8cfb4d1c344317d',1,'uel_promise_store']]],
-  ['signal_80',['signal',['../unionevent_1_1uel__event__detail.html#a82ba97ed6ebbb9a86cecde4d0c48e4fc',1,'event::uel_event_detail']]],
-  ['signal_2eh_81',['signal.h',['../signal_8h.html',1,'']]],
-  ['signal_5fvector_82',['signal_vector',['../structuel__signal__relay.html#a264ee9199e913c30ec6487d258093324',1,'uel_signal_relay']]],
-  ['size_83',['size',['../structuel__cqueue.html#ad424eefbf635da1957a7c25a6b390a57',1,'uel_cqueue']]],
-  ['source_84',['source',['../structuel__autoptr.html#a32f472b4cef00ebc64db35493ac269d9',1,'uel_autoptr::source()'],['../structuel__promise.html#a2f753bbc2fcd30adcafac5de640143f5',1,'uel_promise::source()']]],
-  ['state_85',['state',['../structuel__promise.html#a678870a0975db700de0bbcb5d102aa4e',1,'uel_promise']]],
-  ['status_86',['status',['../structevent_1_1uel__event__detail_1_1uel__event__timer.html#a38f12f5dce7b8ef363fd5c8a786d3390',1,'event::uel_event_detail::uel_event_timer']]],
-  ['syspools_87',['syspools',['../structsyspools.html',1,'']]],
-  ['sysqueues_88',['sysqueues',['../structsysqueues.html',1,'']]],
-  ['system_2dpools_2eh_89',['system-pools.h',['../system-pools_8h.html',1,'']]],
-  ['system_2dqueues_2eh_90',['system-queues.h',['../system-queues_8h.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['event_285',['event',['../structevent.html',1,'']]]
-];
@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['syspools_286',['syspools',['../structsyspools.html',1,'']]],
-  ['sysqueues_287',['sysqueues',['../structsysqueues.html',1,'']]]
-];
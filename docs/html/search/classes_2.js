@@ -1,28 +0,0 @@
-var searchData=
-[
-  ['uel_5fapplication_288',['uel_application',['../structuel__application.html',1,'']]],
-  ['uel_5fautopool_289',['uel_autopool',['../structuel__autopool.html',1,'']]],
-  ['uel_5fautoptr_290',['uel_autoptr',['../structuel__autoptr.html',1,'']]],
-  ['uel_5fclosure_291',['uel_closure',['../structuel__closure.html',1,'']]],
-  ['uel_5fconditional_292',['uel_conditional',['../structuel__conditional.html',1,'']]],
-  ['uel_5fcqueue_293',['uel_cqueue',['../structuel__cqueue.html',1,'']]],
-  ['uel_5fevent_5fdetail_294',['uel_event_detail',['../unionevent_1_1uel__event__detail.html',1,'event']]],
-  ['uel_5fevent_5flistener_295',['uel_event_listener',['../structevent_1_1uel__event__detail_1_1uel__event__listener.html',1,'event::uel_event_detail']]],
-  ['uel_5fevent_5fobserver_296',['uel_event_observer',['../structevent_1_1uel__event__detail_1_1uel__event__observer.html',1,'event::uel_event_detail']]],
-  ['uel_5fevent_5fsignal_297',['uel_event_signal',['../structevent_1_1uel__event__detail_1_1uel__event__signal.html',1,'event::uel_event_detail']]],
-  ['uel_5fevent_5ftimer_298',['uel_event_timer',['../structevent_1_1uel__event__detail_1_1uel__event__timer.html',1,'event::uel_event_detail']]],
-  ['uel_5fevloop_299',['uel_evloop',['../structuel__evloop.html',1,'']]],
-  ['uel_5ffunc_5fmapper_300',['uel_func_mapper',['../structuel__func__mapper.html',1,'']]],
-  ['uel_5fiterator_301',['uel_iterator',['../structuel__iterator.html',1,'']]],
-  ['uel_5fiterator_5farray_302',['uel_iterator_array',['../structuel__iterator__array.html',1,'']]],
-  ['uel_5fllist_303',['uel_llist',['../structuel__llist.html',1,'']]],
-  ['uel_5fllist_5fnode_304',['uel_llist_node',['../structuel__llist__node.html',1,'']]],
-  ['uel_5fmodule_305',['uel_module',['../structuel__module.html',1,'']]],
-  ['uel_5fobjpool_306',['uel_objpool',['../structuel__objpool.html',1,'']]],
-  ['uel_5fpipeline_307',['uel_pipeline',['../structuel__pipeline.html',1,'']]],
-  ['uel_5fpromise_308',['uel_promise',['../structuel__promise.html',1,'']]],
-  ['uel_5fpromise_5fsegment_309',['uel_promise_segment',['../structuel__promise__segment.html',1,'']]],
-  ['uel_5fpromise_5fstore_310',['uel_promise_store',['../structuel__promise__store.html',1,'']]],
-  ['uel_5fscheduler_311',['uel_scheduler',['../structuel__scheduler.html',1,'']]],
-  ['uel_5fsignal_5frelay_312',['uel_signal_relay',['../structuel__signal__relay.html',1,'']]]
-];
@@ -1,25 +0,0 @@
-var searchData=
-[
-  ['uel_5fautopool_5fbuffers_547',['UEL_AUTOPOOL_BUFFERS',['../automatic-pool_8h.html#a956766ef0a875886ce9cee1751fed842',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fbuffers_5fat_548',['UEL_AUTOPOOL_BUFFERS_AT',['../automatic-pool_8h.html#a06ddb8294f2f7ff72a458684df783479',1,'automatic-pool.h']]],
-  ['uel_5fautopool_5fbuffers_5fin_549',['UEL_AUTOPOOL_BUFFERS_IN',['../automatic-pool_8h.html#aed55c3bfece785d4bc440359c4a84697',1,'automatic-pool.h']]],
-  ['uel_5fcritical_5fenter_550',['UEL_CRITICAL_ENTER',['../critical-section_8h.html#a7c0f97308e835939cf0404b167cc188a',1,'critical-section.h']]],
-  ['uel_5fcritical_5fexit_551',['UEL_CRITICAL_EXIT',['../critical-section_8h.html#aebdb2b9597df1dac79b2fd88d58d6539',1,'critical-section.h']]],
-  ['uel_5fdeclare_5fautopool_5fbuffers_552',['UEL_DECLARE_AUTOPOOL_BUFFERS',['../automatic-pool_8h.html#a59c59798394f60a6e567954997cc8176',1,'automatic-pool.h']]],
-  ['uel_5fdeclare_5fobjpool_5fbuffers_553',['UEL_DECLARE_OBJPOOL_BUFFERS',['../object-pool_8h.html#a6f94946d39d323f7ea0f409962c59f1e',1,'object-pool.h']]],
-  ['uel_5fiterator_5fmap_5fboundless_554',['UEL_ITERATOR_MAP_BOUNDLESS',['../iterator_8h.html#a6f1cacb4e55d7a7e1b7d1a4ae9f8c2bb',1,'iterator.h']]],
-  ['uel_5fobjpool_5fbuffers_555',['UEL_OBJPOOL_BUFFERS',['../object-pool_8h.html#a623ea70a0df4cc76d0e65a99bc5c26c9',1,'object-pool.h']]],
-  ['uel_5fobjpool_5fbuffers_5fat_556',['UEL_OBJPOOL_BUFFERS_AT',['../object-pool_8h.html#aa3a5c0e14ab186fffed61c2b3d67405e',1,'object-pool.h']]],
-  ['uel_5fobjpool_5fbuffers_5fin_557',['UEL_OBJPOOL_BUFFERS_IN',['../object-pool_8h.html#ae25ae5d897163fb9104f4295f6fdf84b',1,'object-pool.h']]],
-  ['uel_5fpipeline_5fdeclare_558',['UEL_PIPELINE_DECLARE',['../pipeline_8h.html#a64c47a347b70a55627e1a66a9972890c',1,'pipeline.h']]],
-  ['uel_5fpromise_5fshortcuts_559',['UEL_PROMISE_SHORTCUTS',['../config_8h.html#a815cda45b611ac94d7b7b56bbeb12e1c',1,'config.h']]],
-  ['uel_5fsignal_5fmax_5flisteners_560',['UEL_SIGNAL_MAX_LISTENERS',['../config_8h.html#a7dec29ef683393c228642729b534fbf5',1,'config.h']]],
-  ['uel_5fsyspools_5fevent_5fpool_5fsize_561',['UEL_SYSPOOLS_EVENT_POOL_SIZE',['../system-pools_8h.html#a338ddcefe15ac9790e2c246817b2bd86',1,'system-pools.h']]],
-  ['uel_5fsyspools_5fevent_5fpool_5fsize_5flog2n_562',['UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N',['../config_8h.html#aacb6827b910a09fe40f49dfc22bc3a9b',1,'config.h']]],
-  ['uel_5fsyspools_5fllist_5fnode_5fpool_5fsize_563',['UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE',['../system-pools_8h.html#a5015b8b98a72b1642be11223dfd4b400',1,'system-pools.h']]],
-  ['uel_5fsyspools_5fllist_5fnode_5fpool_5fsize_5flog2n_564',['UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N',['../config_8h.html#ab3932a51e5254319c1d0feb178a5b164',1,'config.h']]],
-  ['uel_5fsysqueues_5fevent_5fqueue_5fsize_565',['UEL_SYSQUEUES_EVENT_QUEUE_SIZE',['../system-queues_8h.html#a1d616ec92aac7c521870c1ddfbfecba9',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fevent_5fqueue_5fsize_5flog2n_566',['UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N',['../config_8h.html#a89c8fac6285ec1a2ad001ee55d131e90',1,'config.h']]],
-  ['uel_5fsysqueues_5fschedule_5fqueue_5fsize_567',['UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE',['../system-queues_8h.html#a0a913dc860f0136e0633381c33d1821e',1,'system-queues.h']]],
-  ['uel_5fsysqueues_5fschedule_5fqueue_5fsize_5flog2n_568',['UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N',['../config_8h.html#af83cc01ed7c71a81a08be6340bff7f4b',1,'config.h']]]
-];
@@ -1,7 +0,0 @@
-var searchData=
-[
-  ['uel_5fapp_5fevent_540',['uel_app_event',['../application_8h.html#a335ab53567298b8918257c2970b388f2',1,'application.h']]],
-  ['uel_5fevent_5ftimer_5fstatus_541',['uel_event_timer_status',['../event_8h.html#ae586ca82fed67108457450a49661a4aa',1,'event.h']]],
-  ['uel_5fevent_5ftype_542',['uel_event_type',['../event_8h.html#a0a3805dfccf139ba6521d57e0b79fb60',1,'event.h']]],
-  ['uel_5fpromise_5fstate_543',['uel_promise_state',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856',1,'promise.h']]]
-];
@@ -1,6 +0,0 @@
-var searchData=
-[
-  ['uel_5fpromise_5fpending_544',['UEL_PROMISE_PENDING',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856ae619a3bfec8234d4302fbec8c2dfe6d2',1,'promise.h']]],
-  ['uel_5fpromise_5frejected_545',['UEL_PROMISE_REJECTED',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856ae137a12a3c564815d59e2548e304ab39',1,'promise.h']]],
-  ['uel_5fpromise_5fresolved_546',['UEL_PROMISE_RESOLVED',['../promise_8h.html#ac0201d84b1e362087d83bdb57a8e8856a5ef1eb9b1cdf442f77a5844d9cca3ce0',1,'promise.h']]]
-];
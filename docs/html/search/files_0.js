@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['application_2eh_313',['application.h',['../application_8h.html',1,'']]],
-  ['automatic_2dpool_2eh_314',['automatic-pool.h',['../automatic-pool_8h.html',1,'']]]
-];
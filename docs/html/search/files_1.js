@@ -1,8 +0,0 @@
-var searchData=
-[
-  ['circular_2dqueue_2eh_315',['circular-queue.h',['../circular-queue_8h.html',1,'']]],
-  ['closure_2eh_316',['closure.h',['../closure_8h.html',1,'']]],
-  ['conditional_2eh_317',['conditional.h',['../conditional_8h.html',1,'']]],
-  ['config_2eh_318',['config.h',['../config_8h.html',1,'']]],
-  ['critical_2dsection_2eh_319',['critical-section.h',['../critical-section_8h.html',1,'']]]
-];
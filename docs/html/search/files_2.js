@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['event_2dloop_2eh_320',['event-loop.h',['../event-loop_8h.html',1,'']]],
-  ['event_2eh_321',['event.h',['../event_8h.html',1,'']]]
-];
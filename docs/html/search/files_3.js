@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['functional_2eh_322',['functional.h',['../functional_8h.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['iterator_2eh_323',['iterator.h',['../iterator_8h.html',1,'']]]
-];
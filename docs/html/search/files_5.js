@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['linked_2dlist_2eh_324',['linked-list.h',['../linked-list_8h.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['module_2eh_325',['module.h',['../module_8h.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['object_2dpool_2eh_326',['object-pool.h',['../object-pool_8h.html',1,'']]]
-];
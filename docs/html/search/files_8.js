@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['pipeline_2eh_327',['pipeline.h',['../pipeline_8h.html',1,'']]],
-  ['promise_2eh_328',['promise.h',['../promise_8h.html',1,'']]]
-];
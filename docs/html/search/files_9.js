@@ -1,7 +0,0 @@
-var searchData=
-[
-  ['scheduler_2eh_329',['scheduler.h',['../scheduler_8h.html',1,'']]],
-  ['signal_2eh_330',['signal.h',['../signal_8h.html',1,'']]],
-  ['system_2dpools_2eh_331',['system-pools.h',['../system-pools_8h.html',1,'']]],
-  ['system_2dqueues_2eh_332',['system-queues.h',['../system-queues_8h.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['µevloop_20_3cimg_20src_3d_22https_3a_2f_2fgithub_2ecom_2fandsmedeiros_2fuevloop_2fworkflows_2fc_2fc_2b_2b_2520ci_2fbadge_2esvg_3fevent_3dpush_22_20alt_3d_22c_2fc_2b_2b_20ci_22_2f_3e_569',['µEvLoop &lt;img src=&quot;https://github.com/andsmedeiros/uevloop/workflows/C/C++%20CI/badge.svg?event=push&quot; alt=&quot;C/C++ CI&quot;/&gt;',['../index.html',1,'']]]
-];
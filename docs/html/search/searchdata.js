@@ -1,42 +0,0 @@
-var indexSectionsWithContent =
-{
-  0: "abcdefhilmnopqrstuvwÂ",
-  1: "esu",
-  2: "acefilmops",
-  3: "u",
-  4: "abcdefhilmnopqrstuvw",
-  5: "u",
-  6: "u",
-  7: "u",
-  8: "u",
-  9: "Â"
-};
-
-var indexSectionNames =
-{
-  0: "all",
-  1: "classes",
-  2: "files",
-  3: "functions",
-  4: "variables",
-  5: "typedefs",
-  6: "enums",
-  7: "enumvalues",
-  8: "defines",
-  9: "pages"
-};
-
-var indexSectionLabels =
-{
-  0: "All",
-  1: "Data Structures",
-  2: "Files",
-  3: "Functions",
-  4: "Variables",
-  5: "Typedefs",
-  6: "Enumerations",
-  7: "Enumerator",
-  8: "Macros",
-  9: "Pages"
-};
-
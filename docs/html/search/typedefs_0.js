@@ -1,13 +0,0 @@
-var searchData=
-[
-  ['uel_5fapp_5fevent_5ft_530',['uel_app_event_t',['../application_8h.html#a138e72d6aced8d43e9a2d0c63c830080',1,'application.h']]],
-  ['uel_5fautoptr_5ft_531',['uel_autoptr_t',['../automatic-pool_8h.html#a83a2aef2df919bea22dd489c0a5403fd',1,'automatic-pool.h']]],
-  ['uel_5fclosure_5ffunction_5ft_532',['uel_closure_function_t',['../closure_8h.html#a04cc5d51a9c86aeedcd6641b43dd8564',1,'closure.h']]],
-  ['uel_5fevent_5ftimer_5fstatus_5ft_533',['uel_event_timer_status_t',['../event_8h.html#ada757ae763328a1774f87efe179e0d0d',1,'event.h']]],
-  ['uel_5fevent_5ftype_5ft_534',['uel_event_type_t',['../event_8h.html#a04647f8821482fc8f635924fc2f1539b',1,'event.h']]],
-  ['uel_5fiterator_5fllist_5ft_535',['uel_iterator_llist_t',['../iterator_8h.html#a0646f93de558b7d6c5c312c010cf7254',1,'iterator.h']]],
-  ['uel_5fmodule_5fhook_5ft_536',['uel_module_hook_t',['../module_8h.html#ad589448a7bcdb1d7cce57f42346a1657',1,'module.h']]],
-  ['uel_5fpromise_5fstate_5ft_537',['uel_promise_state_t',['../promise_8h.html#a95fdddb2c4ccf80657feebb0d4c9adfb',1,'promise.h']]],
-  ['uel_5fsignal_5flistener_5ft_538',['uel_signal_listener_t',['../signal_8h.html#acf4ce9806bae5489706f0409f0a58067',1,'signal.h']]],
-  ['uel_5fsignal_5ft_539',['uel_signal_t',['../signal_8h.html#a4321d8b0f2c6bc3c0cc143e1bb1d1a2b',1,'signal.h']]]
-];
@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['app_453',['app',['../structuel__module.html#a05f6845722afabe30337e1d294fb0a9e',1,'uel_module']]],
-  ['autoptr_5fpool_454',['autoptr_pool',['../structuel__autopool.html#aa0f1f8622a0ba1f1d2d15d94eb5cbc71',1,'uel_autopool']]]
-];
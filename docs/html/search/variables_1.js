@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['base_455',['base',['../structuel__iterator__array.html#ace993eaa734f8fd100b086c2539afad9',1,'uel_iterator_array']]],
-  ['buffer_456',['buffer',['../structuel__cqueue.html#a5a87f38cf8b46556a71b286c8623a54d',1,'uel_cqueue::buffer()'],['../structuel__objpool.html#a69cf1db520005f386293899cdb9e07ca',1,'uel_objpool::buffer()']]]
-];
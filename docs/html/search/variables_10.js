@@ -1,9 +0,0 @@
-var searchData=
-[
-  ['tail_521',['tail',['../structuel__cqueue.html#aa4fa1f34111ddf307825c9a6b06c4b4e',1,'uel_cqueue::tail()'],['../structuel__llist.html#a8d93e6bd35f15f0ee438088ebf814671',1,'uel_llist::tail()']]],
-  ['test_522',['test',['../structuel__conditional.html#a8d83f18dd90afbc47881b9617087c4a1',1,'uel_conditional']]],
-  ['timeout_523',['timeout',['../structevent_1_1uel__event__detail_1_1uel__event__timer.html#a9a6b966db9c39c3302c2a1cb8e813cad',1,'event::uel_event_detail::uel_event_timer']]],
-  ['timer_524',['timer',['../unionevent_1_1uel__event__detail.html#a5d602dc38887276027f2dac93afcb81d',1,'event::uel_event_detail::timer()'],['../structuel__scheduler.html#a46642fc80fb6d917ed35f3ab61d1c7eb',1,'uel_scheduler::timer()']]],
-  ['timer_5flist_525',['timer_list',['../structuel__scheduler.html#a9c71f717e4ca6878742aad2e147e9dd6',1,'uel_scheduler']]],
-  ['type_526',['type',['../structevent.html#a22c24ebb438dfad40f977484a1fa7a35',1,'event']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['unlistened_527',['unlistened',['../structevent_1_1uel__event__detail_1_1uel__event__listener.html#a7c68240052221e1ebbab4a9c1c096512',1,'event::uel_event_detail::uel_event_listener']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['width_529',['width',['../structuel__signal__relay.html#aedd6f0d0fee789b65472d7fa3981322b',1,'uel_signal_relay']]]
-];
@@ -1,12 +0,0 @@
-var searchData=
-[
-  ['cancelled_457',['cancelled',['../structevent_1_1uel__event__detail_1_1uel__event__observer.html#a1bd55787112aae874e8b4c906a37614e',1,'event::uel_event_detail::uel_event_observer']]],
-  ['closure_458',['closure',['../structevent.html#aac834e055b38447126d27c0dec51498c',1,'event']]],
-  ['closures_459',['closures',['../structuel__pipeline.html#a5dafb55ed93d4b7a6e8c7a9cfc50af4c',1,'uel_pipeline']]],
-  ['collection_460',['collection',['../structuel__iterator.html#a37bae427d28c271a3e9fbdc0c3a70b8d',1,'uel_iterator']]],
-  ['condition_5fvar_461',['condition_var',['../structevent_1_1uel__event__detail_1_1uel__event__observer.html#ac17e9951df24dfb12fa6a7824f65c311',1,'event::uel_event_detail::uel_event_observer']]],
-  ['config_462',['config',['../structuel__module.html#a9b066ffb62e47bf3fac7e0d70623eb15',1,'uel_module']]],
-  ['constructor_463',['constructor',['../structuel__autopool.html#a7890d66a262f1c057598b5cf281df2c2',1,'uel_autopool']]],
-  ['context_464',['context',['../structuel__closure.html#ae22a9c4275f31ab9741ef42479ce59cf',1,'uel_closure']]],
-  ['count_465',['count',['../structuel__cqueue.html#a0ef8883068b2d0b6d37e03cd33c46628',1,'uel_cqueue::count()'],['../structuel__llist.html#abd8b53084233e30e2dd36e1e2e7538f0',1,'uel_llist::count()'],['../structuel__pipeline.html#a6b52ff1fecb520e604f0b167e9c85a46',1,'uel_pipeline::count()']]]
-];
@@ -1,7 +0,0 @@
-var searchData=
-[
-  ['destination_466',['destination',['../structuel__func__mapper.html#a847f834606bbc994068aaa93ed705e3c',1,'uel_func_mapper']]],
-  ['destructor_467',['destructor',['../structuel__autopool.html#a34dff758685ceefd0227aaf98eb66318',1,'uel_autopool']]],
-  ['detail_468',['detail',['../structevent.html#abcda7218789a4eac49e099cd895b042a',1,'event']]],
-  ['due_5ftime_469',['due_time',['../structevent_1_1uel__event__detail_1_1uel__event__timer.html#aded9e4913a031f9a4cc62ae362406b11',1,'event::uel_event_detail::uel_event_timer']]]
-];
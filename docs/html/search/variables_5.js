@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['first_5fsegment_476',['first_segment',['../structuel__promise.html#a6f892488ff6d7f0a6b90b128306c8498',1,'uel_promise']]],
-  ['function_477',['function',['../structuel__closure.html#a53af2a72baa02fe3d0b18e20aff59a66',1,'uel_closure']]]
-];
@@ -1,8 +0,0 @@
-var searchData=
-[
-  ['if_5ffalse_479',['if_false',['../structuel__conditional.html#adb02d4c97ad9486edfb43dcb44ca2577',1,'uel_conditional']]],
-  ['if_5ftrue_480',['if_true',['../structuel__conditional.html#a49681bebb19750fea3e0ddcdc2e41ea9',1,'uel_conditional']]],
-  ['item_5fcount_481',['item_count',['../structuel__iterator__array.html#a514d0828182e9649d6285caddfb650c8',1,'uel_iterator_array']]],
-  ['item_5fsize_482',['item_size',['../structuel__iterator__array.html#a65622bdc18897601b6bc5da70ea44f09',1,'uel_iterator_array']]],
-  ['iterator_483',['iterator',['../structuel__func__mapper.html#a435db29ac7596f5b8c3f5c5735a2517f',1,'uel_func_mapper']]]
-];
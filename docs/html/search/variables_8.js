@@ -1,12 +0,0 @@
-var searchData=
-[
-  ['last_5fsegment_484',['last_segment',['../structuel__promise.html#a18d4ef955a1110e9182d7fea5779a147',1,'uel_promise']]],
-  ['last_5fvalue_485',['last_value',['../structevent_1_1uel__event__detail_1_1uel__event__observer.html#a79d55d944dc3a1b83c8b09bb88ebb7ce',1,'event::uel_event_detail::uel_event_observer']]],
-  ['launch_486',['launch',['../structuel__module.html#a5a45b6478c665841c477f57386785cd4',1,'uel_module']]],
-  ['limit_487',['limit',['../structuel__func__mapper.html#abfb2f5ced405ae371069abfd131a1895',1,'uel_func_mapper']]],
-  ['listener_488',['listener',['../unionevent_1_1uel__event__detail.html#a0be1ff74c4b46a39fb4a6dd320a9eb89',1,'event::uel_event_detail']]],
-  ['listeners_489',['listeners',['../structevent_1_1uel__event__detail_1_1uel__event__signal.html#ab003ff58199d9d50fa51b17532d75895',1,'event::uel_event_detail::uel_event_signal']]],
-  ['llist_5fnode_5fpool_490',['llist_node_pool',['../structsyspools.html#a8a333444479f17163fe541f84f88d8ce',1,'syspools']]],
-  ['llist_5fnode_5fpool_5fbuffer_491',['llist_node_pool_buffer',['../structsyspools.html#ab4b8e76d74b86c933227779f6dac2779',1,'syspools']]],
-  ['llist_5fnode_5fpool_5fqueue_5fbuffer_492',['llist_node_pool_queue_buffer',['../structsyspools.html#ae6d43157b64e89395ddf2ca93150c2de',1,'syspools']]]
-];
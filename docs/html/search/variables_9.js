@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['mask_493',['mask',['../structuel__cqueue.html#a3f0a994df09bb73f3545024a857dca78',1,'uel_cqueue']]]
-];
@@ -1,6 +0,0 @@
-var searchData=
-[
-  ['object_495',['object',['../structuel__autoptr.html#a215d58b3f6c7b953b0c60e8963252535',1,'uel_autoptr']]],
-  ['observer_496',['observer',['../unionevent_1_1uel__event__detail.html#a072f8eee18648e4fb7fc180043b65eac',1,'event::uel_event_detail']]],
-  ['observers_497',['observers',['../structuel__evloop.html#ac91617cd57a61785f2feb0748039836c',1,'uel_evloop']]]
-];
@@ -1,6 +0,0 @@
-var searchData=
-[
-  ['pause_5flist_498',['pause_list',['../structuel__scheduler.html#abcdd34ae1b4f2889ce0e301bc1f52826',1,'uel_scheduler']]],
-  ['pools_499',['pools',['../structuel__application.html#af74c95c7a5b2c751e83a3bb6a5404e99',1,'uel_application::pools()'],['../structuel__evloop.html#a47a9ebe4361677bce4f550f3d08b74bb',1,'uel_evloop::pools()'],['../structuel__scheduler.html#a599ff398356901589bed5930a77523c3',1,'uel_scheduler::pools()'],['../structuel__signal__relay.html#af0cc9622120868903e43eda29518433b',1,'uel_signal_relay::pools()']]],
-  ['promise_5fpool_500',['promise_pool',['../structuel__promise__store.html#acde6648fc7bed2bbbdac7df5fa0059f7',1,'uel_promise_store']]]
-];
@@ -1,13 +0,0 @@
-var searchData=
-[
-  ['schedule_5fqueue_511',['schedule_queue',['../structsysqueues.html#a92e5df8975b6c6b1aa7f79df54da8565',1,'sysqueues']]],
-  ['schedule_5fqueue_5fbuffer_512',['schedule_queue_buffer',['../structsysqueues.html#a3f90eebf85af0e239358c276ea741917',1,'sysqueues']]],
-  ['scheduler_513',['scheduler',['../structuel__application.html#a977b88c48d61a8688773b062f74fc78c',1,'uel_application']]],
-  ['segment_5fpool_514',['segment_pool',['../structuel__promise__store.html#ae08a8b8b4a72f9e1d8cfb4d1c344317d',1,'uel_promise_store']]],
-  ['signal_515',['signal',['../unionevent_1_1uel__event__detail.html#a82ba97ed6ebbb9a86cecde4d0c48e4fc',1,'event::uel_event_detail']]],
-  ['signal_5fvector_516',['signal_vector',['../structuel__signal__relay.html#a264ee9199e913c30ec6487d258093324',1,'uel_signal_relay']]],
-  ['size_517',['size',['../structuel__cqueue.html#ad424eefbf635da1957a7c25a6b390a57',1,'uel_cqueue']]],
-  ['source_518',['source',['../structuel__autoptr.html#a32f472b4cef00ebc64db35493ac269d9',1,'uel_autoptr::source()'],['../structuel__promise.html#a2f753bbc2fcd30adcafac5de640143f5',1,'uel_promise::source()']]],
-  ['state_519',['state',['../structuel__promise.html#a678870a0975db700de0bbcb5d102aa4e',1,'uel_promise']]],
-  ['status_520',['status',['../structevent_1_1uel__event__detail_1_1uel__event__timer.html#a38f12f5dce7b8ef363fd5c8a786d3390',1,'event::uel_event_detail::uel_event_timer']]]
-];
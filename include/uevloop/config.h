@@ -32,6 +32,37 @@
 #define UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N (4)
 #endif /* UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N */
 
+#ifndef UEL_SYSQUEUES_BATCH_SIZE
+//! \brief The max number of events moved at once by the scheduler and the event
+//! loop when using bulk queue operations. Bounds the stack used by them.
+#define UEL_SYSQUEUES_BATCH_SIZE (16)
+#endif /* UEL_SYSQUEUES_BATCH_SIZE */
+
+
+/* APPLICATION MODULE CONFIGURATION */
+
+#ifndef UEL_APP_SCRATCH_SIZE
+//! \brief The size in bytes of the application scratch arena, which is reset at
+//! the end of every tick. Every application, including each workgroup worker,
+//! reserves this much RAM for it. Defaults to 0, which disables the arena and
+//! `uel_app_scratch_alloc()`.
+#define UEL_APP_SCRATCH_SIZE    (0)
+#endif /* UEL_APP_SCRATCH_SIZE */
+
+/* SCHEDULER MODULE CONFIGURATION */
+
+#ifndef UEL_SCH_TICKS_PER_SECOND
+//! \brief How many scheduler timer ticks make up a second. Defaults to 1000,
+//! *i.e.* the timer counts milliseconds.
+#define UEL_SCH_TICKS_PER_SECOND    (1000)
+#endif /* UEL_SCH_TICKS_PER_SECOND */
+
+/* Define UEL_SCH_64BIT_TIME to represent time as 64-bit ticks and timeouts as
+ * 32-bit ticks, instead of 32-bit and 16-bit. Useful for fine tick resolutions
+ * on hosts, where the 32-bit counter would otherwise wrap around too soon.
+ */
+// #define UEL_SCH_64BIT_TIME
+
 
 /* SIGNAL MODULE CONFIGURATION */
 
@@ -41,6 +72,100 @@
 #define UEL_SIGNAL_MAX_LISTENERS    (5)
 #endif /* UEL_SIGNAL_MAX_LISTENERS */
 
+/* WORKGROUP MODULE CONFIGURATION */
+
+#ifndef UEL_WORKGROUP_DEQUE_SIZE_LOG2N
+//! The size of each worker's work-stealing deque in log2 form. Defaults to 32 closures.
+#define UEL_WORKGROUP_DEQUE_SIZE_LOG2N (5)
+#endif /* UEL_WORKGROUP_DEQUE_SIZE_LOG2N */
+
+#ifndef UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N
+//! \brief The size of the workgroup's shared injection queue in log2 form. This
+//! also sizes the pool of events backing injected closures. Defaults to 32 closures.
+#define UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N (5)
+#endif /* UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N */
+
+/* CHANNEL MODULE CONFIGURATION */
+
+#ifndef UEL_CHANNEL_BATCH_SIZE
+//! \brief Defines the max number of messages a channel delivers to its target
+//! event loop in a single runloop
+#define UEL_CHANNEL_BATCH_SIZE  (16)
+#endif /* UEL_CHANNEL_BATCH_SIZE */
+
+/* ITERATOR MODULE CONFIGURATION */
+
+#ifndef UEL_ITERATOR_BATCH_SIZE
+//! \brief Defines the max number of elements iterator operations request at
+//! once from iterators that implement `next_batch`
+#define UEL_ITERATOR_BATCH_SIZE (16)
+#endif /* UEL_ITERATOR_BATCH_SIZE */
+
+#ifndef UEL_ITERATOR_PAR_CHUNK_SIZE
+//! \brief Defines the default number of elements parallel iterator operations
+//! hand to a worker at once
+#define UEL_ITERATOR_PAR_CHUNK_SIZE (64)
+#endif /* UEL_ITERATOR_PAR_CHUNK_SIZE */
+
+/* LOCKING CONFIGURATION */
+
+/* Define one of UEL_LOCK_SPINLOCK, UEL_LOCK_FUTEX or UEL_LOCK_PTHREAD to guard
+ * critical sections with one of the locks in `uevloop/portability/lock.h`.
+ * Each system container then gets a lock of its own. If none is defined,
+ * critical sections are delimited by the user supplied UEL_CRITICAL_ENTER and
+ * UEL_CRITICAL_EXIT macros only.
+ */
+// #define UEL_LOCK_SPINLOCK
+// #define UEL_LOCK_FUTEX
+// #define UEL_LOCK_PTHREAD
+
+#ifndef UEL_LOCK_FUTEX_SPIN_COUNT
+//! How many times the futex lock retries before putting the thread to sleep
+#define UEL_LOCK_FUTEX_SPIN_COUNT   (100)
+#endif /* UEL_LOCK_FUTEX_SPIN_COUNT */
+
+/* INSTRUMENTATION CONFIGURATION */
+
+/* Define UEL_ENABLE_LATENCY_STATS (here or in the compiler command line) to
+ * timestamp events and record event loop latency histograms. Disabled by default.
+ */
+// #define UEL_ENABLE_LATENCY_STATS
+
+/* Define UEL_ENABLE_TRACE to log event dispatches, timer expirations, signal
+ * emissions and promise settlements into the trace ring. Disabled by default.
+ */
+// #define UEL_ENABLE_TRACE
+
+#ifndef UEL_TRACE_BUFFER_SIZE_LOG2N
+//! The number of records kept by the trace ring in log2 form. Defaults to 256 records.
+#define UEL_TRACE_BUFFER_SIZE_LOG2N (8)
+#endif /* UEL_TRACE_BUFFER_SIZE_LOG2N */
+
+/* Define UEL_ENABLE_PROFILER to account for the time consumed by each closure
+ * function invoked by the core. Disabled by default.
+ */
+// #define UEL_ENABLE_PROFILER
+
+#ifndef UEL_PROFILER_TABLE_SIZE_LOG2N
+//! The number of distinct closure functions the profiler can account for, in
+//! log2 form. Defaults to 64 functions.
+#define UEL_PROFILER_TABLE_SIZE_LOG2N   (6)
+#endif /* UEL_PROFILER_TABLE_SIZE_LOG2N */
+
+#ifndef UEL_HISTOGRAM_PRECISION_BITS
+//! \brief The number of linear sub-buckets per power of two in histograms, in
+//! log2 form. Bounds the relative error of recorded values. Defaults to 25%.
+#define UEL_HISTOGRAM_PRECISION_BITS    (2)
+#endif /* UEL_HISTOGRAM_PRECISION_BITS */
+
+/* SWITCH MODULE CONFIGURATION */
+
+#ifndef UEL_SWITCH_MAX_ATTEMPTS
+//! \brief How many hash multipliers a switch tries before giving up on a
+//! hashed table and falling back to linear search
+#define UEL_SWITCH_MAX_ATTEMPTS (1024)
+#endif /* UEL_SWITCH_MAX_ATTEMPTS */
+
 /* PROMISE MODULE CONFIGURATION */
 
 //! Enable promise chain functions aliases: THEN, CATCH, AFTER, ALWAYS
@@ -0,0 +1,96 @@
+/** \file atomic.h
+  * \brief Contains macros for lock-free access to shared memory.
+  *
+  * On GCC-compatible compilers these map to the `__atomic` builtins, which
+  * implement the C11 memory model while remaining usable from C99 code.
+  * Each macro can be overridden by the programmer, according to the
+  * synchronisation methods available on the target platform.
+  */
+
+#ifndef UEL_ATOMIC_H
+#define UEL_ATOMIC_H
+
+/// \cond
+#include <stdbool.h>
+/// \endcond
+
+#if defined(__GNUC__) || defined(__clang__)
+
+//! No ordering constraints, only atomicity
+#define UEL_ATOMIC_RELAXED  __ATOMIC_RELAXED
+//! Subsequent memory accesses are not reordered before the operation
+#define UEL_ATOMIC_ACQUIRE  __ATOMIC_ACQUIRE
+//! Preceding memory accesses are not reordered after the operation
+#define UEL_ATOMIC_RELEASE  __ATOMIC_RELEASE
+//! Full sequential consistency
+#define UEL_ATOMIC_SEQ_CST  __ATOMIC_SEQ_CST
+
+#ifndef UEL_ATOMIC_LOAD
+//! Atomically loads the value stored at `ptr`
+#define UEL_ATOMIC_LOAD(ptr, order) __atomic_load_n((ptr), (order))
+#endif /* UEL_ATOMIC_LOAD */
+
+#ifndef UEL_ATOMIC_STORE
+//! Atomically stores `value` at `ptr`
+#define UEL_ATOMIC_STORE(ptr, value, order) __atomic_store_n((ptr), (value), (order))
+#endif /* UEL_ATOMIC_STORE */
+
+#ifndef UEL_ATOMIC_FETCH_ADD
+//! Atomically adds `value` to the value stored at `ptr`, returning the old value
+#define UEL_ATOMIC_FETCH_ADD(ptr, value, order) __atomic_fetch_add((ptr), (value), (order))
+#endif /* UEL_ATOMIC_FETCH_ADD */
+
+#ifndef UEL_ATOMIC_CAS
+/** \brief Atomically replaces the value at `ptr` with `desired` if it equals
+  * `*expected`. Otherwise, `*expected` is updated with the current value.
+  * Evaluates to whether the exchange took place.
+  */
+#define UEL_ATOMIC_CAS(ptr, expected, desired)                              \
+    __atomic_compare_exchange_n(                                            \
+        (ptr), (expected), (desired), false,                                \
+        __ATOMIC_SEQ_CST, __ATOMIC_RELAXED                                  \
+    )
+#endif /* UEL_ATOMIC_CAS */
+
+#ifndef UEL_ATOMIC_FENCE
+//! Issues a memory fence with the supplied ordering
+#define UEL_ATOMIC_FENCE(order) __atomic_thread_fence(order)
+#endif /* UEL_ATOMIC_FENCE */
+
+#else /* __GNUC__ || __clang__ */
+
+/* Without compiler support, atomic operations degrade to plain memory accesses.
+ * This is only safe on single-core targets where the operations below are not
+ * interrupted midway. Override the macros otherwise.
+ */
+#define UEL_ATOMIC_RELAXED  0
+#define UEL_ATOMIC_ACQUIRE  0
+#define UEL_ATOMIC_RELEASE  0
+#define UEL_ATOMIC_SEQ_CST  0
+
+#ifndef UEL_ATOMIC_LOAD
+#define UEL_ATOMIC_LOAD(ptr, order) (*(ptr))
+#endif /* UEL_ATOMIC_LOAD */
+
+#ifndef UEL_ATOMIC_STORE
+#define UEL_ATOMIC_STORE(ptr, value, order) ((void)(*(ptr) = (value)))
+#endif /* UEL_ATOMIC_STORE */
+
+#ifndef UEL_ATOMIC_FETCH_ADD
+#define UEL_ATOMIC_FETCH_ADD(ptr, value, order) ((*(ptr) += (value)) - (value))
+#endif /* UEL_ATOMIC_FETCH_ADD */
+
+#ifndef UEL_ATOMIC_CAS
+#define UEL_ATOMIC_CAS(ptr, expected, desired)                              \
+    (*(ptr) == *(expected) ?                                                \
+        (*(ptr) = (desired), true) :                                        \
+        (*(expected) = *(ptr), false))
+#endif /* UEL_ATOMIC_CAS */
+
+#ifndef UEL_ATOMIC_FENCE
+#define UEL_ATOMIC_FENCE(order) ((void)0)
+#endif /* UEL_ATOMIC_FENCE */
+
+#endif /* __GNUC__ || __clang__ */
+
+#endif /* end of include guard: UEL_ATOMIC_H */
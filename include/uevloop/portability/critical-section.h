@@ -5,11 +5,25 @@
 #ifndef CRITICAL_SECTION_H
 #define CRITICAL_SECTION_H
 
+#include "uevloop/config.h"
+#include "uevloop/portability/lock.h"
+#include "uevloop/portability/linkage.h"
+
+#if defined(UEL_LOCK_BACKEND) && !defined(UEL_CRITICAL_ENTER) && \
+    !defined(UEL_CRITICAL_SECTION_OBJ_TYPE)
+//! Defined when the global critical section object is allocated by the library
+#define UEL_CRITICAL_SECTION_BUILTIN
+#define UEL_CRITICAL_SECTION_OBJ_TYPE uel_lock_t
+#define UEL_CRITICAL_ENTER uel_lock_acquire(&uel_critical_section)
+#define UEL_CRITICAL_EXIT uel_lock_release(&uel_critical_section)
+#endif
+
 #ifndef UEL_CRITICAL_ENTER
 /** \brief Enters a critical section.
   *
   * This is a no-op meant to be overridden by the programmer, according to the
-  * synchronisation methods available on the target platform.
+  * synchronisation methods available on the target platform. If a lock backend
+  * is selected, it acquires the global `uel_critical_section` lock instead.
   */
 #define UEL_CRITICAL_ENTER
 #endif /* UEL_CRITICAL_ENTER */
@@ -18,11 +32,36 @@
 /** \brief Exits a critical section..
   *
   * This is a no-op meant to be overridden by the programmer, according to the
-  * synchronisation methods available on the target platform.
+  * synchronisation methods available on the target platform. If a lock backend
+  * is selected, it releases the global `uel_critical_section` lock instead.
   */
 #define UEL_CRITICAL_EXIT
 #endif /* UEL_CRITICAL_EXIT */
 
+#ifndef UEL_CRITICAL_ENTER_ON
+#ifdef UEL_LOCK_BACKEND
+/** \brief Enters a critical section guarded by a particular `uel_lock_t`.
+  *
+  * Without a lock backend, this falls back to `UEL_CRITICAL_ENTER`.
+  */
+#define UEL_CRITICAL_ENTER_ON(lock) uel_lock_acquire(lock)
+#else
+#define UEL_CRITICAL_ENTER_ON(lock) UEL_CRITICAL_ENTER
+#endif /* UEL_LOCK_BACKEND */
+#endif /* UEL_CRITICAL_ENTER_ON */
+
+#ifndef UEL_CRITICAL_EXIT_ON
+#ifdef UEL_LOCK_BACKEND
+/** \brief Exits a critical section guarded by a particular `uel_lock_t`.
+  *
+  * Without a lock backend, this falls back to `UEL_CRITICAL_EXIT`.
+  */
+#define UEL_CRITICAL_EXIT_ON(lock) uel_lock_release(lock)
+#else
+#define UEL_CRITICAL_EXIT_ON(lock) UEL_CRITICAL_EXIT
+#endif /* UEL_LOCK_BACKEND */
+#endif /* UEL_CRITICAL_EXIT_ON */
+
 #ifdef UEL_CRITICAL_SECTION_OBJ_TYPE
 /** \brief The global critical section object.
 *
@@ -33,9 +72,14 @@
 * An object of type `UEL_CRITICAL_SECTION_OBJ_TYPE` will be then declared as
 * an external global under the symbol `uel_critical_section`.
 * It is the programmer's responsability to actually allocate such object. It will
-* then be available in all critical sections.
+* then be available in all critical sections. When a lock backend provides the
+* global lock, the library allocates it instead.
 */
+#ifdef UEL_CRITICAL_SECTION_BUILTIN
+UEL_EXTERN UEL_CRITICAL_SECTION_OBJ_TYPE uel_critical_section;
+#else
 extern UEL_CRITICAL_SECTION_OBJ_TYPE uel_critical_section;
+#endif /* UEL_CRITICAL_SECTION_BUILTIN */
 #endif /* UEL_CRITICAL_SECTION_OBJ_TYPE */
 
 #endif /* end of include guard: CRITICAL_SECTION_H */
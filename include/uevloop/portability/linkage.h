@@ -0,0 +1,28 @@
+/** \file linkage.h
+  * \brief Contains macros that set the linkage of the library's symbols.
+  *
+  * By default, µEvLoop is built as a regular library and its symbols have
+  * external linkage. The single-header build generated by
+  * `scripts/amalgamate.py` redefines these so every function is `static inline`
+  * and the whole dispatch path can be inlined by the compiler.
+  */
+
+#ifndef UEL_LINKAGE_H
+#define UEL_LINKAGE_H
+
+#ifndef UEL_API
+//! Prefixes every library function. Empty for regular builds.
+#define UEL_API
+#endif /* UEL_API */
+
+#ifndef UEL_EXTERN
+//! Prefixes declarations of library owned globals. `extern` for regular builds.
+#define UEL_EXTERN extern
+#endif /* UEL_EXTERN */
+
+#ifndef UEL_GLOBAL
+//! Prefixes definitions of library owned globals. Empty for regular builds.
+#define UEL_GLOBAL
+#endif /* UEL_GLOBAL */
+
+#endif /* end of include guard: UEL_LINKAGE_H */
@@ -0,0 +1,194 @@
+/** \file lock.h
+  * \brief Ready-made locks to back critical sections on hosted and multi-core
+  * targets.
+  *
+  * Three lock types are provided:
+  * - `uel_spinlock_t`: a test-and-test-and-set spinlock built on the macros in
+  * `atomic.h`. Available wherever those are.
+  * - `uel_futex_t`: spins for a while and then sleeps on a futex. Linux only.
+  * - `uel_mutex_t`: a thin wrapper over `pthread_mutex_t`. POSIX only.
+  *
+  * Defining `UEL_LOCK_SPINLOCK`, `UEL_LOCK_FUTEX` or `UEL_LOCK_PTHREAD` selects
+  * one of them as `uel_lock_t`, the lock type used by critical sections.
+  */
+
+#ifndef UEL_LOCK_H
+#define UEL_LOCK_H
+
+/// \cond
+#include <stdbool.h>
+/// \endcond
+
+#include "uevloop/config.h"
+
+#if defined(__linux__)
+//! Defined when the futex lock is available on the target
+#define UEL_LOCK_HAS_FUTEX
+#endif /* __linux__ */
+
+#if defined(__unix__) || defined(__APPLE__)
+//! Defined when the pthread lock is available on the target
+#define UEL_LOCK_HAS_PTHREAD
+/// \cond
+#include <pthread.h>
+/// \endcond
+#endif /* __unix__ || __APPLE__ */
+
+#ifndef UEL_LOCK_RELAX
+#if defined(__x86_64__) || defined(__i386__)
+//! Hints the processor that the thread is busy-waiting
+#define UEL_LOCK_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define UEL_LOCK_RELAX() __asm__ __volatile__("yield")
+#else
+#define UEL_LOCK_RELAX() ((void)0)
+#endif
+#endif /* UEL_LOCK_RELAX */
+
+/** \brief A spinlock. Zero when released, so it can be statically initialised
+  * with `UEL_SPINLOCK_INITIALIZER`.
+  */
+typedef int uel_spinlock_t;
+//! Static initialiser for spinlocks
+#define UEL_SPINLOCK_INITIALIZER 0
+
+/** \brief Initialises a spinlock in the released state
+  *
+  * \param lock The spinlock to be initialised
+  */
+void uel_spinlock_init(uel_spinlock_t *lock);
+
+/** \brief Acquires a spinlock, busy-waiting until it is released
+  *
+  * \param lock The spinlock to be acquired
+  */
+void uel_spinlock_acquire(uel_spinlock_t *lock);
+
+/** \brief Tries to acquire a spinlock without waiting
+  *
+  * \param lock The spinlock to be acquired
+  * \returns Whether the lock was acquired
+  */
+bool uel_spinlock_try_acquire(uel_spinlock_t *lock);
+
+/** \brief Releases a spinlock
+  *
+  * \param lock The spinlock to be released
+  */
+void uel_spinlock_release(uel_spinlock_t *lock);
+
+#ifdef UEL_LOCK_HAS_FUTEX
+/** \brief A futex lock. Zero when released, one when held and two when held
+  * with threads sleeping on it.
+  */
+typedef int uel_futex_t;
+//! Static initialiser for futex locks
+#define UEL_FUTEX_INITIALIZER 0
+
+/** \brief Initialises a futex lock in the released state
+  *
+  * \param lock The futex lock to be initialised
+  */
+void uel_futex_init(uel_futex_t *lock);
+
+/** \brief Acquires a futex lock. Spins `UEL_LOCK_FUTEX_SPIN_COUNT` times and
+  * then sleeps until the lock is released.
+  *
+  * \param lock The futex lock to be acquired
+  */
+void uel_futex_acquire(uel_futex_t *lock);
+
+/** \brief Tries to acquire a futex lock without waiting
+  *
+  * \param lock The futex lock to be acquired
+  * \returns Whether the lock was acquired
+  */
+bool uel_futex_try_acquire(uel_futex_t *lock);
+
+/** \brief Releases a futex lock, waking one sleeping thread if there is any
+  *
+  * \param lock The futex lock to be released
+  */
+void uel_futex_release(uel_futex_t *lock);
+#endif /* UEL_LOCK_HAS_FUTEX */
+
+#ifdef UEL_LOCK_HAS_PTHREAD
+//! A lock backed by a pthread mutex
+typedef pthread_mutex_t uel_mutex_t;
+//! Static initialiser for pthread locks
+#define UEL_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+
+/** \brief Initialises a pthread lock with default attributes
+  *
+  * \param lock The pthread lock to be initialised
+  */
+void uel_mutex_init(uel_mutex_t *lock);
+
+/** \brief Acquires a pthread lock
+  *
+  * \param lock The pthread lock to be acquired
+  */
+void uel_mutex_acquire(uel_mutex_t *lock);
+
+/** \brief Tries to acquire a pthread lock without waiting
+  *
+  * \param lock The pthread lock to be acquired
+  * \returns Whether the lock was acquired
+  */
+bool uel_mutex_try_acquire(uel_mutex_t *lock);
+
+/** \brief Releases a pthread lock
+  *
+  * \param lock The pthread lock to be released
+  */
+void uel_mutex_release(uel_mutex_t *lock);
+#endif /* UEL_LOCK_HAS_PTHREAD */
+
+#if defined(UEL_LOCK_SPINLOCK)
+//! Defined when a lock type backs critical sections
+#define UEL_LOCK_BACKEND
+//! The lock type guarding critical sections
+typedef uel_spinlock_t uel_lock_t;
+//! Static initialiser for `uel_lock_t`
+#define UEL_LOCK_INITIALIZER UEL_SPINLOCK_INITIALIZER
+//! Initialises a lock of the selected type
+#define uel_lock_init(lock) uel_spinlock_init(lock)
+//! Acquires a lock of the selected type
+#define uel_lock_acquire(lock) uel_spinlock_acquire(lock)
+//! Releases a lock of the selected type
+#define uel_lock_release(lock) uel_spinlock_release(lock)
+
+#elif defined(UEL_LOCK_FUTEX)
+#ifndef UEL_LOCK_HAS_FUTEX
+#error "UEL_LOCK_FUTEX requires a Linux target"
+#endif /* UEL_LOCK_HAS_FUTEX */
+#define UEL_LOCK_BACKEND
+typedef uel_futex_t uel_lock_t;
+#define UEL_LOCK_INITIALIZER UEL_FUTEX_INITIALIZER
+#define uel_lock_init(lock) uel_futex_init(lock)
+#define uel_lock_acquire(lock) uel_futex_acquire(lock)
+#define uel_lock_release(lock) uel_futex_release(lock)
+
+#elif defined(UEL_LOCK_PTHREAD)
+#ifndef UEL_LOCK_HAS_PTHREAD
+#error "UEL_LOCK_PTHREAD requires a POSIX target"
+#endif /* UEL_LOCK_HAS_PTHREAD */
+#define UEL_LOCK_BACKEND
+typedef uel_mutex_t uel_lock_t;
+#define UEL_LOCK_INITIALIZER UEL_MUTEX_INITIALIZER
+#define uel_lock_init(lock) uel_mutex_init(lock)
+#define uel_lock_acquire(lock) uel_mutex_acquire(lock)
+#define uel_lock_release(lock) uel_mutex_release(lock)
+
+#else
+/* Without a backend, containers still hold a lock member so their layout does
+ * not depend on the users' critical section macros. It is never touched.
+ */
+typedef unsigned char uel_lock_t;
+#define UEL_LOCK_INITIALIZER 0
+#define uel_lock_init(lock) ((void)(lock))
+#define uel_lock_acquire(lock) ((void)(lock))
+#define uel_lock_release(lock) ((void)(lock))
+#endif
+
+#endif /* end of include guard: UEL_LOCK_H */
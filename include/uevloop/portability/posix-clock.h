@@ -0,0 +1,49 @@
+/** \file posix-clock.h
+  *
+  * \brief Helpers to drive the scheduler from the POSIX monotonic clock.
+  *
+  * This header is optional and only usable on POSIX hosts. Define
+  * `_POSIX_C_SOURCE` to at least `199309L` before including any system header.
+  */
+
+#ifndef UEL_POSIX_CLOCK_H
+#define UEL_POSIX_CLOCK_H
+
+/// \cond
+#include <stdint.h>
+#include <time.h>
+/// \endcond
+
+#include "uevloop/system/time.h"
+
+/** \brief Converts a `struct timespec` into scheduler ticks
+  *
+  * \param ts The time to be converted
+  * \returns The equivalent number of scheduler ticks, rounded down
+  */
+static inline uel_time_t uel_posix_clock_to_time(const struct timespec *ts){
+    return UEL_TIME_FROM_S(ts->tv_sec) + UEL_TIME_FROM_NS(ts->tv_nsec);
+}
+
+/** \brief Converts scheduler ticks into a `struct timespec`
+  *
+  * \param time The number of scheduler ticks to be converted
+  * \param ts The `struct timespec` where to store the result
+  */
+static inline void uel_posix_clock_from_time(uel_time_t time, struct timespec *ts){
+    ts->tv_sec = (time_t)(time / UEL_SCH_TICKS_PER_SECOND);
+    ts->tv_nsec = (long)UEL_TIME_TO_NS(time % UEL_SCH_TICKS_PER_SECOND);
+}
+
+/** \brief Reads `CLOCK_MONOTONIC` in scheduler ticks. Feed this to
+  * `uel_app_update_timer()` or `uel_sch_update_timer()`.
+  *
+  * \returns The current monotonic time, in scheduler ticks
+  */
+static inline uel_time_t uel_posix_clock_now(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uel_posix_clock_to_time(&ts);
+}
+
+#endif /* end of include guard: UEL_POSIX_CLOCK_H */
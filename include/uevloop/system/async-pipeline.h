@@ -0,0 +1,106 @@
+/** \file async-pipeline.h
+  * \brief Defines asynchronous pipelines, which apply a pipeline one stage per
+  * event so long pipelines do not block the event loop
+  */
+
+#ifndef UEL_ASYNC_PIPELINE_H
+#define UEL_ASYNC_PIPELINE_H
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/system/event-loop.h"
+#include "uevloop/utils/pipeline.h"
+#include "uevloop/utils/promise.h"
+#include "uevloop/utils/clock.h"
+
+/** \brief Applies a pipeline asynchronously.
+  *
+  * Each stage of the pipeline is enqueued into the event loop as a separate
+  * closure event, so other events, timers included, can run between stages.
+  * Stages wrapped with `uel_async_pipeline_awaiting()` return a promise instead
+  * of a value: the pipeline is suspended until it settles and resumes with its
+  * value. The outcome of the whole pipeline is reported through a promise.
+  *
+  * Only one application may be in flight at a time and the structure must
+  * outlive it.
+  */
+typedef struct uel_async_pipeline uel_async_pipeline_t;
+struct uel_async_pipeline {
+    //! The pipeline to be applied
+    uel_pipeline_t *pipeline;
+    //! The event loop where stages are enqueued
+    uel_evloop_t *event_loop;
+    //! The store from where the resulting promise is acquired
+    uel_promise_store_t *store;
+    //! Where to record how long each stage took. Nothing is recorded if `NULL`.
+    uel_timestamp_t *durations;
+    //! The closure enqueued to run each stage
+    uel_closure_t step;
+
+    //! The promise settled when the current application is over
+    uel_promise_t *promise;
+    //! The promise returned by the awaited stage, if any
+    uel_promise_t *awaited;
+    //! The index of the next stage to be run
+    size_t stage;
+    //! The value passed along to the next stage
+    void *value;
+    //! When the stage being awaited started
+    uel_timestamp_t started_at;
+};
+
+/** \brief Initialises an asynchronous pipeline
+  *
+  * \param async_pipeline The asynchronous pipeline to be initialised
+  * \param pipeline The pipeline to be applied
+  * \param event_loop The event loop where to enqueue stages
+  * \param store The store from where to acquire promises
+  * \param durations An array with one timestamp per stage of the pipeline.
+  * Each application records there how long each stage took, measured with the
+  * instrumentation clock, including the time spent waiting for awaited stages
+  * to settle. Pass `NULL` if no timing is needed.
+  */
+void uel_async_pipeline_init(
+    uel_async_pipeline_t *async_pipeline,
+    uel_pipeline_t *pipeline,
+    uel_evloop_t *event_loop,
+    uel_promise_store_t *store,
+    uel_timestamp_t *durations
+);
+
+/** \brief Applies an asynchronous pipeline to some input
+  *
+  * The first stage is enqueued immediately and each stage enqueues the next
+  * when it is over. No stage is run during this call.
+  *
+  * \param async_pipeline The asynchronous pipeline to be applied
+  * \param params The initial parameters that will be passed to the first stage
+  * \returns A promise resolved with whatever was returned by the last stage, or
+  * rejected with the error of an awaited stage's promise. It must be destroyed
+  * by the caller.
+  */
+uel_promise_t *uel_async_pipeline_apply(
+    uel_async_pipeline_t *async_pipeline,
+    void *params
+);
+
+/** \brief Marks a pipeline stage as returning a promise to be awaited
+  *
+  * When the asynchronous pipeline reaches the returned stage, it invokes
+  * `closure` and suspends until the promise it returns settles. If it is
+  * resolved, the next stage receives its value. If it is rejected, the whole
+  * pipeline is rejected with the same error. Either way, the awaited promise is
+  * destroyed by the pipeline.
+  *
+  * If applied synchronously with `uel_pipeline_apply()`, the stage simply
+  * passes on the promise.
+  *
+  * \param closure The closure that returns a `uel_promise_t *`. Must outlive
+  * the pipeline.
+  * \returns The stage to be placed in the pipeline
+  */
+uel_closure_t uel_async_pipeline_awaiting(uel_closure_t *closure);
+
+#endif /* end of include guard: UEL_ASYNC_PIPELINE_H */
@@ -0,0 +1,138 @@
+/** \file channel.h
+  * \brief Defines channels, lock-free structures used to pass messages from one
+  * application to another, possibly running in different threads
+  */
+
+#ifndef UEL_CHANNEL_H
+#define UEL_CHANNEL_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/system/containers/application.h"
+#include "uevloop/system/signal.h"
+#include "uevloop/system/event.h"
+#include "uevloop/utils/closure.h"
+
+//! Possible types of messages carried by a channel
+enum uel_channel_message_type {
+    UEL_CHANNEL_CLOSURE_MESSAGE, //!< A closure to be enqueued at the target
+    UEL_CHANNEL_SIGNAL_MESSAGE //!< A signal to be emitted at the target
+};
+//! Alias to the uel_channel_message_type enum
+typedef enum uel_channel_message_type uel_channel_message_type_t;
+
+/** \brief A single message in transit through a channel
+  */
+typedef struct uel_channel_message uel_channel_message_t;
+struct uel_channel_message {
+    uel_channel_message_type_t type; //!< The type of this message
+    //! What to do with this message once it is delivered. Depends on `type`.
+    union uel_channel_message_target {
+        uel_closure_t closure; //!< The closure to be enqueued at the target
+        //! The signal to be emitted at the target
+        struct uel_channel_signal {
+            uel_signal_t signal; //!< The signal to be emitted
+            uel_signal_relay_t *relay; //!< The relay where to emit the signal
+        } signal;
+    } target;
+    //! The value the closure will be invoked with or the signal emitted with
+    void *value;
+};
+
+/** \brief A single-producer, single-consumer channel into an application.
+  *
+  * Channels are lock-free rings of messages. A single producer thread sends
+  * messages, which are delivered into the target application's event queue
+  * in batches of up to `UEL_CHANNEL_BATCH_SIZE` per runloop.
+  *
+  * Delivery is driven by an observer registered at the target's event loop, so
+  * the target application needs only be ticked. Whenever a message is sent
+  * into an empty channel, the `wakeup` closure is invoked by the producer so
+  * the host driver of the target can be awaken, if sleeping.
+  */
+typedef struct uel_channel uel_channel_t;
+struct uel_channel {
+    //! The buffer that holds messages in transit
+    uel_channel_message_t *buffer;
+    //! The mask used to wrap indices around the capacity of the ring
+    uintptr_t mask;
+    //! The count of messages ever sent. Only modified by the producer.
+    volatile uintptr_t head;
+    //! The count of messages ever delivered. Only modified by the consumer.
+    volatile uintptr_t tail;
+    //! The application into which messages are delivered
+    uel_application_t *target;
+    //! The closure invoked when the channel goes from empty to non-empty
+    uel_closure_t wakeup;
+    //! The observer event that delivers messages at the target
+    uel_event_t *observer;
+    //! Bumped by the consumer whenever a delivery leaves messages behind
+    volatile uintptr_t backlog;
+    //! The observer event that resumes delivery of messages left behind
+    uel_event_t *backlog_observer;
+};
+
+/** \brief Initialises a channel and attaches it to its target application.
+  *
+  * This must be called from the thread that runs the target application.
+  *
+  * \param channel The channel to be initialised
+  * \param buffer The buffer used to store messages. Must be `2**size_log2n` long.
+  * \param size_log2n The capacity of the channel in log2 form.
+  * \param target The application into which messages will be delivered
+  * \param wakeup A closure invoked, with the channel as parameter, when a message
+  * is sent to an empty channel. Pass `uel_nop()` if no wakeup is needed.
+  */
+void uel_channel_init(
+    uel_channel_t *channel,
+    uel_channel_message_t *buffer,
+    uintptr_t size_log2n,
+    uel_application_t *target,
+    uel_closure_t wakeup
+);
+
+/** \brief Detaches a channel from its target. Messages still in transit will
+  * not be delivered.
+  *
+  * \param channel The channel to be closed
+  */
+void uel_channel_close(uel_channel_t *channel);
+
+/** \brief Sends a closure to be enqueued at the target application.
+  *
+  * \param channel The channel through which to send the closure
+  * \param closure The closure to be enqueued
+  * \param value The value to invoke the closure with
+  * \returns Whether the message could be sent. Fails if the channel is full.
+  */
+bool uel_channel_send(uel_channel_t *channel, uel_closure_t *closure, void *value);
+
+/** \brief Sends a signal to be emitted at the target application.
+  *
+  * \param channel The channel through which to send the signal
+  * \param signal The signal to be emitted
+  * \param relay The relay where the signal is registered. Must belong to the
+  * target application.
+  * \param params The parameters supplied to the listeners' closures
+  * \returns Whether the message could be sent. Fails if the channel is full.
+  */
+bool uel_channel_emit(
+    uel_channel_t *channel,
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    void *params
+);
+
+/** \brief Counts the messages in transit through a channel. When other threads
+  * are operating on the channel, this is only an estimate.
+  *
+  * \param channel The channel whose messages should be counted
+  * \returns The number of messages sent but not yet delivered
+  */
+uintptr_t uel_channel_count(uel_channel_t *channel);
+
+#endif /* end of include guard: UEL_CHANNEL_H */
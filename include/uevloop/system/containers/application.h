@@ -16,6 +16,7 @@
 #include "uevloop/system/event-loop.h"
 #include "uevloop/system/scheduler.h"
 #include "uevloop/system/signal.h"
+#include "uevloop/utils/arena.h"
 #include "uevloop/utils/module.h"
 
 //! Events emitted by the application relay. Unused ATM.
@@ -39,6 +40,8 @@ typedef struct uel_application uel_application_t;
 struct uel_application{
     uel_module_t **registry; //!< The modules managed by this application
     size_t registry_size; //!< The number of modules managed by this application
+    //! Whether all modules have been configured, so lazy modules may be launched
+    bool loaded;
     uel_syspools_t pools; //!< Holds the system pools: events and llist nodes
     uel_sysqueues_t queues; //!< Holds the system event queues
     uel_evloop_t event_loop; //!< The application's event loop
@@ -46,6 +49,12 @@ struct uel_application{
     uel_signal_relay_t relay;   //!< Unused
     uel_llist_t relay_buffer[UEL_APP_EVENT_COUNT]; //!< Unused
     bool run_scheduler; //!< Marks when it's time to wake the scheduler
+#if UEL_APP_SCRATCH_SIZE > 0
+    //! The buffer backing the scratch arena
+    uint8_t scratch_buffer[UEL_APP_SCRATCH_SIZE];
+    //! Holds memory that lives until the end of the current tick
+    uel_arena_t scratch;
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
 };
 
 /** \brief Initialises an uel_application_t instance
@@ -54,6 +63,13 @@ struct uel_application{
 void uel_app_init(uel_application_t *app);
 
 /** \brief Loads modules into an application and run their lifecycle hooks
+  *
+  * First, the `config` hook of every module is called, in array order. Then,
+  * every module that is not lazy is launched after its dependencies, which
+  * are launched even if lazy. Modules whose dependencies are all launched are
+  * launched right away, so this function returns with every module launched
+  * unless some of them are asynchronous. Modules depending on asynchronous ones
+  * are launched from the event loop once those signal they are done.
   *
   * \param app The application onto which to load the modules
   * \param modules The modules to be loaded
@@ -62,6 +78,10 @@ void uel_app_init(uel_application_t *app);
 void uel_app_load(uel_application_t *app, uel_module_t **modules, size_t module_count);
 
 /** \brief Fetches a module from the app's registry
+  *
+  * If the module is lazy and has not been launched yet, it is launched along
+  * with its dependencies. If any of them is asynchronous, the module may still
+  * be launching when returned: check `uel_module_t::state`.
   *
   * \param app The application from where to fetch the module
   * \param id The module ID  to be fetched
@@ -70,23 +90,63 @@ void uel_app_load(uel_application_t *app, uel_module_t **modules, size_t module_
   */
 uel_module_t *uel_app_require(uel_application_t *app, size_t id);
 
+/** \brief Launches a module after its dependencies, if it has not been
+  * launched yet
+  *
+  * \param app The application where the module is loaded
+  * \param id The module ID to be launched
+  */
+void uel_app_launch(uel_application_t *app, size_t id);
+
+/** \brief Marks a module as launched and launches the modules waiting on it.
+  *
+  * This is invoked from the event loop when an asynchronous module calls
+  * `uel_module_launched()`, and is seldom useful otherwise.
+  *
+  * \param app The application where the module is loaded
+  * \param module The module that has finished launching
+  */
+void uel_app_complete_launch(uel_application_t *app, uel_module_t *module);
+
 /** \brief Ticks the application.
   *
   * Yields control to the application runtime. This will:
   * 1. Check if the scheduler ought to be run (i.e.:  the counter has been
   * updated or there are events awaiting rescheduling) and do so if necessary
   * 2. Perform a runloop
+  * 3. Reset the scratch arena, if enabled, recycling all memory from
+  * `uel_app_scratch_alloc()`
   *
   * \param app The uel_application_t instance
   */
 void uel_app_tick(uel_application_t *app);
 
+#if UEL_APP_SCRATCH_SIZE > 0
+/** \brief Allocates scratch memory that lives until the end of the current tick
+  *
+  * Only available when `UEL_APP_SCRATCH_SIZE` is greater than zero. Scratch
+  * memory needs no releasing: it is all recycled once `uel_app_tick()`
+  * returns. This suits transient buffers such as signal payloads, which are
+  * consumed within the same tick. Scratch memory must never cross a tick
+  * boundary, so it must not be handed to anything that runs on a later tick,
+  * such as timers or async pipelines resuming after a promise settles. It must
+  * only be requested from the context that ticks the application, never from
+  * interrupts or other threads.
+  *
+  * \param app The uel_application_t instance
+  * \param size The number of bytes to allocate
+  * \param align The alignment of the returned address. Must be a power of two.
+  * \returns The allocated memory or `NULL` if the scratch arena is exhausted
+  */
+void *uel_app_scratch_alloc(uel_application_t *app, size_t size, size_t align);
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+
 /** \brief Updates the internal timer of an application, located at the scheduler
   *
   * \param app The uel_application_t instance
-  * \param timer The current application timer, in milliseconds
+  * \param timer The current application timer, in scheduler ticks
   */
-void uel_app_update_timer(uel_application_t *app, uint32_t timer);
+void uel_app_update_timer(uel_application_t *app, uel_time_t timer);
 
 /** \brief Enqueues a closure for later execution.
   *
@@ -94,17 +154,17 @@ void uel_app_update_timer(uel_application_t *app, uint32_t timer);
   * parameter.
   *
   * \param app The uel_application_t instance
-  * \param timeout_in_ms The delay in milliseconds until the closure is run
+  * \param timeout The delay in scheduler ticks until the closure is run
   * \param closure The closure to be invoked when the due time is reached
   * \param value The value to invoked the closure with
   * \returns The timer event associated with this operation
   */
-  uel_event_t *uel_app_run_later(
-      uel_application_t *app,
-      uint16_t timeout_in_ms,
-      uel_closure_t closure,
-      void *value
-  );
+uel_event_t *uel_app_run_later(
+    uel_application_t *app,
+    uel_timeout_t timeout,
+    uel_closure_t closure,
+    void *value
+);
 
 /** \brief Enqueues a closure for execution at intervals.
   *
@@ -112,7 +172,7 @@ void uel_app_update_timer(uel_application_t *app, uint32_t timer);
   * parameter.
   *
   * \param app The uel_application_t instance
-  * \param interval_in_ms The delay in milliseconds two executions of the closure
+  * \param interval The delay in scheduler ticks between two executions of the closure
   * \param immediate If this flag is set, the the event will be created with a
   * due time to the current time.
   * \param closure The closure to be invoked when the due time is reached
@@ -121,7 +181,7 @@ void uel_app_update_timer(uel_application_t *app, uint32_t timer);
   */
 uel_event_t *uel_app_run_at_intervals(
     uel_application_t *app,
-    uint16_t interval_in_ms,
+    uel_timeout_t interval,
     bool immediate,
     uel_closure_t closure,
     void *value
@@ -159,4 +219,16 @@ uel_event_t *uel_app_observe(
     uel_closure_t *closure
 );
 
+#ifdef UEL_ENABLE_LATENCY_STATS
+/** \brief Attaches latency statistics to an application
+  *
+  * Proxies the call to `uel_evloop_set_latency()` and `uel_sch_set_latency()`
+  * so both queueing delays and timer lateness are recorded.
+  *
+  * \param app The `uel_application_t` instance
+  * \param latency Where to record the statistics. Pass `NULL` to detach.
+  */
+void uel_app_set_latency(uel_application_t *app, uel_latency_t *latency);
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
 #endif /* end of include guard: UEL_APPLICATION_H */
@@ -12,6 +12,7 @@
 #include "uevloop/system/event.h"
 #include "uevloop/config.h"
 #include "uevloop/utils/circular-queue.h"
+#include "uevloop/portability/lock.h"
 
 /** \brief A container for the system's internal queues
   *
@@ -33,6 +34,8 @@ struct sysqueues {
       * Holds events ready to be processed on the next runloop.
       */
     uel_cqueue_t event_queue;
+    //! Guards the event queue when a lock backend is selected
+    uel_lock_t event_queue_lock;
 
 
     //! Unrolls the `UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N` value to its power-of-two form
@@ -45,6 +48,8 @@ struct sysqueues {
       * the scheduler.
       */
     uel_cqueue_t schedule_queue;
+    //! Guards the schedule queue when a lock backend is selected
+    uel_lock_t schedule_queue_lock;
 };
 
 /** \brief Initialises a new uel_sysqueues_t
@@ -62,6 +67,20 @@ void uel_sysqueues_init(uel_sysqueues_t *queues);
   */
 void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event);
 
+/** \brief Pushes many events into the event queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events The events to be enqueued, in order
+  * \param count The number of events to be enqueued
+  * \returns How many events were enqueued. Fewer than `count` events are only
+  * enqueued if the queue gets full.
+  */
+uintptr_t uel_sysqueues_enqueue_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+);
+
 /** \brief Pops an event from the event queue.
   *
   * \param queues The uel_sysqueues_t instance from whose event queue the event must
@@ -70,6 +89,19 @@ void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event);
   */
 uel_event_t *uel_sysqueues_get_enqueued_event(uel_sysqueues_t *queues);
 
+/** \brief Pops many events from the event queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events Where to store the popped events, from the oldest to the newest
+  * \param max The max number of events to be popped
+  * \returns How many events were popped
+  */
+uintptr_t uel_sysqueues_get_enqueued_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+);
+
 /** \brief Counts the number of elements in the event queue
   *
   * \param queues The uel_sysqueues_t instance whose event queue's elements should
@@ -87,6 +119,20 @@ uintptr_t uel_sysqueues_count_enqueued_events(uel_sysqueues_t *queues);
   */
 void uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event);
 
+/** \brief Pushes many events into the schedule queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events The events to be scheduled, in order
+  * \param count The number of events to be scheduled
+  * \returns How many events were scheduled. Fewer than `count` events are only
+  * scheduled if the queue gets full.
+  */
+uintptr_t uel_sysqueues_schedule_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+);
+
 /** \brief Pops an event from the schedule queue.
   *
   * \param queues The uel_sysqueues_t instance from whose schedule queue the event must
@@ -95,6 +141,19 @@ void uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event);
   */
 uel_event_t *uel_sysqueues_get_scheduled_event(uel_sysqueues_t *queues);
 
+/** \brief Pops many events from the schedule queue inside a single critical section.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param events Where to store the popped events, from the oldest to the newest
+  * \param max The max number of events to be popped
+  * \returns How many events were popped
+  */
+uintptr_t uel_sysqueues_get_scheduled_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+);
+
 /** \brief Counts the number of elements in the schedule queue
   *
   * \param queues The uel_sysqueues_t instance whose schedule queue's elements should
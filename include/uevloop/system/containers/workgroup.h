@@ -0,0 +1,153 @@
+/** \file workgroup.h
+  * \brief The workgroup module is a multi-worker alternative to the application
+  * container, running one event loop per thread and balancing closures
+  * between them by work stealing.
+  */
+
+#ifndef UEL_WORKGROUP_H
+#define UEL_WORKGROUP_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/system/containers/application.h"
+#include "uevloop/system/event.h"
+#include "uevloop/utils/circular-queue.h"
+#include "uevloop/utils/object-pool.h"
+#include "uevloop/utils/work-stealing-deque.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/portability/lock.h"
+
+//! Affinity value that lets a closure be run by any worker in the group
+#define UEL_WORKGROUP_ANY SIZE_MAX
+
+/** \brief A single worker of a workgroup
+  *
+  * Each worker owns a complete application, with its own pools, queues, event
+  * loop and scheduler, plus a work-stealing deque holding closures that may
+  * be run by any other worker in the group.
+  *
+  * A worker is meant to be ticked by a single thread.
+  */
+typedef struct uel_worker uel_worker_t;
+struct uel_worker {
+    //! The worker's application. Holds everything pinned to this worker.
+    uel_application_t app;
+
+    //! Unrolls the `UEL_WORKGROUP_DEQUE_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_WORKGROUP_DEQUE_SIZE (1<<UEL_WORKGROUP_DEQUE_SIZE_LOG2N)
+    //! The buffer used to store closure events in the deque
+    void *deque_buffer[UEL_WORKGROUP_DEQUE_SIZE];
+    //! Closure events spawned at this worker that may be stolen by others
+    uel_wsdeque_t deque;
+};
+
+/** \brief A group of workers that share closures among themselves
+  *
+  * Closures submitted without affinity are balanced between workers: each
+  * worker first drains its own deque, then the group's shared injection queue
+  * and then tries to steal from the other workers' deques.
+  *
+  * Closures submitted with affinity are enqueued directly on the selected
+  * worker's event loop and are never stolen. Timers, signals and observers
+  * always belong to the application of the worker they were created at.
+  */
+typedef struct uel_workgroup uel_workgroup_t;
+struct uel_workgroup {
+    uel_worker_t *workers; //!< The workers in this group
+    size_t count; //!< The number of workers in this group
+
+    //! Unrolls the `UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_WORKGROUP_INJECT_QUEUE_SIZE (1<<UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N)
+    //! The buffer used to store events in the injected task pool
+    uel_event_t task_pool_buffer[UEL_WORKGROUP_INJECT_QUEUE_SIZE];
+    //! The buffer used to store event pointers in the injected task pool queue
+    void *task_pool_queue_buffer[UEL_WORKGROUP_INJECT_QUEUE_SIZE];
+    //! The pool of events backing closures injected from outside the workers
+    uel_objpool_t task_pool;
+    //! The injection queue buffer
+    void *inject_queue_buffer[UEL_WORKGROUP_INJECT_QUEUE_SIZE];
+    //! Holds closures injected from outside the workers, runnable by any of them
+    uel_cqueue_t inject_queue;
+    //! Guards the injection queue when a lock backend is selected
+    uel_lock_t inject_queue_lock;
+};
+
+/** \brief Initialises a workgroup and each of its workers
+  *
+  * \param group The uel_workgroup_t instance to be initialised
+  * \param workers An array of workers to be managed by the group
+  * \param count The number of workers in the array
+  */
+void uel_workgroup_init(uel_workgroup_t *group, uel_worker_t *workers, size_t count);
+
+/** \brief Fetches the application owned by a worker
+  *
+  * Use this to schedule timers, set up observers or listen for signals on a
+  * speciffic worker.
+  *
+  * \param group The uel_workgroup_t instance
+  * \param worker_id The index of the worker
+  * \returns The application owned by the worker
+  */
+uel_application_t *uel_workgroup_app(uel_workgroup_t *group, size_t worker_id);
+
+/** \brief Enqueues a closure to be invoked by the group.
+  *
+  * This is safe to call from any thread.
+  *
+  * \param group The uel_workgroup_t instance
+  * \param closure The closure to be enqueued
+  * \param value The value to invoke the closure with
+  * \param affinity The index of the worker the closure must run at. If
+  * `UEL_WORKGROUP_ANY`, the closure can be run by any worker.
+  * \returns Whether the closure could be enqueued. Fails only when the shared
+  * injection queue is full.
+  */
+bool uel_workgroup_enqueue_closure(
+    uel_workgroup_t *group,
+    uel_closure_t *closure,
+    void *value,
+    size_t affinity
+);
+
+/** \brief Spawns a closure at a worker, allowing other workers to steal it.
+  *
+  * This is cheaper than `uel_workgroup_enqueue_closure()`, but **must** only be
+  * called from the thread that ticks the worker (*e.g.* from inside a closure
+  * running on it). If the worker's deque is full, the closure is pinned to
+  * the worker instead.
+  *
+  * \param group The uel_workgroup_t instance
+  * \param worker_id The index of the worker spawning the closure
+  * \param closure The closure to be spawned
+  * \param value The value to invoke the closure with
+  */
+void uel_workgroup_spawn(
+    uel_workgroup_t *group,
+    size_t worker_id,
+    uel_closure_t *closure,
+    void *value
+);
+
+/** \brief Ticks a worker.
+  *
+  * Yields control to the worker runtime. This will:
+  * 1. Tick the worker's application, running its pinned events and timers
+  * 2. Run the closures in the worker's own deque. Closures spawned while
+  * these run are left for the next tick.
+  * 3. If the deque was empty, run one injected closure or, failing that,
+  * steal and run one closure from another worker
+  *
+  * \param group The uel_workgroup_t instance
+  * \param worker_id The index of the worker to be ticked
+  * \returns Whether any shareable closure was run. The host may use this to
+  * decide when the thread should sleep.
+  */
+bool uel_workgroup_tick(uel_workgroup_t *group, size_t worker_id);
+
+#endif /* end of include guard: UEL_WORKGROUP_H */
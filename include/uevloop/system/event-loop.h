@@ -9,6 +9,8 @@
 #include "uevloop/utils/linked-list.h"
 #include "uevloop/system/containers/system-pools.h"
 #include "uevloop/system/containers/system-queues.h"
+#include "uevloop/portability/lock.h"
+#include "uevloop/system/latency.h"
 
 /** \brief The event loop object
   *
@@ -22,6 +24,13 @@ struct uel_evloop{
     uel_syspools_t *pools; //!< Reference to the system's pools
     uel_sysqueues_t *queues; //!< Reference to the system's queues
     uel_llist_t observers; //!< Stores references to values to be observed
+    //! Guards the observer list when a lock backend is selected
+    uel_lock_t observers_lock;
+    uintptr_t dispatched; //!< How many events were taken from the event queue so far
+#ifdef UEL_ENABLE_LATENCY_STATS
+    //! Where to record queueing delays. Nothing is recorded if `NULL`.
+    uel_latency_t *latency;
+#endif /* UEL_ENABLE_LATENCY_STATS */
 };
 
 /** \brief Initialises an event loop
@@ -89,4 +98,14 @@ uel_event_t *uel_evloop_observe_once(
     uel_closure_t *closure
 );
 
+#ifdef UEL_ENABLE_LATENCY_STATS
+/** \brief Attaches latency statistics to an event loop. From now on, the
+  * queueing delay of each event run is recorded.
+  *
+  * \param event_loop The event loop to be measured
+  * \param latency Where to record the statistics. Pass `NULL` to detach.
+  */
+void uel_evloop_set_latency(uel_evloop_t *event_loop, uel_latency_t *latency);
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
 #endif /* end of include guard: UEL_EVENT_LOOP_H */
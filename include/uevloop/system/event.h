@@ -10,8 +10,14 @@
 #include <stdbool.h>
 /// \endcond
 
+#include "uevloop/config.h"
+#include "uevloop/system/time.h"
+#include "uevloop/portability/lock.h"
 #include "uevloop/utils/closure.h"
 #include "uevloop/utils/linked-list.h"
+#ifdef UEL_ENABLE_LATENCY_STATS
+#include "uevloop/utils/clock.h"
+#endif /* UEL_ENABLE_LATENCY_STATS */
 
 //! Possible types of events understood by the core
 enum uel_event_type {
@@ -19,7 +25,8 @@ enum uel_event_type {
     UEL_TIMER_EVENT,
     UEL_SIGNAL_EVENT,
     UEL_SIGNAL_LISTENER_EVENT,
-    UEL_OBSERVER_EVENT
+    UEL_OBSERVER_EVENT,
+    UEL_EVENT_TYPE_COUNT
 };
 //! Alias to the uel_event_type enum.
 typedef enum uel_event_type uel_event_type_t;
@@ -34,6 +41,18 @@ enum uel_event_timer_status {
 //! Alias to the uel_event_timer_status
 typedef enum uel_event_timer_status uel_event_timer_status_t;
 
+//! Possible policies for recurring timers that fall behind schedule
+enum uel_event_timer_overrun {
+    //! Run once for each missed period, as soon as possible. This is the default.
+    UEL_TIMER_CATCH_UP,
+    //! Drop missed periods and run again on the next period boundary
+    UEL_TIMER_SKIP,
+    //! Run once right away, standing for every missed period
+    UEL_TIMER_COALESCE
+};
+//! Alias to the uel_event_timer_overrun enum
+typedef enum uel_event_timer_overrun uel_event_timer_overrun_t;
+
 
 /** \brief Events are special messages passed around the core.
   * They represent tasks to be run at some point by the system.
@@ -60,6 +79,10 @@ struct event {
     uel_closure_t closure; //!< The closure to be invoked a.k.a. the action to be run
     void *value; //!< The value the closure should be invoked with
     bool repeating; //!< Marks whether the event should be discarded after processing.
+#ifdef UEL_ENABLE_LATENCY_STATS
+    //! The instrumentation clock reading when this event was last enqueued
+    uel_timestamp_t enqueued_at;
+#endif /* UEL_ENABLE_LATENCY_STATS */
 
     //! Allows to compact many speciffic details on various event types on a single
     //! memory slot. Pertinent content depends on the `type` member value.
@@ -70,15 +93,29 @@ struct event {
             /** \brief The value the system timer must be at when this event's closure
             * should be invoked. This is a best effort value.
             */
-            uint32_t due_time;
-            uint16_t timeout; //!< Holds the interval between two executions of the timer
+            uel_time_t due_time;
+            /** \brief When the scheduler will actually expire this timer. This is
+              * `due_time`, possibly deferred within `slack` to match other timers.
+              */
+            uel_time_t expires_at;
+            uel_timeout_t timeout; //!< Holds the interval between two executions of the timer
+            /** \brief How much later than `due_time` this timer may expire, so
+              * the scheduler can batch it with other timers.
+              */
+            uel_timeout_t slack;
             uel_event_timer_status_t status; //!< Current timer status
+            //! What to do when a recurring timer falls behind schedule
+            uel_event_timer_overrun_t overrun;
+            //! How many periods were dropped by the overrun policy the last time
+            //! this timer was rescheduled (skip) or expired (coalesce)
+            uint16_t missed;
         } timer; //!< The scheduling information of this event. Relevant only for timers
 
         //! Contains information related to an emitted `signal`.
         struct uel_event_signal {
             uintptr_t value; //!< The integer value that identifies this signal
             uel_llist_t *listeners; //!< Reference to the signal listeners
+            uel_lock_t *lock; //!< The lock guarding the signal listeners
         } signal; //!< The emission information of this event. Relevant only for signals
 
         //! Contains the context of a particular signal listener
@@ -119,12 +156,14 @@ void uel_event_config_closure(
   * \param event The event to be configured
   * \param signal The integer value that identifies this signal
   * \param listeners The listeners associated to this signal
+  * \param lock The lock guarding the listeners, usually the relay's
   * \param params The parameters associated with this signal emission
   */
 void uel_event_config_signal(
     uel_event_t *event,
     uintptr_t signal,
     uel_llist_t *listeners,
+    uel_lock_t *lock,
     void *params
 );
 
@@ -160,8 +199,8 @@ void uel_event_observer_cancel(uel_event_t *event);
 
 /** \brief Configures a timer event
   * \param event The event to be configured
-  * \param timeout_in_ms The delay to process this event. If the event is repeating,
-  * this defines the interval between successive executions.
+  * \param timeout The delay to process this event, in scheduler ticks. If the
+  * event is repeating, this defines the interval between successive executions.
   * \param repeating If this flag is set, the event will not be destroyed after
   * execution. Instead it will be put on the schedule queue.
   * \param immediate If this flag is set, a recurring timer will be immediately
@@ -172,14 +211,52 @@ void uel_event_observer_cancel(uel_event_t *event);
   */
 void uel_event_config_timer(
     uel_event_t *event,
-    uint16_t timeout_in_ms,
+    uel_timeout_t timeout,
     bool repeating,
     bool immediate,
     uel_closure_t *closure,
     void *value,
-    uint32_t current_time
+    uel_time_t current_time
 );
 
+/** \brief Sets the slack of a timer event
+  *
+  * Whenever the timer is scheduled, its expiration may be deferred by up to
+  * `slack` so that it expires together with some other timer already
+  * scheduled. This reduces the number of times the scheduler wakes up when
+  * many timers have close due times. The nominal due time is left untouched,
+  * so recurring timers do not drift. Timers are created with no slack.
+  *
+  * \param event The timer event whose slack should be set
+  * \param slack The maximum deferral of each expiration, in scheduler ticks
+  */
+void uel_event_timer_set_slack(uel_event_t *event, uel_timeout_t slack);
+
+/** \brief Sets the overrun policy of a recurring timer event
+  *
+  * When the application stalls for longer than a timer's period, its due time
+  * is already past by the time it is rescheduled. The overrun policy determines
+  * whether the timer then runs once for each missed period
+  * (`UEL_TIMER_CATCH_UP`), runs again only on the next period boundary
+  * (`UEL_TIMER_SKIP`) or runs once right away (`UEL_TIMER_COALESCE`). In any
+  * case, due times stay aligned to the original period grid.
+  *
+  * \param event The timer event whose policy should be set
+  * \param overrun The overrun policy
+  */
+void uel_event_timer_set_overrun(uel_event_t *event, uel_event_timer_overrun_t overrun);
+
+/** \brief Fetches how many periods a timer event dropped due to its overrun
+  * policy. A coalescing timer can read this from its closure to account for the
+  * periods its current run stands for, besides its own.
+  *
+  * \param event The timer event
+  * \returns The number of periods dropped the last time the timer was
+  * rescheduled (skipping timers) or expired (coalescing timers). Always zero for
+  * catch-up timers.
+  */
+uint16_t uel_event_timer_get_missed(uel_event_t *event);
+
 /** \brief Pauses a timer event
   *
   * \param event The timer event to be paused
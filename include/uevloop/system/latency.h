@@ -0,0 +1,65 @@
+/** \file latency.h
+  *
+  * \brief Defines latency statistics, optional histograms of how long events
+  * wait before being run. Only available when `UEL_ENABLE_LATENCY_STATS` is defined.
+  */
+
+#ifndef UEL_LATENCY_H
+#define UEL_LATENCY_H
+
+#include "uevloop/config.h"
+#include "uevloop/system/event.h"
+#include "uevloop/utils/histogram.h"
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+
+/** \brief Latency statistics of an application
+  *
+  * Once attached to an event loop and a scheduler, this records:
+  *
+  * - The queueing delay of each event, *i.e.* the time between the event being
+  * enqueued and its closure being invoked, measured in instrumentation clock
+  * units (see `uel_clock_set_source()`) and sorted by event type
+  * - The lateness of each timer, *i.e.* the time between its due time and it
+  * being enqueued by the scheduler, measured in scheduler timer units. The total
+  * delay of a timer is its lateness plus its queueing delay.
+  *
+  * Histograms can be scraped directly at any moment and reset with
+  * `uel_latency_init()`.
+  */
+typedef struct uel_latency uel_latency_t;
+struct uel_latency {
+    //! Queueing delay histograms, indexed by `uel_event_type_t`
+    uel_histogram_t queueing_delay[UEL_EVENT_TYPE_COUNT];
+    //! Timer lateness histogram
+    uel_histogram_t timer_lateness;
+};
+
+/** \brief Initialises latency statistics. This also clears any recorded values.
+  *
+  * \param latency The uel_latency_t instance to be initialised
+  */
+void uel_latency_init(uel_latency_t *latency);
+
+/** \brief Records the queueing delay of an event that is about to be run
+  *
+  * \param latency The uel_latency_t instance where to record the delay
+  * \param event The event about to be run
+  */
+void uel_latency_record_queueing(uel_latency_t *latency, uel_event_t *event);
+
+/** \brief Records the lateness of a timer that has just expired
+  *
+  * \param latency The uel_latency_t instance where to record the lateness
+  * \param timer The expired timer
+  * \param current_time The scheduler's timer value when the timer expired
+  */
+void uel_latency_record_lateness(
+    uel_latency_t *latency,
+    uel_event_t *timer,
+    uel_time_t current_time
+);
+
+#endif /* UEL_ENABLE_LATENCY_STATS */
+
+#endif /* end of include guard: UEL_LATENCY_H */
@@ -0,0 +1,157 @@
+/** \file parallel-iterator.h
+  * \brief Defines parallel iterator operations, which split arrays into chunks
+  * and spread them over the workers of a workgroup
+  */
+
+#ifndef UEL_PARALLEL_ITERATOR_H
+#define UEL_PARALLEL_ITERATOR_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/system/containers/workgroup.h"
+#include "uevloop/utils/iterator.h"
+#include "uevloop/utils/closure.h"
+
+//! The operations that can be run in parallel
+enum uel_iterator_par_operation {
+    UEL_ITERATOR_PAR_MAP, //!< Maps each element into a destination array
+    UEL_ITERATOR_PAR_COUNT, //!< Counts elements that pass a test
+    UEL_ITERATOR_PAR_FIND //!< Finds the first element that passes a test
+};
+//! Alias to the uel_iterator_par_operation enum
+typedef enum uel_iterator_par_operation uel_iterator_par_operation_t;
+
+/** \brief Runs iterator operations over arrays in parallel.
+  *
+  * Each operation splits an array iterator into chunks of `chunk_size`
+  * elements. The calling thread enqueues helper closures into the workgroup
+  * and then claims chunks itself, alongside the workers that pick the helpers
+  * up. The call returns once every chunk has been processed, so results are
+  * complete even if no worker is free to help.
+  *
+  * Helpers that run after their operation is over find no chunks left and
+  * return immediately. The structure must therefore outlive any helper still
+  * enqueued in the workgroup. Only one operation may run on it at a time.
+  */
+typedef struct uel_iterator_par uel_iterator_par_t;
+struct uel_iterator_par {
+    //! The workgroup whose workers help running operations
+    uel_workgroup_t *group;
+    //! How many elements each chunk is made of
+    size_t chunk_size;
+    //! The closure enqueued into the workgroup to help running operations
+    uel_closure_t helper;
+
+    //! The operation being run
+    uel_iterator_par_operation_t operation;
+    //! The array being iterated
+    char *collection;
+    //! How many elements of the array are processed
+    size_t item_count;
+    //! The size of each element in the array
+    size_t item_size;
+    //! The closure applied to each element
+    uel_closure_t closure;
+    //! Where mapped values are stored
+    void **destination;
+
+    //! The next chunk to be claimed. Only ever grows, across operations.
+    volatile uintptr_t next_chunk;
+    //! The value of `next_chunk` that maps to the first chunk of the operation
+    uintptr_t first_chunk;
+    //! The value of `next_chunk` past the last chunk of the operation
+    volatile uintptr_t end_chunk;
+    //! How many chunks are not finished yet
+    volatile uintptr_t pending;
+    //! How many elements passed the test, when counting
+    volatile uintptr_t passed;
+    //! The lowest index of an element that passed the test, when finding
+    volatile uintptr_t found;
+};
+
+/** \brief Initialises a parallel iterator operations runner
+  *
+  * \param par The runner to be initialised
+  * \param group The workgroup whose workers will help running operations. Its
+  * workers must be ticked by their own threads for operations to actually run
+  * in parallel.
+  * \param chunk_size How many elements each chunk is made of. If 0,
+  * `UEL_ITERATOR_PAR_CHUNK_SIZE` is used.
+  */
+void uel_iterator_par_init(
+    uel_iterator_par_t *par,
+    uel_workgroup_t *group,
+    size_t chunk_size
+);
+
+/** \brief Applies a closure to each element of an array in parallel and stores
+  * its results
+  *
+  * The closure may be invoked from several threads at once.
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The closure to be invoked with each element as parameter
+  * \param destination An array of void pointers where results are stored. Each
+  * result is stored at the index of the element it was produced from.
+  * \param limit The maximum number of elements to be mapped
+  * \returns The number of mapped elements
+  */
+size_t uel_iterator_par_map(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure,
+    void **destination,
+    size_t limit
+);
+
+/** \brief Counts elements of an array that pass the supplied test, in parallel
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The test to be applied against each element
+  * \returns How many elements passed the test
+  */
+size_t uel_iterator_par_count(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+);
+
+/** \brief Finds the first element of an array that passes the supplied test,
+  * in parallel
+  *
+  * Once some element passes the test, chunks beyond it are abandoned.
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The test to be applied against each element
+  * \returns The address of the lowest indexed element that passes the test, as
+  * `uel_iterator_find()` would return. If no element passes, returns `NULL`.
+  */
+void *uel_iterator_par_find(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+);
+
+/** \brief Determines whether any element of an array passes the supplied test,
+  * in parallel
+  *
+  * \param par The runner
+  * \param iterator The array iterator that enumerates the elements
+  * \param closure The test to be applied against each element
+  * \returns Whether any element passes the test
+  */
+bool uel_iterator_par_any(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+);
+
+#endif /* end of include guard: UEL_PARALLEL_ITERATOR_H */
@@ -8,10 +8,13 @@
 
 /// \cond
 #include <stdint.h>
+#include <stdbool.h>
 /// \endcond
 
 #include "uevloop/system/containers/system-pools.h"
 #include "uevloop/system/containers/system-queues.h"
+#include "uevloop/system/latency.h"
+#include "uevloop/system/time.h"
 #include "uevloop/utils/linked-list.h"
 #include "uevloop/utils/closure.h"
 
@@ -47,7 +50,12 @@ struct uel_scheduler{
     uel_sysqueues_t *queues; //!< Reference to the system's queues
 
     /** \brief Internal timer. Must be updated via `uel_sch_update_timer()` */
-    volatile uint32_t timer;
+    volatile uel_time_t timer;
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+    //! Where to record timer lateness. Nothing is recorded if `NULL`.
+    uel_latency_t *latency;
+#endif /* UEL_ENABLE_LATENCY_STATS */
 };
 
 /** \brief Initialises a scheduler object
@@ -65,14 +73,14 @@ void uel_sch_init(
 /** \brief Enqueues a closure for later execution.
   *
   * \param scheduler The uel_scheduer_t into which the event will be registered
-  * \param timeout_in_ms The delay in milliseconds until the closure is run
+  * \param timeout The delay in scheduler ticks until the closure is run
   * \param closure The closure to be invoked when the due time is reached
   * \param value The value to invoked the closure with
   * \returns The scheduled event
   */
 uel_event_t *uel_sch_run_later(
     uel_scheduer_t *scheduler,
-    uint16_t  timeout_in_ms,
+    uel_timeout_t timeout,
     uel_closure_t closure,
     void *value
 );
@@ -81,7 +89,7 @@ uel_event_t *uel_sch_run_later(
 /** \brief Enqueues a closure for execution at intervals.
   *
   * \param scheduler The uel_scheduer_t into which the event will be registered
-  * \param interval_in_ms The delay in milliseconds two executions of the closure
+  * \param interval The delay in scheduler ticks between two executions of the closure
   * \param immediate If this flag is set, the the event will be created with a
   * due time to the current time.
   * \param closure The closure to be invoked when the due time is reached
@@ -90,7 +98,7 @@ uel_event_t *uel_sch_run_later(
   */
 uel_event_t *uel_sch_run_at_intervals(
     uel_scheduer_t *scheduler,
-    uint16_t interval_in_ms,
+    uel_timeout_t interval,
     bool immediate,
     uel_closure_t closure,
     void *value
@@ -105,11 +113,32 @@ uel_event_t *uel_sch_run_at_intervals(
   */
 void uel_sch_manage_timers(uel_scheduer_t *scheduler);
 
+/** \brief Finds when the next scheduled timer is due
+  *
+  * Only timers already managed by the scheduler are considered, so call
+  * `uel_sch_manage_timers()` first to account for recently scheduled ones.
+  *
+  * \param scheduler The scheduler to be inspected
+  * \param deadline Where to store the due time of the next timer
+  * \returns Whether any timer is scheduled. If not, `deadline` is left untouched.
+  */
+bool uel_sch_next_deadline(uel_scheduer_t *scheduler, uel_time_t *deadline);
+
 /** \brief Updates the internal time counter
   *
   * \param scheduler The scheduler whose time coounter should be updated
   * \param timer The new counter value to be acknowledged.
   */
-void uel_sch_update_timer(uel_scheduer_t *scheduler, uint32_t timer);
+void uel_sch_update_timer(uel_scheduer_t *scheduler, uel_time_t timer);
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+/** \brief Attaches latency statistics to a scheduler. From now on, the
+  * lateness of each expired timer is recorded.
+  *
+  * \param scheduler The scheduler to be measured
+  * \param latency Where to record the statistics. Pass `NULL` to detach.
+  */
+void uel_sch_set_latency(uel_scheduer_t *scheduler, uel_latency_t *latency);
+#endif /* UEL_ENABLE_LATENCY_STATS */
 
 #endif	/* UEL_SCHEDULER_H */
@@ -12,6 +12,7 @@
 #include "uevloop/system/containers/system-pools.h"
 #include "uevloop/system/containers/system-queues.h"
 #include "uevloop/system/event.h"
+#include "uevloop/portability/lock.h"
 
 /** \typedef uel_signal_t
   *
@@ -48,6 +49,8 @@ struct uel_signal_relay{
     uel_syspools_t *pools;
     //! The number of signals registered at this relay.
     uintptr_t width;
+    //! Guards the signal vector when a lock backend is selected
+    uel_lock_t lock;
 };
 
 /** \brief Initialises a signal relay
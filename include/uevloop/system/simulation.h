@@ -0,0 +1,98 @@
+/** \file simulation.h
+  *
+  * \brief Defines the simulation driver, a deterministic virtual-time harness
+  * that runs applications as fast as the host allows
+  */
+
+#ifndef UEL_SIMULATION_H
+#define UEL_SIMULATION_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/system/containers/application.h"
+#include "uevloop/system/time.h"
+#include "uevloop/utils/clock.h"
+
+/** \brief A single wakeup of a simulated application
+  */
+typedef struct uel_sim_step uel_sim_step_t;
+struct uel_sim_step {
+    uel_time_t time; //!< The virtual time the application was woken at
+    uintptr_t events; //!< How many events were run until the application went idle
+};
+
+/** \brief The simulation driver
+  *
+  * Instead of waiting for a timer ISR, the driver moves the application's timer
+  * straight to the next deadline and ticks it until it goes idle, skipping
+  * every gap in between. Runs are therefore reproducible and take only as long
+  * as processing the events themselves.
+  *
+  * An application is idle when no events are enqueued and no timers await
+  * scheduling. Closures that keep enqueuing themselves prevent it from ever
+  * going idle.
+  */
+typedef struct uel_sim uel_sim_t;
+struct uel_sim {
+    uel_application_t *app; //!< The simulated application
+    uel_sim_step_t *schedule; //!< Where to record each wakeup. May be `NULL`.
+    size_t capacity; //!< How many wakeups fit in `schedule`
+    uintptr_t steps; //!< How many wakeups happened. May exceed `capacity`.
+    uintptr_t events; //!< How many events were run in total
+    uel_time_t start_time; //!< The virtual time when the simulation started
+    //! Host time spent running the simulation, in instrumentation clock units
+    uel_timestamp_t busy;
+};
+
+/** \brief Initialises a simulation driver
+  *
+  * \param sim The simulation driver to be initialised
+  * \param app The application to be simulated. It must be initialised and is
+  * expected to be driven only by the simulation from now on.
+  * \param schedule A buffer where to record each wakeup. Pass `NULL` if not needed.
+  * \param capacity The number of wakeups `schedule` can hold. Further wakeups
+  * are counted but not recorded.
+  */
+void uel_sim_init(
+    uel_sim_t *sim,
+    uel_application_t *app,
+    uel_sim_step_t *schedule,
+    size_t capacity
+);
+
+/** \brief Ticks the application until it goes idle, without advancing time
+  *
+  * \param sim The simulation driver
+  * \returns How many events were run
+  */
+uintptr_t uel_sim_run_until_idle(uel_sim_t *sim);
+
+/** \brief Advances time to the next deadline and runs the application until
+  * it goes idle.
+  *
+  * \param sim The simulation driver
+  * \returns Whether there was any deadline to advance to
+  */
+bool uel_sim_step(uel_sim_t *sim);
+
+/** \brief Steps the simulation through every deadline up to some point in time.
+  * Afterwards, the application timer is left at `end`.
+  *
+  * \param sim The simulation driver
+  * \param end The virtual time where to stop
+  */
+void uel_sim_run_until(uel_sim_t *sim, uel_time_t end);
+
+/** \brief Computes the simulated throughput
+  *
+  * \param sim The simulation driver
+  * \returns How many events were run per simulated second, rounded down. Zero
+  * if no virtual time has passed.
+  */
+uint64_t uel_sim_throughput(uel_sim_t *sim);
+
+#endif /* end of include guard: UEL_SIMULATION_H */
@@ -0,0 +1,47 @@
+/** \file time.h
+  *
+  * \brief Defines the types used to represent time in the scheduler and helpers
+  * to convert between scheduler ticks and physical time units
+  */
+
+#ifndef UEL_TIME_H
+#define UEL_TIME_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+#include "uevloop/config.h"
+
+#ifdef UEL_SCH_64BIT_TIME
+//! A point in time, measured in scheduler ticks since the application started
+typedef uint64_t uel_time_t;
+//! An interval between two points in time, measured in scheduler ticks
+typedef uint32_t uel_timeout_t;
+#else
+//! A point in time, measured in scheduler ticks since the application started
+typedef uint32_t uel_time_t;
+//! An interval between two points in time, measured in scheduler ticks
+typedef uint16_t uel_timeout_t;
+#endif /* UEL_SCH_64BIT_TIME */
+
+//! Converts a duration in seconds to scheduler ticks
+#define UEL_TIME_FROM_S(s) ((uel_time_t)((uint64_t)(s) * UEL_SCH_TICKS_PER_SECOND))
+//! Converts a duration in milliseconds to scheduler ticks, rounding down
+#define UEL_TIME_FROM_MS(ms) \
+    ((uel_time_t)((uint64_t)(ms) * UEL_SCH_TICKS_PER_SECOND / 1000))
+//! Converts a duration in microseconds to scheduler ticks, rounding down
+#define UEL_TIME_FROM_US(us) \
+    ((uel_time_t)((uint64_t)(us) * UEL_SCH_TICKS_PER_SECOND / 1000000))
+//! Converts a duration in nanoseconds to scheduler ticks, rounding down
+#define UEL_TIME_FROM_NS(ns) \
+    ((uel_time_t)((uint64_t)(ns) * UEL_SCH_TICKS_PER_SECOND / 1000000000))
+
+//! Converts a number of scheduler ticks to milliseconds, rounding down
+#define UEL_TIME_TO_MS(ticks) ((uint64_t)(ticks) * 1000 / UEL_SCH_TICKS_PER_SECOND)
+//! Converts a number of scheduler ticks to microseconds, rounding down
+#define UEL_TIME_TO_US(ticks) ((uint64_t)(ticks) * 1000000 / UEL_SCH_TICKS_PER_SECOND)
+//! Converts a number of scheduler ticks to nanoseconds, rounding down
+#define UEL_TIME_TO_NS(ticks) ((uint64_t)(ticks) * 1000000000 / UEL_SCH_TICKS_PER_SECOND)
+
+#endif /* end of include guard: UEL_TIME_H */
@@ -0,0 +1,65 @@
+/** \file arena.h
+  *
+  * \brief Defines arenas, buffers from where memory of any size is bumped out
+  * and recycled all at once
+  */
+
+#ifndef UEL_ARENA_H
+#define UEL_ARENA_H
+
+/// \cond
+#include <stdint.h>
+#include <stdlib.h>
+/// \endcond
+
+/** \brief A buffer that hands out memory by bumping an offset.
+  *
+  * Arenas serve allocations of any size and alignment from a single buffer.
+  * Memory cannot be released piecemeal: instead, the whole arena is reset at
+  * once, when all its allocations are known to be dead. This fits short lived
+  * scratch memory that would otherwise require an object pool per type.
+  */
+typedef struct uel_arena uel_arena_t;
+struct uel_arena {
+    //! The buffer from where memory is allocated
+    uint8_t *buffer;
+    //! The size of the buffer, in bytes
+    size_t size;
+    //! How many bytes have been allocated since the last reset, padding included
+    size_t used;
+    //! The highest value `used` has ever reached
+    size_t peak;
+};
+
+/** \brief Initialises an arena
+  *
+  * \param arena The arena to be initialised
+  * \param buffer The buffer from where memory will be allocated
+  * \param size The size of the buffer, in bytes
+  */
+void uel_arena_init(uel_arena_t *arena, uint8_t *buffer, size_t size);
+
+/** \brief Allocates memory from an arena
+  *
+  * \param arena The arena from where to allocate
+  * \param size The number of bytes to allocate
+  * \param align The alignment of the returned address. Must be a power of two.
+  * Zero is treated as one.
+  * \returns The allocated memory or `NULL` if the arena cannot fit it
+  */
+void *uel_arena_alloc(uel_arena_t *arena, size_t size, size_t align);
+
+/** \brief Releases every allocation made from an arena at once
+  *
+  * \param arena The arena to be reset
+  */
+void uel_arena_reset(uel_arena_t *arena);
+
+/** \brief Counts the bytes that can still be allocated from an arena
+  *
+  * \param arena The arena to be verified
+  * \returns How many bytes are left, before any alignment padding
+  */
+size_t uel_arena_count_available(uel_arena_t *arena);
+
+#endif /* end of include guard: UEL_ARENA_H */
@@ -0,0 +1,190 @@
+/** \file array-kernels.h
+  *
+  * \brief Defines typed kernels that test arrays of fixed-width integers against
+  * thresholds, equality and ranges without invoking a closure per element.
+  *
+  * Every supported comparison is reduced to a range filter, so a single kernel
+  * per integer width serves all of them. Kernels process 16 bytes at a time with
+  * SSE2 or NEON, 32 bytes at a time with AVX2, and fall back to scalar loops
+  * elsewhere and for the trailing elements. Define `UEL_ARRAY_NO_SIMD` to force
+  * the scalar loops.
+  */
+
+#ifndef UEL_ARRAY_KERNELS_H
+#define UEL_ARRAY_KERNELS_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+/** \brief A comparison against the elements of an integer array, reduced to an
+  * inclusive range.
+  *
+  * Elements are first XORed with `bias`, which maps signed integers onto
+  * unsigned ones while preserving their order. An element passes when its
+  * biased value minus `low`, wrapped to the element width, is at most `span`.
+  */
+typedef struct uel_array_filter uel_array_filter_t;
+struct uel_array_filter {
+    //! The width of each element in bytes: 1, 2 or 4
+    uint8_t width;
+    //! Whether no element can possibly pass this filter
+    bool empty;
+    //! Maps element values onto unsigned values
+    uint32_t bias;
+    //! The lowest biased value that passes
+    uint32_t low;
+    //! How far above `low` a biased value may be and still pass
+    uint32_t span;
+};
+
+/** \brief Creates a filter from an inclusive range of biased values
+  *
+  * Prefer the typed constructors, such as `uel_array_filter_u16_gt()`.
+  *
+  * \param width The width of each element in bytes: 1, 2 or 4
+  * \param bias The value elements are XORed with. The sign bit for signed types,
+  * 0 for unsigned ones.
+  * \param low The lowest value that passes, before biasing
+  * \param high The highest value that passes, before biasing
+  * \param empty Whether no element can pass
+  * \returns The created filter
+  */
+static inline uel_array_filter_t uel_array_filter_create(
+    uint8_t width,
+    uint32_t bias,
+    uint32_t low,
+    uint32_t high,
+    bool empty
+){
+    uint32_t mask = width == 4 ? UINT32_MAX : ((uint32_t)1 << (width * 8)) - 1;
+    uint32_t biased_low = (low ^ bias) & mask;
+    uint32_t biased_high = (high ^ bias) & mask;
+    uel_array_filter_t filter = {
+        width,
+        empty || biased_low > biased_high,
+        bias,
+        biased_low,
+        biased_high - biased_low
+    };
+    return filter;
+}
+
+/** \brief Counts elements of an array that pass a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns How many elements pass the filter
+  */
+size_t uel_array_filter_count(const uel_array_filter_t *filter, const void *array, size_t count);
+
+/** \brief Finds the first element of an array that passes a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns The address of the first element that passes, or `NULL` if none does
+  */
+void *uel_array_filter_find(const uel_array_filter_t *filter, const void *array, size_t count);
+
+/** \brief Determines whether any element of an array passes a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns Whether any element passes. Returns as soon as one is found.
+  */
+bool uel_array_filter_any(const uel_array_filter_t *filter, const void *array, size_t count);
+
+/** \brief Determines whether all elements of an array pass a filter
+  *
+  * \param filter The filter to test elements against
+  * \param array The array of integers whose width matches the filter's
+  * \param count The number of elements in the array
+  * \returns Whether all elements pass. Returns as soon as one fails.
+  */
+bool uel_array_filter_all(const uel_array_filter_t *filter, const void *array, size_t count);
+
+//! \cond
+#define UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, operation, params, filter)  \
+    static inline size_t uel_array_count_##suffix##_##operation(             \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return uel_array_filter_count(&predicate, array, count);             \
+    }                                                                         \
+    static inline type *uel_array_find_##suffix##_##operation(               \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return (type *)uel_array_filter_find(&predicate, array, count);      \
+    }                                                                         \
+    static inline bool uel_array_any_##suffix##_##operation(                 \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return uel_array_filter_any(&predicate, array, count);               \
+    }                                                                         \
+    static inline bool uel_array_all_##suffix##_##operation(                 \
+        const type *array, size_t count, params                               \
+    ){                                                                        \
+        uel_array_filter_t predicate = filter;                                \
+        return uel_array_filter_all(&predicate, array, count);               \
+    }
+
+#define UEL_ARRAY_DEFINE_KERNELS(suffix, type, min, max, bias)                \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_gt(type value){ \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)(value + (value != (max))), (uint32_t)(max), value == (max)); \
+    }                                                                         \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_lt(type value){ \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)(min), (uint32_t)(value - (value != (min))), value == (min)); \
+    }                                                                         \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_eq(type value){ \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)value, (uint32_t)value, false);                         \
+    }                                                                         \
+    static inline uel_array_filter_t uel_array_filter_##suffix##_range(       \
+        type low, type high                                                   \
+    ){                                                                        \
+        return uel_array_filter_create(sizeof(type), (bias),                  \
+            (uint32_t)low, (uint32_t)high, low > high);                       \
+    }                                                                         \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, gt, type value,                 \
+        uel_array_filter_##suffix##_gt(value))                                \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, lt, type value,                 \
+        uel_array_filter_##suffix##_lt(value))                                \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, eq, type value,                 \
+        uel_array_filter_##suffix##_eq(value))                                \
+    UEL_ARRAY_DEFINE_OPERATIONS(suffix, type, range, type low UEL_ARRAY_COMMA type high, \
+        uel_array_filter_##suffix##_range(low, high))
+
+#define UEL_ARRAY_COMMA ,
+//! \endcond
+
+/** \brief Typed filters and kernels for each supported integer type.
+  *
+  * For each of `u8`, `i8`, `u16`, `i16`, `u32` and `i32`, and each comparison
+  * `gt` (greater than), `lt` (less than), `eq` (equal to) and `range` (within
+  * `[low, high]`), the following are defined, *e.g.* for `u16` and `gt`:
+  *
+  * - `uel_array_filter_t uel_array_filter_u16_gt(uint16_t value)`
+  * - `size_t uel_array_count_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  * - `uint16_t *uel_array_find_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  * - `bool uel_array_any_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  * - `bool uel_array_all_u16_gt(const uint16_t *array, size_t count, uint16_t value)`
+  *
+  * The `range` variants take `low` and `high` instead of `value`.
+  */
+UEL_ARRAY_DEFINE_KERNELS(u8, uint8_t, 0, UINT8_MAX, 0)
+UEL_ARRAY_DEFINE_KERNELS(i8, int8_t, INT8_MIN, INT8_MAX, 0x80)
+UEL_ARRAY_DEFINE_KERNELS(u16, uint16_t, 0, UINT16_MAX, 0)
+UEL_ARRAY_DEFINE_KERNELS(i16, int16_t, INT16_MIN, INT16_MAX, 0x8000)
+UEL_ARRAY_DEFINE_KERNELS(u32, uint32_t, 0, UINT32_MAX, 0)
+UEL_ARRAY_DEFINE_KERNELS(i32, int32_t, INT32_MIN, INT32_MAX, 0x80000000)
+
+#endif /* end of include guard: UEL_ARRAY_KERNELS_H */
@@ -50,6 +50,8 @@ void uel_autoptr_dealloc(uel_autoptr_t autoptr);
 typedef struct uel_autopool uel_autopool_t;
 struct uel_autopool {
     uel_objpool_t autoptr_pool; //!< The object pool that holds autopointers
+    uint8_t *object_buffer; //!< The buffer that contains each object in the pool
+    size_t item_size; //!< The size of each object in the pool
     uel_closure_t constructor; //!< The constructor closure
     uel_closure_t destructor; //!< The destructor closure
 };
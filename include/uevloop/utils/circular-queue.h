@@ -66,6 +66,27 @@ bool uel_cqueue_push(uel_cqueue_t *queue, void *element);
   */
 void *uel_cqueue_pop(uel_cqueue_t *queue);
 
+/** \brief Pushes many elements into the queue at once
+  *
+  * \param queue The queue into which to push the elements
+  * \param elements The elements to be pushed, from the oldest to the newest
+  * \param count The number of elements to be pushed
+  * \return How many elements were pushed. If the queue cannot hold all of them,
+  * only the first elements that fit are pushed.
+  */
+uintptr_t uel_cqueue_push_many(uel_cqueue_t *queue, void **elements, uintptr_t count);
+
+/** \brief Pops many elements from the queue at once
+  *
+  * \param queue The queue from where to pop
+  * \param elements The array where to store the popped elements, from the oldest
+  * to the newest
+  * \param max The max number of elements to be popped. `elements` must be able
+  * to hold this many elements.
+  * \return How many elements were popped
+  */
+uintptr_t uel_cqueue_pop_many(uel_cqueue_t *queue, void **elements, uintptr_t max);
+
 /** \brief Peeks the tail of the queue, where the oldest element is enqueued.
   * This is the element that will be returned on the next pop operation.
   *
@@ -0,0 +1,40 @@
+/** \file clock.h
+  *
+  * \brief Defines the instrumentation clock, a high resolution time source used
+  * by the optional instrumentation facilities
+  */
+
+#ifndef UEL_CLOCK_H
+#define UEL_CLOCK_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+#include "uevloop/utils/closure.h"
+
+/** \brief A reading of the instrumentation clock.
+  *
+  * The unit is defined by whatever source is installed (*e.g.* CPU cycles,
+  * microseconds or nanoseconds). Timestamps are expected to wrap around, so
+  * only differences between close readings are meaningful.
+  */
+typedef uint32_t uel_timestamp_t;
+
+/** \brief Installs the source of the instrumentation clock.
+  *
+  * The source closure is invoked with no meaningful parameters and must return
+  * the current reading of a free-running counter, cast to a `void *`.
+  * Until a source is installed, the clock always reads zero.
+  *
+  * \param source The closure that reads the clock
+  */
+void uel_clock_set_source(uel_closure_t source);
+
+/** \brief Reads the instrumentation clock
+  *
+  * \returns The current clock reading
+  */
+uel_timestamp_t uel_clock_now();
+
+#endif /* end of include guard: UEL_CLOCK_H */
@@ -13,7 +13,9 @@
 #include "uevloop/utils/closure.h"
 #include "uevloop/utils/pipeline.h"
 #include "uevloop/utils/conditional.h"
+#include "uevloop/utils/switch.h"
 #include "uevloop/utils/iterator.h"
+#include "uevloop/utils/array-kernels.h"
 
 /** \brief Maps elements of an iterator to an area of memory. Each element is
   * assigned to a `void` pointer slot.
@@ -60,6 +62,17 @@ uel_closure_t uel_func_pipeline(uel_pipeline_t *pipeline);
   */
 uel_closure_t uel_func_conditional(uel_conditional_t *conditional);
 
+/** \brief Wraps a switch in a closure
+  *
+  * This function wraps a switch in a closure. When invoked, the closure's
+  * parameters will be forwarded to the switch. Also, the returned value of the
+  * branch taken will be returned from the closure.
+  *
+  * \param sw The switch to be wrapped
+  * \returns A closure that, when invoked, will apply the supplied switch
+  */
+uel_closure_t uel_func_switch(uel_switch_t *sw);
+
 /** \brief Wraps a closure in a `foreach` construct
   *
   * Creates a new closure based on a supplied closure. When invoked, this new
@@ -159,4 +172,46 @@ uel_closure_t uel_func_none(uel_closure_t *closure);
   */
 uel_closure_t uel_func_any(uel_closure_t *closure);
 
+/** \brief Creates a closure that counts the elements of an integer array that
+  * pass a filter
+  *
+  * The new closure accepts an `uel_iterator_array_t` as parameter and runs the
+  * filter's kernel over its whole array, with no closure invoked per element.
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that returns how many elements pass the filter
+  */
+uel_closure_t uel_func_array_count(uel_array_filter_t *filter);
+
+/** \brief Creates a closure that finds the first element of an integer array
+  * that passes a filter
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that, invoked with an `uel_iterator_array_t`, returns the
+  * address of the first element that passes the filter or `NULL`
+  */
+uel_closure_t uel_func_array_find(uel_array_filter_t *filter);
+
+/** \brief Creates a closure that determines whether all elements of an integer
+  * array pass a filter
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that, invoked with an `uel_iterator_array_t`, returns
+  * whether all elements pass the filter
+  */
+uel_closure_t uel_func_array_all(uel_array_filter_t *filter);
+
+/** \brief Creates a closure that determines whether any element of an integer
+  * array passes a filter
+  *
+  * \param filter The filter to test elements against. Its width must match the
+  * iterator's item size.
+  * \returns A closure that, invoked with an `uel_iterator_array_t`, returns
+  * whether any element passes the filter
+  */
+uel_closure_t uel_func_array_any(uel_array_filter_t *filter);
+
 #endif /* end of include guard: UEL_FUNCTIONAL_H */
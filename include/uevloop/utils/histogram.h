@@ -0,0 +1,85 @@
+/** \file histogram.h
+  *
+  * \brief Defines log-linear histograms, compact structures that record
+  * distributions of values spanning many orders of magnitude
+  */
+
+#ifndef UEL_HISTOGRAM_H
+#define UEL_HISTOGRAM_H
+
+/// \cond
+#include <stdint.h>
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/config.h"
+
+//! Unrolls `UEL_HISTOGRAM_PRECISION_BITS` into the number of buckets per power of two
+#define UEL_HISTOGRAM_SUB_BUCKET_COUNT (1<<UEL_HISTOGRAM_PRECISION_BITS)
+//! The number of buckets needed to cover the whole 32-bit range
+#define UEL_HISTOGRAM_BUCKET_COUNT \
+    ((33 - UEL_HISTOGRAM_PRECISION_BITS) * UEL_HISTOGRAM_SUB_BUCKET_COUNT)
+
+/** \brief A log-linear histogram of 32-bit values
+  *
+  * Values are sorted into buckets in the same fashion as HDR histograms: each
+  * power of two is split into `UEL_HISTOGRAM_SUB_BUCKET_COUNT` linear buckets.
+  * Values smaller than twice that are recorded exactly; larger values are
+  * recorded with a relative error bounded by `1/UEL_HISTOGRAM_SUB_BUCKET_COUNT`.
+  *
+  * Recording a value takes constant time and no memory other than the
+  * histogram itself.
+  */
+typedef struct uel_histogram uel_histogram_t;
+struct uel_histogram {
+    //! The number of recorded values in each bucket
+    uint32_t buckets[UEL_HISTOGRAM_BUCKET_COUNT];
+    //! The number of recorded values
+    uint32_t count;
+    //! The smallest recorded value
+    uint32_t min;
+    //! The largest recorded value
+    uint32_t max;
+    //! The sum of every recorded value
+    uint64_t sum;
+};
+
+/** \brief Initialises a histogram. This also clears any recorded values.
+  *
+  * \param histogram The histogram to be initialised
+  */
+void uel_histogram_init(uel_histogram_t *histogram);
+
+/** \brief Records a value into a histogram
+  *
+  * \param histogram The histogram where to record the value
+  * \param value The value to be recorded
+  */
+void uel_histogram_record(uel_histogram_t *histogram, uint32_t value);
+
+/** \brief Finds which bucket a value is recorded at
+  *
+  * \param value The value to be located
+  * \returns The index of the bucket that holds `value`
+  */
+size_t uel_histogram_bucket_index(uint32_t value);
+
+/** \brief Computes the smallest value recorded at some bucket. Use this to
+  * label buckets when exporting histograms.
+  *
+  * \param index The index of the bucket
+  * \returns The lower bound of the bucket
+  */
+uint32_t uel_histogram_bucket_floor(size_t index);
+
+/** \brief Estimates a quantile of the recorded distribution
+  *
+  * \param histogram The histogram to be inspected
+  * \param permille The quantile to be estimated, in permille (*e.g.* 500 for the
+  * median, 990 for the 99th percentile)
+  * \returns The lower bound of the bucket that contains the quantile. If no
+  * value was recorded, returns zero.
+  */
+uint32_t uel_histogram_quantile(uel_histogram_t *histogram, uint16_t permille);
+
+#endif /* end of include guard: UEL_HISTOGRAM_H */
@@ -12,6 +12,7 @@
 #include <limits.h>
 /// \endcond
 
+#include "uevloop/config.h"
 #include "uevloop/utils/linked-list.h"
 #include "uevloop/utils/closure.h"
 
@@ -41,8 +42,43 @@ struct uel_iterator{
     void * (* next)(uel_iterator_t *, void *);
     //! A reference to the collection being iterated.
     void *collection;
+    /** \brief The optional batched iteration function of this iterator type
+      *
+      * Takes a reference to the iterator, the last accessed element's address,
+      * a buffer and its capacity. Fills the buffer with the addresses of the
+      * elements following the last one, up to the capacity, and returns how many
+      * were stored. When it returns 0, there are no more elements.
+      *
+      * Iterator operations request up to `UEL_ITERATOR_BATCH_SIZE` elements at
+      * once through this function and process them in a tight loop. If it is
+      * `NULL`, they fall back to `next`.
+      */
+    size_t (* next_batch)(uel_iterator_t *, void *, void **, size_t);
 };
 
+//! The type of the `next` function of iterators
+typedef void * (* uel_iterator_next_t)(uel_iterator_t *, void *);
+//! The type of the `next_batch` function of iterators
+typedef size_t (* uel_iterator_next_batch_t)(uel_iterator_t *, void *, void **, size_t);
+
+/** \brief Fills a buffer with elements enumerated by an iterator
+  *
+  * Uses the iterator's `next_batch` function when available. Otherwise, yields
+  * a single element obtained from `next`.
+  *
+  * \param iterator The iterator that enumerates the elements of some collection
+  * \param last The last element yielded. If `NULL`, starts from the first one.
+  * \param batch The buffer where element addresses will be stored
+  * \param capacity The maximum number of elements to store. Must be at least 1.
+  * \returns How many elements were stored. If 0, the iteration is over.
+  */
+size_t uel_iterator_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+);
+
 /** \brief Applies a closure to an enumerable collection
   *
   * \param iterator The iterator that enumerates the elements of some collection
@@ -140,6 +176,21 @@ struct uel_iterator_array{
   */
 void *uel_iterator_array_next(uel_iterator_array_t *iterator, void *last);
 
+/** \brief Yields a contiguous range of elements in an array
+  *
+  * \param iterator The iterator that enumerates the elements in the target array
+  * \param last The last element yielded. If `NULL`, starts from the first element.
+  * \param batch The buffer where element addresses will be stored
+  * \param capacity The maximum number of elements to store
+  * \returns How many elements were stored. If 0, there are no more elements.
+  */
+size_t uel_iterator_array_next_batch(
+    uel_iterator_array_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+);
+
 /** \brief Creates a new array iterator
   *
   * \param collection The array to be  enumerated
@@ -166,6 +217,21 @@ typedef uel_iterator_t uel_iterator_llist_t;
   */
 void *uel_iterator_llist_next(uel_iterator_t *iterator, void *last);
 
+/** \brief Yields a run of elements in a linked list
+  *
+  * \param iterator The iterator that enumerates the elements in the target list
+  * \param last The last element yielded. If `NULL`, starts from the first element.
+  * \param batch The buffer where element addresses will be stored
+  * \param capacity The maximum number of elements to store
+  * \returns How many elements were stored. If 0, there are no more elements.
+  */
+size_t uel_iterator_llist_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+);
+
 /** \brief Creates a new linked list iterator
   *
   * \param list The linked list to be enumerated
@@ -173,6 +239,146 @@ void *uel_iterator_llist_next(uel_iterator_t *iterator, void *last);
   */
 uel_iterator_llist_t uel_iterator_llist_create(uel_llist_t *list);
 
+/** \brief An iterator that lazily applies a closure to each element yielded by
+  * a source iterator.
+  *
+  * Yields the addresses of `void *` slots holding the values returned by the
+  * closure. Each slot is only valid until the iterator is advanced again.
+  *
+  * Like the other iterator adapters, it is stateful: it tracks its position in
+  * the source iterator and can only be enumerated in one pass. Requesting the
+  * first element again (passing `NULL` as the last element) restarts it.
+  */
+typedef struct uel_iterator_map_adapter uel_iterator_map_adapter_t;
+struct uel_iterator_map_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The closure applied to each element yielded by the source iterator
+    uel_closure_t closure;
+    //! The last element yielded by the source iterator
+    void *source_last;
+    //! The slots holding the values produced by the closure
+    void *values[UEL_ITERATOR_BATCH_SIZE];
+};
+
+/** \brief Creates a lazy mapping iterator
+  *
+  * \param source The iterator whose elements will be mapped
+  * \param closure The closure to be invoked with each element of the source
+  * iterator as parameter
+  * \returns The created iterator
+  */
+uel_iterator_map_adapter_t uel_iterator_map_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+);
+
+/** \brief An iterator that lazily yields only the elements of a source iterator
+  * that pass some test.
+  */
+typedef struct uel_iterator_filter_adapter uel_iterator_filter_adapter_t;
+struct uel_iterator_filter_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The test applied to each element yielded by the source iterator
+    uel_closure_t closure;
+    //! The last element yielded by the source iterator
+    void *source_last;
+};
+
+/** \brief Creates a lazy filtering iterator
+  *
+  * \param source The iterator whose elements will be filtered
+  * \param closure The test to be applied against each element of the source
+  * iterator. Only elements for which it returns `true` are yielded.
+  * \returns The created iterator
+  */
+uel_iterator_filter_adapter_t uel_iterator_filter_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+);
+
+/** \brief An iterator that yields at most a number of elements from a source
+  * iterator.
+  */
+typedef struct uel_iterator_take_adapter uel_iterator_take_adapter_t;
+struct uel_iterator_take_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The maximum number of elements to be yielded
+    size_t count;
+    //! How many elements were yielded so far
+    size_t taken;
+    //! The last element yielded by the source iterator
+    void *source_last;
+};
+
+/** \brief Creates an iterator that yields the first elements of another
+  *
+  * \param source The iterator whose elements will be taken
+  * \param count The maximum number of elements to be yielded
+  * \returns The created iterator
+  */
+uel_iterator_take_adapter_t uel_iterator_take_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+);
+
+/** \brief An iterator that skips a number of elements from a source iterator
+  * before yielding the remaining ones.
+  */
+typedef struct uel_iterator_skip_adapter uel_iterator_skip_adapter_t;
+struct uel_iterator_skip_adapter{
+    //! The base iterator interface. Its collection is the source iterator.
+    uel_iterator_t base;
+    //! The number of elements to be skipped
+    size_t count;
+    //! The last element yielded by the source iterator
+    void *source_last;
+};
+
+/** \brief Creates an iterator that skips the first elements of another
+  *
+  * \param source The iterator whose elements will be skipped
+  * \param count The number of elements to be skipped
+  * \returns The created iterator
+  */
+uel_iterator_skip_adapter_t uel_iterator_skip_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+);
+
+/** \brief An iterator that pairs up the elements of two source iterators.
+  *
+  * Yields the addresses of two-element arrays of `void *`, holding one element
+  * of each source. Each pair is only valid until the iterator is advanced again.
+  * Iteration ends when either source is exhausted.
+  */
+typedef struct uel_iterator_zip_adapter uel_iterator_zip_adapter_t;
+struct uel_iterator_zip_adapter{
+    //! The base iterator interface. Its collection is the first source iterator.
+    uel_iterator_t base;
+    //! The second source iterator
+    uel_iterator_t *other;
+    //! The last element yielded by the first source iterator
+    void *source_last;
+    //! The last element yielded by the second source iterator
+    void *other_last;
+    //! The pairs of elements yielded by the source iterators
+    void *pairs[UEL_ITERATOR_BATCH_SIZE][2];
+};
+
+/** \brief Creates an iterator that pairs up the elements of two others
+  *
+  * \param source The iterator whose elements will be first in each pair
+  * \param other The iterator whose elements will be second in each pair
+  * \returns The created iterator
+  */
+uel_iterator_zip_adapter_t uel_iterator_zip_adapter_create(
+    uel_iterator_t *source,
+    uel_iterator_t *other
+);
+
 //! Defines the maximum possible iteration limit for the `uel_iterator_map()`
 //! function.
 #define UEL_ITERATOR_MAP_BOUNDLESS UINT_MAX
@@ -4,6 +4,11 @@
 #ifndef UEL_MODULE_H
 #define UEL_MODULE_H
 
+/// \cond
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
 struct uel_application;
 struct uel_module;
 
@@ -11,6 +16,21 @@ struct uel_module;
   */
 typedef void (*uel_module_hook_t)(struct uel_module *);
 
+/** \brief Defines the stages of a module's launch
+  */
+enum uel_module_state {
+    //! The module has not been launched
+    UEL_MODULE_IDLE,
+    //! The module is due to launch as soon as its dependencies are launched
+    UEL_MODULE_WAITING,
+    //! The launch hook has been called, but the module has not finished launching
+    UEL_MODULE_LAUNCHING,
+    //! The module has finished launching
+    UEL_MODULE_LAUNCHED
+};
+//! Alias to the `uel_module_state` enum
+typedef enum uel_module_state uel_module_state_t;
+
 /** \brief A module is an isolated unit of behaviour with lifecycle hooks
   *
   * Modules can serve as a variety of purposes:
@@ -22,6 +42,11 @@ typedef void (*uel_module_hook_t)(struct uel_module *);
   *   parts of the application in a sattelite-fashion.
   *
   * Modules are meant to be singletons and user extendable.
+  *
+  * Modules may depend on other modules of the same application, which are
+  * then launched first. Asynchronous modules are only considered launched once
+  * they call `uel_module_launched()`, so slow launches of independent modules
+  * can overlap. Lazy modules are only launched when first required.
   */
 typedef struct uel_module uel_module_t;
 struct uel_module {
@@ -37,6 +62,16 @@ struct uel_module {
     uel_module_hook_t launch;
     //! Keeps a reference to the application onto which the module is loaded
     struct uel_application *app;
+    //! The registry IDs of the modules that must launch before this one
+    const size_t *dependencies;
+    //! The number of dependencies
+    size_t dependency_count;
+    //! Whether this module is only launched when first required
+    bool lazy;
+    //! Whether this module signals the end of its launch with `uel_module_launched()`
+    bool asynchronous;
+    //! The stage of this module's launch
+    volatile uel_module_state_t state;
 };
 
 /** \brief Initialised a module
@@ -65,4 +100,47 @@ void uel_module_config(uel_module_t *module);
   */
 void uel_module_launch(uel_module_t *module);
 
+/** \brief Declares the modules a module depends on
+  *
+  * The application only launches a module after all its dependencies are
+  * launched. Modules involved in dependency cycles are never launched.
+  *
+  * \param module The dependent module
+  * \param dependencies The registry IDs of the dependencies. Must outlive the
+  * module.
+  * \param count The number of dependencies
+  */
+void uel_module_set_dependencies(
+    uel_module_t *module,
+    const size_t *dependencies,
+    size_t count
+);
+
+/** \brief Marks a module as lazy. Lazy modules are not launched when loaded,
+  * but the first time they are required, either directly with
+  * `uel_app_require()` or as a dependency of a module being launched.
+  *
+  * \param module The module to be marked
+  * \param lazy Whether the module is lazy
+  */
+void uel_module_set_lazy(uel_module_t *module, bool lazy);
+
+/** \brief Marks a module as asynchronous. Asynchronous modules are not
+  * considered launched when their launch hook returns, but when they call
+  * `uel_module_launched()`.
+  *
+  * \param module The module to be marked
+  * \param asynchronous Whether the module is asynchronous
+  */
+void uel_module_set_async(uel_module_t *module, bool asynchronous);
+
+/** \brief Signals that an asynchronous module has finished launching
+  *
+  * Modules that depend on it are launched from the application's event loop,
+  * so this function may be called from interrupts.
+  *
+  * \param module The module that has finished launching
+  */
+void uel_module_launched(uel_module_t *module);
+
 #endif /* end of include guard: UEL_MODULE_H */
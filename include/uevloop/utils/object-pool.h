@@ -7,6 +7,7 @@
 #define	UEL_OBJECT_POOL_H
 
 #include "uevloop/utils/circular-queue.h"
+#include "uevloop/portability/lock.h"
 
 /// \cond
 #include <stdint.h>
@@ -20,15 +21,24 @@
   * compile time as an alternative to runtime memory allocation for dynamic
   * object management.
   *
-  * To efficiently release and acquire objects from a pool, their addresses are
-  * kept in a circular queue that is fully populated during initialisation.
+  * Objects that have never been acquired are handed out in buffer order by
+  * bumping an index, so initialisation takes constant time regardless of the
+  * pool size. Once released, the addresses of objects are kept in a circular
+  * queue, from where they are acquired again before any untouched object.
   */
 typedef struct uel_objpool uel_objpool_t;
 struct uel_objpool {
     //! The buffer that contains each object managed by this pool.
     uint8_t *buffer;
-    //! The queue containing the addresses for each object in the pool.
+    //! The queue containing the addresses of released objects.
     uel_cqueue_t queue;
+    //! The size of each object in the pool
+    size_t item_size;
+    //! The index of the first object in the buffer never acquired
+    uintptr_t untouched;
+    //! Guards the pool when it is shared between threads and a lock backend is
+    //! selected. Acquiring and releasing do not take it themselves.
+    uel_lock_t lock;
 };
 
 /** \brief Initialises an object pool
@@ -72,6 +82,13 @@ bool uel_objpool_release(uel_objpool_t *pool, void *element);
   */
 bool uel_objpool_is_empty(uel_objpool_t *pool);
 
+/** \brief Counts the objects that can still be acquired from a pool
+  *
+  * \param pool The pool to be verified
+  * \return How many objects are available, released or never acquired
+  */
+size_t uel_objpool_count_available(uel_objpool_t *pool);
+
 /** \brief Declares the necessary buffers to back an object pool, so the
   * programmer doesn't have to reason much about it.
   *
@@ -62,4 +62,68 @@ void *uel_pipeline_apply(uel_pipeline_t *pipeline, void *params);
     uel_pipeline_init(&id##_pipeline, id##_pipeline_closures,                 \
                     sizeof(id##_pipeline_closures) / sizeof(uel_closure_t));
 
+//! \cond
+#define UEL_PIPELINE_STAGE_CALL(...) UEL_PIPELINE_STAGE_CALL_(__VA_ARGS__)
+#define UEL_PIPELINE_STAGE_CALL_(value, function, context)                    \
+    function((void *)(context), (value))
+#define UEL_PIPELINE_STAGE_UNPACK(function, context) function, context
+#define UEL_PIPELINE_STAGE(value, stage)                                      \
+    UEL_PIPELINE_STAGE_CALL(value, UEL_PIPELINE_STAGE_UNPACK stage)
+
+#define UEL_PIPELINE_CHAIN_1(v, s1) UEL_PIPELINE_STAGE(v, s1)
+#define UEL_PIPELINE_CHAIN_2(v, s1, s2)                                       \
+    UEL_PIPELINE_CHAIN_1(UEL_PIPELINE_STAGE(v, s1), s2)
+#define UEL_PIPELINE_CHAIN_3(v, s1, s2, s3)                                   \
+    UEL_PIPELINE_CHAIN_2(UEL_PIPELINE_STAGE(v, s1), s2, s3)
+#define UEL_PIPELINE_CHAIN_4(v, s1, s2, s3, s4)                               \
+    UEL_PIPELINE_CHAIN_3(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4)
+#define UEL_PIPELINE_CHAIN_5(v, s1, s2, s3, s4, s5)                           \
+    UEL_PIPELINE_CHAIN_4(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5)
+#define UEL_PIPELINE_CHAIN_6(v, s1, s2, s3, s4, s5, s6)                       \
+    UEL_PIPELINE_CHAIN_5(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5, s6)
+#define UEL_PIPELINE_CHAIN_7(v, s1, s2, s3, s4, s5, s6, s7)                   \
+    UEL_PIPELINE_CHAIN_6(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5, s6, s7)
+#define UEL_PIPELINE_CHAIN_8(v, s1, s2, s3, s4, s5, s6, s7, s8)               \
+    UEL_PIPELINE_CHAIN_7(UEL_PIPELINE_STAGE(v, s1), s2, s3, s4, s5, s6, s7, s8)
+
+#define UEL_PIPELINE_COUNT(...)                                               \
+    UEL_PIPELINE_COUNT_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define UEL_PIPELINE_COUNT_(_1, _2, _3, _4, _5, _6, _7, _8, count, ...) count
+#define UEL_PIPELINE_CHAIN(count, value, ...)                                 \
+    UEL_PIPELINE_CHAIN_(count, value, __VA_ARGS__)
+#define UEL_PIPELINE_CHAIN_(count, value, ...)                                \
+    UEL_PIPELINE_CHAIN_##count(value, __VA_ARGS__)
+//! \endcond
+
+/** \brief Helper macro to define a pipeline whose stages are known at compile
+  * time
+  *
+  * Instead of an array of closures walked at runtime, this macro expands into
+  * a direct chain of calls that the compiler can inline. It must be used at
+  * file scope and, based on the input identifier, defines:
+  * - `void *[id]_pipeline_apply(void *params)`, with the same semantics as
+  * `uel_pipeline_apply()`
+  * - `void *[id]_pipeline_function(void *context, void *params)`, which ignores
+  * its context and can be bound with `uel_closure_create()` wherever a closure
+  * is expected
+  *
+  * Stages are given as parenthesised `(function, context)` pairs, where
+  * `function` is a closure function and `context` is an expression valid at
+  * file scope, such as a constant or the address of a static object. Up to 8
+  * stages are supported. Unlike closures invoked by the core, stages are not
+  * accounted for by the profiler.
+  *
+  * \param id The identifier on which to base defined functions' names.
+  * \param ... The `(function, context)` stages to be pipelined.
+  */
+#define UEL_PIPELINE_DECLARE_STATIC(id, ...)                                  \
+    static inline void *id##_pipeline_apply(void *params){                    \
+        return UEL_PIPELINE_CHAIN(                                            \
+            UEL_PIPELINE_COUNT(__VA_ARGS__), params, __VA_ARGS__              \
+        );                                                                    \
+    }                                                                         \
+    static inline void *id##_pipeline_function(void *context, void *params){  \
+        return id##_pipeline_apply(params);                                   \
+    }
+
 #endif /* end of include guard: UEL_PIPELINE_H */
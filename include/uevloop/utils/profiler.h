@@ -0,0 +1,125 @@
+/** \file profiler.h
+  *
+  * \brief Defines the profiler, an optional accounting of how much time each
+  * closure function consumes
+  */
+
+#ifndef UEL_PROFILER_H
+#define UEL_PROFILER_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/utils/clock.h"
+#include "uevloop/utils/closure.h"
+
+//! Unrolls `UEL_PROFILER_TABLE_SIZE_LOG2N` into its power-of-two form
+#define UEL_PROFILER_TABLE_SIZE (1<<UEL_PROFILER_TABLE_SIZE_LOG2N)
+
+/** \brief The accumulated cost of a single closure function
+  */
+typedef struct uel_profile_entry uel_profile_entry_t;
+struct uel_profile_entry {
+    //! The closure function accounted for. `NULL` if this entry is vacant.
+    uel_closure_function_t function;
+    uint32_t calls; //!< How many times the function was invoked
+    uint64_t total; //!< The sum of the durations of all invocations
+    uel_timestamp_t max; //!< The duration of the longest invocation
+};
+
+/** \brief Describes a single invocation, as reported to the watchdog
+  */
+typedef struct uel_profile_sample uel_profile_sample_t;
+struct uel_profile_sample {
+    uel_closure_t *closure; //!< The closure that was invoked
+    uel_timestamp_t elapsed; //!< How long the invocation took
+};
+
+/** \brief The profiler object
+  *
+  * Holds an open-addressing table of entries keyed by closure function address.
+  * Durations are measured with the instrumentation clock (see
+  * `uel_clock_set_source()`) and are inclusive: a closure that invokes other
+  * profiled closures is also charged for their time.
+  *
+  * A single profiler is attached for every event loop in the program, so
+  * entries are claimed and updated atomically and may be accounted from many
+  * threads at once. Each field of an entry is consistent on its own, but an
+  * entry read while being updated may mix old and new fields.
+  */
+typedef struct uel_profiler uel_profiler_t;
+struct uel_profiler {
+    //! The accounting table. Vacant entries have a `NULL` function.
+    uel_profile_entry_t entries[UEL_PROFILER_TABLE_SIZE];
+    //! Samples that could not be accounted because the table was full
+    uint32_t dropped;
+    //! Invocations longer than this trigger the watchdog
+    uel_timestamp_t threshold;
+    //! Invoked with a `uel_profile_sample_t *` when an invocation is too long
+    uel_closure_t watchdog;
+};
+
+#ifdef UEL_ENABLE_PROFILER
+//! Invokes a closure, accounting for it at the attached profiler
+#define UEL_PROFILED_INVOKE(closure, params) uel_profiler_invoke((closure), (params))
+#else
+//! Plain `uel_closure_invoke()` when `UEL_ENABLE_PROFILER` is not defined
+#define UEL_PROFILED_INVOKE(closure, params) uel_closure_invoke((closure), (params))
+#endif /* UEL_ENABLE_PROFILER */
+
+/** \brief Initialises a profiler
+  *
+  * \param profiler The profiler to be initialised
+  * \param threshold The longest acceptable invocation duration
+  * \param watchdog The closure to be invoked, with a `uel_profile_sample_t *` as
+  * parameter, whenever an invocation takes longer than `threshold`. Pass
+  * `uel_nop()` if no watchdog is needed.
+  */
+void uel_profiler_init(
+    uel_profiler_t *profiler,
+    uel_timestamp_t threshold,
+    uel_closure_t watchdog
+);
+
+/** \brief Attaches a profiler to the core. From now on, the core accounts for
+  * closures invoked by the event loop, signal listeners, timers and promises.
+  *
+  * \param profiler The profiler to be attached. Pass `NULL` to detach.
+  */
+void uel_profiler_attach(uel_profiler_t *profiler);
+
+/** \brief Accounts for an invocation
+  *
+  * \param profiler The profiler where to account
+  * \param closure The closure invoked
+  * \param elapsed How long the invocation took
+  */
+void uel_profiler_record(
+    uel_profiler_t *profiler,
+    uel_closure_t *closure,
+    uel_timestamp_t elapsed
+);
+
+/** \brief Finds the entry of a closure function
+  *
+  * \param profiler The profiler to be searched
+  * \param function The closure function to be found
+  * \returns The function's entry or `NULL`, if it has never been accounted for
+  */
+uel_profile_entry_t *uel_profiler_find(
+    uel_profiler_t *profiler,
+    uel_closure_function_t function
+);
+
+/** \brief Invokes a closure and accounts for it at the attached profiler, if any.
+  * Prefer the `UEL_PROFILED_INVOKE` macro, which vanishes when profiling is disabled.
+  *
+  * \param closure The closure to be invoked
+  * \param params The parameters to invoke the closure with
+  * \returns Whatever the closure returned
+  */
+void *uel_profiler_invoke(uel_closure_t *closure, void *params);
+
+#endif /* end of include guard: UEL_PROFILER_H */
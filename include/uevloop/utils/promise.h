@@ -85,6 +85,11 @@ struct uel_promise {
 
 /** \brief An issuer of promises. Contains references to pools for promises and
   * segments.
+  *
+  * Many stores may share the same pools. With a lock backend selected, each
+  * pool is guarded by its own `uel_objpool_t::lock`, so stores on different
+  * threads can draw from the same pools. A promise and its segment chain are
+  * not guarded, though: each promise must only be used from one thread.
   */
 typedef struct uel_promise_store uel_promise_store_t;
 struct uel_promise_store {
@@ -0,0 +1,259 @@
+/** \file static-closure.h
+  *
+  * \brief Defines static closures, typed functions known at compile time that
+  * can be composed and applied without erasing their types.
+  *
+  * Regular closures are invoked through a `void *(*)(void *, void *)` pointer,
+  * so their parameters must be boxed and the call cannot be inlined. Static
+  * closures are plain `static inline` functions with typed context and
+  * parameters. The macros in this file generate pipelines, conditionals and
+  * iterator operations that call them directly, so the compiler can inline the
+  * whole chain. Each static closure also gets a type-erased adapter, so it can
+  * still be bound to a `uel_closure_t` and used with the rest of the library.
+  *
+  * Context, parameter and return types must be either pointers or integers no
+  * wider than `uintptr_t`, as that is what the erased adapter can carry.
+  */
+
+#ifndef UEL_STATIC_CLOSURE_H
+#define UEL_STATIC_CLOSURE_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/utils/closure.h"
+#include "uevloop/utils/iterator.h"
+
+/** \brief Defines a static closure. Must be followed by the function body.
+  *
+  * Declares `return_type name(context_type context, param_type params)` and
+  * its type-erased adapter, `name##_erased`, suitable for `uel_closure_create()`.
+  * The body sees the arguments as `context` and `params`.
+  *
+  * \param name The name of the static closure
+  * \param return_type The type returned by the closure
+  * \param context_type The type of the context the closure is bound to
+  * \param param_type The type of the parameters the closure is invoked with
+  */
+#define UEL_STATIC_CLOSURE(name, return_type, context_type, param_type)       \
+    static inline return_type name(context_type context, param_type params);  \
+    static inline void *name##_erased(void *context, void *params){           \
+        return (void *)(uintptr_t)name(                                       \
+            (context_type)(uintptr_t)context,                                 \
+            (param_type)(uintptr_t)params                                     \
+        );                                                                    \
+    }                                                                         \
+    static inline return_type name(context_type context, param_type params)
+
+/** \brief Binds a static closure to a context, erasing its type
+  *
+  * \param name The static closure to be bound
+  * \param context The context to bind the closure to
+  * \returns A regular `uel_closure_t`, by value
+  */
+#define UEL_STATIC_CLOSURE_BIND(name, context)                                \
+    uel_closure_create(name##_erased, (void *)(uintptr_t)(context))
+
+/** \brief Defines a static closure that pipes its parameters through two others
+  *
+  * Both stages are invoked with the same context. As the result is a static
+  * closure too, pipelines of any length can be built by nesting.
+  *
+  * \param name The name of the pipeline
+  * \param type The type of the parameters and of the value returned by each stage
+  * \param context_type The type of the context shared by both stages
+  * \param first The static closure applied to the parameters
+  * \param second The static closure applied to the value returned by `first`
+  */
+#define UEL_STATIC_PIPELINE(name, type, context_type, first, second)          \
+    UEL_STATIC_CLOSURE(name, type, context_type, type){                       \
+        return second(context, first(context, params));                       \
+    }
+
+/** \brief Defines a static closure that acts as an if-else construct
+  *
+  * \param name The name of the conditional
+  * \param return_type The type returned by both branches
+  * \param context_type The type of the context shared by the test and branches
+  * \param param_type The type of the parameters
+  * \param test The static closure that decides which branch to take
+  * \param if_true The static closure invoked when `test` returns `true`
+  * \param if_false The static closure invoked when `test` returns `false`
+  */
+#define UEL_STATIC_CONDITIONAL(                                               \
+    name, return_type, context_type, param_type, test, if_true, if_false      \
+)                                                                             \
+    UEL_STATIC_CLOSURE(name, return_type, context_type, param_type){          \
+        return test(context, params) ?                                        \
+            if_true(context, params) : if_false(context, params);             \
+    }
+
+//! \cond
+// Expands to a loop that runs `body` with `element` pointing at each item
+// enumerated by an iterator, fetched in batches
+#define UEL_STATIC_ITERATE(iterator, element_type, element, body)             \
+    void *batch[UEL_ITERATOR_BATCH_SIZE];                                     \
+    for(size_t count = uel_iterator_next_batch(                               \
+            (iterator), NULL, batch, UEL_ITERATOR_BATCH_SIZE                  \
+        ); count != 0; count = uel_iterator_next_batch(                       \
+            (iterator), batch[count - 1], batch, UEL_ITERATOR_BATCH_SIZE      \
+        )){                                                                   \
+        for(size_t i = 0; i < count; i++){                                    \
+            element_type *element = (element_type *)batch[i];                 \
+            body                                                              \
+        }                                                                     \
+    }
+
+// Expands to a loop that runs `body` with `element` pointing at each array item
+#define UEL_STATIC_ITERATE_ARRAY(array, count, element_type, element, body)   \
+    for(size_t i = 0; i < (count); i++){                                      \
+        element_type *element = &(array)[i];                                  \
+        body                                                                  \
+    }
+
+// Defines the iterator and array forms of an iterator operation
+#define UEL_STATIC_ITERATOR_OPERATION(                                        \
+    name, return_type, element_type, context_type, extra, init, body, result  \
+)                                                                             \
+    static inline return_type name(                                           \
+        uel_iterator_t *iterator, context_type context extra                  \
+    ){                                                                        \
+        init                                                                  \
+        UEL_STATIC_ITERATE(iterator, element_type, element, body)             \
+        return result;                                                        \
+    }                                                                         \
+    static inline return_type name##_array(                                   \
+        element_type *array, size_t count, context_type context extra         \
+    ){                                                                        \
+        init                                                                  \
+        UEL_STATIC_ITERATE_ARRAY(array, count, element_type, element, body)   \
+        return result;                                                        \
+    }
+//! \endcond
+
+/** \brief Defines a typed counterpart to `uel_iterator_foreach()`
+  *
+  * Generates `bool name(uel_iterator_t *iterator, context_type context)` and
+  * `bool name##_array(element_type *array, size_t count, context_type context)`.
+  * The array form involves no indirect calls at all.
+  *
+  * \param name The name of the generated functions
+  * \param element_type The type of the enumerated elements
+  * \param context_type The context type of `closure`
+  * \param closure A static closure taking an `element_type *`. Iteration halts
+  * when it returns `false`.
+  */
+#define UEL_STATIC_FOREACH(name, element_type, context_type, closure)         \
+    UEL_STATIC_ITERATOR_OPERATION(name, bool, element_type, context_type, ,   \
+        ,                                                                     \
+        if(!closure(context, element)) return false;,                         \
+        true                                                                  \
+    )
+
+/** \brief Defines a typed counterpart to `uel_iterator_map()`
+  *
+  * Generates both forms, taking two extra parameters: a `result_type *`
+  * destination and a `size_t` limit. They return how many elements were mapped.
+  *
+  * \param name The name of the generated functions
+  * \param element_type The type of the enumerated elements
+  * \param result_type The type returned by `closure`
+  * \param context_type The context type of `closure`
+  * \param closure A static closure taking an `element_type *`
+  */
+#define UEL_STATIC_MAP(name, element_type, result_type, context_type, closure) \
+    UEL_STATIC_ITERATOR_OPERATION(name, size_t, element_type, context_type,   \
+        UEL_STATIC_COMMA result_type *destination UEL_STATIC_COMMA size_t limit, \
+        size_t mapped = 0;,                                                   \
+        if(mapped == limit) return mapped;                                    \
+        destination[mapped++] = closure(context, element);,                   \
+        mapped                                                                \
+    )
+
+/** \brief Defines a typed counterpart to `uel_iterator_find()`
+  *
+  * Generates both forms, returning the first `element_type *` that passes the
+  * test or `NULL`.
+  *
+  * \param name The name of the generated functions
+  * \param element_type The type of the enumerated elements
+  * \param context_type The context type of `test`
+  * \param test A static closure taking an `element_type *` and returning a
+  * boolean value
+  */
+#define UEL_STATIC_FIND(name, element_type, context_type, test)               \
+    UEL_STATIC_ITERATOR_OPERATION(name, element_type *, element_type,         \
+        context_type, ,                                                       \
+        ,                                                                     \
+        if(test(context, element)) return element;,                           \
+        NULL                                                                  \
+    )
+
+/** \brief Defines a typed counterpart to `uel_iterator_count()`
+  *
+  * \param name The name of the generated functions
+  * \param element_type The type of the enumerated elements
+  * \param context_type The context type of `test`
+  * \param test A static closure taking an `element_type *` and returning a
+  * boolean value
+  */
+#define UEL_STATIC_COUNT(name, element_type, context_type, test)              \
+    UEL_STATIC_ITERATOR_OPERATION(name, size_t, element_type, context_type, , \
+        size_t passed = 0;,                                                   \
+        if(test(context, element)) passed++;,                                 \
+        passed                                                                \
+    )
+
+/** \brief Defines a typed counterpart to `uel_iterator_all()`
+  *
+  * \param name The name of the generated functions
+  * \param element_type The type of the enumerated elements
+  * \param context_type The context type of `test`
+  * \param test A static closure taking an `element_type *` and returning a
+  * boolean value
+  */
+#define UEL_STATIC_ALL(name, element_type, context_type, test)                \
+    UEL_STATIC_ITERATOR_OPERATION(name, bool, element_type, context_type, ,   \
+        ,                                                                     \
+        if(!test(context, element)) return false;,                            \
+        true                                                                  \
+    )
+
+/** \brief Defines a typed counterpart to `uel_iterator_any()`
+  *
+  * \param name The name of the generated functions
+  * \param element_type The type of the enumerated elements
+  * \param context_type The context type of `test`
+  * \param test A static closure taking an `element_type *` and returning a
+  * boolean value
+  */
+#define UEL_STATIC_ANY(name, element_type, context_type, test)                \
+    UEL_STATIC_ITERATOR_OPERATION(name, bool, element_type, context_type, ,   \
+        ,                                                                     \
+        if(test(context, element)) return true;,                              \
+        false                                                                 \
+    )
+
+/** \brief Defines a typed counterpart to `uel_iterator_none()`
+  *
+  * \param name The name of the generated functions
+  * \param element_type The type of the enumerated elements
+  * \param context_type The context type of `test`
+  * \param test A static closure taking an `element_type *` and returning a
+  * boolean value
+  */
+#define UEL_STATIC_NONE(name, element_type, context_type, test)               \
+    UEL_STATIC_ITERATOR_OPERATION(name, bool, element_type, context_type, ,   \
+        ,                                                                     \
+        if(test(context, element)) return false;,                             \
+        true                                                                  \
+    )
+
+//! \cond
+#define UEL_STATIC_COMMA ,
+//! \endcond
+
+#endif /* end of include guard: UEL_STATIC_CLOSURE_H */
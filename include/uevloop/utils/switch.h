@@ -0,0 +1,131 @@
+/** \file switch.h
+  *
+  * \brief Contains definitions of functional switches, structures that act as
+  * table-driven multiway branches.
+  */
+
+#ifndef UEL_SWITCH_H
+#define UEL_SWITCH_H
+
+/// \cond
+#include <stdint.h>
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/utils/closure.h"
+
+/** \brief A single branch of a switch
+  */
+typedef struct uel_switch_case uel_switch_case_t;
+struct uel_switch_case {
+    //! The key that selects this branch
+    uintptr_t key;
+    //! The closure to be invoked when this branch is selected
+    uel_closure_t closure;
+};
+
+/** \brief Defines how a switch looks up its branches
+  */
+enum uel_switch_mode {
+    //! Keys are few and close together. The table is indexed by key directly.
+    UEL_SWITCH_DENSE,
+    //! Keys are sparse. The table is indexed by a perfect hash of the key.
+    UEL_SWITCH_HASHED,
+    //! No table could be built. Cases are searched one by one.
+    UEL_SWITCH_LINEAR
+};
+//! Alias to the `uel_switch_mode` enum
+typedef enum uel_switch_mode uel_switch_mode_t;
+
+/** \brief Switches are constructs that provide multiway functional flow control.
+  *
+  * A switch is defined by a `selector` closure, a list of cases and a default
+  * branch. When applied to some input, the selector maps this input to an
+  * integer key and the case with this key is invoked with the same input. The
+  * default branch is invoked if no case matches.
+  *
+  * When initialised, the switch fills a table of case pointers so lookups take
+  * a single probe. If all keys fit in the table when offset by the lowest one,
+  * they index it directly. Otherwise, multiplicative hashes are tried until one
+  * maps every key to a distinct slot. Tables at least four times larger than
+  * the number of cases make such a hash easy to find.
+  */
+typedef struct uel_switch uel_switch_t;
+struct uel_switch {
+    //! A closure that maps its input to the key of the branch to be taken
+    uel_closure_t selector;
+    //! The closure invoked when no case matches the key
+    uel_closure_t default_branch;
+    //! The cases of this switch
+    uel_switch_case_t *cases;
+    //! The number of cases
+    size_t count;
+    //! The lookup table. Empty slots are `NULL`.
+    uel_switch_case_t **table;
+    //! The base-2 logarithm of the number of slots in the table
+    uint8_t table_size_log2n;
+    //! How the table is indexed
+    uel_switch_mode_t mode;
+    //! The lowest key, subtracted from keys to index dense tables
+    uintptr_t base;
+    //! The multiplier of the perfect hash used by hashed tables
+    uint32_t multiplier;
+};
+
+/** \brief Declares the table a switch needs.
+  *
+  * \param size_log2n The base-2 logarithm of the number of slots in the table
+  * \param id The identifier to base the table name on
+  */
+#define UEL_DECLARE_SWITCH_TABLE(size_log2n, id)                              \
+    uel_switch_case_t *id##_switch_table[1<<(size_log2n)]
+
+/** \brief Initialises a switch and builds its lookup table
+  *
+  * If neither a dense nor a hashed table can be built, the switch falls back
+  * to searching its cases linearly. Check `uel_switch_t::mode` to find out. If
+  * more than one case has the same key, the first one is taken.
+  *
+  * \param sw The switch to be initialised
+  * \param selector The closure that maps inputs to keys
+  * \param cases The cases of the switch. Must outlive the switch.
+  * \param count The number of cases
+  * \param default_branch The closure to be invoked when no case matches
+  * \param table The buffer where to build the lookup table, with
+  * `(1<<table_size_log2n)` slots
+  * \param table_size_log2n The base-2 logarithm of the number of slots in the
+  * table. Must be less than 32.
+  */
+void uel_switch_init(
+    uel_switch_t *sw,
+    uel_closure_t selector,
+    uel_switch_case_t *cases,
+    size_t count,
+    uel_closure_t default_branch,
+    uel_switch_case_t **table,
+    uint8_t table_size_log2n
+);
+
+/** \brief Finds the branch taken for some key
+  *
+  * \param sw The switch to be searched
+  * \param key The key to be looked up
+  * \returns The closure of the case with this key, or the default branch
+  */
+uel_closure_t *uel_switch_find(uel_switch_t *sw, uintptr_t key);
+
+/** \brief Applies a switch to some input
+  *
+  * The input is passed to the selector closure, whose output is cast to a key.
+  * The branch selected by this key is then invoked with the *same value* as
+  * parameters.
+  *
+  * \param sw The switch to be applied
+  * \param params The parameter that will be mapped to a key and provided to the
+  * chosen closure
+  * \returns Whatever the invoked closure returned
+  */
+void *uel_switch_apply(uel_switch_t *sw, void *params);
+
+#endif /* end of include guard: UEL_SWITCH_H */
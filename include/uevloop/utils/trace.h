@@ -0,0 +1,94 @@
+/** \file trace.h
+  *
+  * \brief Defines the tracer, an optional flight recorder that logs what the
+  * core is doing into a fixed-size binary ring
+  */
+
+#ifndef UEL_TRACE_H
+#define UEL_TRACE_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/utils/clock.h"
+#include "uevloop/utils/closure.h"
+
+//! Kinds of records logged by the tracer
+enum uel_trace_record_type {
+    //! An event is about to be processed by the event loop. The subject is the
+    //! closure function (or the signal, for signal events) and the detail is
+    //! the event type.
+    UEL_TRACE_DISPATCH_BEGIN,
+    //! An event has just been processed. Mirrors `UEL_TRACE_DISPATCH_BEGIN`.
+    UEL_TRACE_DISPATCH_END,
+    //! A timer expired at the scheduler. The subject is the closure function and
+    //! the detail is the nominal due time, before any deferral due to slack.
+    UEL_TRACE_TIMER_EXPIRED,
+    //! A signal was emitted. The subject is the signal and the detail is the relay.
+    UEL_TRACE_SIGNAL_EMITTED,
+    //! A promise was resolved. The subject is the promise and the detail is the value.
+    UEL_TRACE_PROMISE_RESOLVED,
+    //! A promise was rejected. The subject is the promise and the detail is the value.
+    UEL_TRACE_PROMISE_REJECTED
+};
+//! Alias to the uel_trace_record_type enum
+typedef enum uel_trace_record_type uel_trace_record_type_t;
+
+/** \brief A single trace record.
+  *
+  * The layout is free of padding, so records can be dumped as raw bytes and
+  * decoded by host tools such as `scripts/uel-trace.py`, provided they know the
+  * target's pointer size and endianness.
+  */
+typedef struct uel_trace_record uel_trace_record_t;
+struct uel_trace_record {
+    uel_timestamp_t timestamp; //!< The instrumentation clock reading
+    uint32_t type; //!< The kind of record, as defined by `uel_trace_record_type_t`
+    uintptr_t subject; //!< What this record refers to. Depends on `type`.
+    uintptr_t detail; //!< Additional information. Depends on `type`.
+};
+
+#ifdef UEL_ENABLE_TRACE
+//! Logs a record into the trace ring
+#define UEL_TRACE(type, subject, detail)                                    \
+    uel_trace_record((type), (uintptr_t)(subject), (uintptr_t)(detail))
+#else
+//! Compiles to nothing when `UEL_ENABLE_TRACE` is not defined
+#define UEL_TRACE(type, subject, detail) ((void)0)
+#endif /* UEL_ENABLE_TRACE */
+
+/** \brief Logs a record into the trace ring, overwriting the oldest record
+  * once the ring is full.
+  *
+  * This is lock-free and safe to call from ISRs and any thread. A record being
+  * written while the ring is dumped may show up torn. Prefer the `UEL_TRACE`
+  * macro, which vanishes when tracing is disabled.
+  *
+  * \param type The kind of record
+  * \param subject What the record refers to
+  * \param detail Additional information
+  */
+void uel_trace_record(uel_trace_record_type_t type, uintptr_t subject, uintptr_t detail);
+
+/** \brief Pauses or resumes tracing. Use this to freeze the ring as soon as
+  * an anomaly is detected. Tracing starts enabled.
+  *
+  * \param enabled Whether records should be logged
+  */
+void uel_trace_set_enabled(bool enabled);
+
+//! \brief Discards every record in the trace ring
+void uel_trace_reset();
+
+/** \brief Dumps the trace ring, from the oldest to the newest record
+  *
+  * \param writer A closure invoked with a pointer to each record in turn. It
+  * will usually write the record out through some host link.
+  * \returns The number of records dumped
+  */
+uintptr_t uel_trace_dump(uel_closure_t *writer);
+
+#endif /* end of include guard: UEL_TRACE_H */
@@ -0,0 +1,79 @@
+/** \file work-stealing-deque.h
+  *
+  * \brief Defines work-stealing deques, lock-free double-ended queues meant to
+  * distribute work between threads
+  */
+
+#ifndef UEL_WORK_STEALING_DEQUE_H
+#define UEL_WORK_STEALING_DEQUE_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+/** \brief Defines a bounded work-stealing deque of void pointers
+  *
+  * This is a fixed-capacity Chase-Lev deque. A single owner thread pushes and
+  * pops elements at the bottom end in LIFO order, while any other thread may
+  * concurrently steal elements from the top end in FIFO order. No operation
+  * ever blocks.
+  *
+  * Its capacity is **required** to be a power of two.
+  */
+typedef struct uel_wsdeque uel_wsdeque_t;
+struct uel_wsdeque {
+    //! The buffer that will contain the enqueued values.
+    void **buffer;
+    //! The mask used to wrap indices around the capacity of the deque.
+    intptr_t mask;
+    //! The index of the oldest element. Advanced by thieves.
+    volatile intptr_t top;
+    //! The index one past the newest element. Only modified by the owner.
+    volatile intptr_t bottom;
+};
+
+/** \brief Initialises a work-stealing deque
+  *
+  * \param deque The deque object to be initialised
+  * \param buffer An array of void pointers that will be used to store the
+  * enqueued values.
+  * \param size_log2n The size of the deque in its log2 form.
+  */
+void uel_wsdeque_init(uel_wsdeque_t *deque, void **buffer, uintptr_t size_log2n);
+
+/** \brief Pushes an element at the bottom of the deque. Must only be called
+  * by the deque owner.
+  *
+  * \param deque The deque into which to push the element
+  * \param element The element to be pushed
+  * \returns Whether the push operation was successful
+  */
+bool uel_wsdeque_push(uel_wsdeque_t *deque, void *element);
+
+/** \brief Pops the newest element from the bottom of the deque. Must only be
+  * called by the deque owner.
+  *
+  * \param deque The deque from where to pop
+  * \returns The newest element in the deque, if it exists. Otherwise, NULL.
+  */
+void *uel_wsdeque_pop(uel_wsdeque_t *deque);
+
+/** \brief Steals the oldest element from the top of the deque. May be called
+  * from any thread.
+  *
+  * \param deque The deque from where to steal
+  * \returns The oldest element in the deque. If the deque is empty or the
+  * element was taken by a concurrent operation, returns NULL.
+  */
+void *uel_wsdeque_steal(uel_wsdeque_t *deque);
+
+/** \brief Counts the number of elements in the deque. When other threads are
+  * operating on the deque, this is only an estimate.
+  *
+  * \param deque The deque whose elements should be counted
+  * \returns The number of enqueued elements
+  */
+uintptr_t uel_wsdeque_count(uel_wsdeque_t *deque);
+
+#endif /* end of include guard: UEL_WORK_STEALING_DEQUE_H */
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Generates the single-header build of µEvLoop.
+
+Every header reachable from the library sources is pasted once, dependencies
+first, followed by every source file. Headers are pasted unconditionally, even
+where they are included conditionally, as each one guards its own contents. Library functions are prefixed with
+`UEL_API` and library owned globals with `UEL_GLOBAL`, which the generated
+header defines as `static inline` and `static`. Each translation unit that
+includes it gets a private copy of the library the compiler can inline into
+its callers. File scope `static` helpers are renamed with a `uel__<file>_`
+prefix so they neither collide with each other nor with the user's code.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+INCLUDE = re.compile(r'^\s*#\s*include\s+"(uevloop/[^"]+)"')
+
+# A library function prototype or definition starting at column zero, e.g.
+# `uel_event_t *uel_sch_run_later(` or `void uel_cqueue_init(...){`
+FUNCTION = re.compile(
+    r'^(?!static\b|typedef\b|extern\b|struct\b|enum\b|union\b|return\b|UEL_)'
+    r'[A-Za-z_][\w \t\*]*?\buel_\w+\s*\('
+)
+
+# A file scope static function or variable, capturing its name
+STATIC = re.compile(r'^static\b[^=;(]*?\b([A-Za-z_]\w*)\s*[(\[=;]', re.M)
+
+PRELUDE = """\
+/* µEvLoop single-header build.
+ *
+ * Generated by scripts/amalgamate.py. Do not edit: changes belong in the
+ * library sources. Every function is `static inline`, so translation units
+ * including this header get private copies of the library and its globals.
+ * Configuration macros must be defined before this header is included.
+ */
+
+#ifndef UEL_AMALGAMATED_H
+#define UEL_AMALGAMATED_H
+
+//! Defined when building from the single-header distribution
+#define UEL_AMALGAMATED
+#define UEL_API static inline
+#define UEL_EXTERN static
+#if defined(__GNUC__) || defined(__clang__)
+#define UEL_GLOBAL static __attribute__((unused))
+#else
+#define UEL_GLOBAL static
+#endif
+"""
+
+EPILOGUE = """
+#endif /* end of include guard: UEL_AMALGAMATED_H */
+"""
+
+
+def privatise(text, stem):
+    """Prefixes file scope static names not already under the uel_ namespace."""
+    prefix = 'uel__{}_'.format(re.sub(r'\W', '_', stem))
+    for name in set(STATIC.findall(text)):
+        if name.startswith('uel_'):
+            continue
+        # Member accesses and designators (`->name`, `.name`) are left alone
+        text = re.sub(r'(?<![.>\w]){}\b'.format(name), prefix + name, text)
+    return text
+
+
+def includes(path):
+    with open(path, encoding='utf-8') as source:
+        return [m.group(1) for m in map(INCLUDE.match, source) if m]
+
+
+class Amalgamation:
+    def __init__(self, root):
+        self.root = root
+        self.pasted = set()
+        self.output = []
+
+    def paste(self, path, banner):
+        self.output.append('\n/* ---- {} ---- */\n'.format(banner))
+        with open(path, encoding='utf-8') as source:
+            text = source.read()
+        if path.endswith('.c'):
+            text = privatise(text, os.path.splitext(os.path.basename(path))[0])
+        for line in text.splitlines(keepends=True):
+            if INCLUDE.match(line):
+                continue
+            if FUNCTION.match(line):
+                line = 'UEL_API ' + line
+            self.output.append(line)
+
+    def paste_header(self, name):
+        if name in self.pasted:
+            return
+        self.pasted.add(name)
+        path = os.path.join(self.root, 'include', name)
+        for dependency in includes(path):
+            self.paste_header(dependency)
+        self.paste(path, name)
+
+    def paste_sources(self):
+        sources = []
+        for directory, _, files in os.walk(os.path.join(self.root, 'src')):
+            sources += [os.path.join(directory, f) for f in files if f.endswith('.c')]
+        sources.sort()
+        for path in sources:
+            for dependency in includes(path):
+                self.paste_header(dependency)
+        for path in sources:
+            self.paste(path, os.path.relpath(path, self.root))
+
+    def render(self):
+        return PRELUDE + ''.join(self.output) + EPILOGUE
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        'output', nargs='?', type=argparse.FileType('w'), default=sys.stdout,
+        help='where to write the header (default: stdout)'
+    )
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser.add_argument('--root', default=root, help='repository root')
+    args = parser.parse_args()
+
+    amalgamation = Amalgamation(args.root)
+    amalgamation.paste_header('uevloop/config.h')
+    amalgamation.paste_sources()
+    args.output.write(amalgamation.render())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Converts a raw µEvLoop trace dump into Chrome trace JSON.
+
+The input is the sequence of `uel_trace_record_t` structures written by
+`uel_trace_dump()`, as raw bytes. The output can be loaded in
+chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+DISPATCH_BEGIN, DISPATCH_END, TIMER_EXPIRED, SIGNAL_EMITTED, \
+    PROMISE_RESOLVED, PROMISE_REJECTED = range(6)
+
+EVENT_TYPES = ['closure', 'timer', 'signal', 'listener', 'observer']
+
+# Record type -> (name, subject argument, detail argument)
+INSTANTS = {
+    TIMER_EXPIRED: ('timer expired', 'closure', 'due_time'),
+    SIGNAL_EMITTED: ('signal emitted', 'signal', 'relay'),
+    PROMISE_RESOLVED: ('promise resolved', 'promise', 'value'),
+    PROMISE_REJECTED: ('promise rejected', 'promise', 'value'),
+}
+
+
+def load_symbols(path):
+    """Reads `nm` output into an address -> name map."""
+    symbols = {}
+    with open(path) as lines:
+        for line in lines:
+            fields = line.split()
+            if len(fields) == 3:
+                try:
+                    symbols[int(fields[0], 16)] = fields[2]
+                except ValueError:
+                    pass
+    return symbols
+
+
+def read_records(data, pointer_size, endianness):
+    layout = endianness + 'II' + ('Q' if pointer_size == 8 else 'I') * 2
+    size = struct.calcsize(layout)
+    for offset in range(0, len(data) - size + 1, size):
+        yield struct.unpack_from(layout, data, offset)
+
+
+def convert(records, symbols, ticks_per_us):
+    events = []
+    elapsed = 0
+    last = None
+    for timestamp, kind, subject, detail in records:
+        # Timestamps are free-running 32-bit counters: accumulate deltas
+        if last is not None:
+            elapsed += (timestamp - last) & 0xffffffff
+        last = timestamp
+        ts = elapsed / ticks_per_us
+
+        if kind in (DISPATCH_BEGIN, DISPATCH_END):
+            event_type = EVENT_TYPES[detail] if detail < len(EVENT_TYPES) else str(detail)
+            if event_type == 'signal':
+                name = 'signal %d' % subject
+            else:
+                name = symbols.get(subject, '0x%x' % subject)
+            events.append({
+                'name': name,
+                'cat': event_type,
+                'ph': 'B' if kind == DISPATCH_BEGIN else 'E',
+                'ts': ts, 'pid': 0, 'tid': 0,
+            })
+        elif kind in INSTANTS:
+            name, subject_name, detail_name = INSTANTS[kind]
+            if kind == TIMER_EXPIRED:
+                subject = symbols.get(subject, '0x%x' % subject)
+            events.append({
+                'name': name,
+                'ph': 'i', 's': 't',
+                'ts': ts, 'pid': 0, 'tid': 0,
+                'args': {
+                    subject_name: subject,
+                    detail_name: detail,
+                },
+            })
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('dump', help='raw trace dump file')
+    parser.add_argument('--pointer-size', type=int, choices=(4, 8), default=4,
+                        help='size of uintptr_t on the target (default: 4)')
+    parser.add_argument('--big-endian', action='store_true',
+                        help='the target is big-endian')
+    parser.add_argument('--ticks-per-us', type=float, default=1.0,
+                        help='instrumentation clock ticks per microsecond')
+    parser.add_argument('--symbols', help='output of `nm` for the firmware image')
+    parser.add_argument('-o', '--output', help='output file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.dump, 'rb') as dump:
+        data = dump.read()
+    symbols = load_symbols(args.symbols) if args.symbols else {}
+    records = read_records(data, args.pointer_size, '>' if args.big_endian else '<')
+    trace = convert(records, symbols, args.ticks_per_us)
+
+    output = open(args.output, 'w') if args.output else sys.stdout
+    json.dump(trace, output, indent=1)
+    output.write('\n')
+
+
+if __name__ == '__main__':
+    main()
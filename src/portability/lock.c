@@ -0,0 +1,104 @@
+/* <unistd.h> only declares syscall() when GNU extensions are enabled. This
+ * must come before any system header is included.
+ */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+#include "uevloop/portability/lock.h"
+
+#ifdef UEL_LOCK_HAS_FUTEX
+/// \cond
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+/// \endcond
+#endif /* UEL_LOCK_HAS_FUTEX */
+
+#include "uevloop/portability/atomic.h"
+#include "uevloop/portability/critical-section.h"
+
+#ifdef UEL_CRITICAL_SECTION_BUILTIN
+UEL_GLOBAL UEL_CRITICAL_SECTION_OBJ_TYPE uel_critical_section = UEL_LOCK_INITIALIZER;
+#endif /* UEL_CRITICAL_SECTION_BUILTIN */
+
+void uel_spinlock_init(uel_spinlock_t *lock){
+    UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+}
+
+bool uel_spinlock_try_acquire(uel_spinlock_t *lock){
+    int expected = 0;
+    return UEL_ATOMIC_CAS(lock, &expected, 1);
+}
+
+void uel_spinlock_acquire(uel_spinlock_t *lock){
+    while(!uel_spinlock_try_acquire(lock)){
+        // Waits on plain loads so the cache line is not bounced between cores
+        while(UEL_ATOMIC_LOAD(lock, UEL_ATOMIC_RELAXED) != 0) UEL_LOCK_RELAX();
+    }
+}
+
+void uel_spinlock_release(uel_spinlock_t *lock){
+    UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+}
+
+#ifdef UEL_LOCK_HAS_FUTEX
+static inline void futex_wait(uel_futex_t *lock, int value){
+    syscall(SYS_futex, lock, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static inline void futex_wake(uel_futex_t *lock){
+    syscall(SYS_futex, lock, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+void uel_futex_init(uel_futex_t *lock){
+    UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+}
+
+bool uel_futex_try_acquire(uel_futex_t *lock){
+    int expected = 0;
+    return UEL_ATOMIC_CAS(lock, &expected, 1);
+}
+
+void uel_futex_acquire(uel_futex_t *lock){
+    for(unsigned int i = 0; i < UEL_LOCK_FUTEX_SPIN_COUNT; i++){
+        if(UEL_ATOMIC_LOAD(lock, UEL_ATOMIC_RELAXED) == 0 &&
+            uel_futex_try_acquire(lock)
+        ) return;
+        UEL_LOCK_RELAX();
+    }
+
+    // From now on the lock is taken as contended, as other threads may sleep on it
+    for(;;){
+        int value = 0;
+        if(UEL_ATOMIC_CAS(lock, &value, 2)) return;
+        if(value == 1 && !UEL_ATOMIC_CAS(lock, &value, 2)) continue;
+        futex_wait(lock, 2);
+    }
+}
+
+void uel_futex_release(uel_futex_t *lock){
+    if(UEL_ATOMIC_FETCH_ADD(lock, -1, UEL_ATOMIC_RELEASE) != 1){
+        UEL_ATOMIC_STORE(lock, 0, UEL_ATOMIC_RELEASE);
+        futex_wake(lock);
+    }
+}
+#endif /* UEL_LOCK_HAS_FUTEX */
+
+#ifdef UEL_LOCK_HAS_PTHREAD
+void uel_mutex_init(uel_mutex_t *lock){
+    pthread_mutex_init(lock, NULL);
+}
+
+void uel_mutex_acquire(uel_mutex_t *lock){
+    pthread_mutex_lock(lock);
+}
+
+bool uel_mutex_try_acquire(uel_mutex_t *lock){
+    return pthread_mutex_trylock(lock) == 0;
+}
+
+void uel_mutex_release(uel_mutex_t *lock){
+    pthread_mutex_unlock(lock);
+}
+#endif /* UEL_LOCK_HAS_PTHREAD */
@@ -0,0 +1,103 @@
+#include "uevloop/system/async-pipeline.h"
+#include "uevloop/utils/profiler.h"
+
+// Marks awaiting stages. The context is the closure that returns the promise.
+static void *awaiting(void *context, void *params){
+    return uel_closure_invoke((uel_closure_t *)context, params);
+}
+
+static void *resume(void *context, void *params){
+    uel_async_pipeline_t *async_pipeline = (uel_async_pipeline_t *)context;
+    uel_evloop_enqueue_closure(
+        async_pipeline->event_loop,
+        &async_pipeline->step,
+        NULL
+    );
+    return NULL;
+}
+
+static inline void finish_stage(uel_async_pipeline_t *async_pipeline, void *value){
+    if(async_pipeline->durations != NULL){
+        async_pipeline->durations[async_pipeline->stage] =
+            uel_clock_now() - async_pipeline->started_at;
+    }
+    async_pipeline->value = value;
+    async_pipeline->stage++;
+}
+
+// Runs a single stage and enqueues itself to run the next one
+static void *step(void *context, void *params){
+    uel_async_pipeline_t *async_pipeline = (uel_async_pipeline_t *)context;
+
+    if(async_pipeline->awaited != NULL){
+        uel_promise_t *awaited = async_pipeline->awaited;
+        uel_promise_state_t state = awaited->state;
+        void *value = awaited->value;
+        async_pipeline->awaited = NULL;
+        uel_promise_destroy(awaited);
+
+        if(state == UEL_PROMISE_REJECTED){
+            uel_promise_reject(async_pipeline->promise, value);
+            return NULL;
+        }
+        finish_stage(async_pipeline, value);
+    }
+
+    if(async_pipeline->stage == async_pipeline->pipeline->count){
+        uel_promise_resolve(async_pipeline->promise, async_pipeline->value);
+        return NULL;
+    }
+
+    uel_closure_t *closure = &async_pipeline->pipeline->closures[async_pipeline->stage];
+    async_pipeline->started_at = uel_clock_now();
+    if(closure->function == awaiting){
+        async_pipeline->awaited = (uel_promise_t *)UEL_PROFILED_INVOKE(
+            (uel_closure_t *)closure->context,
+            async_pipeline->value
+        );
+        uel_promise_always(
+            async_pipeline->awaited,
+            uel_closure_create(resume, (void *)async_pipeline)
+        );
+        return NULL;
+    }
+
+    finish_stage(async_pipeline, UEL_PROFILED_INVOKE(closure, async_pipeline->value));
+    uel_evloop_enqueue_closure(async_pipeline->event_loop, &async_pipeline->step, NULL);
+    return NULL;
+}
+
+void uel_async_pipeline_init(
+    uel_async_pipeline_t *async_pipeline,
+    uel_pipeline_t *pipeline,
+    uel_evloop_t *event_loop,
+    uel_promise_store_t *store,
+    uel_timestamp_t *durations
+){
+    async_pipeline->pipeline = pipeline;
+    async_pipeline->event_loop = event_loop;
+    async_pipeline->store = store;
+    async_pipeline->durations = durations;
+    async_pipeline->step = uel_closure_create(step, (void *)async_pipeline);
+    async_pipeline->promise = NULL;
+    async_pipeline->awaited = NULL;
+    async_pipeline->stage = 0;
+    async_pipeline->value = NULL;
+    async_pipeline->started_at = 0;
+}
+
+uel_promise_t *uel_async_pipeline_apply(
+    uel_async_pipeline_t *async_pipeline,
+    void *params
+){
+    async_pipeline->promise = uel_promise_create(async_pipeline->store, uel_nop());
+    async_pipeline->awaited = NULL;
+    async_pipeline->stage = 0;
+    async_pipeline->value = params;
+    uel_evloop_enqueue_closure(async_pipeline->event_loop, &async_pipeline->step, NULL);
+    return async_pipeline->promise;
+}
+
+uel_closure_t uel_async_pipeline_awaiting(uel_closure_t *closure){
+    return uel_closure_create(awaiting, (void *)closure);
+}
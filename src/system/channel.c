@@ -0,0 +1,122 @@
+#include "uevloop/system/channel.h"
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/portability/atomic.h"
+
+static inline void enqueue_batch(uel_channel_t *channel, uel_event_t **batch, size_t count){
+    uel_sysqueues_enqueue_events(&channel->target->queues, batch, count);
+}
+
+static void *deliver_messages(void *context, void *params){
+    uel_channel_t *channel = (uel_channel_t *)context;
+    uel_event_t *batch[UEL_CHANNEL_BATCH_SIZE];
+    size_t count = 0;
+    uintptr_t head = UEL_ATOMIC_LOAD(&channel->head, UEL_ATOMIC_ACQUIRE);
+    uintptr_t tail = channel->tail;
+
+    while(tail != head && count < UEL_CHANNEL_BATCH_SIZE){
+        uel_channel_message_t *message = &channel->buffer[tail & channel->mask];
+        if(message->type == UEL_CHANNEL_SIGNAL_MESSAGE){
+            // Keeps ordering between closures and signals
+            enqueue_batch(channel, batch, count);
+            count = 0;
+            uel_signal_emit(
+                message->target.signal.signal,
+                message->target.signal.relay,
+                message->value
+            );
+        }else{
+            uel_event_t *event = uel_syspools_acquire_event(&channel->target->pools);
+            if(event == NULL) break;
+            uel_event_config_closure(event, &message->target.closure, message->value, false);
+            batch[count++] = event;
+        }
+        tail++;
+    }
+    UEL_ATOMIC_STORE(&channel->tail, tail, UEL_ATOMIC_RELEASE);
+    enqueue_batch(channel, batch, count);
+
+    // Pairs with the fence in send_message(): either the producer sees the
+    // channel drained and wakes the target or the target sees the messages
+    // sent meanwhile, which also move the observed head
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    if(tail != head){
+        // Not everything could be delivered; resume on the next runloop
+        channel->backlog++;
+    }
+    return NULL;
+}
+
+static bool send_message(uel_channel_t *channel, uel_channel_message_t *message){
+    uintptr_t head = channel->head;
+    uintptr_t tail = UEL_ATOMIC_LOAD(&channel->tail, UEL_ATOMIC_ACQUIRE);
+    if(head - tail > channel->mask) return false;
+
+    channel->buffer[head & channel->mask] = *message;
+    UEL_ATOMIC_STORE(&channel->head, head + 1, UEL_ATOMIC_RELEASE);
+    // The consumer may have drained the channel since tail was loaded
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    tail = UEL_ATOMIC_LOAD(&channel->tail, UEL_ATOMIC_ACQUIRE);
+    if(head == tail){
+        uel_closure_invoke(&channel->wakeup, (void *)channel);
+    }
+    return true;
+}
+
+void uel_channel_init(
+    uel_channel_t *channel,
+    uel_channel_message_t *buffer,
+    uintptr_t size_log2n,
+    uel_application_t *target,
+    uel_closure_t wakeup
+){
+    channel->buffer = buffer;
+    channel->mask = ((uintptr_t)1 << size_log2n) - 1;
+    channel->head = 0;
+    channel->tail = 0;
+    channel->backlog = 0;
+    channel->target = target;
+    channel->wakeup = wakeup;
+
+    uel_closure_t deliver = uel_closure_create(deliver_messages, (void *)channel);
+    // Observers run in registration order, so a backlog left by a delivery is
+    // only seen on the next runloop
+    channel->backlog_observer = uel_app_observe(target, &channel->backlog, &deliver);
+    channel->observer = uel_app_observe(target, &channel->head, &deliver);
+}
+
+void uel_channel_close(uel_channel_t *channel){
+    uel_event_observer_cancel(channel->observer);
+    uel_event_observer_cancel(channel->backlog_observer);
+}
+
+bool uel_channel_send(uel_channel_t *channel, uel_closure_t *closure, void *value){
+    uel_channel_message_t message;
+    message.type = UEL_CHANNEL_CLOSURE_MESSAGE;
+    message.target.closure = *closure;
+    message.value = value;
+    return send_message(channel, &message);
+}
+
+bool uel_channel_emit(
+    uel_channel_t *channel,
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    void *params
+){
+    uel_channel_message_t message;
+    message.type = UEL_CHANNEL_SIGNAL_MESSAGE;
+    message.target.signal.signal = signal;
+    message.target.signal.relay = relay;
+    message.value = params;
+    return send_message(channel, &message);
+}
+
+uintptr_t uel_channel_count(uel_channel_t *channel){
+    uintptr_t tail = UEL_ATOMIC_LOAD(&channel->tail, UEL_ATOMIC_ACQUIRE);
+    uintptr_t head = UEL_ATOMIC_LOAD(&channel->head, UEL_ATOMIC_ACQUIRE);
+    return head - tail;
+}
@@ -1,5 +1,46 @@
 #include "uevloop/system/containers/application.h"
 
+// Marks a module and its dependencies, recursively, as due to launch
+static void request_launch(uel_application_t *app, size_t id){
+    uel_module_t *module = app->registry[id];
+    if(module->state != UEL_MODULE_IDLE) return;
+
+    module->state = UEL_MODULE_WAITING;
+    for(size_t i = 0; i < module->dependency_count; i++){
+        request_launch(app, module->dependencies[i]);
+    }
+}
+
+static bool dependencies_launched(uel_application_t *app, uel_module_t *module){
+    for(size_t i = 0; i < module->dependency_count; i++){
+        if(app->registry[module->dependencies[i]]->state != UEL_MODULE_LAUNCHED){
+            return false;
+        }
+    }
+    return true;
+}
+
+// Launches waiting modules whose dependencies are launched until no other
+// module can be. Launch hooks may reenter through `uel_app_require()`.
+static void launch_ready_modules(uel_application_t *app){
+    bool launched;
+    do {
+        launched = false;
+        for(size_t i = 0; i < app->registry_size; i++){
+            uel_module_t *module = app->registry[i];
+            if(module->state != UEL_MODULE_WAITING) continue;
+            if(!dependencies_launched(app, module)) continue;
+
+            module->state = UEL_MODULE_LAUNCHING;
+            uel_module_launch(module);
+            if(!module->asynchronous){
+                module->state = UEL_MODULE_LAUNCHED;
+                launched = true;
+            }
+        }
+    } while(launched);
+}
+
 void uel_app_init(uel_application_t *app){
     uel_syspools_init(&app->pools);
     uel_sysqueues_init(&app->queues);
@@ -23,24 +64,45 @@ void uel_app_init(uel_application_t *app){
     app->run_scheduler = true;
     app->registry = NULL;
     app->registry_size = 0;
+    app->loaded = false;
+#if UEL_APP_SCRATCH_SIZE > 0
+    uel_arena_init(&app->scratch, app->scratch_buffer, UEL_APP_SCRATCH_SIZE);
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
 }
 
 void uel_app_load(uel_application_t *app, uel_module_t **modules, size_t module_count){
+    app->registry_size = module_count;
+    app->registry = modules;
+    app->loaded = false;
     for (size_t i = 0; i < module_count; i++) {
         uel_module_config(modules[i]);
     }
+    app->loaded = true;
     for (size_t i = 0; i < module_count; i++) {
-        uel_module_launch(modules[i]);
+        if(!modules[i]->lazy) request_launch(app, i);
     }
-    app->registry_size = module_count;
-    app->registry = modules;
+    launch_ready_modules(app);
 }
 
 uel_module_t *uel_app_require(uel_application_t *app, size_t id){
-    return app->registry[id];
+    uel_module_t *module = app->registry[id];
+    if(app->loaded && module->state == UEL_MODULE_IDLE){
+        uel_app_launch(app, id);
+    }
+    return module;
 }
 
-void uel_app_update_timer(uel_application_t *app, uint32_t timer){
+void uel_app_launch(uel_application_t *app, size_t id){
+    request_launch(app, id);
+    launch_ready_modules(app);
+}
+
+void uel_app_complete_launch(uel_application_t *app, uel_module_t *module){
+    module->state = UEL_MODULE_LAUNCHED;
+    launch_ready_modules(app);
+}
+
+void uel_app_update_timer(uel_application_t *app, uel_time_t timer){
     uel_sch_update_timer(&app->scheduler, timer);
     app->run_scheduler = true;
 }
@@ -51,27 +113,36 @@ void uel_app_tick(uel_application_t *app){
         uel_sch_manage_timers(&app->scheduler);
     }
     uel_evloop_run(&app->event_loop);
+#if UEL_APP_SCRATCH_SIZE > 0
+    uel_arena_reset(&app->scratch);
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+}
+
+#if UEL_APP_SCRATCH_SIZE > 0
+void *uel_app_scratch_alloc(uel_application_t *app, size_t size, size_t align){
+    return uel_arena_alloc(&app->scratch, size, align);
 }
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
 
 uel_event_t *uel_app_run_later(
     uel_application_t *app,
-    uint16_t timeout_in_ms,
+    uel_timeout_t timeout,
     uel_closure_t closure,
     void *value
 ){
     app->run_scheduler = true;
-    return uel_sch_run_later(&app->scheduler, timeout_in_ms, closure, value);
+    return uel_sch_run_later(&app->scheduler, timeout, closure, value);
 }
 
 uel_event_t *uel_app_run_at_intervals(
   uel_application_t *app,
-  uint16_t interval_in_ms,
+  uel_timeout_t interval,
   bool immediate,
   uel_closure_t closure,
   void *value
 ){
     app->run_scheduler = true;
-    return uel_sch_run_at_intervals(&app->scheduler, interval_in_ms, immediate, closure, value);
+    return uel_sch_run_at_intervals(&app->scheduler, interval, immediate, closure, value);
 }
 
 void uel_app_enqueue_closure(
@@ -89,3 +160,10 @@ uel_event_t *uel_app_observe(
 ){
     return uel_evloop_observe(&app->event_loop, condition_var, closure);
 }
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+void uel_app_set_latency(uel_application_t *app, uel_latency_t *latency){
+    uel_evloop_set_latency(&app->event_loop, latency);
+    uel_sch_set_latency(&app->scheduler, latency);
+}
+#endif /* UEL_ENABLE_LATENCY_STATS */
@@ -17,29 +17,29 @@ void uel_syspools_init(uel_syspools_t *pools){
 }
 
 uel_event_t *uel_syspools_acquire_event(uel_syspools_t *pools){
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&pools->event_pool.lock);
     uel_event_t *event = (uel_event_t *)uel_objpool_acquire(&pools->event_pool);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&pools->event_pool.lock);
     return event;
 }
 
 uel_llist_node_t *uel_syspools_acquire_llist_node(uel_syspools_t *pools){
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&pools->llist_node_pool.lock);
     uel_llist_node_t *node = (uel_llist_node_t *)uel_objpool_acquire(&pools->llist_node_pool);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&pools->llist_node_pool.lock);
     return node;
 }
 
 bool uel_syspools_release_event(uel_syspools_t *pools, uel_event_t *event){
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&pools->event_pool.lock);
     bool released = uel_objpool_release(&pools->event_pool, (void *)event);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&pools->event_pool.lock);
     return released;
 }
 
 bool uel_syspools_release_llist_node(uel_syspools_t *pools, uel_llist_node_t *node){
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&pools->llist_node_pool.lock);
     bool released = uel_objpool_release(&pools->llist_node_pool, (void *)node);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&pools->llist_node_pool.lock);
     return released;
 }
@@ -12,48 +12,103 @@ void uel_sysqueues_init(uel_sysqueues_t *queues){
         queues->schedule_queue_buffer,
         UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N
     );
+    uel_lock_init(&queues->event_queue_lock);
+    uel_lock_init(&queues->schedule_queue_lock);
 }
 
 void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event){
-    UEL_CRITICAL_ENTER;
+#ifdef UEL_ENABLE_LATENCY_STATS
+    event->enqueued_at = uel_clock_now();
+#endif /* UEL_ENABLE_LATENCY_STATS */
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
     uel_cqueue_push(&queues->event_queue, (void *)event);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+}
+
+uintptr_t uel_sysqueues_enqueue_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+){
+#ifdef UEL_ENABLE_LATENCY_STATS
+    uel_timestamp_t now = uel_clock_now();
+    for(uintptr_t i = 0; i < count; i++) events[i]->enqueued_at = now;
+#endif /* UEL_ENABLE_LATENCY_STATS */
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
+    count = uel_cqueue_push_many(&queues->event_queue, (void **)events, count);
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+    return count;
 }
 
 uel_event_t *uel_sysqueues_get_enqueued_event(uel_sysqueues_t *queues){
     uel_event_t *event;
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
     event = (uel_event_t *)uel_cqueue_pop(&queues->event_queue);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
     return event;
 }
 
+uintptr_t uel_sysqueues_get_enqueued_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+){
+    uintptr_t count;
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
+    count = uel_cqueue_pop_many(&queues->event_queue, (void **)events, max);
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
+    return count;
+}
+
 uintptr_t uel_sysqueues_count_enqueued_events(uel_sysqueues_t *queues){
     uintptr_t count;
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&queues->event_queue_lock);
     count = uel_cqueue_count(&queues->event_queue);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&queues->event_queue_lock);
     return count;
 }
 
 void uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event){
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
     uel_cqueue_push(&queues->schedule_queue, (void *)event);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+}
+
+uintptr_t uel_sysqueues_schedule_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t count
+){
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
+    count = uel_cqueue_push_many(&queues->schedule_queue, (void **)events, count);
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+    return count;
 }
 
 uel_event_t *uel_sysqueues_get_scheduled_event(uel_sysqueues_t *queues){
     uel_event_t *event;
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
     event = (uel_event_t *)uel_cqueue_pop(&queues->schedule_queue);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
     return event;
 }
 
+uintptr_t uel_sysqueues_get_scheduled_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+){
+    uintptr_t count;
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
+    count = uel_cqueue_pop_many(&queues->schedule_queue, (void **)events, max);
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
+    return count;
+}
+
 uintptr_t uel_sysqueues_count_scheduled_events(uel_sysqueues_t *queues){
     uintptr_t count;
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&queues->schedule_queue_lock);
     count = uel_cqueue_count(&queues->schedule_queue);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&queues->schedule_queue_lock);
     return count;
 }
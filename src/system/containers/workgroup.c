@@ -0,0 +1,118 @@
+#include "uevloop/system/containers/workgroup.h"
+#include "uevloop/portability/critical-section.h"
+
+static inline void run_task(uel_event_t *task){
+    uel_closure_invoke(&task->closure, task->value);
+}
+
+static bool run_injected_task(uel_workgroup_t *group){
+    UEL_CRITICAL_ENTER_ON(&group->inject_queue_lock);
+    uel_event_t *task = (uel_event_t *)uel_cqueue_pop(&group->inject_queue);
+    UEL_CRITICAL_EXIT_ON(&group->inject_queue_lock);
+    if(task == NULL) return false;
+
+    run_task(task);
+    UEL_CRITICAL_ENTER_ON(&group->task_pool.lock);
+    uel_objpool_release(&group->task_pool, (void *)task);
+    UEL_CRITICAL_EXIT_ON(&group->task_pool.lock);
+    return true;
+}
+
+static bool run_stolen_task(uel_workgroup_t *group, size_t worker_id){
+    for(size_t i = 1; i < group->count; i++){
+        uel_worker_t *victim = &group->workers[(worker_id + i) % group->count];
+        uel_event_t *task = (uel_event_t *)uel_wsdeque_steal(&victim->deque);
+        if(task != NULL){
+            run_task(task);
+            uel_syspools_release_event(&victim->app.pools, task);
+            return true;
+        }
+    }
+    return false;
+}
+
+void uel_workgroup_init(uel_workgroup_t *group, uel_worker_t *workers, size_t count){
+    group->workers = workers;
+    group->count = count;
+    uel_objpool_init(
+        &group->task_pool,
+        UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N,
+        sizeof(uel_event_t),
+        UEL_OBJPOOL_BUFFERS_AT(task, group)
+    );
+    uel_cqueue_init(
+        &group->inject_queue,
+        group->inject_queue_buffer,
+        UEL_WORKGROUP_INJECT_QUEUE_SIZE_LOG2N
+    );
+    uel_lock_init(&group->inject_queue_lock);
+    for(size_t i = 0; i < count; i++){
+        uel_app_init(&workers[i].app);
+        uel_wsdeque_init(
+            &workers[i].deque,
+            workers[i].deque_buffer,
+            UEL_WORKGROUP_DEQUE_SIZE_LOG2N
+        );
+    }
+}
+
+uel_application_t *uel_workgroup_app(uel_workgroup_t *group, size_t worker_id){
+    return &group->workers[worker_id].app;
+}
+
+bool uel_workgroup_enqueue_closure(
+    uel_workgroup_t *group,
+    uel_closure_t *closure,
+    void *value,
+    size_t affinity
+){
+    if(affinity != UEL_WORKGROUP_ANY){
+        uel_app_enqueue_closure(&group->workers[affinity].app, closure, value);
+        return true;
+    }
+
+    UEL_CRITICAL_ENTER_ON(&group->task_pool.lock);
+    uel_event_t *task = (uel_event_t *)uel_objpool_acquire(&group->task_pool);
+    UEL_CRITICAL_EXIT_ON(&group->task_pool.lock);
+    if(task == NULL) return false;
+
+    uel_event_config_closure(task, closure, value, false);
+    UEL_CRITICAL_ENTER_ON(&group->inject_queue_lock);
+    uel_cqueue_push(&group->inject_queue, (void *)task);
+    UEL_CRITICAL_EXIT_ON(&group->inject_queue_lock);
+    return true;
+}
+
+void uel_workgroup_spawn(
+    uel_workgroup_t *group,
+    size_t worker_id,
+    uel_closure_t *closure,
+    void *value
+){
+    uel_worker_t *worker = &group->workers[worker_id];
+    uel_event_t *task = uel_syspools_acquire_event(&worker->app.pools);
+    uel_event_config_closure(task, closure, value, false);
+    if(!uel_wsdeque_push(&worker->deque, (void *)task)){
+        uel_sysqueues_enqueue_event(&worker->app.queues, task);
+    }
+}
+
+bool uel_workgroup_tick(uel_workgroup_t *group, size_t worker_id){
+    uel_worker_t *worker = &group->workers[worker_id];
+    bool ran = false;
+
+    uel_app_tick(&worker->app);
+
+    // Closures spawned meanwhile wait for the next tick, so self-respawning
+    // closures cannot starve the application or the injection queue
+    uintptr_t count = uel_wsdeque_count(&worker->deque);
+    uel_event_t *task;
+    while(count-- > 0 && (task = (uel_event_t *)uel_wsdeque_pop(&worker->deque)) != NULL){
+        run_task(task);
+        uel_syspools_release_event(&worker->app.pools, task);
+        ran = true;
+    }
+    if(ran) return true;
+
+    return run_injected_task(group) || run_stolen_task(group, worker_id);
+}
@@ -7,26 +7,43 @@
 
 #include "uevloop/config.h"
 #include "uevloop/utils/iterator.h"
+#include "uevloop/utils/trace.h"
+#include "uevloop/utils/profiler.h"
 #include "uevloop/portability/critical-section.h"
+#include "uevloop/portability/atomic.h"
+
+#ifdef UEL_ENABLE_TRACE
+static inline uintptr_t trace_subject(uel_event_t *event){
+    if(event->type == UEL_SIGNAL_EVENT) return event->detail.signal.value;
+    return (uintptr_t)event->closure.function;
+}
+#endif /* UEL_ENABLE_TRACE */
 
 static inline bool run_closure_event(uel_evloop_t *event_loop, uel_event_t *event){
-    uel_closure_invoke(&event->closure, event->value);
+    UEL_PROFILED_INVOKE(&event->closure, event->value);
     return event->repeating;
 }
 
-static inline bool run_timer_event(uel_evloop_t *event_loop, uel_event_t *event){
+// Timers to be sent back to the scheduler are collected in `reschedule` so they
+// can be scheduled in bulk
+static inline bool run_timer_event(
+    uel_evloop_t *event_loop,
+    uel_event_t *event,
+    uel_event_t **reschedule,
+    uintptr_t *reschedule_count
+){
     switch (event->detail.timer.status) {
         case UEL_TIMER_CANCELLED:
             return false;
         case UEL_TIMER_PAUSED:
-            uel_sysqueues_schedule_event(event_loop->queues, event);
+            reschedule[(*reschedule_count)++] = event;
             return true;
         default: break;
     }
-    uel_closure_invoke(&event->closure, event->value);
+    UEL_PROFILED_INVOKE(&event->closure, event->value);
     if (event->repeating) {
         event->detail.timer.due_time += event->detail.timer.timeout;
-        uel_sysqueues_schedule_event(event_loop->queues, event);
+        reschedule[(*reschedule_count)++] = event;
         return true;
     }
     return false;
@@ -38,7 +55,7 @@ static inline void run_signal_event(uel_evloop_t *event_loop, uel_event_t *signa
     uel_llist_t *listeners = signal->detail.signal.listeners;
     unsigned int i = 0, j =  0;
 
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(signal->detail.signal.lock);
     for(uel_llist_node_t *current = listeners->tail;
         current != NULL && i < UEL_SIGNAL_MAX_LISTENERS;
         current = current->next
@@ -52,11 +69,11 @@ static inline void run_signal_event(uel_evloop_t *event_loop, uel_event_t *signa
             closures[i++] = listener->closure;
         }
     }
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(signal->detail.signal.lock);
 
     for(unsigned int uel_closure_count = i, i = 0; i < uel_closure_count; i++){
         uel_closure_t *closure = &closures[i];
-        uel_closure_invoke(closure, signal->value);
+        UEL_PROFILED_INVOKE(closure, signal->value);
     }
     for(unsigned int node_count = j, j = 0; j < node_count; j++){
         uel_event_t *event = removed_nodes[j]->value;
@@ -72,20 +89,19 @@ static void *run_observer_event(void *context, void *params){
     struct uel_event_observer *observer = &event->detail.observer;
 
     if(!observer->cancelled){
-        uintptr_t value;
-        // Ensures lock-free synchronisation
-        do{
-            value = *observer->condition_var;
-        } while(value != *observer->condition_var);
+        // Observed values may be written from other threads
+        uintptr_t value = UEL_ATOMIC_LOAD(observer->condition_var, UEL_ATOMIC_ACQUIRE);
 
         if(value != observer->last_value){
-            uel_closure_invoke(&event->closure, (void *)value);
+            UEL_PROFILED_INVOKE(&event->closure, (void *)value);
             observer->last_value = value;
         }
     }
 
     if (observer->cancelled || !event->repeating) {
+        UEL_CRITICAL_ENTER_ON(&event_loop->observers_lock);
         uel_llist_remove(&event_loop->observers, node);
+        UEL_CRITICAL_EXIT_ON(&event_loop->observers_lock);
         uel_syspools_release_event(event_loop->pools, event);
         uel_syspools_release_llist_node(event_loop->pools, node);
     }
@@ -96,9 +112,9 @@ static void *run_observer_event(void *context, void *params){
 static void register_observer(uel_evloop_t *event_loop, uel_event_t *observer){
     uel_llist_node_t *node = uel_syspools_acquire_llist_node(event_loop->pools);
     node->value = (void *)observer;
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&event_loop->observers_lock);
     uel_llist_push_head(&event_loop->observers, node);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&event_loop->observers_lock);
 }
 
 void uel_evloop_init(
@@ -109,24 +125,52 @@ void uel_evloop_init(
     event_loop->pools = pools;
     event_loop->queues = queues;
     uel_llist_init(&event_loop->observers);
+    uel_lock_init(&event_loop->observers_lock);
+    event_loop->dispatched = 0;
+#ifdef UEL_ENABLE_LATENCY_STATS
+    event_loop->latency = NULL;
+#endif /* UEL_ENABLE_LATENCY_STATS */
 }
 
 void uel_evloop_run(uel_evloop_t *event_loop){
-    uel_event_t *event;
-    while((event = uel_sysqueues_get_enqueued_event(event_loop->queues)) != NULL){
-        switch(event->type){
-            case UEL_CLOSURE_EVENT:
-                if(run_closure_event(event_loop, event)) continue;
-                break;
-            case UEL_TIMER_EVENT:
-                if(run_timer_event(event_loop, event)) continue;
-                break;
-            case UEL_SIGNAL_EVENT:
-                run_signal_event(event_loop, event);
-                break;
-            default: continue;
+    uel_event_t *batch[UEL_SYSQUEUES_BATCH_SIZE];
+    uel_event_t *reschedule[UEL_SYSQUEUES_BATCH_SIZE];
+    uintptr_t count;
+    while((count = uel_sysqueues_get_enqueued_events(
+        event_loop->queues,
+        batch,
+        UEL_SYSQUEUES_BATCH_SIZE
+    )) > 0){
+        uintptr_t reschedule_count = 0;
+        event_loop->dispatched += count;
+        for(uintptr_t i = 0; i < count; i++){
+            uel_event_t *event = batch[i];
+#ifdef UEL_ENABLE_LATENCY_STATS
+            if(event_loop->latency != NULL){
+                uel_latency_record_queueing(event_loop->latency, event);
+            }
+#endif /* UEL_ENABLE_LATENCY_STATS */
+            UEL_TRACE(UEL_TRACE_DISPATCH_BEGIN, trace_subject(event), event->type);
+            bool keep = true;
+            switch(event->type){
+                case UEL_CLOSURE_EVENT:
+                    keep = run_closure_event(event_loop, event);
+                    break;
+                case UEL_TIMER_EVENT:
+                    keep = run_timer_event(event_loop, event, reschedule, &reschedule_count);
+                    break;
+                case UEL_SIGNAL_EVENT:
+                    run_signal_event(event_loop, event);
+                    keep = false;
+                    break;
+                default: break;
+            }
+            UEL_TRACE(UEL_TRACE_DISPATCH_END, trace_subject(event), event->type);
+            if(!keep){
+                uel_syspools_release_event(event_loop->pools, event);
+            }
         }
-        uel_syspools_release_event(event_loop->pools, event);
+        uel_sysqueues_schedule_events(event_loop->queues, reschedule, reschedule_count);
     }
 
     uel_closure_t observe =
@@ -170,3 +214,9 @@ uel_event_t *uel_evloop_observe_once(
 
     return observer;
 }
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+void uel_evloop_set_latency(uel_evloop_t *event_loop, uel_latency_t *latency){
+    event_loop->latency = latency;
+}
+#endif /* UEL_ENABLE_LATENCY_STATS */
@@ -20,12 +20,14 @@ void uel_event_config_signal(
     uel_event_t *event,
     uintptr_t signal,
     uel_llist_t *listeners,
+    uel_lock_t *lock,
     void *params
 ){
     event->closure = uel_closure_create(NULL, NULL);
     event->type = UEL_SIGNAL_EVENT;
     event->detail.signal.value = signal;
     event->detail.signal.listeners = listeners;
+    event->detail.signal.lock = lock;
     event->value = params;
 }
 
@@ -56,12 +58,12 @@ void uel_event_observer_cancel(uel_event_t *event){
 
 void uel_event_config_timer(
     uel_event_t *event,
-    uint16_t timeout_in_ms,
+    uel_timeout_t timeout,
     bool repeating,
     bool immediate,
     uel_closure_t *closure,
     void *value,
-    uint32_t current_time
+    uel_time_t current_time
 ) {
     event->type = UEL_TIMER_EVENT;
     event->closure = *closure;
@@ -69,11 +71,27 @@ void uel_event_config_timer(
     event->repeating = repeating;
     event->detail.timer.due_time = immediate ?
         current_time :
-        current_time + timeout_in_ms;
-    event->detail.timer.timeout = timeout_in_ms;
+        current_time + timeout;
+    event->detail.timer.expires_at = event->detail.timer.due_time;
+    event->detail.timer.timeout = timeout;
+    event->detail.timer.slack = 0;
+    event->detail.timer.overrun = UEL_TIMER_CATCH_UP;
+    event->detail.timer.missed = 0;
     event->detail.timer.status = UEL_TIMER_RUNNING;
 }
 
+void uel_event_timer_set_slack(uel_event_t *event, uel_timeout_t slack){
+    event->detail.timer.slack = slack;
+}
+
+void uel_event_timer_set_overrun(uel_event_t *event, uel_event_timer_overrun_t overrun){
+    event->detail.timer.overrun = overrun;
+}
+
+uint16_t uel_event_timer_get_missed(uel_event_t *event){
+    return event->detail.timer.missed;
+}
+
 void uel_event_timer_pause(uel_event_t *event){
     event->detail.timer.status = UEL_TIMER_PAUSED;
 }
@@ -0,0 +1,31 @@
+#include "uevloop/system/latency.h"
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+
+#include "uevloop/utils/clock.h"
+
+void uel_latency_init(uel_latency_t *latency){
+    for(size_t i = 0; i < UEL_EVENT_TYPE_COUNT; i++){
+        uel_histogram_init(&latency->queueing_delay[i]);
+    }
+    uel_histogram_init(&latency->timer_lateness);
+}
+
+void uel_latency_record_queueing(uel_latency_t *latency, uel_event_t *event){
+    uel_timestamp_t delay = uel_clock_now() - event->enqueued_at;
+    uel_histogram_record(&latency->queueing_delay[event->type], delay);
+}
+
+void uel_latency_record_lateness(
+    uel_latency_t *latency,
+    uel_event_t *timer,
+    uel_time_t current_time
+){
+    uel_time_t lateness = current_time - timer->detail.timer.expires_at;
+    uel_histogram_record(
+        &latency->timer_lateness,
+        lateness > UINT32_MAX ? UINT32_MAX : (uint32_t)lateness
+    );
+}
+
+#endif /* UEL_ENABLE_LATENCY_STATS */
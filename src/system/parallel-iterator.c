@@ -0,0 +1,167 @@
+#include "uevloop/system/parallel-iterator.h"
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+#include "uevloop/portability/atomic.h"
+#include "uevloop/portability/lock.h"
+
+static void find_in_chunk(uel_iterator_par_t *par, size_t start, size_t end){
+    for(size_t i = start; i < end; i++){
+        if(i >= UEL_ATOMIC_LOAD(&par->found, UEL_ATOMIC_RELAXED)) return;
+        if(uel_closure_invoke(&par->closure, par->collection + i * par->item_size)){
+            uintptr_t found = UEL_ATOMIC_LOAD(&par->found, UEL_ATOMIC_RELAXED);
+            while(i < found && !UEL_ATOMIC_CAS(&par->found, &found, i));
+            return;
+        }
+    }
+}
+
+static void run_chunk(uel_iterator_par_t *par, size_t chunk){
+    size_t start = chunk * par->chunk_size;
+    size_t end = start + par->chunk_size;
+    if(end > par->item_count) end = par->item_count;
+
+    switch(par->operation){
+        case UEL_ITERATOR_PAR_MAP:
+            for(size_t i = start; i < end; i++){
+                par->destination[i] = uel_closure_invoke(
+                    &par->closure,
+                    par->collection + i * par->item_size
+                );
+            }
+            break;
+
+        case UEL_ITERATOR_PAR_COUNT: {
+            uintptr_t passed = 0;
+            for(size_t i = start; i < end; i++){
+                if(uel_closure_invoke(&par->closure, par->collection + i * par->item_size)){
+                    passed++;
+                }
+            }
+            UEL_ATOMIC_FETCH_ADD(&par->passed, passed, UEL_ATOMIC_RELAXED);
+            break;
+        }
+
+        case UEL_ITERATOR_PAR_FIND:
+            find_in_chunk(par, start, end);
+            break;
+    }
+}
+
+// Claims and runs chunks until there are none left. Chunk numbers keep growing
+// across operations, so helpers left over from a finished operation can never
+// claim a chunk before the next operation is fully set up.
+static void run_chunks(uel_iterator_par_t *par){
+    while(1){
+        uintptr_t end = UEL_ATOMIC_LOAD(&par->end_chunk, UEL_ATOMIC_ACQUIRE);
+        uintptr_t chunk = UEL_ATOMIC_LOAD(&par->next_chunk, UEL_ATOMIC_ACQUIRE);
+        if(chunk >= end) return;
+        if(!UEL_ATOMIC_CAS(&par->next_chunk, &chunk, chunk + 1)) continue;
+
+        run_chunk(par, chunk - par->first_chunk);
+        UEL_ATOMIC_FETCH_ADD(&par->pending, (uintptr_t)-1, UEL_ATOMIC_RELEASE);
+    }
+}
+
+static void *help(void *context, void *params){
+    run_chunks((uel_iterator_par_t *)context);
+    return NULL;
+}
+
+static void run_operation(
+    uel_iterator_par_t *par,
+    uel_iterator_par_operation_t operation,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure,
+    size_t count
+){
+    // Nothing can be claimed until `end_chunk` is moved forward
+    par->operation = operation;
+    par->collection = (char *)iterator->base.collection;
+    par->item_count = count;
+    par->item_size = iterator->item_size;
+    par->closure = *closure;
+    par->passed = 0;
+    par->found = UINTPTR_MAX;
+
+    uintptr_t chunk_count = (count + par->chunk_size - 1) / par->chunk_size;
+    par->pending = chunk_count;
+    par->first_chunk = UEL_ATOMIC_LOAD(&par->next_chunk, UEL_ATOMIC_ACQUIRE);
+    UEL_ATOMIC_STORE(&par->end_chunk, par->first_chunk + chunk_count, UEL_ATOMIC_RELEASE);
+
+    size_t helpers = chunk_count - 1;
+    if(helpers > par->group->count) helpers = par->group->count;
+    for(size_t i = 0; i < helpers; i++){
+        if(!uel_workgroup_enqueue_closure(par->group, &par->helper, NULL, UEL_WORKGROUP_ANY)){
+            break;
+        }
+    }
+
+    run_chunks(par);
+    while(UEL_ATOMIC_LOAD(&par->pending, UEL_ATOMIC_ACQUIRE) != 0){
+        UEL_LOCK_RELAX();
+    }
+}
+
+void uel_iterator_par_init(
+    uel_iterator_par_t *par,
+    uel_workgroup_t *group,
+    size_t chunk_size
+){
+    par->group = group;
+    par->chunk_size = chunk_size != 0 ? chunk_size : UEL_ITERATOR_PAR_CHUNK_SIZE;
+    par->helper = uel_closure_create(help, (void *)par);
+    par->next_chunk = 0;
+    par->first_chunk = 0;
+    par->end_chunk = 0;
+    par->pending = 0;
+}
+
+size_t uel_iterator_par_map(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure,
+    void **destination,
+    size_t limit
+){
+    size_t count = iterator->item_count < limit ? iterator->item_count : limit;
+    if(count == 0) return 0;
+
+    par->destination = destination;
+    run_operation(par, UEL_ITERATOR_PAR_MAP, iterator, closure, count);
+    return count;
+}
+
+size_t uel_iterator_par_count(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+){
+    if(iterator->item_count == 0) return 0;
+
+    run_operation(par, UEL_ITERATOR_PAR_COUNT, iterator, closure, iterator->item_count);
+    return UEL_ATOMIC_LOAD(&par->passed, UEL_ATOMIC_ACQUIRE);
+}
+
+void *uel_iterator_par_find(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+){
+    if(iterator->item_count == 0) return NULL;
+
+    run_operation(par, UEL_ITERATOR_PAR_FIND, iterator, closure, iterator->item_count);
+    uintptr_t found = UEL_ATOMIC_LOAD(&par->found, UEL_ATOMIC_ACQUIRE);
+    if(found == UINTPTR_MAX) return NULL;
+    return par->collection + found * par->item_size;
+}
+
+bool uel_iterator_par_any(
+    uel_iterator_par_t *par,
+    uel_iterator_array_t *iterator,
+    uel_closure_t *closure
+){
+    return uel_iterator_par_find(par, iterator, closure) != NULL;
+}
@@ -5,17 +5,18 @@
 /// \endcond
 
 #include "uevloop/system/event.h"
+#include "uevloop/utils/trace.h"
 
 static void *is_past_due_time(void *context, void *params){
-    uint32_t current_time = *(uint32_t *)context;
+    uel_time_t current_time = *(uel_time_t *)context;
     uel_llist_node_t *node = (uel_llist_node_t *)params;
     uel_event_t *event = (uel_event_t *)node->value;
-    bool fit_for_removal = event->detail.timer.due_time <= current_time;
+    bool fit_for_removal = event->detail.timer.expires_at <= current_time;
     return (void *)fit_for_removal;
 }
 
 static void *place_in_order(void *context, void *params){
-    uint32_t due_time = *(uint32_t *)context;
+    uel_time_t expires_at = *(uel_time_t *)context;
     uel_llist_node_t **nodes = (uel_llist_node_t **)params;
 
     bool fits = false;
@@ -23,24 +24,81 @@ static void *place_in_order(void *context, void *params){
         fits = true;
     }else if(nodes[0] == NULL){
         uel_event_t *next = (uel_event_t *)nodes[1]->value;
-        fits = next->detail.timer.due_time > due_time;
+        fits = next->detail.timer.expires_at > expires_at;
     }else{
         uel_event_t *prev = (uel_event_t *)nodes[0]->value;
         uel_event_t *next = (uel_event_t *)nodes[1]->value;
 
-        fits = prev->detail.timer.due_time <= due_time &&
-            next->detail.timer.due_time > due_time;
+        fits = prev->detail.timer.expires_at <= expires_at &&
+            next->detail.timer.expires_at > expires_at;
     }
 
     return (void *)(uintptr_t)fits;
 }
 
+// Defers a timer to expire together with the earliest timer already scheduled
+// within its slack window, if any. The nominal due time is kept so recurring
+// timers stay on their own period grid.
+static void coalesce_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    detail->expires_at = detail->due_time;
+    if(detail->slack == 0) return;
+
+    uel_time_t latest = detail->due_time + detail->slack;
+    for(uel_llist_node_t *current = scheduler->timer_list.tail;
+        current != NULL;
+        current = current->next
+    ){
+        uel_time_t expires_at = ((uel_event_t *)current->value)->detail.timer.expires_at;
+        if(expires_at > latest) break;
+        if(expires_at >= detail->due_time){
+            detail->expires_at = expires_at;
+            break;
+        }
+    }
+}
+
+// Counts the period boundaries of a recurring timer that lie between its due
+// time (exclusive) and the current time (inclusive)
+static inline uel_time_t count_overdue_periods(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    if(!timer->repeating || detail->timeout == 0) return 0;
+    if(detail->due_time > scheduler->timer) return 0;
+    return (scheduler->timer - detail->due_time) / detail->timeout;
+}
+
+static inline void skip_periods(struct uel_event_timer *detail, uel_time_t periods){
+    detail->due_time += periods * detail->timeout;
+    detail->missed = periods > UINT16_MAX ? UINT16_MAX : (uint16_t)periods;
+}
+
+// Skipping timers that come back from the event loop already late drop every
+// period up to the current time
+static void skip_missed_periods(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    if(detail->overrun != UEL_TIMER_SKIP) return;
+    if(!timer->repeating || detail->due_time > scheduler->timer){
+        detail->missed = 0;
+        return;
+    }
+    skip_periods(detail, count_overdue_periods(scheduler, timer) + 1);
+}
+
+// Coalescing timers that expire late fold every missed period into this expiration
+static void coalesce_missed_periods(uel_scheduer_t *scheduler, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    if(detail->overrun != UEL_TIMER_COALESCE) return;
+    skip_periods(detail, count_overdue_periods(scheduler, timer));
+}
+
 static void enqueue_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    skip_missed_periods(scheduler, timer);
+    coalesce_timer(scheduler, timer);
     uel_llist_node_t *node = uel_syspools_acquire_llist_node(scheduler->pools);
     node->value = (void *)timer;
     uel_closure_t in_order = uel_closure_create(
         place_in_order,
-        (void *)&timer->detail.timer.due_time
+        (void *)&timer->detail.timer.expires_at
     );
     uel_llist_insert_at(&scheduler->timer_list, node, &in_order);
 }
@@ -53,9 +111,10 @@ static void reschedule_resumed_timers(uel_scheduer_t *scheduler){
             uel_llist_remove(&scheduler->pause_list, current);
             timer->detail.timer.due_time =
                 scheduler->timer + timer->detail.timer.timeout;
+            coalesce_timer(scheduler, timer);
             uel_closure_t in_order = uel_closure_create(
                 place_in_order,
-                (void *)&timer->detail.timer.due_time
+                (void *)&timer->detail.timer.expires_at
             );
             uel_llist_insert_at(&scheduler->timer_list, current, &in_order);
         }
@@ -68,16 +127,34 @@ static void enqueue_expired_timers(uel_scheduer_t *scheduler){
         uel_closure_create(&is_past_due_time, (void *)&scheduler->timer);
     uel_llist_t expired_timers = uel_llist_remove_while(&scheduler->timer_list, &closure);
     uel_llist_node_t *current = expired_timers.tail;
+    uel_event_t *batch[UEL_SYSQUEUES_BATCH_SIZE];
+    uintptr_t count = 0;
     while(current != NULL){
         uel_event_t *timer = (uel_event_t *)current->value;
         if (timer->detail.timer.status == UEL_TIMER_PAUSED) {
             uel_llist_push_head(&scheduler->pause_list, current);
         }else{
+            UEL_TRACE(
+                UEL_TRACE_TIMER_EXPIRED,
+                timer->closure.function,
+                timer->detail.timer.due_time
+            );
+#ifdef UEL_ENABLE_LATENCY_STATS
+            if(scheduler->latency != NULL){
+                uel_latency_record_lateness(scheduler->latency, timer, scheduler->timer);
+            }
+#endif /* UEL_ENABLE_LATENCY_STATS */
+            coalesce_missed_periods(scheduler, timer);
             uel_syspools_release_llist_node(scheduler->pools, current);
-            uel_sysqueues_enqueue_event(scheduler->queues, timer);
+            batch[count++] = timer;
+            if(count == UEL_SYSQUEUES_BATCH_SIZE){
+                uel_sysqueues_enqueue_events(scheduler->queues, batch, count);
+                count = 0;
+            }
         }
         current = current->next;
     }
+    uel_sysqueues_enqueue_events(scheduler->queues, batch, count);
 }
 
 void uel_sch_init(
@@ -90,16 +167,19 @@ void uel_sch_init(
     scheduler->pools = pools;
     scheduler->queues = queues;
     scheduler->timer = 0;
+#ifdef UEL_ENABLE_LATENCY_STATS
+    scheduler->latency = NULL;
+#endif /* UEL_ENABLE_LATENCY_STATS */
 }
 
 uel_event_t *uel_sch_run_later(
     uel_scheduer_t *scheduler,
-    uint16_t  timeout_in_ms,
+    uel_timeout_t timeout,
     uel_closure_t closure,
     void *value
 ){
     uel_event_t *event = uel_syspools_acquire_event(scheduler->pools);
-    uel_event_config_timer(event, timeout_in_ms, false, false, &closure,
+    uel_event_config_timer(event, timeout, false, false, &closure,
                                                     value, scheduler->timer);
                                                     
     uel_sysqueues_schedule_event(scheduler->queues, event);
@@ -108,13 +188,13 @@ uel_event_t *uel_sch_run_later(
 
 uel_event_t *uel_sch_run_at_intervals(
     uel_scheduer_t *scheduler,
-    uint16_t interval_in_ms,
+    uel_timeout_t interval,
     bool immediate,
     uel_closure_t closure,
     void *value
 ){
     uel_event_t *event = uel_syspools_acquire_event(scheduler->pools);
-    uel_event_config_timer(event, interval_in_ms, true, immediate, &closure,
+    uel_event_config_timer(event, interval, true, immediate, &closure,
                                                     value, scheduler->timer);
                                                     
     if(immediate){
@@ -126,15 +206,36 @@ uel_event_t *uel_sch_run_at_intervals(
 }
 
 void uel_sch_manage_timers(uel_scheduer_t *scheduler){
-    uel_event_t *event;
-    while((event = uel_sysqueues_get_scheduled_event(scheduler->queues)) != NULL){
-        enqueue_timer(scheduler, event);
+    uel_event_t *batch[UEL_SYSQUEUES_BATCH_SIZE];
+    uintptr_t count;
+    while((count = uel_sysqueues_get_scheduled_events(
+        scheduler->queues,
+        batch,
+        UEL_SYSQUEUES_BATCH_SIZE
+    )) > 0){
+        for(uintptr_t i = 0; i < count; i++){
+            enqueue_timer(scheduler, batch[i]);
+        }
     }
 
     reschedule_resumed_timers(scheduler);
     enqueue_expired_timers(scheduler);
 }
 
-void uel_sch_update_timer(uel_scheduer_t *scheduler, uint32_t timer){
+bool uel_sch_next_deadline(uel_scheduer_t *scheduler, uel_time_t *deadline){
+    uel_llist_node_t *next = scheduler->timer_list.tail;
+    if(next == NULL) return false;
+
+    *deadline = ((uel_event_t *)next->value)->detail.timer.expires_at;
+    return true;
+}
+
+void uel_sch_update_timer(uel_scheduer_t *scheduler, uel_time_t timer){
     scheduler->timer = timer;
 }
+
+#ifdef UEL_ENABLE_LATENCY_STATS
+void uel_sch_set_latency(uel_scheduer_t *scheduler, uel_latency_t *latency){
+    scheduler->latency = latency;
+}
+#endif /* UEL_ENABLE_LATENCY_STATS */
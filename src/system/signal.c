@@ -7,6 +7,7 @@
 
 #include "uevloop/config.h"
 #include "uevloop/portability/critical-section.h"
+#include "uevloop/utils/trace.h"
 
 static void register_listener(
     uel_signal_t signal,
@@ -17,9 +18,9 @@ static void register_listener(
     uel_llist_node_t *node = uel_syspools_acquire_llist_node(relay->pools);
     node->value = (void *)listener;
 
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&relay->lock);
     uel_llist_push_head(listeners, node);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&relay->lock);
 }
 
 void uel_signal_relay_init(
@@ -33,6 +34,7 @@ void uel_signal_relay_init(
     relay->queues = queues;
     relay->signal_vector = buffer;
     relay->width = width;
+    uel_lock_init(&relay->lock);
 
     for (uintptr_t i = 0; i < width; i++) {
         uel_llist_init(&relay->signal_vector[i]);
@@ -64,14 +66,15 @@ void uel_signal_unlisten(uel_signal_listener_t listener){
 }
 
 void uel_signal_emit(uel_signal_t signal, uel_signal_relay_t *relay, void *params){
+    UEL_TRACE(UEL_TRACE_SIGNAL_EMITTED, signal, relay);
     uel_llist_t *listeners = &relay->signal_vector[signal];
     bool has_listeners = false;
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&relay->lock);
     has_listeners = listeners->count > 0;
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&relay->lock);
     if (has_listeners) {
         uel_event_t *event = uel_syspools_acquire_event(relay->pools);
-        uel_event_config_signal(event, signal, listeners, params);
+        uel_event_config_signal(event, signal, listeners, &relay->lock, params);
         uel_sysqueues_enqueue_event(relay->queues, event);
     }
 }
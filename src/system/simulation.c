@@ -0,0 +1,77 @@
+#include "uevloop/system/simulation.h"
+
+static inline bool is_idle(uel_application_t *app){
+    return uel_sysqueues_count_enqueued_events(&app->queues) == 0 &&
+        uel_sysqueues_count_scheduled_events(&app->queues) == 0;
+}
+
+static void record_step(uel_sim_t *sim, uintptr_t events){
+    if(sim->schedule != NULL && sim->steps < sim->capacity){
+        uel_sim_step_t *step = &sim->schedule[sim->steps];
+        step->time = sim->app->scheduler.timer;
+        step->events = events;
+    }
+    sim->steps++;
+}
+
+void uel_sim_init(
+    uel_sim_t *sim,
+    uel_application_t *app,
+    uel_sim_step_t *schedule,
+    size_t capacity
+){
+    sim->app = app;
+    sim->schedule = schedule;
+    sim->capacity = capacity;
+    sim->steps = 0;
+    sim->events = 0;
+    sim->start_time = app->scheduler.timer;
+    sim->busy = 0;
+}
+
+uintptr_t uel_sim_run_until_idle(uel_sim_t *sim){
+    uel_application_t *app = sim->app;
+    uintptr_t dispatched = app->event_loop.dispatched;
+    uel_timestamp_t started_at = uel_clock_now();
+
+    do{
+        // Timers rescheduled by the last runloop must be managed right away
+        app->run_scheduler = true;
+        uel_app_tick(app);
+    } while(!is_idle(app));
+
+    uintptr_t events = app->event_loop.dispatched - dispatched;
+    sim->busy += uel_clock_now() - started_at;
+    sim->events += events;
+    return events;
+}
+
+bool uel_sim_step(uel_sim_t *sim){
+    uel_time_t deadline;
+    uel_sim_run_until_idle(sim);
+    if(!uel_sch_next_deadline(&sim->app->scheduler, &deadline)) return false;
+
+    if(deadline > sim->app->scheduler.timer){
+        uel_app_update_timer(sim->app, deadline);
+    }
+    record_step(sim, uel_sim_run_until_idle(sim));
+    return true;
+}
+
+void uel_sim_run_until(uel_sim_t *sim, uel_time_t end){
+    uel_time_t deadline;
+    uel_sim_run_until_idle(sim);
+    while(uel_sch_next_deadline(&sim->app->scheduler, &deadline) && deadline <= end){
+        uel_sim_step(sim);
+    }
+    if(end > sim->app->scheduler.timer){
+        uel_app_update_timer(sim->app, end);
+    }
+    uel_sim_run_until_idle(sim);
+}
+
+uint64_t uel_sim_throughput(uel_sim_t *sim){
+    uel_time_t elapsed = sim->app->scheduler.timer - sim->start_time;
+    if(elapsed == 0) return 0;
+    return (uint64_t)sim->events * UEL_SCH_TICKS_PER_SECOND / elapsed;
+}
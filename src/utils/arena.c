@@ -0,0 +1,29 @@
+#include "uevloop/utils/arena.h"
+
+void uel_arena_init(uel_arena_t *arena, uint8_t *buffer, size_t size){
+    arena->buffer = buffer;
+    arena->size = size;
+    arena->used = 0;
+    arena->peak = 0;
+}
+
+void *uel_arena_alloc(uel_arena_t *arena, size_t size, size_t align){
+    if(align == 0) align = 1;
+    uintptr_t address = (uintptr_t)(arena->buffer + arena->used);
+    size_t padding = (size_t)(-address & (align - 1));
+    size_t available = arena->size - arena->used;
+    if(padding > available || size > available - padding) return NULL;
+
+    void *memory = arena->buffer + arena->used + padding;
+    arena->used += padding + size;
+    if(arena->used > arena->peak) arena->peak = arena->used;
+    return memory;
+}
+
+void uel_arena_reset(uel_arena_t *arena){
+    arena->used = 0;
+}
+
+size_t uel_arena_count_available(uel_arena_t *arena){
+    return arena->size - arena->used;
+}
@@ -0,0 +1,308 @@
+#include "uevloop/utils/array-kernels.h"
+
+#if !defined(UEL_ARRAY_NO_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UEL_ARRAY_AVX2
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define UEL_ARRAY_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define UEL_ARRAY_NEON
+#endif
+#endif
+
+// Each kernel tests `((element ^ bias) - low) <= span`, wrapped to the element
+// width. Vector loops handle whole blocks; `find` loops stop at the first block
+// holding a match and leave locating it to the scalar loop.
+
+static size_t count8(const uint8_t *array, size_t count, uint8_t bias, uint8_t low, uint8_t span){
+    size_t i = 0, passed = 0;
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi8((char)bias);
+    __m256i low32 = _mm256_set1_epi8((char)low);
+    __m256i span32 = _mm256_set1_epi8((char)span);
+    for(; i + 32 <= count; i += 32){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_sub_epi8(_mm256_xor_si256(x, bias32), low32);
+        __m256i in = _mm256_cmpeq_epi8(_mm256_min_epu8(x, span32), x);
+        passed += __builtin_popcount((uint32_t)_mm256_movemask_epi8(in));
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi8((char)bias);
+    __m128i low16 = _mm_set1_epi8((char)low);
+    __m128i span16 = _mm_set1_epi8((char)span);
+    for(; i + 16 <= count; i += 16){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_sub_epi8(_mm_xor_si128(x, bias16), low16);
+        __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(x, span16), x);
+        passed += __builtin_popcount(_mm_movemask_epi8(in));
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint8x16_t bias16 = vdupq_n_u8(bias), low16 = vdupq_n_u8(low), span16 = vdupq_n_u8(span);
+    for(; i + 16 <= count; i += 16){
+        uint8x16_t x = vsubq_u8(veorq_u8(vld1q_u8(array + i), bias16), low16);
+        passed += vaddvq_u8(vshrq_n_u8(vcleq_u8(x, span16), 7));
+    }
+#endif
+    for(; i < count; i++){
+        passed += (uint8_t)((array[i] ^ bias) - low) <= span;
+    }
+    return passed;
+}
+
+static size_t find8(const uint8_t *array, size_t count, uint8_t bias, uint8_t low, uint8_t span, bool pass){
+    size_t i = 0;
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi8((char)bias);
+    __m256i low32 = _mm256_set1_epi8((char)low);
+    __m256i span32 = _mm256_set1_epi8((char)span);
+    uint32_t expected = pass ? 0 : UINT32_MAX;
+    for(; i + 32 <= count; i += 32){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_sub_epi8(_mm256_xor_si256(x, bias32), low32);
+        __m256i in = _mm256_cmpeq_epi8(_mm256_min_epu8(x, span32), x);
+        if((uint32_t)_mm256_movemask_epi8(in) != expected) break;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi8((char)bias);
+    __m128i low16 = _mm_set1_epi8((char)low);
+    __m128i span16 = _mm_set1_epi8((char)span);
+    int expected16 = pass ? 0 : 0xFFFF;
+    for(; i + 16 <= count; i += 16){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_sub_epi8(_mm_xor_si128(x, bias16), low16);
+        __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(x, span16), x);
+        if(_mm_movemask_epi8(in) != expected16) break;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint8x16_t bias16 = vdupq_n_u8(bias), low16 = vdupq_n_u8(low), span16 = vdupq_n_u8(span);
+    for(; i + 16 <= count; i += 16){
+        uint8x16_t x = vsubq_u8(veorq_u8(vld1q_u8(array + i), bias16), low16);
+        uint8x16_t in = vcleq_u8(x, span16);
+        if(vmaxvq_u8(pass ? in : vmvnq_u8(in)) != 0) break;
+    }
+#endif
+    for(; i < count; i++){
+        if(((uint8_t)((array[i] ^ bias) - low) <= span) == pass) return i;
+    }
+    return count;
+}
+
+static size_t count16(const uint16_t *array, size_t count, uint16_t bias, uint16_t low, uint16_t span){
+    size_t i = 0, passed = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    // There are no unsigned 16 bit comparisons, so values are flipped around
+    // the sign bit and compared as signed ones
+    uint16_t flip = 0x8000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi16((short)bias);
+    __m256i low32 = _mm256_set1_epi16((short)low);
+    __m256i flip32 = _mm256_set1_epi16((short)flip);
+    __m256i span32 = _mm256_set1_epi16((short)(span ^ flip));
+    for(; i + 16 <= count; i += 16){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi16(_mm256_xor_si256(x, bias32), low32), flip32);
+        uint32_t out = (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi16(x, span32));
+        passed += __builtin_popcount(~out) / 2;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi16((short)bias);
+    __m128i low16 = _mm_set1_epi16((short)low);
+    __m128i flip16 = _mm_set1_epi16((short)flip);
+    __m128i span16 = _mm_set1_epi16((short)(span ^ flip));
+    for(; i + 8 <= count; i += 8){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi16(_mm_xor_si128(x, bias16), low16), flip16);
+        int out = _mm_movemask_epi8(_mm_cmpgt_epi16(x, span16));
+        passed += __builtin_popcount(~out & 0xFFFF) / 2;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint16x8_t bias16 = vdupq_n_u16(bias), low16 = vdupq_n_u16(low), span16 = vdupq_n_u16(span);
+    for(; i + 8 <= count; i += 8){
+        uint16x8_t x = vsubq_u16(veorq_u16(vld1q_u16(array + i), bias16), low16);
+        passed += vaddvq_u16(vshrq_n_u16(vcleq_u16(x, span16), 15));
+    }
+#endif
+    for(; i < count; i++){
+        passed += (uint16_t)((array[i] ^ bias) - low) <= span;
+    }
+    return passed;
+}
+
+static size_t find16(const uint16_t *array, size_t count, uint16_t bias, uint16_t low, uint16_t span, bool pass){
+    size_t i = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    uint16_t flip = 0x8000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi16((short)bias);
+    __m256i low32 = _mm256_set1_epi16((short)low);
+    __m256i flip32 = _mm256_set1_epi16((short)flip);
+    __m256i span32 = _mm256_set1_epi16((short)(span ^ flip));
+    uint32_t expected = pass ? UINT32_MAX : 0;
+    for(; i + 16 <= count; i += 16){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi16(_mm256_xor_si256(x, bias32), low32), flip32);
+        if((uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi16(x, span32)) != expected) break;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi16((short)bias);
+    __m128i low16 = _mm_set1_epi16((short)low);
+    __m128i flip16 = _mm_set1_epi16((short)flip);
+    __m128i span16 = _mm_set1_epi16((short)(span ^ flip));
+    int expected16 = pass ? 0xFFFF : 0;
+    for(; i + 8 <= count; i += 8){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi16(_mm_xor_si128(x, bias16), low16), flip16);
+        if(_mm_movemask_epi8(_mm_cmpgt_epi16(x, span16)) != expected16) break;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint16x8_t bias16 = vdupq_n_u16(bias), low16 = vdupq_n_u16(low), span16 = vdupq_n_u16(span);
+    for(; i + 8 <= count; i += 8){
+        uint16x8_t x = vsubq_u16(veorq_u16(vld1q_u16(array + i), bias16), low16);
+        uint16x8_t in = vcleq_u16(x, span16);
+        if(vmaxvq_u16(pass ? in : vmvnq_u16(in)) != 0) break;
+    }
+#endif
+    for(; i < count; i++){
+        if(((uint16_t)((array[i] ^ bias) - low) <= span) == pass) return i;
+    }
+    return count;
+}
+
+static size_t count32(const uint32_t *array, size_t count, uint32_t bias, uint32_t low, uint32_t span){
+    size_t i = 0, passed = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    uint32_t flip = 0x80000000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi32((int)bias);
+    __m256i low32 = _mm256_set1_epi32((int)low);
+    __m256i flip32 = _mm256_set1_epi32((int)flip);
+    __m256i span32 = _mm256_set1_epi32((int)(span ^ flip));
+    for(; i + 8 <= count; i += 8){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi32(_mm256_xor_si256(x, bias32), low32), flip32);
+        uint32_t out = (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi32(x, span32));
+        passed += __builtin_popcount(~out) / 4;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi32((int)bias);
+    __m128i low16 = _mm_set1_epi32((int)low);
+    __m128i flip16 = _mm_set1_epi32((int)flip);
+    __m128i span16 = _mm_set1_epi32((int)(span ^ flip));
+    for(; i + 4 <= count; i += 4){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi32(_mm_xor_si128(x, bias16), low16), flip16);
+        int out = _mm_movemask_epi8(_mm_cmpgt_epi32(x, span16));
+        passed += __builtin_popcount(~out & 0xFFFF) / 4;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint32x4_t bias16 = vdupq_n_u32(bias), low16 = vdupq_n_u32(low), span16 = vdupq_n_u32(span);
+    for(; i + 4 <= count; i += 4){
+        uint32x4_t x = vsubq_u32(veorq_u32(vld1q_u32(array + i), bias16), low16);
+        passed += vaddvq_u32(vshrq_n_u32(vcleq_u32(x, span16), 31));
+    }
+#endif
+    for(; i < count; i++){
+        passed += (uint32_t)((array[i] ^ bias) - low) <= span;
+    }
+    return passed;
+}
+
+static size_t find32(const uint32_t *array, size_t count, uint32_t bias, uint32_t low, uint32_t span, bool pass){
+    size_t i = 0;
+#if defined(UEL_ARRAY_AVX2) || defined(UEL_ARRAY_SSE2)
+    uint32_t flip = 0x80000000;
+#endif
+#ifdef UEL_ARRAY_AVX2
+    __m256i bias32 = _mm256_set1_epi32((int)bias);
+    __m256i low32 = _mm256_set1_epi32((int)low);
+    __m256i flip32 = _mm256_set1_epi32((int)flip);
+    __m256i span32 = _mm256_set1_epi32((int)(span ^ flip));
+    uint32_t expected = pass ? UINT32_MAX : 0;
+    for(; i + 8 <= count; i += 8){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(array + i));
+        x = _mm256_xor_si256(_mm256_sub_epi32(_mm256_xor_si256(x, bias32), low32), flip32);
+        if((uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi32(x, span32)) != expected) break;
+    }
+#endif
+#if defined(UEL_ARRAY_SSE2)
+    __m128i bias16 = _mm_set1_epi32((int)bias);
+    __m128i low16 = _mm_set1_epi32((int)low);
+    __m128i flip16 = _mm_set1_epi32((int)flip);
+    __m128i span16 = _mm_set1_epi32((int)(span ^ flip));
+    int expected16 = pass ? 0xFFFF : 0;
+    for(; i + 4 <= count; i += 4){
+        __m128i x = _mm_loadu_si128((const __m128i *)(array + i));
+        x = _mm_xor_si128(_mm_sub_epi32(_mm_xor_si128(x, bias16), low16), flip16);
+        if(_mm_movemask_epi8(_mm_cmpgt_epi32(x, span16)) != expected16) break;
+    }
+#elif defined(UEL_ARRAY_NEON)
+    uint32x4_t bias16 = vdupq_n_u32(bias), low16 = vdupq_n_u32(low), span16 = vdupq_n_u32(span);
+    for(; i + 4 <= count; i += 4){
+        uint32x4_t x = vsubq_u32(veorq_u32(vld1q_u32(array + i), bias16), low16);
+        uint32x4_t in = vcleq_u32(x, span16);
+        if(vmaxvq_u32(pass ? in : vmvnq_u32(in)) != 0) break;
+    }
+#endif
+    for(; i < count; i++){
+        if(((uint32_t)((array[i] ^ bias) - low) <= span) == pass) return i;
+    }
+    return count;
+}
+
+// Finds the index of the first element whose test result equals `pass`
+static size_t find_index(const uel_array_filter_t *filter, const void *array, size_t count, bool pass){
+    switch(filter->width){
+        case 1:
+            return find8((const uint8_t *)array, count,
+                (uint8_t)filter->bias, (uint8_t)filter->low, (uint8_t)filter->span, pass);
+        case 2:
+            return find16((const uint16_t *)array, count,
+                (uint16_t)filter->bias, (uint16_t)filter->low, (uint16_t)filter->span, pass);
+        default:
+            return find32((const uint32_t *)array, count,
+                filter->bias, filter->low, filter->span, pass);
+    }
+}
+
+size_t uel_array_filter_count(const uel_array_filter_t *filter, const void *array, size_t count){
+    if(filter->empty) return 0;
+    switch(filter->width){
+        case 1:
+            return count8((const uint8_t *)array, count,
+                (uint8_t)filter->bias, (uint8_t)filter->low, (uint8_t)filter->span);
+        case 2:
+            return count16((const uint16_t *)array, count,
+                (uint16_t)filter->bias, (uint16_t)filter->low, (uint16_t)filter->span);
+        default:
+            return count32((const uint32_t *)array, count,
+                filter->bias, filter->low, filter->span);
+    }
+}
+
+void *uel_array_filter_find(const uel_array_filter_t *filter, const void *array, size_t count){
+    if(filter->empty) return NULL;
+    size_t index = find_index(filter, array, count, true);
+    if(index == count) return NULL;
+    return (char *)array + index * filter->width;
+}
+
+bool uel_array_filter_any(const uel_array_filter_t *filter, const void *array, size_t count){
+    return uel_array_filter_find(filter, array, count) != NULL;
+}
+
+bool uel_array_filter_all(const uel_array_filter_t *filter, const void *array, size_t count){
+    if(filter->empty) return count == 0;
+    return find_index(filter, array, count, false) == count;
+}
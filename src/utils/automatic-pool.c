@@ -14,10 +14,8 @@ void uel_autopool_init(
     struct uel_autoptr *autoptr_buffer,
     void **queue_buffer
 ){
-    for (size_t i = 0; i < (1<<size_log2n); i++) {
-        autoptr_buffer[i].object = (void *)(object_buffer + i * item_size);
-        autoptr_buffer[i].source = pool;
-    }
+    pool->object_buffer = object_buffer;
+    pool->item_size = item_size;
     uel_objpool_init(
         &pool->autoptr_pool,
         size_log2n,
@@ -30,10 +28,17 @@ void uel_autopool_init(
 }
 
 uel_autoptr_t uel_autopool_alloc(uel_autopool_t *pool){
-    uel_autoptr_t autoptr =
-        (uel_autoptr_t)uel_objpool_acquire(&pool->autoptr_pool);
-    uel_closure_invoke(&pool->constructor, *autoptr);
-    return autoptr;
+    struct uel_autoptr *autoptr =
+        (struct uel_autoptr *)uel_objpool_acquire(&pool->autoptr_pool);
+    if(autoptr == NULL) return NULL;
+
+    // Autopointers are bound to their objects when acquired, so
+    // initialisation does not have to visit each of them
+    size_t index = autoptr - (struct uel_autoptr *)pool->autoptr_pool.buffer;
+    autoptr->object = (void *)(pool->object_buffer + index * pool->item_size);
+    autoptr->source = pool;
+    uel_closure_invoke(&pool->constructor, autoptr->object);
+    return (uel_autoptr_t)autoptr;
 }
 
 bool uel_autopool_is_empty(uel_autopool_t *pool){
@@ -39,6 +39,30 @@ void *uel_cqueue_pop(uel_cqueue_t *queue){
     return element;
 }
 
+uintptr_t uel_cqueue_push_many(uel_cqueue_t *queue, void **elements, uintptr_t count){
+    uintptr_t available = queue->size - queue->count;
+    if(count > available) count = available;
+
+    uintptr_t head = queue->tail + queue->count;
+    for(uintptr_t i = 0; i < count; i++){
+        queue->buffer[++head & queue->mask] = elements[i];
+    }
+    queue->count += count;
+    return count;
+}
+
+uintptr_t uel_cqueue_pop_many(uel_cqueue_t *queue, void **elements, uintptr_t max){
+    if(max > queue->count) max = queue->count;
+
+    for(uintptr_t i = 0; i < max; i++){
+        queue->tail = (queue->tail + 1) & queue->mask;
+        elements[i] = queue->buffer[queue->tail];
+        queue->buffer[queue->tail] = NULL;
+    }
+    queue->count -= max;
+    return max;
+}
+
 void *uel_cqueue_peek_tail(uel_cqueue_t *queue){
     if(uel_cqueue_is_empty(queue)) return NULL;
 
@@ -0,0 +1,16 @@
+#include "uevloop/utils/clock.h"
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+static uel_closure_t clock_source = { NULL, NULL };
+
+void uel_clock_set_source(uel_closure_t source){
+    clock_source = source;
+}
+
+uel_timestamp_t uel_clock_now(){
+    if(clock_source.function == NULL) return 0;
+    return (uel_timestamp_t)(uintptr_t)uel_closure_invoke(&clock_source, NULL);
+}
@@ -14,6 +14,11 @@ static void *uel_func_unwrap_conditional(void *context, void *params){
     return uel_conditional_apply(conditional, params);
 }
 
+static void *uel_func_unwrap_switch(void *context, void *params){
+    uel_switch_t *sw = (uel_switch_t *)context;
+    return uel_switch_apply(sw, params);
+}
+
 static void *uel_func_unwrap_foreach(void *context, void *params){
     uel_iterator_t *iterator = (uel_iterator_t *)params;
     uel_closure_t *wrapped = (uel_closure_t *)context;
@@ -58,6 +63,36 @@ static void *uel_func_unwrap_any(void *context, void *params){
     return (void *)uel_iterator_any(iterator, wrapped);
 }
 
+static void *uel_func_unwrap_array_count(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return (void *)(uintptr_t)uel_array_filter_count(
+        filter, iterator->base.collection, iterator->item_count
+    );
+}
+
+static void *uel_func_unwrap_array_find(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return uel_array_filter_find(filter, iterator->base.collection, iterator->item_count);
+}
+
+static void *uel_func_unwrap_array_all(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return (void *)uel_array_filter_all(
+        filter, iterator->base.collection, iterator->item_count
+    );
+}
+
+static void *uel_func_unwrap_array_any(void *context, void *params){
+    uel_iterator_array_t *iterator = (uel_iterator_array_t *)params;
+    uel_array_filter_t *filter = (uel_array_filter_t *)context;
+    return (void *)uel_array_filter_any(
+        filter, iterator->base.collection, iterator->item_count
+    );
+}
+
 void uel_func_mapper_init(uel_func_mapper_t *mapper, uel_iterator_t *iterator,
                                           void **destination, size_t limit){
     mapper->iterator = iterator;
@@ -77,6 +112,10 @@ uel_closure_t uel_func_conditional(uel_conditional_t *conditional){
     return closure;
 }
 
+uel_closure_t uel_func_switch(uel_switch_t *sw){
+    return uel_closure_create(uel_func_unwrap_switch, (void *)sw);
+}
+
 uel_closure_t uel_func_foreach(uel_closure_t *closure){
     return uel_closure_create( uel_func_unwrap_foreach, (void *)closure);
 }
@@ -104,3 +143,19 @@ uel_closure_t uel_func_none(uel_closure_t *closure){
 uel_closure_t uel_func_any(uel_closure_t *closure){
     return uel_closure_create(uel_func_unwrap_any, (void *)closure);
 }
+
+uel_closure_t uel_func_array_count(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_count, (void *)filter);
+}
+
+uel_closure_t uel_func_array_find(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_find, (void *)filter);
+}
+
+uel_closure_t uel_func_array_all(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_all, (void *)filter);
+}
+
+uel_closure_t uel_func_array_any(uel_array_filter_t *filter){
+    return uel_closure_create(uel_func_unwrap_array_any, (void *)filter);
+}
@@ -0,0 +1,57 @@
+#include "uevloop/utils/histogram.h"
+
+static inline unsigned int most_significant_bit(uint32_t value){
+#if defined(__GNUC__) || defined(__clang__)
+    return 31 - __builtin_clz(value);
+#else
+    unsigned int msb = 0;
+    while(value >>= 1) msb++;
+    return msb;
+#endif
+}
+
+void uel_histogram_init(uel_histogram_t *histogram){
+    for(size_t i = 0; i < UEL_HISTOGRAM_BUCKET_COUNT; i++){
+        histogram->buckets[i] = 0;
+    }
+    histogram->count = 0;
+    histogram->min = UINT32_MAX;
+    histogram->max = 0;
+    histogram->sum = 0;
+}
+
+size_t uel_histogram_bucket_index(uint32_t value){
+    if(value < UEL_HISTOGRAM_SUB_BUCKET_COUNT) return value;
+
+    unsigned int shift = most_significant_bit(value) - UEL_HISTOGRAM_PRECISION_BITS;
+    return shift * UEL_HISTOGRAM_SUB_BUCKET_COUNT + (value >> shift);
+}
+
+uint32_t uel_histogram_bucket_floor(size_t index){
+    if(index < 2 * UEL_HISTOGRAM_SUB_BUCKET_COUNT) return (uint32_t)index;
+
+    unsigned int shift = (index >> UEL_HISTOGRAM_PRECISION_BITS) - 1;
+    uint32_t mantissa = index - shift * UEL_HISTOGRAM_SUB_BUCKET_COUNT;
+    return mantissa << shift;
+}
+
+void uel_histogram_record(uel_histogram_t *histogram, uint32_t value){
+    histogram->buckets[uel_histogram_bucket_index(value)]++;
+    histogram->count++;
+    histogram->sum += value;
+    if(value < histogram->min) histogram->min = value;
+    if(value > histogram->max) histogram->max = value;
+}
+
+uint32_t uel_histogram_quantile(uel_histogram_t *histogram, uint16_t permille){
+    if(histogram->count == 0) return 0;
+
+    uint64_t rank = ((uint64_t)histogram->count * permille + 999) / 1000;
+    if(rank == 0) rank = 1;
+    uint64_t seen = 0;
+    for(size_t i = 0; i < UEL_HISTOGRAM_BUCKET_COUNT; i++){
+        seen += histogram->buckets[i];
+        if(seen >= rank) return uel_histogram_bucket_floor(i);
+    }
+    return histogram->max;
+}
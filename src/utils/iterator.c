@@ -1,67 +1,86 @@
 #include "uevloop/utils/iterator.h"
 
-typedef void * (* uel_iterator_next_t)(uel_iterator_t *, void *);
+size_t uel_iterator_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(iterator->next_batch != NULL){
+        return iterator->next_batch(iterator, last, batch, capacity);
+    }
+    batch[0] = iterator->next(iterator, last);
+    return batch[0] != NULL;
+}
 
 bool uel_iterator_foreach(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
     void *last = NULL;
-    while(1){
-        last = iterator->next(iterator, last);
-        if(last == NULL){
-            return true;
-        }else if(!uel_closure_invoke(closure, last)){
-            return false;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(!uel_closure_invoke(closure, batch[i])) return false;
         }
+        last = batch[count - 1];
     }
+    return true;
 }
 
 size_t uel_iterator_map(uel_iterator_t *iterator, uel_closure_t *closure, void **destination, size_t limit){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
     void *last = NULL;
-    for(size_t i = 0; i < limit; i++){
-        last = iterator->next(iterator, last);
-        if(last == NULL){
-            return i;
-        }else{
-            destination[i] = uel_closure_invoke(closure, last);
+    size_t mapped = 0;
+    while(mapped < limit){
+        size_t capacity = limit - mapped;
+        if(capacity > UEL_ITERATOR_BATCH_SIZE) capacity = UEL_ITERATOR_BATCH_SIZE;
+        size_t count = uel_iterator_next_batch(iterator, last, batch, capacity);
+        if(count == 0) break;
+        for(size_t i = 0; i < count; i++){
+            destination[mapped++] = uel_closure_invoke(closure, batch[i]);
         }
+        last = batch[count - 1];
     }
-    return limit;
+    return mapped;
 }
 
 void *uel_iterator_find(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
     void *last = NULL;
-    while(1){
-        last = iterator->next(iterator, last);
-        if(last == NULL){
-            return NULL;
-        }else if(uel_closure_invoke(closure, last)){
-            return last;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(uel_closure_invoke(closure, batch[i])) return batch[i];
         }
+        last = batch[count - 1];
     }
+    return NULL;
 }
 
 size_t uel_iterator_count(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
     void *last = NULL;
-    size_t count = 0;
-    while (1) {
-        last = iterator->next(iterator, last);
-        if (last == NULL) {
-            return count;
-        }else if(uel_closure_invoke(closure, last)){
-            count++;
+    size_t passed = 0;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(uel_closure_invoke(closure, batch[i])) passed++;
         }
+        last = batch[count - 1];
     }
+    return passed;
 }
 
 bool uel_iterator_all(uel_iterator_t *iterator, uel_closure_t *closure){
+    void *batch[UEL_ITERATOR_BATCH_SIZE];
     void *last = NULL;
-    while(1){
-        last = iterator->next(iterator, last);
-        if(last == NULL){
-            return true;
-        }else if(!uel_closure_invoke(closure, last)){
-            return false;
+    size_t count;
+    while((count = uel_iterator_next_batch(iterator, last, batch, UEL_ITERATOR_BATCH_SIZE))){
+        for(size_t i = 0; i < count; i++){
+            if(!uel_closure_invoke(closure, batch[i])) return false;
         }
+        last = batch[count - 1];
     }
+    return true;
 }
 
 bool uel_iterator_none(uel_iterator_t *iterator, uel_closure_t *closure){
@@ -69,15 +88,7 @@ bool uel_iterator_none(uel_iterator_t *iterator, uel_closure_t *closure){
 }
 
 bool uel_iterator_any(uel_iterator_t *iterator, uel_closure_t *closure){
-    void *last = NULL;
-    while(1){
-        last = iterator->next(iterator, last);
-        if(last == NULL){
-            return false;
-        }else if(uel_closure_invoke(closure, last)){
-            return true;
-        }
-    }
+    return uel_iterator_find(iterator, closure) != NULL;
 }
 
 void *uel_iterator_array_next(uel_iterator_array_t *iterator, void *last){
@@ -94,9 +105,35 @@ void *uel_iterator_array_next(uel_iterator_array_t *iterator, void *last){
     }
 }
 
+size_t uel_iterator_array_next_batch(
+    uel_iterator_array_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    char *collection = (char *)iterator->base.collection;
+    size_t index = 0;
+    if(last != NULL){
+        index = ((char *)last - collection) / iterator->item_size + 1;
+    }
+
+    size_t count = iterator->item_count - index;
+    if(count > capacity) count = capacity;
+    char *item = collection + index * iterator->item_size;
+    for(size_t i = 0; i < count; i++){
+        batch[i] = (void *)item;
+        item += iterator->item_size;
+    }
+    return count;
+}
+
 uel_iterator_array_t uel_iterator_array_create(void *collection, size_t count, size_t size){
     uel_iterator_array_t iterator = {
-        { (uel_iterator_next_t)&uel_iterator_array_next, collection },
+        {
+            (uel_iterator_next_t)&uel_iterator_array_next,
+            collection,
+            (uel_iterator_next_batch_t)&uel_iterator_array_next_batch
+        },
         count,
         size
     };
@@ -113,7 +150,263 @@ void *uel_iterator_llist_next(uel_iterator_t *iterator, void *last){
     }
 }
 
+size_t uel_iterator_llist_next_batch(
+    uel_iterator_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    uel_llist_node_t *node = (uel_llist_node_t *)uel_iterator_llist_next(iterator, last);
+    size_t count = 0;
+    while(node != NULL && count < capacity){
+        batch[count++] = (void *)node;
+        node = node->next;
+    }
+    return count;
+}
+
 uel_iterator_llist_t uel_iterator_llist_create(uel_llist_t *list){
-    uel_iterator_llist_t iterator = {uel_iterator_llist_next, (void *)list};
+    uel_iterator_llist_t iterator = {
+        uel_iterator_llist_next,
+        (void *)list,
+        uel_iterator_llist_next_batch
+    };
+    return iterator;
+}
+
+static inline size_t adapter_capacity(size_t capacity){
+    return capacity < UEL_ITERATOR_BATCH_SIZE ? capacity : UEL_ITERATOR_BATCH_SIZE;
+}
+
+static void *adapter_next(uel_iterator_t *iterator, void *last){
+    void *element;
+    return iterator->next_batch(iterator, last, &element, 1) ? element : NULL;
+}
+
+static size_t map_adapter_next_batch(
+    uel_iterator_map_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL) iterator->source_last = NULL;
+    size_t count = uel_iterator_next_batch(
+        (uel_iterator_t *)iterator->base.collection,
+        iterator->source_last,
+        batch,
+        adapter_capacity(capacity)
+    );
+    if(count == 0) return 0;
+
+    iterator->source_last = batch[count - 1];
+    for(size_t i = 0; i < count; i++){
+        iterator->values[i] = uel_closure_invoke(&iterator->closure, batch[i]);
+        batch[i] = (void *)&iterator->values[i];
+    }
+    return count;
+}
+
+uel_iterator_map_adapter_t uel_iterator_map_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+){
+    uel_iterator_map_adapter_t iterator = {
+        {
+            adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&map_adapter_next_batch
+        },
+        *closure,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t filter_adapter_next_batch(
+    uel_iterator_filter_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL) iterator->source_last = NULL;
+    size_t passed = 0;
+    while(passed == 0){
+        size_t count = uel_iterator_next_batch(
+            (uel_iterator_t *)iterator->base.collection,
+            iterator->source_last,
+            batch,
+            capacity
+        );
+        if(count == 0) return 0;
+
+        iterator->source_last = batch[count - 1];
+        for(size_t i = 0; i < count; i++){
+            if(uel_closure_invoke(&iterator->closure, batch[i])){
+                batch[passed++] = batch[i];
+            }
+        }
+    }
+    return passed;
+}
+
+uel_iterator_filter_adapter_t uel_iterator_filter_adapter_create(
+    uel_iterator_t *source,
+    uel_closure_t *closure
+){
+    uel_iterator_filter_adapter_t iterator = {
+        {
+            adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&filter_adapter_next_batch
+        },
+        *closure,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t take_adapter_next_batch(
+    uel_iterator_take_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL){
+        iterator->source_last = NULL;
+        iterator->taken = 0;
+    }
+    size_t remaining = iterator->count - iterator->taken;
+    if(remaining == 0) return 0;
+
+    size_t count = uel_iterator_next_batch(
+        (uel_iterator_t *)iterator->base.collection,
+        iterator->source_last,
+        batch,
+        capacity < remaining ? capacity : remaining
+    );
+    if(count != 0) iterator->source_last = batch[count - 1];
+    iterator->taken += count;
+    return count;
+}
+
+uel_iterator_take_adapter_t uel_iterator_take_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+){
+    uel_iterator_take_adapter_t iterator = {
+        {
+            adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&take_adapter_next_batch
+        },
+        count,
+        0,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t skip_adapter_next_batch(
+    uel_iterator_skip_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    uel_iterator_t *source = (uel_iterator_t *)iterator->base.collection;
+    if(last == NULL){
+        iterator->source_last = NULL;
+        for(size_t skipped = 0; skipped < iterator->count;){
+            size_t remaining = iterator->count - skipped;
+            size_t count = uel_iterator_next_batch(
+                source,
+                iterator->source_last,
+                batch,
+                capacity < remaining ? capacity : remaining
+            );
+            if(count == 0) return 0;
+            iterator->source_last = batch[count - 1];
+            skipped += count;
+        }
+    }
+
+    size_t count =
+        uel_iterator_next_batch(source, iterator->source_last, batch, capacity);
+    if(count != 0) iterator->source_last = batch[count - 1];
+    return count;
+}
+
+uel_iterator_skip_adapter_t uel_iterator_skip_adapter_create(
+    uel_iterator_t *source,
+    size_t count
+){
+    uel_iterator_skip_adapter_t iterator = {
+        {
+            adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&skip_adapter_next_batch
+        },
+        count,
+        NULL
+    };
+    return iterator;
+}
+
+static size_t zip_adapter_next_batch(
+    uel_iterator_zip_adapter_t *iterator,
+    void *last,
+    void **batch,
+    size_t capacity
+){
+    if(last == NULL){
+        iterator->source_last = NULL;
+        iterator->other_last = NULL;
+    }
+    size_t count = uel_iterator_next_batch(
+        (uel_iterator_t *)iterator->base.collection,
+        iterator->source_last,
+        batch,
+        adapter_capacity(capacity)
+    );
+    if(count == 0) return 0;
+    iterator->source_last = batch[count - 1];
+
+    // The other source may yield shorter batches, so it is drained until it
+    // matches the first one or is exhausted
+    void *others[UEL_ITERATOR_BATCH_SIZE];
+    size_t paired = 0;
+    while(paired < count){
+        size_t fetched = uel_iterator_next_batch(
+            iterator->other,
+            iterator->other_last,
+            &others[paired],
+            count - paired
+        );
+        if(fetched == 0) break;
+        paired += fetched;
+        iterator->other_last = others[paired - 1];
+    }
+
+    for(size_t i = 0; i < paired; i++){
+        iterator->pairs[i][0] = batch[i];
+        iterator->pairs[i][1] = others[i];
+        batch[i] = (void *)iterator->pairs[i];
+    }
+    return paired;
+}
+
+uel_iterator_zip_adapter_t uel_iterator_zip_adapter_create(
+    uel_iterator_t *source,
+    uel_iterator_t *other
+){
+    uel_iterator_zip_adapter_t iterator = {
+        {
+            adapter_next,
+            (void *)source,
+            (uel_iterator_next_batch_t)&zip_adapter_next_batch
+        },
+        other,
+        NULL,
+        NULL
+    };
     return iterator;
 }
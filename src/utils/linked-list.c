@@ -63,6 +63,7 @@ uel_llist_node_t *uel_llist_peek_tail(uel_llist_t *list){
 bool uel_llist_remove(uel_llist_t *list, uel_llist_node_t *node){
     if(node == list->tail){
         list->tail = node->next;
+        if(node == list->head) list->head = NULL;
         list->count--;
         return true;
     }
@@ -71,6 +72,7 @@ bool uel_llist_remove(uel_llist_t *list, uel_llist_node_t *node){
     while(current != NULL){
         if(current->next == node){
             current->next = node->next;
+            if(node == list->head) list->head = current;
             list->count--;
             return true;
         }
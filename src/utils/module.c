@@ -1,4 +1,11 @@
 #include "uevloop/utils/module.h"
+#include "uevloop/system/containers/application.h"
+
+static void *complete_launch(void *context, void *params){
+    uel_module_t *module = (uel_module_t *)context;
+    uel_app_complete_launch(module->app, module);
+    return NULL;
+}
 
 void uel_module_init(
     uel_module_t *module,
@@ -9,6 +16,11 @@ void uel_module_init(
     module->config = config;
     module->launch = launch;
     module->app = app;
+    module->dependencies = NULL;
+    module->dependency_count = 0;
+    module->lazy = false;
+    module->asynchronous = false;
+    module->state = UEL_MODULE_IDLE;
 }
 
 void uel_module_config(uel_module_t *module){
@@ -18,3 +30,25 @@ void uel_module_config(uel_module_t *module){
 void uel_module_launch(uel_module_t *module){
     module->launch(module);
 }
+
+void uel_module_set_dependencies(
+    uel_module_t *module,
+    const size_t *dependencies,
+    size_t count
+){
+    module->dependencies = dependencies;
+    module->dependency_count = count;
+}
+
+void uel_module_set_lazy(uel_module_t *module, bool lazy){
+    module->lazy = lazy;
+}
+
+void uel_module_set_async(uel_module_t *module, bool asynchronous){
+    module->asynchronous = asynchronous;
+}
+
+void uel_module_launched(uel_module_t *module){
+    uel_closure_t closure = uel_closure_create(complete_launch, (void *)module);
+    uel_app_enqueue_closure(module->app, &closure, NULL);
+}
@@ -9,14 +9,17 @@ void uel_objpool_init(
 ){
     pool->buffer = buffer;
     uel_cqueue_init(&pool->queue, queue_buffer, size_log2n);
-    size_t i;
-    for(i = 0; i < pool->queue.size; i++){
-        uel_cqueue_push(&pool->queue, (void *)(buffer + i * item_size));
-    }
+    pool->item_size = item_size;
+    pool->untouched = 0;
+    uel_lock_init(&pool->lock);
 }
 
 void *uel_objpool_acquire(uel_objpool_t *pool){
-    return uel_cqueue_pop(&pool->queue);
+    if(!uel_cqueue_is_empty(&pool->queue)){
+        return uel_cqueue_pop(&pool->queue);
+    }
+    if(pool->untouched == pool->queue.size) return NULL;
+    return (void *)(pool->buffer + pool->untouched++ * pool->item_size);
 }
 
 bool uel_objpool_release(uel_objpool_t *pool, void *element){
@@ -24,5 +27,9 @@ bool uel_objpool_release(uel_objpool_t *pool, void *element){
 }
 
 bool uel_objpool_is_empty(uel_objpool_t *pool){
-    return uel_cqueue_is_empty(&pool->queue);
+    return uel_cqueue_is_empty(&pool->queue) && pool->untouched == pool->queue.size;
+}
+
+size_t uel_objpool_count_available(uel_objpool_t *pool){
+    return pool->queue.count + (pool->queue.size - pool->untouched);
 }
@@ -0,0 +1,97 @@
+#include "uevloop/utils/profiler.h"
+#include "uevloop/portability/atomic.h"
+
+/// \cond
+#include <stdlib.h>
+#include <stdbool.h>
+/// \endcond
+
+static uel_profiler_t *attached_profiler = NULL;
+
+static inline uintptr_t hash_function(uel_closure_function_t function){
+    // Fibonacci hashing; low bits of code addresses carry little entropy
+    uintptr_t address = (uintptr_t)function;
+    return (uintptr_t)((uint32_t)(address >> 2) * UINT32_C(2654435769)) >>
+        (32 - UEL_PROFILER_TABLE_SIZE_LOG2N);
+}
+
+static uel_profile_entry_t *probe(
+    uel_profiler_t *profiler,
+    uel_closure_function_t function,
+    bool claim
+){
+    uintptr_t index = hash_function(function);
+    for(uintptr_t i = 0; i < UEL_PROFILER_TABLE_SIZE; i++){
+        uel_profile_entry_t *entry =
+            &profiler->entries[(index + i) & (UEL_PROFILER_TABLE_SIZE - 1)];
+        uel_closure_function_t current =
+            UEL_ATOMIC_LOAD(&entry->function, UEL_ATOMIC_ACQUIRE);
+        if(current == function) return entry;
+        if(current == NULL){
+            if(!claim) return NULL;
+            // Another thread may claim the same entry meanwhile
+            if(UEL_ATOMIC_CAS(&entry->function, &current, function)) return entry;
+            if(current == function) return entry;
+        }
+    }
+    return NULL;
+}
+
+void uel_profiler_init(
+    uel_profiler_t *profiler,
+    uel_timestamp_t threshold,
+    uel_closure_t watchdog
+){
+    for(size_t i = 0; i < UEL_PROFILER_TABLE_SIZE; i++){
+        uel_profile_entry_t *entry = &profiler->entries[i];
+        entry->function = NULL;
+        entry->calls = 0;
+        entry->total = 0;
+        entry->max = 0;
+    }
+    profiler->dropped = 0;
+    profiler->threshold = threshold;
+    profiler->watchdog = watchdog;
+}
+
+void uel_profiler_attach(uel_profiler_t *profiler){
+    UEL_ATOMIC_STORE(&attached_profiler, profiler, UEL_ATOMIC_RELEASE);
+}
+
+void uel_profiler_record(
+    uel_profiler_t *profiler,
+    uel_closure_t *closure,
+    uel_timestamp_t elapsed
+){
+    uel_profile_entry_t *entry = probe(profiler, closure->function, true);
+    if(entry == NULL){
+        UEL_ATOMIC_FETCH_ADD(&profiler->dropped, 1, UEL_ATOMIC_RELAXED);
+    }else{
+        UEL_ATOMIC_FETCH_ADD(&entry->calls, 1, UEL_ATOMIC_RELAXED);
+        UEL_ATOMIC_FETCH_ADD(&entry->total, elapsed, UEL_ATOMIC_RELAXED);
+        uel_timestamp_t max = UEL_ATOMIC_LOAD(&entry->max, UEL_ATOMIC_RELAXED);
+        while(elapsed > max && !UEL_ATOMIC_CAS(&entry->max, &max, elapsed));
+    }
+
+    if(elapsed > profiler->threshold){
+        uel_profile_sample_t sample = { closure, elapsed };
+        uel_closure_invoke(&profiler->watchdog, (void *)&sample);
+    }
+}
+
+uel_profile_entry_t *uel_profiler_find(
+    uel_profiler_t *profiler,
+    uel_closure_function_t function
+){
+    return probe(profiler, function, false);
+}
+
+void *uel_profiler_invoke(uel_closure_t *closure, void *params){
+    uel_profiler_t *profiler = UEL_ATOMIC_LOAD(&attached_profiler, UEL_ATOMIC_ACQUIRE);
+    if(profiler == NULL) return uel_closure_invoke(closure, params);
+
+    uel_timestamp_t start = uel_clock_now();
+    void *result = uel_closure_invoke(closure, params);
+    uel_profiler_record(profiler, closure, uel_clock_now() - start);
+    return result;
+}
@@ -1,5 +1,7 @@
 #include "uevloop/utils/promise.h"
 #include "uevloop/portability/critical-section.h"
+#include "uevloop/utils/trace.h"
+#include "uevloop/utils/profiler.h"
 
 #include <stddef.h>
 
@@ -20,9 +22,9 @@ static void *resolver(void *context, void *params) {
 static void *destroyer(void *context, void *params) {
     uel_promise_t *promise = (uel_promise_t *)context;
 
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&promise->source->promise_pool->lock);
     uel_objpool_release(promise->source->promise_pool, (void *)promise);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&promise->source->promise_pool->lock);
 
     return NULL;
 }
@@ -39,10 +41,10 @@ static inline void push_segment(uel_promise_t *promise, uel_promise_segment_t *s
 static inline void await_promise(uel_promise_t *promise, uel_promise_t *other) {
     promise->state = UEL_PROMISE_PENDING;
 
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
     uel_promise_segment_t *segment =
         (uel_promise_segment_t *)uel_objpool_acquire(promise->source->segment_pool);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
 
     segment->next = promise->first_segment;
     segment->reject = uel_promise_destroyer(promise);
@@ -60,19 +62,17 @@ static inline void await_promise(uel_promise_t *promise, uel_promise_t *other) {
 }
 
 static inline void process_segment(uel_promise_t *promise) {
-    UEL_CRITICAL_ENTER;
     uel_promise_segment_t *segment = promise->first_segment;
     promise->first_segment = segment->next;
     if(!promise->first_segment) promise->last_segment = NULL;
-    UEL_CRITICAL_EXIT;
 
     uel_promise_t *other = NULL;
     switch (promise->state) {
         case UEL_PROMISE_RESOLVED:
-            other = (uel_promise_t *)uel_closure_invoke(&segment->resolve, (void *)promise);
+            other = (uel_promise_t *)UEL_PROFILED_INVOKE(&segment->resolve, (void *)promise);
             break;
         case UEL_PROMISE_REJECTED:
-            other = (uel_promise_t *)uel_closure_invoke(&segment->reject, (void *)promise);
+            other = (uel_promise_t *)UEL_PROFILED_INVOKE(&segment->reject, (void *)promise);
             break;
         default: break;
     }
@@ -80,9 +80,9 @@ static inline void process_segment(uel_promise_t *promise) {
         await_promise(promise, other);
     }
 
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
     uel_objpool_release(promise->source->segment_pool, (void *)segment);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
 }
 
 static inline void flush_segments(uel_promise_t *promise) {
@@ -102,10 +102,10 @@ uel_promise_store_t uel_promise_store_create(
     return store;
 }
 uel_promise_t *uel_promise_create(uel_promise_store_t *store, uel_closure_t closure) {
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&store->promise_pool->lock);
     uel_promise_t *promise =
         (uel_promise_t *)uel_objpool_acquire(store->promise_pool);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&store->promise_pool->lock);
 
     promise->source = store;
     promise->state = UEL_PROMISE_PENDING;
@@ -118,15 +118,17 @@ uel_promise_t *uel_promise_create(uel_promise_store_t *store, uel_closure_t clos
 }
 
 void uel_promise_destroy(uel_promise_t *promise) {
-    uel_promise_segment_t *segment;
-    for(segment = promise->first_segment; segment; segment = segment->next) {
-        UEL_CRITICAL_ENTER;
+    uel_promise_segment_t *segment = promise->first_segment;
+    while(segment) {
+        uel_promise_segment_t *next = segment->next;
+        UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
         uel_objpool_release(promise->source->segment_pool, (void *)segment);
-        UEL_CRITICAL_EXIT;
+        UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
+        segment = next;
     }
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&promise->source->promise_pool->lock);
     uel_objpool_release(promise->source->promise_pool, (void *)promise);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&promise->source->promise_pool->lock);
 }
 
 void uel_promise_then(uel_promise_t *promise, uel_closure_t resolve) {
@@ -146,10 +148,10 @@ void uel_promise_after(
     uel_closure_t resolve,
     uel_closure_t reject
 ) {
-    UEL_CRITICAL_ENTER;
+    UEL_CRITICAL_ENTER_ON(&promise->source->segment_pool->lock);
     uel_promise_segment_t *segment =
         (uel_promise_segment_t *)uel_objpool_acquire(promise->source->segment_pool);
-    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&promise->source->segment_pool->lock);
 
     segment ->next = NULL;
     segment->resolve = resolve;
@@ -159,12 +161,14 @@ void uel_promise_after(
 }
 
 void uel_promise_resolve(uel_promise_t *promise, void *value) {
+    UEL_TRACE(UEL_TRACE_PROMISE_RESOLVED, promise, value);
     promise->value = value;
     promise->state = UEL_PROMISE_RESOLVED;
     flush_segments(promise);
 }
 
 void uel_promise_reject(uel_promise_t *promise, void *value) {
+    UEL_TRACE(UEL_TRACE_PROMISE_REJECTED, promise, value);
     promise->value = value;
     promise->state = UEL_PROMISE_REJECTED;
     flush_segments(promise);
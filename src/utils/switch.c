@@ -0,0 +1,111 @@
+#include "uevloop/utils/switch.h"
+
+/// \cond
+#include <stdbool.h>
+/// \endcond
+
+static inline uint32_t fold_key(uintptr_t key){
+    uint32_t folded = (uint32_t)key;
+#if UINTPTR_MAX > UINT32_MAX
+    folded ^= (uint32_t)(key >> 32);
+#endif
+    return folded;
+}
+
+static inline size_t hash_key(uel_switch_t *sw, uintptr_t key){
+    if(sw->table_size_log2n == 0) return 0;
+    return (fold_key(key) * sw->multiplier) >> (32 - sw->table_size_log2n);
+}
+
+static inline size_t table_index(uel_switch_t *sw, uintptr_t key){
+    return sw->mode == UEL_SWITCH_DENSE ? key - sw->base : hash_key(sw, key);
+}
+
+static void clear_table(uel_switch_t *sw){
+    for(size_t i = 0; i < ((size_t)1 << sw->table_size_log2n); i++){
+        sw->table[i] = NULL;
+    }
+}
+
+// Fills the table, keeping the first of any repeated keys. Fails if two
+// distinct keys share a slot.
+static bool fill_table(uel_switch_t *sw){
+    clear_table(sw);
+    for(size_t i = 0; i < sw->count; i++){
+        uel_switch_case_t **slot = &sw->table[table_index(sw, sw->cases[i].key)];
+        if(*slot == NULL){
+            *slot = &sw->cases[i];
+        }else if((*slot)->key != sw->cases[i].key){
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool build_dense_table(uel_switch_t *sw){
+    uintptr_t min = sw->cases[0].key, max = sw->cases[0].key;
+    for(size_t i = 1; i < sw->count; i++){
+        if(sw->cases[i].key < min) min = sw->cases[i].key;
+        if(sw->cases[i].key > max) max = sw->cases[i].key;
+    }
+    if(max - min >= ((uintptr_t)1 << sw->table_size_log2n)) return false;
+
+    sw->mode = UEL_SWITCH_DENSE;
+    sw->base = min;
+    return fill_table(sw);
+}
+
+static bool build_hashed_table(uel_switch_t *sw){
+    if(sw->count > ((size_t)1 << sw->table_size_log2n)) return false;
+
+    sw->mode = UEL_SWITCH_HASHED;
+    uint32_t multiplier = 0x9E3779B1u;
+    for(unsigned int attempt = 0; attempt < UEL_SWITCH_MAX_ATTEMPTS; attempt++){
+        sw->multiplier = multiplier | 1;
+        if(fill_table(sw)) return true;
+        multiplier += 0x7F4A7C16u;
+    }
+    return false;
+}
+
+void uel_switch_init(
+    uel_switch_t *sw,
+    uel_closure_t selector,
+    uel_switch_case_t *cases,
+    size_t count,
+    uel_closure_t default_branch,
+    uel_switch_case_t **table,
+    uint8_t table_size_log2n
+){
+    sw->selector = selector;
+    sw->default_branch = default_branch;
+    sw->cases = cases;
+    sw->count = count;
+    sw->table = table;
+    sw->table_size_log2n = table_size_log2n;
+    sw->base = 0;
+    sw->multiplier = 0;
+
+    if(count != 0 && (build_dense_table(sw) || build_hashed_table(sw))) return;
+    sw->mode = UEL_SWITCH_LINEAR;
+}
+
+uel_closure_t *uel_switch_find(uel_switch_t *sw, uintptr_t key){
+    if(sw->mode == UEL_SWITCH_LINEAR){
+        for(size_t i = 0; i < sw->count; i++){
+            if(sw->cases[i].key == key) return &sw->cases[i].closure;
+        }
+        return &sw->default_branch;
+    }
+
+    size_t index = table_index(sw, key);
+    if(index >= ((size_t)1 << sw->table_size_log2n)) return &sw->default_branch;
+    uel_switch_case_t *branch = sw->table[index];
+    if(branch == NULL || branch->key != key) return &sw->default_branch;
+    return &branch->closure;
+}
+
+void *uel_switch_apply(uel_switch_t *sw, void *params){
+    uintptr_t key = (uintptr_t)uel_closure_invoke(&sw->selector, params);
+    return uel_closure_invoke(uel_switch_find(sw, key), params);
+}
@@ -0,0 +1,38 @@
+#include "uevloop/utils/trace.h"
+
+#include "uevloop/portability/atomic.h"
+
+//! Unrolls `UEL_TRACE_BUFFER_SIZE_LOG2N` into its power-of-two form
+#define UEL_TRACE_BUFFER_SIZE (1<<UEL_TRACE_BUFFER_SIZE_LOG2N)
+
+static uel_trace_record_t trace_buffer[UEL_TRACE_BUFFER_SIZE];
+static volatile uintptr_t trace_head = 0;
+static volatile bool trace_enabled = true;
+
+void uel_trace_record(uel_trace_record_type_t type, uintptr_t subject, uintptr_t detail){
+    if(!trace_enabled) return;
+
+    uintptr_t slot = UEL_ATOMIC_FETCH_ADD(&trace_head, 1, UEL_ATOMIC_RELAXED);
+    uel_trace_record_t *record = &trace_buffer[slot & (UEL_TRACE_BUFFER_SIZE - 1)];
+    record->timestamp = uel_clock_now();
+    record->type = (uint32_t)type;
+    record->subject = subject;
+    record->detail = detail;
+}
+
+void uel_trace_set_enabled(bool enabled){
+    trace_enabled = enabled;
+}
+
+void uel_trace_reset(){
+    UEL_ATOMIC_STORE(&trace_head, 0, UEL_ATOMIC_RELEASE);
+}
+
+uintptr_t uel_trace_dump(uel_closure_t *writer){
+    uintptr_t head = UEL_ATOMIC_LOAD(&trace_head, UEL_ATOMIC_ACQUIRE);
+    uintptr_t first = head > UEL_TRACE_BUFFER_SIZE ? head - UEL_TRACE_BUFFER_SIZE : 0;
+    for(uintptr_t i = first; i < head; i++){
+        uel_closure_invoke(writer, (void *)&trace_buffer[i & (UEL_TRACE_BUFFER_SIZE - 1)]);
+    }
+    return head - first;
+}
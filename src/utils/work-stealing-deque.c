@@ -0,0 +1,68 @@
+#include "uevloop/utils/work-stealing-deque.h"
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/portability/atomic.h"
+
+void uel_wsdeque_init(uel_wsdeque_t *deque, void **buffer, uintptr_t size_log2n){
+    deque->buffer = buffer;
+    deque->mask = ((intptr_t)1 << size_log2n) - 1;
+    deque->top = 0;
+    deque->bottom = 0;
+}
+
+bool uel_wsdeque_push(uel_wsdeque_t *deque, void *element){
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_RELAXED);
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_ACQUIRE);
+    if(bottom - top > deque->mask) return false;
+
+    UEL_ATOMIC_STORE(&deque->buffer[bottom & deque->mask], element, UEL_ATOMIC_RELAXED);
+    UEL_ATOMIC_STORE(&deque->bottom, bottom + 1, UEL_ATOMIC_RELEASE);
+    return true;
+}
+
+void *uel_wsdeque_pop(uel_wsdeque_t *deque){
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_RELAXED) - 1;
+    UEL_ATOMIC_STORE(&deque->bottom, bottom, UEL_ATOMIC_RELAXED);
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_RELAXED);
+
+    if(top > bottom){
+        // Deque was already empty
+        UEL_ATOMIC_STORE(&deque->bottom, bottom + 1, UEL_ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    void *element =
+        UEL_ATOMIC_LOAD(&deque->buffer[bottom & deque->mask], UEL_ATOMIC_RELAXED);
+    if(top == bottom){
+        // Last element: race against thieves for it
+        if(!UEL_ATOMIC_CAS(&deque->top, &top, top + 1)){
+            element = NULL;
+        }
+        UEL_ATOMIC_STORE(&deque->bottom, bottom + 1, UEL_ATOMIC_RELAXED);
+    }
+    return element;
+}
+
+void *uel_wsdeque_steal(uel_wsdeque_t *deque){
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_ACQUIRE);
+    UEL_ATOMIC_FENCE(UEL_ATOMIC_SEQ_CST);
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_ACQUIRE);
+    if(top >= bottom) return NULL;
+
+    void *element =
+        UEL_ATOMIC_LOAD(&deque->buffer[top & deque->mask], UEL_ATOMIC_RELAXED);
+    if(!UEL_ATOMIC_CAS(&deque->top, &top, top + 1)){
+        return NULL;
+    }
+    return element;
+}
+
+uintptr_t uel_wsdeque_count(uel_wsdeque_t *deque){
+    intptr_t top = UEL_ATOMIC_LOAD(&deque->top, UEL_ATOMIC_ACQUIRE);
+    intptr_t bottom = UEL_ATOMIC_LOAD(&deque->bottom, UEL_ATOMIC_ACQUIRE);
+    return bottom > top ? (uintptr_t)(bottom - top) : 0;
+}
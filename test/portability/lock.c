@@ -0,0 +1,157 @@
+#include "lock.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "uevloop/portability/lock.h"
+#include "uevloop/portability/critical-section.h"
+#include "../uelt.h"
+
+#define CONTENDERS      (4)
+#define INCREMENTS      (20000)
+
+typedef struct contention contention_t;
+struct contention {
+    void (*acquire)(void *lock);
+    void (*release)(void *lock);
+    void *lock;
+    volatile uintptr_t counter;
+};
+
+static void *contend(void *arg){
+    contention_t *contention = (contention_t *)arg;
+    for(uintptr_t i = 0; i < INCREMENTS; i++){
+        contention->acquire(contention->lock);
+        contention->counter++;
+        contention->release(contention->lock);
+    }
+    return NULL;
+}
+
+static uintptr_t run_contention(contention_t *contention){
+    pthread_t threads[CONTENDERS];
+    contention->counter = 0;
+    for(size_t i = 0; i < CONTENDERS; i++){
+        pthread_create(&threads[i], NULL, contend, (void *)contention);
+    }
+    for(size_t i = 0; i < CONTENDERS; i++){
+        pthread_join(threads[i], NULL);
+    }
+    return contention->counter;
+}
+
+static void spinlock_acquire(void *lock){ uel_spinlock_acquire((uel_spinlock_t *)lock); }
+static void spinlock_release(void *lock){ uel_spinlock_release((uel_spinlock_t *)lock); }
+
+static char *should_lock_spinlocks(){
+    uel_spinlock_t lock = UEL_SPINLOCK_INITIALIZER;
+    uel_spinlock_init(&lock);
+
+    uelt_assert("uel_spinlock_try_acquire", uel_spinlock_try_acquire(&lock));
+    uelt_assert_not("uel_spinlock_try_acquire while held", uel_spinlock_try_acquire(&lock));
+    uel_spinlock_release(&lock);
+    uel_spinlock_acquire(&lock);
+    uelt_assert_not("uel_spinlock_try_acquire after acquiring", uel_spinlock_try_acquire(&lock));
+    uel_spinlock_release(&lock);
+
+    contention_t contention = { spinlock_acquire, spinlock_release, (void *)&lock, 0 };
+    uelt_assert_ints_equal(
+        "contended counter",
+        CONTENDERS * INCREMENTS,
+        run_contention(&contention)
+    );
+
+    return NULL;
+}
+
+#ifdef UEL_LOCK_HAS_FUTEX
+static void futex_acquire(void *lock){ uel_futex_acquire((uel_futex_t *)lock); }
+static void futex_release(void *lock){ uel_futex_release((uel_futex_t *)lock); }
+
+static char *should_lock_futexes(){
+    uel_futex_t lock = UEL_FUTEX_INITIALIZER;
+    uel_futex_init(&lock);
+
+    uelt_assert("uel_futex_try_acquire", uel_futex_try_acquire(&lock));
+    uelt_assert_not("uel_futex_try_acquire while held", uel_futex_try_acquire(&lock));
+    uel_futex_release(&lock);
+    uelt_assert_int_zero("lock", lock);
+    uel_futex_acquire(&lock);
+    uelt_assert_not("uel_futex_try_acquire after acquiring", uel_futex_try_acquire(&lock));
+    uel_futex_release(&lock);
+
+    contention_t contention = { futex_acquire, futex_release, (void *)&lock, 0 };
+    uelt_assert_ints_equal(
+        "contended counter",
+        CONTENDERS * INCREMENTS,
+        run_contention(&contention)
+    );
+    uelt_assert_int_zero("lock", lock);
+
+    return NULL;
+}
+#endif /* UEL_LOCK_HAS_FUTEX */
+
+#ifdef UEL_LOCK_HAS_PTHREAD
+static void mutex_acquire(void *lock){ uel_mutex_acquire((uel_mutex_t *)lock); }
+static void mutex_release(void *lock){ uel_mutex_release((uel_mutex_t *)lock); }
+
+static char *should_lock_mutexes(){
+    uel_mutex_t lock;
+    uel_mutex_init(&lock);
+
+    uelt_assert("uel_mutex_try_acquire", uel_mutex_try_acquire(&lock));
+    uelt_assert_not("uel_mutex_try_acquire while held", uel_mutex_try_acquire(&lock));
+    uel_mutex_release(&lock);
+
+    contention_t contention = { mutex_acquire, mutex_release, (void *)&lock, 0 };
+    uelt_assert_ints_equal(
+        "contended counter",
+        CONTENDERS * INCREMENTS,
+        run_contention(&contention)
+    );
+
+    return NULL;
+}
+#endif /* UEL_LOCK_HAS_PTHREAD */
+
+static char *should_guard_critical_sections(){
+    uel_lock_t lock;
+    uel_lock_init(&lock);
+    uintptr_t guarded = 0;
+
+    UEL_CRITICAL_ENTER_ON(&lock);
+    guarded++;
+    UEL_CRITICAL_EXIT_ON(&lock);
+
+    UEL_CRITICAL_ENTER;
+    guarded++;
+    UEL_CRITICAL_EXIT;
+
+    // Both locks must have been released, otherwise this would block
+    UEL_CRITICAL_ENTER_ON(&lock);
+    UEL_CRITICAL_ENTER;
+    guarded++;
+    UEL_CRITICAL_EXIT;
+    UEL_CRITICAL_EXIT_ON(&lock);
+
+    uelt_assert_ints_equal("guarded", 3, guarded);
+
+    return NULL;
+}
+
+char *uel_lock_run_tests(){
+    uelt_run_test("should lock spinlocks", should_lock_spinlocks);
+#ifdef UEL_LOCK_HAS_FUTEX
+    uelt_run_test("should lock futexes", should_lock_futexes);
+#endif /* UEL_LOCK_HAS_FUTEX */
+#ifdef UEL_LOCK_HAS_PTHREAD
+    uelt_run_test("should lock pthread mutexes", should_lock_mutexes);
+#endif /* UEL_LOCK_HAS_PTHREAD */
+    uelt_run_test(
+        "should guard critical sections with the selected lock",
+        should_guard_critical_sections
+    );
+
+    return NULL;
+}
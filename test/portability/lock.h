@@ -0,0 +1,6 @@
+#ifndef TEST_LOCK_H
+#define TEST_LOCK_H
+
+char *uel_lock_run_tests();
+
+#endif /* end of include guard: TEST_LOCK_H */
@@ -0,0 +1,240 @@
+#include "async-pipeline.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "uevloop/system/async-pipeline.h"
+#include "uevloop/system/event-loop.h"
+#include "uevloop/system/containers/system-pools.h"
+#include "uevloop/system/containers/system-queues.h"
+#include "uevloop/utils/object-pool.h"
+#include "uevloop/utils/pipeline.h"
+#include "uevloop/utils/promise.h"
+#include "uevloop/utils/clock.h"
+#include "uevloop/utils/closure.h"
+#include "../uelt.h"
+
+#define DECLARE_ENVIRONMENT                                         \
+    uel_syspools_t pools;                                           \
+    uel_syspools_init(&pools);                                      \
+    uel_sysqueues_t queues;                                         \
+    uel_sysqueues_init(&queues);                                    \
+    uel_evloop_t loop;                                              \
+    uel_evloop_init(&loop, &pools, &queues);                        \
+    UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_t, 3, promise);         \
+    uel_objpool_t promise_pool;                                     \
+    uel_objpool_init(                                               \
+        &promise_pool,                                              \
+        3,                                                          \
+        sizeof(uel_promise_t),                                      \
+        UEL_OBJPOOL_BUFFERS(promise)                                \
+    );                                                              \
+    UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_segment_t, 4, segment); \
+    uel_objpool_t segment_pool;                                     \
+    uel_objpool_init(                                               \
+        &segment_pool,                                              \
+        4,                                                          \
+        sizeof(uel_promise_segment_t),                              \
+        UEL_OBJPOOL_BUFFERS(segment)                                \
+    );                                                              \
+    uel_promise_store_t store =                                     \
+        uel_promise_store_create(&promise_pool, &segment_pool);
+
+static char log_entries[16];
+static size_t log_count = 0;
+static uintptr_t fake_clock = 0;
+
+static void *read_clock(void *context, void *params){
+    return (void *)fake_clock;
+}
+
+// Logs its context, takes 5 time units and increments its parameter
+static void *increment(void *context, void *params){
+    log_entries[log_count++] = (char)(uintptr_t)context;
+    fake_clock += 5;
+    return (void *)((uintptr_t)params + 1);
+}
+
+// Logs its context, takes 2 time units and doubles its parameter
+static void *twice(void *context, void *params){
+    log_entries[log_count++] = (char)(uintptr_t)context;
+    fake_clock += 2;
+    return (void *)((uintptr_t)params * 2);
+}
+
+static void *mark(void *context, void *params){
+    log_entries[log_count++] = (char)(uintptr_t)context;
+    return NULL;
+}
+
+struct deferral {
+    uel_promise_store_t *store;
+    uel_promise_t *promise;
+};
+
+// Returns a pending promise, storing it in the context
+static void *defer(void *context, void *params){
+    struct deferral *deferral = (struct deferral *)context;
+    deferral->promise = uel_promise_create(deferral->store, uel_nop());
+    return (void *)deferral->promise;
+}
+
+static char *should_init_async_pipeline(){
+    DECLARE_ENVIRONMENT;
+    uel_closure_t closures[1] = { uel_closure_create(increment, (void *)'a') };
+    uel_pipeline_t pipeline;
+    uel_pipeline_init(&pipeline, closures, 1);
+    uel_timestamp_t durations[1];
+
+    uel_async_pipeline_t async_pipeline;
+    uel_async_pipeline_init(&async_pipeline, &pipeline, &loop, &store, durations);
+
+    uelt_assert_pointers_equal("async_pipeline.pipeline", &pipeline, async_pipeline.pipeline);
+    uelt_assert_pointers_equal("async_pipeline.event_loop", &loop, async_pipeline.event_loop);
+    uelt_assert_pointers_equal("async_pipeline.store", &store, async_pipeline.store);
+    uelt_assert_pointers_equal("async_pipeline.durations", durations, async_pipeline.durations);
+    uelt_assert_pointer_null("async_pipeline.promise", async_pipeline.promise);
+    uelt_assert_pointer_null("async_pipeline.awaited", async_pipeline.awaited);
+
+    return NULL;
+}
+
+static char *should_run_one_stage_per_event(){
+    DECLARE_ENVIRONMENT;
+    uel_closure_t closures[3] = {
+        uel_closure_create(increment, (void *)'a'),
+        uel_closure_create(twice, (void *)'b'),
+        uel_closure_create(increment, (void *)'c')
+    };
+    uel_pipeline_t pipeline;
+    uel_pipeline_init(&pipeline, closures, 3);
+    uel_timestamp_t durations[3] = {0};
+    uel_async_pipeline_t async_pipeline;
+    uel_async_pipeline_init(&async_pipeline, &pipeline, &loop, &store, durations);
+    log_count = 0;
+    uel_clock_set_source(uel_closure_create(read_clock, NULL));
+
+    uel_promise_t *promise = uel_async_pipeline_apply(&async_pipeline, (void *)5);
+    uel_closure_t marker = uel_closure_create(mark, (void *)'m');
+    uel_evloop_enqueue_closure(&loop, &marker, NULL);
+
+    uelt_assert_int_zero("log count before running", log_count);
+    uelt_assert_ints_equal("promise->state before running", UEL_PROMISE_PENDING, promise->state);
+
+    uel_evloop_run(&loop);
+    uel_clock_set_source(uel_closure_create(NULL, NULL));
+
+    uelt_assert_ints_equal("log count", 4, log_count);
+    uelt_assert_int_zero("log", memcmp(log_entries, "ambc", 4));
+    uelt_assert_ints_equal("promise->state", UEL_PROMISE_RESOLVED, promise->state);
+    uelt_assert_ints_equal("promise->value", (5 + 1) * 2 + 1, (uintptr_t)promise->value);
+    uelt_assert_ints_equal("durations[0]", 5, durations[0]);
+    uelt_assert_ints_equal("durations[1]", 2, durations[1]);
+    uelt_assert_ints_equal("durations[2]", 5, durations[2]);
+
+    uel_promise_destroy(promise);
+    uelt_assert_ints_equal(
+        "promise pool count",
+        promise_pool.queue.size,
+        uel_objpool_count_available(&promise_pool)
+    );
+
+    return NULL;
+}
+
+static char *should_await_promise_stages(){
+    DECLARE_ENVIRONMENT;
+    struct deferral deferral = { &store, NULL };
+    uel_closure_t deferrer = uel_closure_create(defer, (void *)&deferral);
+    uel_closure_t closures[3] = {
+        uel_closure_create(increment, (void *)'a'),
+        uel_async_pipeline_awaiting(&deferrer),
+        uel_closure_create(twice, (void *)'b')
+    };
+    uel_pipeline_t pipeline;
+    uel_pipeline_init(&pipeline, closures, 3);
+    uel_timestamp_t durations[3] = {0};
+    uel_async_pipeline_t async_pipeline;
+    uel_async_pipeline_init(&async_pipeline, &pipeline, &loop, &store, durations);
+    log_count = 0;
+    uel_clock_set_source(uel_closure_create(read_clock, NULL));
+
+    uel_promise_t *promise = uel_async_pipeline_apply(&async_pipeline, (void *)1);
+    uel_evloop_run(&loop);
+
+    uelt_assert_ints_equal("log count while suspended", 1, log_count);
+    uelt_assert_ints_equal("promise->state while suspended", UEL_PROMISE_PENDING, promise->state);
+    uelt_assert_pointers_equal("async_pipeline.awaited", deferral.promise, async_pipeline.awaited);
+
+    fake_clock += 10;
+    uel_promise_resolve(deferral.promise, (void *)20);
+    uelt_assert_ints_equal("log count after settling", 1, log_count);
+
+    uel_evloop_run(&loop);
+    uel_clock_set_source(uel_closure_create(NULL, NULL));
+
+    uelt_assert_ints_equal("log count", 2, log_count);
+    uelt_assert_ints_equal("promise->state", UEL_PROMISE_RESOLVED, promise->state);
+    uelt_assert_ints_equal("promise->value", 40, (uintptr_t)promise->value);
+    uelt_assert_ints_equal("durations[1]", 10, durations[1]);
+    uelt_assert_pointer_null("async_pipeline.awaited after resuming", async_pipeline.awaited);
+
+    uel_promise_destroy(promise);
+    uelt_assert_ints_equal(
+        "promise pool count",
+        promise_pool.queue.size,
+        uel_objpool_count_available(&promise_pool)
+    );
+    uelt_assert_ints_equal(
+        "segment pool count",
+        segment_pool.queue.size,
+        uel_objpool_count_available(&segment_pool)
+    );
+
+    return NULL;
+}
+
+static char *should_reject_when_awaited_stage_rejects(){
+    DECLARE_ENVIRONMENT;
+    struct deferral deferral = { &store, NULL };
+    uel_closure_t deferrer = uel_closure_create(defer, (void *)&deferral);
+    uel_closure_t closures[2] = {
+        uel_async_pipeline_awaiting(&deferrer),
+        uel_closure_create(increment, (void *)'a')
+    };
+    uel_pipeline_t pipeline;
+    uel_pipeline_init(&pipeline, closures, 2);
+    uel_async_pipeline_t async_pipeline;
+    uel_async_pipeline_init(&async_pipeline, &pipeline, &loop, &store, NULL);
+    log_count = 0;
+
+    uel_promise_t *promise = uel_async_pipeline_apply(&async_pipeline, NULL);
+    uel_evloop_run(&loop);
+    uel_promise_reject(deferral.promise, (void *)7);
+    uel_evloop_run(&loop);
+
+    uelt_assert_int_zero("log count", log_count);
+    uelt_assert_ints_equal("promise->state", UEL_PROMISE_REJECTED, promise->state);
+    uelt_assert_ints_equal("promise->value", 7, (uintptr_t)promise->value);
+
+    uel_promise_destroy(promise);
+    uelt_assert_ints_equal(
+        "promise pool count",
+        promise_pool.queue.size,
+        uel_objpool_count_available(&promise_pool)
+    );
+
+    return NULL;
+}
+
+char *uel_async_pipeline_run_tests(){
+    uelt_run_test("should initialise async pipeline", should_init_async_pipeline);
+    uelt_run_test("should run one stage per event", should_run_one_stage_per_event);
+    uelt_run_test("should await promise stages", should_await_promise_stages);
+    uelt_run_test(
+        "should reject when awaited stage rejects",
+        should_reject_when_awaited_stage_rejects
+    );
+
+    return NULL;
+}
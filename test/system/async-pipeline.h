@@ -0,0 +1,6 @@
+#ifndef TEST_ASYNC_PIPELINE_H
+#define TEST_ASYNC_PIPELINE_H
+
+char *uel_async_pipeline_run_tests();
+
+#endif /* end of include guard: TEST_ASYNC_PIPELINE_H */
@@ -0,0 +1,209 @@
+#include "channel.h"
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "uevloop/portability/atomic.h"
+#include "uevloop/system/channel.h"
+#include "uevloop/system/containers/application.h"
+#include "uevloop/utils/closure.h"
+#include "../uelt.h"
+
+#define CHANNEL_SIZE_LOG2N  (5)
+#define CHANNEL_SIZE        (1<<CHANNEL_SIZE_LOG2N)
+
+#define DECLARE_CHANNEL()                                                   \
+    static uel_application_t target;                                        \
+    uel_app_init(&target);                                                  \
+    uintptr_t wakeups = 0;                                                  \
+    uel_channel_message_t buffer[CHANNEL_SIZE];                             \
+    uel_channel_t channel;                                                  \
+    uel_channel_init(&channel, buffer, CHANNEL_SIZE_LOG2N, &target,         \
+        uel_closure_create(increment, (void *)&wakeups));
+
+static void *increment(void *context, void *params){
+    uintptr_t *counter = (uintptr_t *)context;
+    (*counter)++;
+    return NULL;
+}
+
+static char *should_init_channel(){
+    DECLARE_CHANNEL();
+
+    uelt_assert_pointers_equal("channel.buffer", buffer, channel.buffer);
+    uelt_assert_ints_equal("channel.mask", CHANNEL_SIZE - 1, channel.mask);
+    uelt_assert_int_zero("channel.head", channel.head);
+    uelt_assert_int_zero("channel.tail", channel.tail);
+    uelt_assert_int_zero("channel.backlog", channel.backlog);
+    uelt_assert_pointers_equal("channel.target", &target, channel.target);
+    uelt_assert_pointers_equal("channel.wakeup.context", &wakeups, channel.wakeup.context);
+    uelt_assert_ints_equal("target.event_loop.observers.count", 2, target.event_loop.observers.count);
+
+    return NULL;
+}
+
+static char *should_deliver_closures(){
+    DECLARE_CHANNEL();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+
+    uelt_assert("send #1", uel_channel_send(&channel, &closure, NULL));
+    uelt_assert_ints_equal("wakeups after first message", 1, wakeups);
+    uelt_assert("send #2", uel_channel_send(&channel, &closure, NULL));
+    uelt_assert("send #3", uel_channel_send(&channel, &closure, NULL));
+    uelt_assert_ints_equal("wakeups after more messages", 1, wakeups);
+    uelt_assert_ints_equal("uel_channel_count", 3, uel_channel_count(&channel));
+
+    uel_app_tick(&target);
+    uelt_assert_int_zero("uel_channel_count after delivery", uel_channel_count(&channel));
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        3,
+        uel_sysqueues_count_enqueued_events(&target.queues)
+    );
+    uelt_assert_int_zero("counter before target runs", counter);
+
+    uel_app_tick(&target);
+    uelt_assert_ints_equal("counter", 3, counter);
+
+    uel_channel_send(&channel, &closure, NULL);
+    uelt_assert_ints_equal("wakeups after channel was emptied", 2, wakeups);
+
+    return NULL;
+}
+
+static char *should_deliver_in_batches(){
+    DECLARE_CHANNEL();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+
+    for(size_t i = 0; i < CHANNEL_SIZE; i++){
+        uelt_assert("send", uel_channel_send(&channel, &closure, NULL));
+    }
+    uelt_assert_not("send when full", uel_channel_send(&channel, &closure, NULL));
+    uelt_assert_ints_equal("wakeups", 1, wakeups);
+
+    uel_app_tick(&target);
+    uelt_assert_ints_equal(
+        "uel_channel_count after first batch",
+        CHANNEL_SIZE - UEL_CHANNEL_BATCH_SIZE,
+        uel_channel_count(&channel)
+    );
+    while(uel_channel_count(&channel) > 0){
+        uel_app_tick(&target);
+    }
+    uel_app_tick(&target);
+    uelt_assert_ints_equal("counter", CHANNEL_SIZE, counter);
+
+    return NULL;
+}
+
+static char *should_emit_signals(){
+    DECLARE_CHANNEL();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+    uel_llist_t relay_buffer[1];
+    uel_signal_relay_t relay;
+    uel_signal_relay_init(&relay, &target.pools, &target.queues, relay_buffer, 1);
+    uel_signal_listen(0, &relay, &closure);
+
+    uelt_assert("emit", uel_channel_emit(&channel, 0, &relay, NULL));
+    uel_app_tick(&target);
+    uel_app_tick(&target);
+    uelt_assert_ints_equal("counter", 1, counter);
+
+    return NULL;
+}
+
+static char *should_close_channel(){
+    DECLARE_CHANNEL();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+
+    uel_channel_close(&channel);
+    uel_channel_send(&channel, &closure, NULL);
+    uel_app_tick(&target);
+    uel_app_tick(&target);
+    uelt_assert_int_zero("counter", counter);
+    uelt_assert_int_zero("target.event_loop.observers.count", target.event_loop.observers.count);
+
+    return NULL;
+}
+
+#define RACE_MESSAGES       (20000)
+// How many times an idle consumer polls for a wakeup before giving up on it
+#define RACE_WAKEUP_SPINS   (1 << 24)
+
+static void *count_wakeup(void *context, void *params){
+    UEL_ATOMIC_FETCH_ADD((volatile uintptr_t *)context, 1, UEL_ATOMIC_RELAXED);
+    return NULL;
+}
+
+typedef struct race race_t;
+struct race {
+    uel_channel_t channel;
+    uintptr_t delivered;
+};
+
+static void *produce(void *arg){
+    race_t *race = (race_t *)arg;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&race->delivered);
+    for(uintptr_t i = 0; i < RACE_MESSAGES; i++){
+        while(!uel_channel_send(&race->channel, &closure, NULL));
+    }
+    return NULL;
+}
+
+static char *should_not_lose_wakeups(){
+    static uel_application_t target;
+    uel_app_init(&target);
+    volatile uintptr_t wakeups = 0;
+    uel_channel_message_t buffer[CHANNEL_SIZE];
+    race_t race;
+    race.delivered = 0;
+    uel_channel_init(&race.channel, buffer, CHANNEL_SIZE_LOG2N, &target,
+        uel_closure_create(count_wakeup, (void *)&wakeups));
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, produce, (void *)&race);
+
+    bool lost = false;
+    while(race.delivered < RACE_MESSAGES){
+        uintptr_t seen = UEL_ATOMIC_LOAD(&wakeups, UEL_ATOMIC_ACQUIRE);
+        uel_app_tick(&target);
+        if(uel_channel_count(&race.channel) != 0) continue;
+        if(uel_sysqueues_count_enqueued_events(&target.queues) != 0) continue;
+        if(race.delivered == RACE_MESSAGES) break;
+
+        // Idle: sleep until woken
+        uintptr_t spins = 0;
+        while(UEL_ATOMIC_LOAD(&wakeups, UEL_ATOMIC_ACQUIRE) == seen){
+            if(++spins == RACE_WAKEUP_SPINS) break;
+            sched_yield();
+        }
+        if(spins == RACE_WAKEUP_SPINS){
+            lost = true;
+            break;
+        }
+    }
+    pthread_join(producer, NULL);
+
+    uelt_assert_not("lost a wakeup", lost);
+    uelt_assert_ints_equal("delivered", RACE_MESSAGES, race.delivered);
+    uelt_assert("wakeups", wakeups <= RACE_MESSAGES);
+
+    return NULL;
+}
+
+char *uel_channel_run_tests(){
+    uelt_run_test("should correctly initialise a channel", should_init_channel);
+    uelt_run_test("should deliver closures to the target application", should_deliver_closures);
+    uelt_run_test("should deliver messages in batches", should_deliver_in_batches);
+    uelt_run_test("should emit signals at the target application", should_emit_signals);
+    uelt_run_test("should stop delivering messages once closed", should_close_channel);
+    uelt_run_test("should not lose wakeups under contention", should_not_lose_wakeups);
+
+    return NULL;
+}
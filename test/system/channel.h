@@ -0,0 +1,6 @@
+#ifndef TEST_CHANNEL_H
+#define TEST_CHANNEL_H
+
+char *uel_channel_run_tests();
+
+#endif /* end of include guard: TEST_CHANNEL_H */
@@ -1,6 +1,7 @@
 #include "application.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include "uevloop/system/containers/application.h"
 #include "uevloop/utils/module.h"
 #include "test/uelt.h"
@@ -117,6 +118,99 @@ static char *should_handle_modules(){
     return NULL;
 }
 
+struct named_module {
+    uel_module_t base;
+    char name;
+};
+static char launch_log[8];
+static size_t launch_count;
+
+static void skip_config(uel_module_t *mod){}
+static void log_launch(uel_module_t *mod){
+    launch_log[launch_count++] = ((struct named_module *)mod)->name;
+}
+
+static void init_named_modules(
+    uel_application_t *app,
+    struct named_module *named,
+    uel_module_t **modules,
+    size_t count
+){
+    launch_count = 0;
+    for(size_t i = 0; i < count; i++){
+        named[i].name = 'a' + i;
+        uel_module_init(&named[i].base, skip_config, log_launch, app);
+        modules[i] = &named[i].base;
+    }
+}
+
+static char *should_launch_modules_after_dependencies(){
+    DECLARE_APP();
+    struct named_module named[5];
+    uel_module_t *modules[5];
+    init_named_modules(&app, named, modules, 5);
+
+    const size_t a_dependencies[] = {1};
+    const size_t b_dependencies[] = {4};
+    const size_t c_dependencies[] = {0};
+    uel_module_set_dependencies(&named[0].base, a_dependencies, 1);
+    uel_module_set_dependencies(&named[1].base, b_dependencies, 1);
+    uel_module_set_dependencies(&named[2].base, c_dependencies, 1);
+    uel_module_set_lazy(&named[3].base, true);
+    uel_module_set_lazy(&named[4].base, true);
+
+    uel_app_load(&app, modules, 5);
+
+    uelt_assert_ints_equal("launch count", 4, launch_count);
+    uelt_assert_int_zero("launch order", memcmp(launch_log, "ebac", 4));
+    uelt_assert_ints_equal("lazy module state", UEL_MODULE_IDLE, named[3].base.state);
+
+    uel_module_t *module = uel_app_require(&app, 3);
+    uelt_assert_pointers_equal("required module", &named[3].base, module);
+    uelt_assert_ints_equal("required module state", UEL_MODULE_LAUNCHED, module->state);
+    uelt_assert_ints_equal("launch count after require", 5, launch_count);
+    uelt_assert_ints_equal("last launched", 'd', launch_log[4]);
+
+    uel_app_require(&app, 3);
+    uel_app_require(&app, 0);
+    uelt_assert_ints_equal("launch count after requiring again", 5, launch_count);
+
+    return NULL;
+}
+
+static char *should_launch_async_modules_concurrently(){
+    DECLARE_APP();
+    struct named_module named[3];
+    uel_module_t *modules[3];
+    init_named_modules(&app, named, modules, 3);
+
+    const size_t c_dependencies[] = {0, 1};
+    uel_module_set_async(&named[0].base, true);
+    uel_module_set_async(&named[1].base, true);
+    uel_module_set_dependencies(&named[2].base, c_dependencies, 2);
+
+    uel_app_load(&app, modules, 3);
+
+    uelt_assert_ints_equal("launch count", 2, launch_count);
+    uelt_assert_ints_equal("a state", UEL_MODULE_LAUNCHING, named[0].base.state);
+    uelt_assert_ints_equal("b state", UEL_MODULE_LAUNCHING, named[1].base.state);
+    uelt_assert_ints_equal("c state", UEL_MODULE_WAITING, named[2].base.state);
+
+    uel_module_launched(&named[1].base);
+    uelt_assert_ints_equal("b state before tick", UEL_MODULE_LAUNCHING, named[1].base.state);
+    uel_app_tick(&app);
+    uelt_assert_ints_equal("b state after tick", UEL_MODULE_LAUNCHED, named[1].base.state);
+    uelt_assert_ints_equal("launch count after b", 2, launch_count);
+
+    uel_module_launched(&named[0].base);
+    uel_app_tick(&app);
+    uelt_assert_ints_equal("launch count after a", 3, launch_count);
+    uelt_assert_int_zero("launch order", memcmp(launch_log, "abc", 3));
+    uelt_assert_ints_equal("c state", UEL_MODULE_LAUNCHED, named[2].base.state);
+
+    return NULL;
+}
+
 static char *should_update_timer(){
     DECLARE_APP();
 
@@ -196,6 +290,51 @@ static char *should_tick(){
     return NULL;
 }
 
+#if UEL_APP_SCRATCH_SIZE > 0
+static uintptr_t *scratch_value;
+static void *use_scratch(void *context, void *params){
+    uel_application_t *app = (uel_application_t *)context;
+    scratch_value = (uintptr_t *)uel_app_scratch_alloc(
+        app,
+        sizeof(uintptr_t),
+        sizeof(uintptr_t)
+    );
+    *scratch_value = (uintptr_t)params;
+    return NULL;
+}
+static char *should_recycle_scratch_memory_every_tick(){
+    DECLARE_APP();
+
+    uelt_assert_pointers_equal("app.scratch.buffer", app.scratch_buffer, app.scratch.buffer);
+    uelt_assert_ints_equal("app.scratch.size", UEL_APP_SCRATCH_SIZE, app.scratch.size);
+
+    uintptr_t *first = (uintptr_t *)uel_app_scratch_alloc(&app, sizeof(uintptr_t), 1);
+    uelt_assert_pointers_equal("first allocation", app.scratch_buffer, first);
+
+    uel_closure_t closure = uel_closure_create(&use_scratch, (void *)&app);
+    uel_app_enqueue_closure(&app, &closure, (void *)42);
+    uel_app_tick(&app);
+    uelt_assert_pointer_not_null("allocation during tick", scratch_value);
+    uelt_assert_int_zero("alignment", (uintptr_t)scratch_value % sizeof(uintptr_t));
+    uelt_assert_ints_equal("scratch value", 42, *scratch_value);
+    uelt_assert_int_zero("app.scratch.used after tick", app.scratch.used);
+    uelt_assert_ints_equal(
+        "app.scratch.peak",
+        (uint8_t *)scratch_value - app.scratch_buffer + sizeof(uintptr_t),
+        app.scratch.peak
+    );
+
+    uintptr_t *recycled = (uintptr_t *)uel_app_scratch_alloc(&app, sizeof(uintptr_t), 1);
+    uelt_assert_pointers_equal("allocation after tick", app.scratch_buffer, recycled);
+    uelt_assert_pointer_null(
+        "oversized allocation",
+        uel_app_scratch_alloc(&app, UEL_APP_SCRATCH_SIZE, 1)
+    );
+
+    return NULL;
+}
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
+
 static void *nop(void *context, void *params){
     return NULL;
 }
@@ -265,6 +404,14 @@ char *uel_app_run_tests(){
 
     uelt_run_test("should correctly initialise an application", should_init_app);
     uelt_run_test("should correctly handle modules", should_handle_modules);
+    uelt_run_test(
+        "should launch modules after their dependencies",
+        should_launch_modules_after_dependencies
+    );
+    uelt_run_test(
+        "should launch asynchronous modules concurrently",
+        should_launch_async_modules_concurrently
+    );
     uelt_run_test(
         "should correctly update an application internal timer",
         should_update_timer
@@ -277,6 +424,12 @@ char *uel_app_run_tests(){
         "should correctly tick an application event loop and operate accordingly",
         should_tick
     );
+#if UEL_APP_SCRATCH_SIZE > 0
+    uelt_run_test(
+        "should recycle scratch memory at the end of every tick",
+        should_recycle_scratch_memory_every_tick
+    );
+#endif /* UEL_APP_SCRATCH_SIZE > 0 */
     uelt_run_test(
         "should correctly proxy scheduler and event loop functions",
         should_proxy_functions
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 
 #include "uevloop/system/containers/system-pools.h"
+#include "uevloop/portability/critical-section.h"
 #include "../../uelt.h"
 
 static char *should_init_syspools(){
@@ -25,9 +26,9 @@ static char *should_init_syspools(){
         pools.event_pool.queue.size
     );
     uelt_assert_ints_equal(
-        "pool.queue.count",
+        "uel_objpool_count_available(event_pool)",
         UEL_SYSPOOLS_EVENT_POOL_SIZE,
-        pools.event_pool.queue.count
+        uel_objpool_count_available(&pools.event_pool)
     );
     uelt_assert_pointers_equal(
         "llist_node_pool.buffer",
@@ -45,9 +46,9 @@ static char *should_init_syspools(){
         pools.llist_node_pool.queue.size
     );
     uelt_assert_ints_equal(
-        "llist_node_pool.queue.count",
+        "uel_objpool_count_available(llist_node_pool)",
         UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE,
-        pools.llist_node_pool.queue.count
+        uel_objpool_count_available(&pools.llist_node_pool)
     );
 
     return NULL;
@@ -82,10 +83,29 @@ static char *should_release_objects(){
     return NULL;
 }
 
+static char *should_lock_each_pool_independently(){
+    uel_syspools_t pools;
+    uel_syspools_init(&pools);
+
+    // With a lock backend, sharing a lock between pools would deadlock here
+    UEL_CRITICAL_ENTER_ON(&pools.llist_node_pool.lock);
+    uel_event_t *event = uel_syspools_acquire_event(&pools);
+    UEL_CRITICAL_EXIT_ON(&pools.llist_node_pool.lock);
+    uelt_assert_pointer_not_null("acquired event must not be null", event);
+
+    UEL_CRITICAL_ENTER_ON(&pools.event_pool.lock);
+    uel_llist_node_t *node = uel_syspools_acquire_llist_node(&pools);
+    UEL_CRITICAL_EXIT_ON(&pools.event_pool.lock);
+    uelt_assert_pointer_not_null("acquired llist node must not be null", node);
+
+    return NULL;
+}
+
 char *uel_syspools_run_tests(){
     uelt_run_test("should correctly initiase system pools", should_init_syspools);
     uelt_run_test("should correctly acquire objects", should_acquire_objects);
     uelt_run_test("should correctly release objects", should_release_objects);
+    uelt_run_test("should lock each pool independently", should_lock_each_pool_independently);
 
     return NULL;
 }
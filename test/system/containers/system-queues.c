@@ -3,6 +3,7 @@
 #include <stdlib.h>
 
 #include "uevloop/system/containers/system-queues.h"
+#include "uevloop/portability/critical-section.h"
 #include "../../uelt.h"
 
 static char *should_init_sysqueues(){
@@ -34,7 +35,7 @@ static char *should_manipulate_the_event_queue(){
     uel_event_t events[3];
     uel_event_config_closure(&events[0], &closure, (void *)&queues, false);
     uel_event_config_timer(&events[1], 10, false, false, &closure, (void *)&queues, 0);
-    uel_event_config_signal(&events[2], 0, NULL, NULL);
+    uel_event_config_signal(&events[2], 0, NULL, NULL, NULL);
 
     uel_sysqueues_enqueue_event(&queues, &events[0]);
     uelt_assert_ints_equal(
@@ -90,7 +91,7 @@ static char *should_manipulate_the_schedule_queue(){
     uel_event_t events[3];
     uel_event_config_closure(&events[0], &closure, (void *)&queues, false);
     uel_event_config_timer(&events[1], 10, false, false, &closure, (void *)&queues, 0);
-    uel_event_config_signal(&events[2], 0, NULL, NULL);
+    uel_event_config_signal(&events[2], 0, NULL, NULL, NULL);
 
     uel_sysqueues_schedule_event(&queues, &events[2]);
     uelt_assert_ints_equal(
@@ -138,6 +139,75 @@ static char *should_manipulate_the_schedule_queue(){
     return NULL;
 }
 
+static char *should_move_events_in_bulk(){
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_event_t events[3];
+    uel_event_t *pointers[3] = { &events[0], &events[1], &events[2] };
+    uel_event_t *popped[3];
+    for(size_t i = 0; i < 3; i++){
+        uel_event_config_closure(&events[i], &closure, NULL, false);
+    }
+
+    uelt_assert_ints_equal("enqueued", 3, uel_sysqueues_enqueue_events(&queues, pointers, 3));
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        3,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uelt_assert_ints_equal("popped", 3, uel_sysqueues_get_enqueued_events(&queues, popped, 3));
+    uelt_assert_pointers_equal("popped[0]", &events[0], popped[0]);
+    uelt_assert_pointers_equal("popped[2]", &events[2], popped[2]);
+
+    uelt_assert_ints_equal("scheduled", 2, uel_sysqueues_schedule_events(&queues, pointers, 2));
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_scheduled_events",
+        2,
+        uel_sysqueues_count_scheduled_events(&queues)
+    );
+    uelt_assert_ints_equal("popped", 2, uel_sysqueues_get_scheduled_events(&queues, popped, 3));
+    uelt_assert_pointers_equal("popped[1]", &events[1], popped[1]);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_scheduled_events",
+        uel_sysqueues_count_scheduled_events(&queues)
+    );
+
+    return NULL;
+}
+
+static char *should_lock_each_queue_independently(){
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_event_t event;
+    uel_event_config_closure(&event, &closure, NULL, false);
+
+    // With a lock backend, sharing a lock between queues would deadlock here
+    UEL_CRITICAL_ENTER_ON(&queues.schedule_queue_lock);
+    uel_sysqueues_enqueue_event(&queues, &event);
+    UEL_CRITICAL_EXIT_ON(&queues.schedule_queue_lock);
+
+    UEL_CRITICAL_ENTER_ON(&queues.event_queue_lock);
+    uel_sysqueues_schedule_event(&queues, &event);
+    UEL_CRITICAL_EXIT_ON(&queues.event_queue_lock);
+
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        1,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_scheduled_events",
+        1,
+        uel_sysqueues_count_scheduled_events(&queues)
+    );
+
+    return NULL;
+}
+
 char *uel_sysqueues_run_tests(){
 
     uelt_run_test("should correctly initialise a new sysqueues", should_init_sysqueues);
@@ -149,6 +219,14 @@ char *uel_sysqueues_run_tests(){
         "should correctly manipulate the schedule queue",
         should_manipulate_the_schedule_queue
     );
+    uelt_run_test(
+        "should correctly move events in bulk",
+        should_move_events_in_bulk
+    );
+    uelt_run_test(
+        "should lock each queue independently",
+        should_lock_each_queue_independently
+    );
 
     return NULL;
 }
@@ -0,0 +1,236 @@
+#include "workgroup.h"
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include "uevloop/system/containers/workgroup.h"
+#include "uevloop/portability/atomic.h"
+#include "test/uelt.h"
+
+#define WORKER_COUNT    (3)
+
+#define DECLARE_WORKGROUP()                                 \
+    static uel_worker_t workers[WORKER_COUNT];              \
+    static uel_workgroup_t group;                           \
+    uel_workgroup_init(&group, workers, WORKER_COUNT);
+
+static void *increment(void *context, void *params){
+    uintptr_t *counter = (uintptr_t *)context;
+    (*counter)++;
+    return NULL;
+}
+
+static char *should_init_workgroup(){
+    DECLARE_WORKGROUP();
+
+    uelt_assert_pointers_equal("group.workers", workers, group.workers);
+    uelt_assert_ints_equal("group.count", WORKER_COUNT, group.count);
+    uelt_assert_int_zero("group.inject_queue.count", group.inject_queue.count);
+    for(size_t i = 0; i < WORKER_COUNT; i++){
+        uelt_assert_pointers_equal(
+            "uel_workgroup_app",
+            &workers[i].app,
+            uel_workgroup_app(&group, i)
+        );
+        uelt_assert_pointers_equal(
+            "workers[i].deque.buffer",
+            workers[i].deque_buffer,
+            workers[i].deque.buffer
+        );
+        uelt_assert_int_zero("uel_wsdeque_count", uel_wsdeque_count(&workers[i].deque));
+    }
+
+    return NULL;
+}
+
+static char *should_run_spawned_closures_locally(){
+    DECLARE_WORKGROUP();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+
+    uel_workgroup_spawn(&group, 0, &closure, NULL);
+    uel_workgroup_spawn(&group, 0, &closure, NULL);
+    uelt_assert_ints_equal("uel_wsdeque_count", 2, uel_wsdeque_count(&workers[0].deque));
+
+    uelt_assert("tick must report work", uel_workgroup_tick(&group, 0));
+    uelt_assert_ints_equal("counter", 2, counter);
+    uelt_assert_not("tick must not report work", uel_workgroup_tick(&group, 0));
+    uelt_assert_ints_equal(
+        "uel_objpool_count_available(workers[0].app.pools.event_pool)",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE,
+        uel_objpool_count_available(&workers[0].app.pools.event_pool)
+    );
+
+    return NULL;
+}
+
+static char *should_steal_closures_from_other_workers(){
+    DECLARE_WORKGROUP();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+
+    uel_workgroup_spawn(&group, 0, &closure, NULL);
+    uel_workgroup_spawn(&group, 0, &closure, NULL);
+
+    uelt_assert("worker 1 must steal", uel_workgroup_tick(&group, 1));
+    uelt_assert_ints_equal("counter", 1, counter);
+    uelt_assert("worker 2 must steal", uel_workgroup_tick(&group, 2));
+    uelt_assert_ints_equal("counter", 2, counter);
+    uelt_assert_not("worker 1 must find no work", uel_workgroup_tick(&group, 1));
+    uelt_assert_ints_equal(
+        "uel_objpool_count_available(workers[0].app.pools.event_pool)",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE,
+        uel_objpool_count_available(&workers[0].app.pools.event_pool)
+    );
+
+    return NULL;
+}
+
+static char *should_run_injected_closures_anywhere(){
+    DECLARE_WORKGROUP();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+
+    uelt_assert(
+        "enqueue must succeed",
+        uel_workgroup_enqueue_closure(&group, &closure, NULL, UEL_WORKGROUP_ANY)
+    );
+    uelt_assert_ints_equal("group.inject_queue.count", 1, group.inject_queue.count);
+
+    uelt_assert("worker 2 must run the closure", uel_workgroup_tick(&group, 2));
+    uelt_assert_ints_equal("counter", 1, counter);
+    uelt_assert_int_zero("group.inject_queue.count", group.inject_queue.count);
+
+    for(size_t i = 0; i < UEL_WORKGROUP_INJECT_QUEUE_SIZE; i++){
+        uel_workgroup_enqueue_closure(&group, &closure, NULL, UEL_WORKGROUP_ANY);
+    }
+    uelt_assert_not(
+        "enqueue must fail when the injection queue is full",
+        uel_workgroup_enqueue_closure(&group, &closure, NULL, UEL_WORKGROUP_ANY)
+    );
+
+    return NULL;
+}
+
+static char *should_honour_affinity(){
+    DECLARE_WORKGROUP();
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(increment, (void *)&counter);
+
+    uel_workgroup_enqueue_closure(&group, &closure, NULL, 1);
+    uelt_assert_int_zero("uel_wsdeque_count", uel_wsdeque_count(&workers[1].deque));
+
+    uel_workgroup_tick(&group, 0);
+    uel_workgroup_tick(&group, 2);
+    uelt_assert_int_zero("counter after ticking other workers", counter);
+
+    uelt_assert_not("pinned closures are not shareable", uel_workgroup_tick(&group, 1));
+    uelt_assert_ints_equal("counter", 1, counter);
+
+    return NULL;
+}
+
+typedef struct respawn respawn_t;
+struct respawn {
+    uel_workgroup_t *group;
+    uintptr_t runs;
+};
+
+static void *respawn(void *context, void *params){
+    respawn_t *state = (respawn_t *)context;
+    state->runs++;
+    uel_closure_t closure = uel_closure_create(respawn, context);
+    uel_workgroup_spawn(state->group, 0, &closure, NULL);
+    return NULL;
+}
+
+static char *should_defer_closures_spawned_during_tick(){
+    DECLARE_WORKGROUP();
+    respawn_t state = { &group, 0 };
+    uel_closure_t closure = uel_closure_create(respawn, (void *)&state);
+
+    uel_workgroup_spawn(&group, 0, &closure, NULL);
+    uelt_assert("tick must report work", uel_workgroup_tick(&group, 0));
+    uelt_assert_ints_equal("runs after first tick", 1, state.runs);
+    uelt_assert("tick must report work", uel_workgroup_tick(&group, 0));
+    uelt_assert_ints_equal("runs after second tick", 2, state.runs);
+    uelt_assert_ints_equal("uel_wsdeque_count", 1, uel_wsdeque_count(&workers[0].deque));
+
+    return NULL;
+}
+
+#define RACE_TASKS      (20000)
+
+typedef struct race race_t;
+struct race {
+    uel_workgroup_t *group;
+    volatile bool done;
+    // How many times each task was run, by any worker
+    volatile uintptr_t runs[RACE_TASKS];
+};
+
+static race_t race;
+
+static void *run_race_task(void *context, void *params){
+    UEL_ATOMIC_FETCH_ADD(&race.runs[(uintptr_t)params], 1, UEL_ATOMIC_RELAXED);
+    return NULL;
+}
+
+static void *tick_worker(void *arg){
+    size_t id = (size_t)arg;
+    while(!UEL_ATOMIC_LOAD(&race.done, UEL_ATOMIC_ACQUIRE)){
+        if(!uel_workgroup_tick(race.group, id)) sched_yield();
+    }
+    return NULL;
+}
+
+static char *should_run_each_closure_once_under_contention(){
+    DECLARE_WORKGROUP();
+    race.group = &group;
+    race.done = false;
+    for(uintptr_t i = 0; i < RACE_TASKS; i++) race.runs[i] = 0;
+
+    pthread_t threads[WORKER_COUNT - 1];
+    for(size_t i = 1; i < WORKER_COUNT; i++){
+        pthread_create(&threads[i - 1], NULL, tick_worker, (void *)i);
+    }
+
+    // Worker 0 keeps its deque short, so it often pops its last closure while
+    // the other workers try to steal it
+    uel_closure_t closure = uel_closure_create(run_race_task, NULL);
+    for(uintptr_t i = 0; i < RACE_TASKS; i++){
+        uel_workgroup_spawn(&group, 0, &closure, (void *)i);
+        if(i % 2 == 1) uel_workgroup_tick(&group, 0);
+    }
+    while(uel_wsdeque_count(&workers[0].deque) > 0){
+        uel_workgroup_tick(&group, 0);
+    }
+    UEL_ATOMIC_STORE(&race.done, true, UEL_ATOMIC_RELEASE);
+    for(size_t i = 1; i < WORKER_COUNT; i++){
+        pthread_join(threads[i - 1], NULL);
+    }
+
+    for(uintptr_t i = 0; i < RACE_TASKS; i++){
+        uelt_assert_ints_equal("times run", 1, race.runs[i]);
+    }
+    uelt_assert_ints_equal(
+        "uel_objpool_count_available(workers[0].app.pools.event_pool)",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE,
+        uel_objpool_count_available(&workers[0].app.pools.event_pool)
+    );
+
+    return NULL;
+}
+
+char *uel_workgroup_run_tests(){
+    uelt_run_test("should correctly initialise a workgroup", should_init_workgroup);
+    uelt_run_test("should run spawned closures at the spawning worker", should_run_spawned_closures_locally);
+    uelt_run_test("should steal closures from other workers", should_steal_closures_from_other_workers);
+    uelt_run_test("should run injected closures at any worker", should_run_injected_closures_anywhere);
+    uelt_run_test("should only run pinned closures at their worker", should_honour_affinity);
+    uelt_run_test("should defer closures spawned during a tick", should_defer_closures_spawned_during_tick);
+    uelt_run_test("should run each closure once under contention", should_run_each_closure_once_under_contention);
+
+    return NULL;
+}
@@ -0,0 +1,6 @@
+#ifndef TEST_WORKGROUP_H
+#define TEST_WORKGROUP_H
+
+char *uel_workgroup_run_tests();
+
+#endif /* end of include guard: TEST_WORKGROUP_H */
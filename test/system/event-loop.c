@@ -139,9 +139,9 @@ static char *should_handle_paused_and_cancelled_timers(){
     );
     uelt_assert_not("flag", flag);
     uelt_assert_ints_equal(
-        "pools.event_pool.queue.count",
+        "uel_objpool_count_available(pools.event_pool)",
         UEL_SYSPOOLS_EVENT_POOL_SIZE - 1,
-        pools.event_pool.queue.count
+        uel_objpool_count_available(&pools.event_pool)
     );
 
     return NULL;
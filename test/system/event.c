@@ -60,6 +60,23 @@ static char *should_config_timer_event(){
         UEL_TIMER_RUNNING,
         event.detail.timer.status
     );
+    uelt_assert_int_zero("event.detail.timer.slack", event.detail.timer.slack);
+    uelt_assert_ints_equal(
+        "event.detail.timer.overrun",
+        UEL_TIMER_CATCH_UP,
+        event.detail.timer.overrun
+    );
+    uelt_assert_int_zero("uel_event_timer_get_missed", uel_event_timer_get_missed(&event));
+
+    uel_event_timer_set_overrun(&event, UEL_TIMER_SKIP);
+    uelt_assert_ints_equal(
+        "event.detail.timer.overrun",
+        UEL_TIMER_SKIP,
+        event.detail.timer.overrun
+    );
+
+    uel_event_timer_set_slack(&event, 20);
+    uelt_assert_ints_equal("event.detail.timer.slack", 20, event.detail.timer.slack);
 
     uel_event_timer_pause(&event);
     uelt_assert_ints_equal(
@@ -93,11 +110,12 @@ static char *should_config_signal_event(){
     uel_event_t event;
     uel_closure_t closure = uel_closure_create(&nop, NULL);
     uel_llist_t listeners[SIGNAL_MAX];
+    uel_lock_t lock;
 
     for (size_t i = 0; i < SIGNAL_MAX; i++) {
         uel_llist_init(&listeners[i]);
     }
-    uel_event_config_signal(&event, SIGNAL_0, listeners, (void *)&closure);
+    uel_event_config_signal(&event, SIGNAL_0, listeners, &lock, (void *)&closure);
     uelt_assert_ints_equal("event.type", UEL_SIGNAL_EVENT, event.type);
     uelt_assert_ints_equal(
         "event.detail.signal.value",
@@ -109,6 +127,7 @@ static char *should_config_signal_event(){
         &listeners,
         event.detail.signal.listeners
     );
+    uelt_assert_pointers_equal("event.detail.signal.lock", &lock, event.detail.signal.lock);
     uelt_assert_pointers_equal("event.value", &closure, event.value);
 
     return NULL;
@@ -0,0 +1,88 @@
+#include "latency.h"
+
+#include <stdlib.h>
+
+#include "uevloop/system/latency.h"
+#include "uevloop/system/containers/application.h"
+#include "uevloop/utils/clock.h"
+#include "uevloop/utils/closure.h"
+#include "../uelt.h"
+
+static void *read_clock(void *context, void *params){
+    return (void *)*(uintptr_t *)context;
+}
+
+static void *advance_clock(void *context, void *params){
+    uintptr_t *clock = (uintptr_t *)context;
+    *clock += (uintptr_t)params;
+    return NULL;
+}
+
+static char *should_record_queueing_delay(){
+    static uel_application_t app;
+    uel_latency_t latency;
+    uintptr_t clock = 1000;
+    uel_app_init(&app);
+    uel_latency_init(&latency);
+    uel_app_set_latency(&app, &latency);
+    uel_clock_set_source(uel_closure_create(read_clock, (void *)&clock));
+
+    uel_closure_t advance = uel_closure_create(advance_clock, (void *)&clock);
+    uel_app_enqueue_closure(&app, &advance, (void *)5);
+    clock += 10;
+    uel_app_enqueue_closure(&app, &advance, (void *)0);
+    clock += 2;
+    uel_app_tick(&app);
+
+    uel_histogram_t *closures = &latency.queueing_delay[UEL_CLOSURE_EVENT];
+    uelt_assert_ints_equal("closure delays recorded", 2, closures->count);
+    uelt_assert_ints_equal("longest delay", 12, closures->max);
+    // The second closure waited for the first one to run
+    uelt_assert_ints_equal("shortest delay", 7, closures->min);
+    uelt_assert_int_zero(
+        "timer delays recorded",
+        latency.queueing_delay[UEL_TIMER_EVENT].count
+    );
+
+    uel_clock_set_source(uel_closure_create(NULL, NULL));
+    return NULL;
+}
+
+static char *should_record_timer_lateness(){
+    static uel_application_t app;
+    uel_latency_t latency;
+    uel_app_init(&app);
+    uel_latency_init(&latency);
+    uel_app_set_latency(&app, &latency);
+
+    uel_app_run_later(&app, 10, uel_nop(), NULL);
+    uel_app_run_at_intervals(&app, 5, false, uel_nop(), NULL);
+    uel_app_tick(&app);
+
+    uel_app_update_timer(&app, 13);
+    uel_app_tick(&app);
+
+    uel_histogram_t *lateness = &latency.timer_lateness;
+    uelt_assert_ints_equal("lateness recorded", 2, lateness->count);
+    uelt_assert_ints_equal("lateness.min", 3, lateness->min);
+    uelt_assert_ints_equal("lateness.max", 8, lateness->max);
+    uelt_assert_ints_equal(
+        "timer delays recorded",
+        2,
+        latency.queueing_delay[UEL_TIMER_EVENT].count
+    );
+
+    uel_app_set_latency(&app, NULL);
+    uel_app_update_timer(&app, 20);
+    uel_app_tick(&app);
+    uelt_assert_ints_equal("lateness after detaching", 2, lateness->count);
+
+    return NULL;
+}
+
+char *uel_latency_run_tests(){
+    uelt_run_test("should record queueing delay of events", should_record_queueing_delay);
+    uelt_run_test("should record lateness of timers", should_record_timer_lateness);
+
+    return NULL;
+}
@@ -0,0 +1,6 @@
+#ifndef TEST_LATENCY_H
+#define TEST_LATENCY_H
+
+char *uel_latency_run_tests();
+
+#endif /* end of include guard: TEST_LATENCY_H */
@@ -0,0 +1,169 @@
+#include "parallel-iterator.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "uevloop/system/parallel-iterator.h"
+#include "uevloop/system/containers/workgroup.h"
+#include "uevloop/utils/iterator.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/portability/atomic.h"
+#include "uevloop/portability/lock.h"
+#include "../uelt.h"
+
+#define WORKER_COUNT    (3)
+#define ITEM_COUNT      (1000)
+#define CHUNK_SIZE      (16)
+
+static uintptr_t items[ITEM_COUNT];
+static void *results[ITEM_COUNT];
+
+#define DECLARE_PAR()                                                       \
+    static uel_worker_t workers[WORKER_COUNT];                              \
+    static uel_workgroup_t group;                                           \
+    static uel_iterator_par_t par;                                          \
+    uel_workgroup_init(&group, workers, WORKER_COUNT);                      \
+    uel_iterator_par_init(&par, &group, CHUNK_SIZE);                        \
+    for(size_t i = 0; i < ITEM_COUNT; i++) items[i] = i;                    \
+    uel_iterator_array_t iterator =                                         \
+        uel_iterator_array_create(items, ITEM_COUNT, sizeof(uintptr_t));
+
+static void *double_item(void *context, void *params){
+    return (void *)(*(uintptr_t *)params * 2);
+}
+
+static void *is_multiple(void *context, void *params){
+    uintptr_t divisor = (uintptr_t)context;
+    return (void *)(uintptr_t)(*(uintptr_t *)params % divisor == 0);
+}
+
+static void *equals(void *context, void *params){
+    return (void *)(uintptr_t)(*(uintptr_t *)params == (uintptr_t)context);
+}
+
+static char *check_operations(uel_iterator_par_t *par, uel_iterator_array_t *iterator){
+    uel_closure_t doubler = uel_closure_create(double_item, NULL);
+    size_t mapped = uel_iterator_par_map(par, iterator, &doubler, results, ITEM_COUNT);
+    uelt_assert_ints_equal("mapped elements", ITEM_COUNT, mapped);
+    for(size_t i = 0; i < ITEM_COUNT; i++){
+        uelt_assert_ints_equal("mapped value", i * 2, (uintptr_t)results[i]);
+    }
+    mapped = uel_iterator_par_map(par, iterator, &doubler, results, 10);
+    uelt_assert_ints_equal("mapped elements up to limit", 10, mapped);
+
+    uel_closure_t multiple_of_three = uel_closure_create(is_multiple, (void *)3);
+    uelt_assert_ints_equal(
+        "count of multiples of three",
+        (ITEM_COUNT + 2) / 3,
+        uel_iterator_par_count(par, iterator, &multiple_of_three)
+    );
+
+    uel_closure_t multiple_of_seven = uel_closure_create(is_multiple, (void *)7);
+    uel_closure_t is_seven_hundred = uel_closure_create(equals, (void *)700);
+    uel_closure_t is_missing = uel_closure_create(equals, (void *)ITEM_COUNT);
+    uel_closure_t multiple_of_large = uel_closure_create(is_multiple, (void *)450);
+    uelt_assert_pointers_equal(
+        "first multiple of seven",
+        &items[0],
+        uel_iterator_par_find(par, iterator, &multiple_of_seven)
+    );
+    uelt_assert_pointers_equal(
+        "element seven hundred",
+        &items[700],
+        uel_iterator_par_find(par, iterator, &is_seven_hundred)
+    );
+    uelt_assert_pointer_null(
+        "missing element",
+        uel_iterator_par_find(par, iterator, &is_missing)
+    );
+    uelt_assert("must find a multiple of 450", uel_iterator_par_any(par, iterator, &multiple_of_large));
+    uelt_assert_not("must not find a missing element", uel_iterator_par_any(par, iterator, &is_missing));
+
+    return NULL;
+}
+
+static char *should_init_par(){
+    DECLARE_PAR();
+    (void)iterator;
+
+    uelt_assert_pointers_equal("par.group", &group, par.group);
+    uelt_assert_ints_equal("par.chunk_size", CHUNK_SIZE, par.chunk_size);
+    uelt_assert_pointers_equal("par.helper.context", &par, par.helper.context);
+
+    uel_iterator_par_init(&par, &group, 0);
+    uelt_assert_ints_equal("default chunk size", UEL_ITERATOR_PAR_CHUNK_SIZE, par.chunk_size);
+
+    return NULL;
+}
+
+static char *should_run_operations_on_calling_thread(){
+    DECLARE_PAR();
+
+    // Workers are not ticked, so the calling thread runs every chunk alone
+    char *result = check_operations(&par, &iterator);
+    if(result != NULL) return result;
+
+    // Helpers left over in the workgroup find nothing to do
+    for(size_t i = 0; i < WORKER_COUNT; i++){
+        while(uel_workgroup_tick(&group, i));
+    }
+    uelt_assert_int_zero("pending chunks", par.pending);
+
+    return NULL;
+}
+
+#ifdef UEL_LOCK_BACKEND
+typedef struct worker_context worker_context_t;
+struct worker_context {
+    uel_workgroup_t *group;
+    size_t id;
+    volatile uintptr_t *stop;
+};
+
+static void *tick_worker(void *arg){
+    worker_context_t *context = (worker_context_t *)arg;
+    while(!UEL_ATOMIC_LOAD(context->stop, UEL_ATOMIC_ACQUIRE)){
+        if(!uel_workgroup_tick(context->group, context->id)) UEL_LOCK_RELAX();
+    }
+    return NULL;
+}
+
+static char *should_run_operations_across_workers(){
+    DECLARE_PAR();
+    volatile uintptr_t stop = 0;
+    pthread_t threads[WORKER_COUNT];
+    worker_context_t contexts[WORKER_COUNT];
+    for(size_t i = 0; i < WORKER_COUNT; i++){
+        contexts[i] = (worker_context_t){ &group, i, &stop };
+        pthread_create(&threads[i], NULL, tick_worker, (void *)&contexts[i]);
+    }
+
+    char *result = NULL;
+    for(size_t round = 0; round < 20 && result == NULL; round++){
+        result = check_operations(&par, &iterator);
+    }
+
+    UEL_ATOMIC_STORE(&stop, 1, UEL_ATOMIC_RELEASE);
+    for(size_t i = 0; i < WORKER_COUNT; i++){
+        pthread_join(threads[i], NULL);
+    }
+    return result;
+}
+#endif /* UEL_LOCK_BACKEND */
+
+char *uel_iterator_par_run_tests(){
+    uelt_run_test("should initialise parallel runner", should_init_par);
+    uelt_run_test(
+        "should run operations on the calling thread",
+        should_run_operations_on_calling_thread
+    );
+#ifdef UEL_LOCK_BACKEND
+    uelt_run_test(
+        "should run operations across workers",
+        should_run_operations_across_workers
+    );
+#endif /* UEL_LOCK_BACKEND */
+
+    return NULL;
+}
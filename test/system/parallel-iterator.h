@@ -0,0 +1,6 @@
+#ifndef TEST_PARALLEL_ITERATOR_H
+#define TEST_PARALLEL_ITERATOR_H
+
+char *uel_iterator_par_run_tests();
+
+#endif /* end of include guard: TEST_PARALLEL_ITERATOR_H */
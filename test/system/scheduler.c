@@ -1,3 +1,6 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif /* _POSIX_C_SOURCE */
 #include "scheduler.h"
 
 #include <stdlib.h>
@@ -7,6 +10,8 @@
 #include "uevloop/system/containers/system-queues.h"
 #include "uevloop/system/scheduler.h"
 #include "uevloop/system/event-loop.h"
+#include "uevloop/system/time.h"
+#include "uevloop/portability/posix-clock.h"
 #include "../uelt.h"
 
 #define DECLARE_SCHEDULER()                                                    \
@@ -331,6 +336,224 @@ static char *should_handle_timer_statuses(){
     return NULL;
 }
 
+static char *should_coalesce_timers_within_slack(){
+    DECLARE_SCHEDULER();
+    uint32_t counter = 0;
+    uel_closure_t do_nothing = uel_closure_create(nop, NULL);
+
+    uel_event_t *anchor =
+        uel_sch_run_at_intervals(&scheduler, 100, false, do_nothing, NULL);
+    uel_event_t *near =
+        uel_sch_run_at_intervals(&scheduler, 95, false, do_nothing, NULL);
+    uel_event_t *far =
+        uel_sch_run_at_intervals(&scheduler, 80, false, do_nothing, NULL);
+    uel_event_t *strict =
+        uel_sch_run_later(&scheduler, 97, do_nothing, NULL);
+    uel_event_timer_set_slack(near, 10);
+    uel_event_timer_set_slack(far, 10);
+    uel_sch_manage_timers(&scheduler);
+
+    uelt_assert_ints_equal("anchor due time", 100, anchor->detail.timer.due_time);
+    uelt_assert_ints_equal("near due time", 95, near->detail.timer.due_time);
+    uelt_assert_ints_equal("near expiration", 100, near->detail.timer.expires_at);
+    uelt_assert_ints_equal("far due time", 80, far->detail.timer.due_time);
+    uelt_assert_ints_equal("strict due time", 97, strict->detail.timer.due_time);
+
+    fast_forward(&scheduler, &counter, 99);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal(
+        "enqueued events before the batch",
+        2,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    fast_forward(&scheduler, &counter, 1);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal(
+        "enqueued events after the batch",
+        4,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    return NULL;
+}
+
+typedef struct expirations expirations_t;
+struct expirations {
+    uel_scheduer_t *scheduler;
+    uintptr_t count;
+    uel_time_t times[20];
+};
+
+static void *record_expiration(void *context, void *params){
+    expirations_t *expirations = (expirations_t *)context;
+    expirations->times[expirations->count++] = expirations->scheduler->timer;
+    return NULL;
+}
+
+static char *should_keep_slack_timers_on_their_period(){
+    DECLARE_SCHEDULER();
+    uel_evloop_t loop;
+    uel_evloop_init(&loop, &pools, &queues);
+    uint32_t counter = 0;
+    expirations_t expirations = { &scheduler, 0, {0} };
+
+    uel_event_t *sampler = uel_sch_run_at_intervals(
+        &scheduler,
+        100,
+        false,
+        uel_closure_create(record_expiration, (void *)&expirations),
+        NULL
+    );
+    uel_event_timer_set_slack(sampler, 10);
+    operate(&scheduler, &loop);
+
+    // The neighbour is due 7 ticks after every third expiration of the sampler
+    fast_forward(&scheduler, &counter, 7);
+    uel_sch_run_at_intervals(&scheduler, 150, false, uel_closure_create(nop, NULL), NULL);
+
+    while(expirations.count < 20){
+        operate(&scheduler, &loop);
+        fast_forward(&scheduler, &counter, 1);
+    }
+
+    for(uintptr_t i = 0; i < 20; i++){
+        uel_time_t nominal = (i + 1) * 100;
+        uelt_assert("expiration not early", expirations.times[i] >= nominal);
+        uelt_assert("expiration within slack", expirations.times[i] <= nominal + 10);
+    }
+    uelt_assert_ints_equal("times coalesced", 307, expirations.times[2]);
+    uelt_assert_ints_equal("sampler due time", 2100, sampler->detail.timer.due_time);
+
+    return NULL;
+}
+
+static void *count_execution(void *context, void *params){
+    uint32_t *executions = (uint32_t *)context;
+    (*executions)++;
+    return NULL;
+}
+
+static void *count_coalesced_execution(void *context, void *params){
+    uint32_t *executions = (uint32_t *)context;
+    uel_event_t *timer = *(uel_event_t **)params;
+    *executions += 1 + uel_event_timer_get_missed(timer);
+    return NULL;
+}
+
+static char *should_apply_overrun_policies(){
+    DECLARE_SCHEDULER();
+    uint32_t timer = 0;
+    uel_evloop_t loop;
+    uel_evloop_init(&loop, &pools, &queues);
+
+    uint32_t caught_up = 0, skipped = 0, coalesced = 0;
+    uel_event_t *coalescer = NULL;
+    uel_sch_run_at_intervals(&scheduler, 10, false,
+        uel_closure_create(count_execution, (void *)&caught_up), NULL);
+    uel_event_t *skipper = uel_sch_run_at_intervals(&scheduler, 10, false,
+        uel_closure_create(count_execution, (void *)&skipped), NULL);
+    coalescer = uel_sch_run_at_intervals(&scheduler, 10, false,
+        uel_closure_create(count_coalesced_execution, (void *)&coalesced),
+        (void *)&coalescer);
+    uel_event_timer_set_overrun(skipper, UEL_TIMER_SKIP);
+    uel_event_timer_set_overrun(coalescer, UEL_TIMER_COALESCE);
+    operate(&scheduler, &loop);
+
+    // The application stalls for three and a half periods
+    fast_forward(&scheduler, &timer, 45);
+    for(int i = 0; i < 5; i++) operate(&scheduler, &loop);
+
+    uelt_assert_ints_equal("catch-up executions", 4, caught_up);
+    uelt_assert_ints_equal("skip executions", 1, skipped);
+    uelt_assert_ints_equal("skip due time", 50, skipper->detail.timer.due_time);
+    uelt_assert_ints_equal("skip missed", 3, uel_event_timer_get_missed(skipper));
+    // Runs once, standing for the periods at 10, 20, 30 and 40
+    uelt_assert_ints_equal("coalesced periods", 4, coalesced);
+    uelt_assert_ints_equal("coalesce due time", 50, coalescer->detail.timer.due_time);
+    uelt_assert_ints_equal("coalesce missed", 3, uel_event_timer_get_missed(coalescer));
+
+    fast_forward(&scheduler, &timer, 5);
+    operate(&scheduler, &loop);
+    uelt_assert_ints_equal("skip executions on schedule", 2, skipped);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_int_zero("skip missed on schedule", uel_event_timer_get_missed(skipper));
+    uelt_assert_ints_equal("coalesced periods on schedule", 5, coalesced);
+    uelt_assert_int_zero("coalesce missed on schedule", uel_event_timer_get_missed(coalescer));
+
+    return NULL;
+}
+
+static char *should_convert_time_units(){
+    uelt_assert_ints_equal(
+        "UEL_TIME_FROM_S",
+        3 * UEL_SCH_TICKS_PER_SECOND,
+        UEL_TIME_FROM_S(3)
+    );
+    uelt_assert_ints_equal(
+        "UEL_TIME_FROM_MS",
+        UEL_SCH_TICKS_PER_SECOND / 4,
+        UEL_TIME_FROM_MS(250)
+    );
+    uelt_assert_ints_equal(
+        "UEL_TIME_FROM_US",
+        UEL_SCH_TICKS_PER_SECOND / 2,
+        UEL_TIME_FROM_US(500000)
+    );
+    uelt_assert_ints_equal(
+        "UEL_TIME_FROM_NS",
+        UEL_SCH_TICKS_PER_SECOND,
+        UEL_TIME_FROM_NS(1000000000)
+    );
+    uelt_assert_ints_equal("UEL_TIME_TO_MS", 2000, UEL_TIME_TO_MS(2 * UEL_SCH_TICKS_PER_SECOND));
+    uelt_assert_ints_equal("UEL_TIME_TO_US", 1000000, UEL_TIME_TO_US(UEL_SCH_TICKS_PER_SECOND));
+    uelt_assert_ints_equal("UEL_TIME_TO_NS", 1000000000, UEL_TIME_TO_NS(UEL_SCH_TICKS_PER_SECOND));
+
+    struct timespec ts = { 2, 500000000 };
+    uel_time_t time = uel_posix_clock_to_time(&ts);
+    uelt_assert_ints_equal(
+        "uel_posix_clock_to_time",
+        UEL_TIME_FROM_MS(2500),
+        time
+    );
+    struct timespec back;
+    uel_posix_clock_from_time(time, &back);
+    uelt_assert_ints_equal("back.tv_sec", 2, back.tv_sec);
+    uelt_assert_ints_equal("back.tv_nsec", 500000000, back.tv_nsec);
+
+    uel_time_t first = uel_posix_clock_now();
+    uelt_assert("uel_posix_clock_now is monotonic", uel_posix_clock_now() >= first);
+
+    return NULL;
+}
+
+static char *should_report_next_deadline(){
+    DECLARE_SCHEDULER();
+    uel_time_t deadline = 0;
+
+    uelt_assert_not(
+        "uel_sch_next_deadline with no timers",
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+
+    uel_sch_update_timer(&scheduler, 100);
+    uel_sch_run_later(&scheduler, 300, uel_closure_create(&nop, NULL), NULL);
+    uel_sch_run_later(&scheduler, 200, uel_closure_create(&nop, NULL), NULL);
+    uelt_assert_not(
+        "uel_sch_next_deadline before managing timers",
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert(
+        "uel_sch_next_deadline",
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 300, deadline);
+
+    return NULL;
+}
+
 char *sch_run_tests(){
     uelt_run_test("should correctly initialise an scheduler", should_init_scheduler);
     uelt_run_test(
@@ -349,5 +572,25 @@ char *sch_run_tests(){
         "should correctly process events as they are input and run them when managing",
         should_operate
     );
+    uelt_run_test(
+        "should coalesce timers expiring within their slack",
+        should_coalesce_timers_within_slack
+    );
+    uelt_run_test(
+        "should keep timers with slack on their own period",
+        should_keep_slack_timers_on_their_period
+    );
+    uelt_run_test(
+        "should apply overrun policies to timers behind schedule",
+        should_apply_overrun_policies
+    );
+    uelt_run_test(
+        "should convert between scheduler ticks and physical time",
+        should_convert_time_units
+    );
+    uelt_run_test(
+        "should report the closest deadline among scheduled timers",
+        should_report_next_deadline
+    );
     return NULL;
 }
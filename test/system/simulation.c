@@ -0,0 +1,127 @@
+#include "simulation.h"
+
+#include <stdlib.h>
+
+#include "uevloop/system/simulation.h"
+#include "uevloop/system/containers/application.h"
+#include "uevloop/utils/closure.h"
+#include "../uelt.h"
+
+#define SCHEDULE_SIZE   (8)
+
+static void *count(void *context, void *params){
+    uintptr_t *counter = (uintptr_t *)context;
+    (*counter)++;
+    return NULL;
+}
+
+static void *enqueue_followup(void *context, void *params){
+    uel_application_t *app = (uel_application_t *)context;
+    uel_closure_t *followup = (uel_closure_t *)params;
+    uel_app_enqueue_closure(app, followup, NULL);
+    return NULL;
+}
+
+static char *should_init_simulation(){
+    static uel_application_t app;
+    uel_app_init(&app);
+    uel_app_update_timer(&app, 42);
+    uel_sim_step_t schedule[SCHEDULE_SIZE];
+    uel_sim_t sim;
+    uel_sim_init(&sim, &app, schedule, SCHEDULE_SIZE);
+
+    uelt_assert_pointers_equal("sim.app", &app, sim.app);
+    uelt_assert_pointers_equal("sim.schedule", schedule, sim.schedule);
+    uelt_assert_ints_equal("sim.capacity", SCHEDULE_SIZE, sim.capacity);
+    uelt_assert_int_zero("sim.steps", sim.steps);
+    uelt_assert_int_zero("sim.events", sim.events);
+    uelt_assert_ints_equal("sim.start_time", 42, sim.start_time);
+
+    return NULL;
+}
+
+static char *should_run_until_idle(){
+    static uel_application_t app;
+    uel_app_init(&app);
+    uel_sim_t sim;
+    uel_sim_init(&sim, &app, NULL, 0);
+
+    uintptr_t counter = 0;
+    uel_closure_t counter_closure = uel_closure_create(count, (void *)&counter);
+    uel_closure_t followup = uel_closure_create(enqueue_followup, (void *)&app);
+    uel_app_enqueue_closure(&app, &followup, (void *)&counter_closure);
+
+    uelt_assert_ints_equal("events run", 2, uel_sim_run_until_idle(&sim));
+    uelt_assert_ints_equal("counter", 1, counter);
+    uelt_assert_int_zero("app.scheduler.timer", app.scheduler.timer);
+    uelt_assert_int_zero("sim.steps", sim.steps);
+
+    return NULL;
+}
+
+static char *should_skip_to_deadlines(){
+    static uel_application_t app;
+    uel_app_init(&app);
+    uel_sim_step_t schedule[SCHEDULE_SIZE];
+    uel_sim_t sim;
+    uel_sim_init(&sim, &app, schedule, SCHEDULE_SIZE);
+
+    uintptr_t periodic = 0, oneshot = 0;
+    uel_app_run_at_intervals(
+        &app,
+        UEL_TIME_FROM_MS(1000),
+        false,
+        uel_closure_create(count, (void *)&periodic),
+        NULL
+    );
+    uel_app_run_later(
+        &app,
+        UEL_TIME_FROM_MS(2500),
+        uel_closure_create(count, (void *)&oneshot),
+        NULL
+    );
+
+    uelt_assert("first step", uel_sim_step(&sim));
+    uelt_assert_ints_equal("app.scheduler.timer", UEL_TIME_FROM_MS(1000), app.scheduler.timer);
+    uelt_assert_ints_equal("periodic", 1, periodic);
+
+    uel_sim_run_until(&sim, UEL_TIME_FROM_MS(5500));
+    uelt_assert_ints_equal("app.scheduler.timer", UEL_TIME_FROM_MS(5500), app.scheduler.timer);
+    uelt_assert_ints_equal("periodic", 5, periodic);
+    uelt_assert_ints_equal("oneshot", 1, oneshot);
+
+    uelt_assert_ints_equal("sim.steps", 6, sim.steps);
+    uelt_assert_ints_equal("sim.events", 6, sim.events);
+    uelt_assert_ints_equal("schedule[0].time", UEL_TIME_FROM_MS(1000), schedule[0].time);
+    uelt_assert_ints_equal("schedule[2].time", UEL_TIME_FROM_MS(2500), schedule[2].time);
+    uelt_assert_ints_equal("schedule[2].events", 1, schedule[2].events);
+    uelt_assert_ints_equal("schedule[5].time", UEL_TIME_FROM_MS(5000), schedule[5].time);
+    uelt_assert_ints_equal(
+        "uel_sim_throughput",
+        6 * UEL_SCH_TICKS_PER_SECOND / UEL_TIME_FROM_MS(5500),
+        uel_sim_throughput(&sim)
+    );
+
+    return NULL;
+}
+
+static char *should_stop_without_deadlines(){
+    static uel_application_t app;
+    uel_app_init(&app);
+    uel_sim_t sim;
+    uel_sim_init(&sim, &app, NULL, 0);
+
+    uelt_assert_not("uel_sim_step", uel_sim_step(&sim));
+    uelt_assert_int_zero("uel_sim_throughput", uel_sim_throughput(&sim));
+
+    return NULL;
+}
+
+char *uel_sim_run_tests(){
+    uelt_run_test("should correctly initialise a simulation", should_init_simulation);
+    uelt_run_test("should tick the application until idle", should_run_until_idle);
+    uelt_run_test("should skip idle gaps straight to deadlines", should_skip_to_deadlines);
+    uelt_run_test("should stop stepping when nothing is scheduled", should_stop_without_deadlines);
+
+    return NULL;
+}
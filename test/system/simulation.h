@@ -0,0 +1,6 @@
+#ifndef TEST_SIMULATION_H
+#define TEST_SIMULATION_H
+
+char *uel_sim_run_tests();
+
+#endif /* end of include guard: TEST_SIMULATION_H */
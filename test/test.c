@@ -6,19 +6,33 @@
 #include "test/utils/linked-list.h"
 #include "test/utils/object-pool.h"
 #include "test/utils/automatic-pool.h"
+#include "test/utils/arena.h"
 #include "test/utils/conditional.h"
+#include "test/utils/switch.h"
 #include "test/utils/pipeline.h"
 #include "test/utils/iterator.h"
 #include "test/utils/functional.h"
 #include "test/utils/module.h"
 #include "test/utils/promise.h"
+#include "test/utils/work-stealing-deque.h"
 #include "test/system/containers/system-pools.h"
 #include "test/system/containers/system-queues.h"
 #include "test/system/containers/application.h"
+#include "test/system/containers/workgroup.h"
 #include "test/system/event.h"
 #include "test/system/scheduler.h"
 #include "test/system/event-loop.h"
 #include "test/system/signal.h"
+#include "test/system/channel.h"
+#include "test/utils/histogram.h"
+#include "test/system/latency.h"
+#include "test/utils/trace.h"
+#include "test/utils/profiler.h"
+#include "test/system/simulation.h"
+#include "test/portability/lock.h"
+#include "test/system/parallel-iterator.h"
+#include "test/utils/array-kernels.h"
+#include "test/system/async-pipeline.h"
 
 uelt_context_t test_context = DEFAULT_TEST_CONTEXT;
 
@@ -28,19 +42,33 @@ static char *run_all_tests(){
     uelt_run_test_group("llist", uel_llist_run_tests);
     uelt_run_test_group("objpool", objpool_run_tests);
     uelt_run_test_group("autopool", uel_autopool_run_tests);
+    uelt_run_test_group("arena", uel_arena_run_tests);
     uelt_run_test_group("conditional", uel_conditional_run_tests);
+    uelt_run_test_group("switch", uel_switch_run_tests);
     uelt_run_test_group("pipeline", uel_pipeline_run_tests);
     uelt_run_test_group("iterator", uel_iterator_run_tests);
+    uelt_run_test_group("array kernels", uel_array_kernels_run_tests);
     uelt_run_test_group("functional", uel_functional_run_tests);
     uelt_run_test_group("module", uel_module_run_tests);
+    uelt_run_test_group("wsdeque", uel_wsdeque_run_tests);
     uelt_run_test_group("syspools", uel_syspools_run_tests);
     uelt_run_test_group("sysqueues", uel_sysqueues_run_tests);
     uelt_run_test_group("event", event_run_tests);
     uelt_run_test_group("scheduler", sch_run_tests);
     uelt_run_test_group("evloop", uel_evloop_run_tests);
     uelt_run_test_group("signal", uel_signal_run_tests);
+    uelt_run_test_group("channel", uel_channel_run_tests);
+    uelt_run_test_group("histogram", uel_histogram_run_tests);
+    uelt_run_test_group("latency", uel_latency_run_tests);
+    uelt_run_test_group("trace", uel_trace_run_tests);
+    uelt_run_test_group("profiler", uel_profiler_run_tests);
+    uelt_run_test_group("simulation", uel_sim_run_tests);
+    uelt_run_test_group("lock", uel_lock_run_tests);
     uelt_run_test_group("promise", uel_promise_run_tests);
+    uelt_run_test_group("async pipeline", uel_async_pipeline_run_tests);
     uelt_run_test_group("app", uel_app_run_tests);
+    uelt_run_test_group("workgroup", uel_workgroup_run_tests);
+    uelt_run_test_group("par", uel_iterator_par_run_tests);
 
     return NULL;
 }
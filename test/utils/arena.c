@@ -0,0 +1,93 @@
+#include "arena.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "uevloop/utils/arena.h"
+#include "../uelt.h"
+
+static char *should_init_arena(){
+    uint8_t buffer[64];
+    uel_arena_t arena;
+    uel_arena_init(&arena, buffer, sizeof(buffer));
+
+    uelt_assert_pointers_equal("arena.buffer", buffer, arena.buffer);
+    uelt_assert_ints_equal("arena.size", 64, arena.size);
+    uelt_assert_int_zero("arena.used", arena.used);
+    uelt_assert_int_zero("arena.peak", arena.peak);
+    uelt_assert_ints_equal("uel_arena_count_available", 64, uel_arena_count_available(&arena));
+
+    return NULL;
+}
+
+static char *should_allocate_aligned_memory(){
+    uint64_t storage[8];
+    uint8_t *buffer = (uint8_t *)storage;
+    uel_arena_t arena;
+    uel_arena_init(&arena, buffer, sizeof(storage));
+
+    uint8_t *byte = (uint8_t *)uel_arena_alloc(&arena, 1, 1);
+    uelt_assert_pointers_equal("first allocation", buffer, byte);
+
+    uint32_t *word = (uint32_t *)uel_arena_alloc(&arena, sizeof(uint32_t), sizeof(uint32_t));
+    uelt_assert_pointers_equal("aligned allocation", &buffer[4], word);
+    uelt_assert_ints_equal("arena.used", 8, arena.used);
+
+    uint8_t *unaligned = (uint8_t *)uel_arena_alloc(&arena, 3, 0);
+    uelt_assert_pointers_equal("allocation with zero alignment", &buffer[8], unaligned);
+
+    uint64_t *dword = (uint64_t *)uel_arena_alloc(&arena, sizeof(uint64_t), 16);
+    uelt_assert_pointer_not_null("16-byte aligned allocation", dword);
+    uelt_assert_int_zero("16-byte alignment", (uintptr_t)dword % 16);
+    uelt_assert_ints_equal(
+        "arena.used",
+        (uint8_t *)dword - buffer + sizeof(uint64_t),
+        arena.used
+    );
+
+    return NULL;
+}
+
+static char *should_fail_when_exhausted(){
+    uint8_t buffer[16];
+    uel_arena_t arena;
+    uel_arena_init(&arena, buffer, sizeof(buffer));
+
+    uelt_assert_pointer_null("oversized allocation", uel_arena_alloc(&arena, 17, 1));
+    uelt_assert_pointer_not_null("first allocation", uel_arena_alloc(&arena, 15, 1));
+    uelt_assert_pointer_null(
+        "allocation not fitting its padding",
+        uel_arena_alloc(&arena, 1, 16)
+    );
+    uelt_assert_pointer_not_null("last byte", uel_arena_alloc(&arena, 1, 1));
+    uelt_assert_int_zero("uel_arena_count_available", uel_arena_count_available(&arena));
+    uelt_assert_pointer_null("allocation when full", uel_arena_alloc(&arena, 1, 1));
+
+    return NULL;
+}
+
+static char *should_reset_arena(){
+    uint8_t buffer[16];
+    uel_arena_t arena;
+    uel_arena_init(&arena, buffer, sizeof(buffer));
+
+    uel_arena_alloc(&arena, 12, 1);
+    uel_arena_reset(&arena);
+    uelt_assert_int_zero("arena.used", arena.used);
+    uelt_assert_ints_equal("arena.peak", 12, arena.peak);
+
+    uint8_t *memory = (uint8_t *)uel_arena_alloc(&arena, 4, 1);
+    uelt_assert_pointers_equal("allocation after reset", buffer, memory);
+    uelt_assert_ints_equal("arena.peak after reset", 12, arena.peak);
+
+    return NULL;
+}
+
+char *uel_arena_run_tests(){
+    uelt_run_test("should correctly initialise an arena", should_init_arena);
+    uelt_run_test("should allocate aligned memory", should_allocate_aligned_memory);
+    uelt_run_test("should fail to allocate when exhausted", should_fail_when_exhausted);
+    uelt_run_test("should recycle all memory when reset", should_reset_arena);
+
+    return NULL;
+}
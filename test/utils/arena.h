@@ -0,0 +1,6 @@
+#ifndef TEST_ARENA_H
+#define TEST_ARENA_H
+
+char *uel_arena_run_tests();
+
+#endif /* end of include guard: TEST_ARENA_H */
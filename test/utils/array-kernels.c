@@ -0,0 +1,113 @@
+#include "array-kernels.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../uelt.h"
+#include "uevloop/utils/array-kernels.h"
+
+#define MAX_LENGTH  (75)
+
+static uint32_t seed = 12345;
+static uint32_t next_random(){
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+// Checks every operation of every comparison of some type against a plain loop,
+// for all array lengths up to MAX_LENGTH so that vector blocks and scalar tails
+// are both exercised. Values are drawn from a narrow window around `pivot` so
+// that comparisons are frequently true and frequently false.
+#define CHECK_KERNELS(suffix, type, pivot, low, high)                         \
+    static char *check_##suffix(){                                            \
+        type array[MAX_LENGTH];                                               \
+        for(size_t length = 0; length <= MAX_LENGTH; length++){               \
+            for(size_t i = 0; i < length; i++){                               \
+                array[i] = (type)((pivot) + (int32_t)(next_random() % 7) - 3);\
+            }                                                                 \
+            type value = (type)(pivot);                                       \
+            size_t gt = 0, lt = 0, eq = 0, range = 0;                         \
+            type *first_gt = NULL, *first_range = NULL;                       \
+            for(size_t i = 0; i < length; i++){                               \
+                if(array[i] > value){ gt++; if(!first_gt) first_gt = &array[i]; } \
+                if(array[i] < value) lt++;                                    \
+                if(array[i] == value) eq++;                                   \
+                if(array[i] >= (type)(low) && array[i] <= (type)(high)){      \
+                    range++;                                                  \
+                    if(!first_range) first_range = &array[i];                 \
+                }                                                             \
+            }                                                                 \
+            uelt_assert_ints_equal(#suffix " gt count", gt,                   \
+                uel_array_count_##suffix##_gt(array, length, value));         \
+            uelt_assert_ints_equal(#suffix " lt count", lt,                   \
+                uel_array_count_##suffix##_lt(array, length, value));         \
+            uelt_assert_ints_equal(#suffix " eq count", eq,                   \
+                uel_array_count_##suffix##_eq(array, length, value));         \
+            uelt_assert_ints_equal(#suffix " range count", range,             \
+                uel_array_count_##suffix##_range(array, length, (type)(low), (type)(high))); \
+            uelt_assert_pointers_equal(#suffix " gt find", first_gt,          \
+                uel_array_find_##suffix##_gt(array, length, value));          \
+            uelt_assert_pointers_equal(#suffix " range find", first_range,    \
+                uel_array_find_##suffix##_range(array, length, (type)(low), (type)(high))); \
+            uelt_assert(#suffix " gt any",                                    \
+                (gt != 0) == uel_array_any_##suffix##_gt(array, length, value)); \
+            uelt_assert(#suffix " lt all",                                    \
+                (lt == length) == uel_array_all_##suffix##_lt(array, length, value)); \
+            uelt_assert(#suffix " range all",                                 \
+                (range == length) == uel_array_all_##suffix##_range(          \
+                    array, length, (type)(low), (type)(high)));               \
+        }                                                                     \
+        return NULL;                                                          \
+    }
+
+CHECK_KERNELS(u8, uint8_t, 128, 126, 129)
+CHECK_KERNELS(i8, int8_t, 0, -2, 1)
+CHECK_KERNELS(u16, uint16_t, 40000, 39998, 40001)
+CHECK_KERNELS(i16, int16_t, -300, -302, -299)
+CHECK_KERNELS(u32, uint32_t, 3000000000u, 2999999998u, 3000000001u)
+CHECK_KERNELS(i32, int32_t, -5, -7, -4)
+
+static char *should_match_plain_loops(){
+    char *result;
+    if((result = check_u8()) != NULL) return result;
+    if((result = check_i8()) != NULL) return result;
+    if((result = check_u16()) != NULL) return result;
+    if((result = check_i16()) != NULL) return result;
+    if((result = check_u32()) != NULL) return result;
+    if((result = check_i32()) != NULL) return result;
+
+    return NULL;
+}
+
+static char *should_handle_type_limits(){
+    uint8_t bytes[40];
+    int16_t words[20];
+    for(size_t i = 0; i < 40; i++) bytes[i] = i % 2 ? UINT8_MAX : 0;
+    for(size_t i = 0; i < 20; i++) words[i] = i % 2 ? INT16_MAX : INT16_MIN;
+
+    uelt_assert_int_zero("nothing is greater than the maximum",
+        uel_array_count_u8_gt(bytes, 40, UINT8_MAX));
+    uelt_assert_int_zero("nothing is less than the minimum",
+        uel_array_count_u8_lt(bytes, 40, 0));
+    uelt_assert_ints_equal("maximum values", 20, uel_array_count_u8_eq(bytes, 40, UINT8_MAX));
+    uelt_assert("everything is within the full range",
+        uel_array_all_u8_range(bytes, 40, 0, UINT8_MAX));
+    uelt_assert_not("an inverted range must be empty",
+        uel_array_any_u8_range(bytes, 40, 1, 0));
+    uelt_assert_ints_equal("values above the minimum", 10,
+        uel_array_count_i16_gt(words, 20, INT16_MIN));
+    uelt_assert_pointers_equal("first maximum value", &words[1],
+        uel_array_find_i16_gt(words, 20, 0));
+    uelt_assert("empty arrays satisfy everything",
+        uel_array_all_i16_gt(words, 0, INT16_MAX));
+
+    return NULL;
+}
+
+char *uel_array_kernels_run_tests(){
+    uelt_run_test("should match plain loops", should_match_plain_loops);
+    uelt_run_test("should handle type limits", should_handle_type_limits);
+
+    return NULL;
+}
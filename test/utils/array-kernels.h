@@ -0,0 +1,6 @@
+#ifndef TEST_ARRAY_KERNELS_H
+#define TEST_ARRAY_KERNELS_H
+
+char *uel_array_kernels_run_tests();
+
+#endif /* end of include guard: TEST_ARRAY_KERNELS_H */
@@ -30,9 +30,9 @@ static char *should_initialise_autopool() {
         pool.autoptr_pool.queue.size
     );
     uelt_assert_ints_equal(
-        "pool.autoptr_pool.queue.count",
+        "uel_objpool_count_available(&pool.autoptr_pool)",
         4,
-        pool.autoptr_pool.queue.count
+        uel_objpool_count_available(&pool.autoptr_pool)
     );
 
     return NULL;
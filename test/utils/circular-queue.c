@@ -220,6 +220,47 @@ static char *should_wrap_on_buffer_limit(){
     return NULL;
 }
 
+static char *should_push_and_pop_many(){
+    uel_cqueue_t queue;
+    void *buffer[BUFFER_SIZE];
+    uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+    queue.tail = BUFFER_SIZE - 2;
+
+    uintptr_t elements[BUFFER_SIZE + 2];
+    void *pointers[BUFFER_SIZE + 2];
+    for(uintptr_t i = 0; i < BUFFER_SIZE + 2; i++){
+        elements[i] = i;
+        pointers[i] = (void *)&elements[i];
+    }
+
+    uelt_assert_ints_equal("pushed", 3, uel_cqueue_push_many(&queue, pointers, 3));
+    uelt_assert_ints_equal("queue.count", 3, queue.count);
+    uelt_assert_pointers_equal("uel_cqueue_peek_tail", pointers[0], uel_cqueue_peek_tail(&queue));
+    uelt_assert_pointers_equal("uel_cqueue_peek_head", pointers[2], uel_cqueue_peek_head(&queue));
+
+    void *popped[BUFFER_SIZE];
+    uelt_assert_ints_equal("popped", 2, uel_cqueue_pop_many(&queue, popped, 2));
+    uelt_assert_pointers_equal("popped[0]", pointers[0], popped[0]);
+    uelt_assert_pointers_equal("popped[1]", pointers[1], popped[1]);
+    uelt_assert_pointers_equal("uel_cqueue_pop", pointers[2], uel_cqueue_pop(&queue));
+
+    uelt_assert_ints_equal(
+        "pushed beyond capacity",
+        BUFFER_SIZE,
+        uel_cqueue_push_many(&queue, pointers, BUFFER_SIZE + 2)
+    );
+    uelt_assert("uel_cqueue_is_full", uel_cqueue_is_full(&queue));
+    uelt_assert_ints_equal(
+        "popped everything",
+        BUFFER_SIZE,
+        uel_cqueue_pop_many(&queue, popped, BUFFER_SIZE)
+    );
+    uelt_assert_pointers_equal("popped[BUFFER_SIZE - 1]", pointers[BUFFER_SIZE - 1], popped[BUFFER_SIZE - 1]);
+    uelt_assert_int_zero("popped from empty queue", uel_cqueue_pop_many(&queue, popped, 1));
+
+    return NULL;
+}
+
 char * uel_cqueue_run_tests(){
     uelt_run_test("should init circular queue with blank fields", should_init);
     uelt_run_test(
@@ -258,6 +299,10 @@ char * uel_cqueue_run_tests(){
         "should correctly wrap over the buffer end when it is reached",
         should_wrap_on_buffer_limit
     );
+    uelt_run_test(
+        "should correctly push and pop many elements at once",
+        should_push_and_pop_many
+    );
     return NULL;
 }
 
@@ -6,6 +6,8 @@
 
 #include "../uelt.h"
 #include "uevloop/utils/closure.h"
+#include "uevloop/utils/static-closure.h"
+#include "uevloop/utils/iterator.h"
 
 static void *nop1(void *context, void *params){ return NULL; }
 static char *should_create_closure(){
@@ -84,11 +86,112 @@ static char *should_create_nop() {
     return NULL;
 }
 
+UEL_STATIC_CLOSURE(static_add, uintptr_t, uintptr_t, uintptr_t){
+    return context + params;
+}
+UEL_STATIC_CLOSURE(static_double, uintptr_t, uintptr_t, uintptr_t){
+    return params * 2;
+}
+static char *should_invoke_static_closure(){
+    uelt_assert_ints_equal("static_add(5, 2)", 7, static_add(5, 2));
+
+    uel_closure_t add_five = UEL_STATIC_CLOSURE_BIND(static_add, 5);
+    uintptr_t result = (uintptr_t)uel_closure_invoke(&add_five, (void *)2);
+    uelt_assert_ints_equal("uel_closure_invoke(&add_five, 2)", 7, result);
+
+    return NULL;
+}
+
+UEL_STATIC_PIPELINE(add_then_double, uintptr_t, uintptr_t, static_add, static_double)
+UEL_STATIC_PIPELINE(
+    add_then_double_then_add, uintptr_t, uintptr_t, add_then_double, static_add
+)
+static char *should_compose_static_pipeline(){
+    uelt_assert_ints_equal("add_then_double(1, 2)", 6, add_then_double(1, 2));
+    uelt_assert_ints_equal(
+        "add_then_double_then_add(1, 2)", 7, add_then_double_then_add(1, 2)
+    );
+
+    uel_closure_t pipeline = UEL_STATIC_CLOSURE_BIND(add_then_double, 3);
+    uintptr_t result = (uintptr_t)uel_closure_invoke(&pipeline, (void *)4);
+    uelt_assert_ints_equal("uel_closure_invoke(&pipeline, 4)", 14, result);
+
+    return NULL;
+}
+
+UEL_STATIC_CLOSURE(is_greater, bool, uintptr_t, uintptr_t){
+    return params > context;
+}
+UEL_STATIC_CONDITIONAL(
+    clamp, uintptr_t, uintptr_t, uintptr_t, is_greater, static_double, static_add
+)
+static char *should_branch_static_conditional(){
+    uelt_assert_ints_equal("clamp(5, 10)", 20, clamp(5, 10));
+    uelt_assert_ints_equal("clamp(5, 3)", 8, clamp(5, 3));
+
+    return NULL;
+}
+
+UEL_STATIC_CLOSURE(accumulate, bool, uint32_t *, uint32_t *){
+    *context += *params;
+    return *params != 0;
+}
+UEL_STATIC_CLOSURE(square, uint32_t, void *, uint32_t *){
+    return *params * *params;
+}
+UEL_STATIC_CLOSURE(is_odd, bool, void *, uint32_t *){
+    return *params % 2;
+}
+UEL_STATIC_FOREACH(sum_until_zero, uint32_t, uint32_t *, accumulate)
+UEL_STATIC_MAP(squares, uint32_t, uint32_t, void *, square)
+UEL_STATIC_FIND(find_odd, uint32_t, void *, is_odd)
+UEL_STATIC_COUNT(count_odd, uint32_t, void *, is_odd)
+UEL_STATIC_ALL(all_odd, uint32_t, void *, is_odd)
+UEL_STATIC_ANY(any_odd, uint32_t, void *, is_odd)
+UEL_STATIC_NONE(none_odd, uint32_t, void *, is_odd)
+static char *should_apply_static_iterator_operations(){
+    uint32_t numbers[] = { 2, 3, 4, 0, 5 };
+    uint32_t evens[] = { 2, 4, 6 };
+    uel_iterator_array_t array = uel_iterator_array_create(numbers, 5, sizeof(uint32_t));
+    uel_iterator_t *iterator = (uel_iterator_t *)&array;
+
+    uint32_t sum = 0;
+    uelt_assert("sum_until_zero() must halt", !sum_until_zero(iterator, &sum));
+    uelt_assert_ints_equal("sum", 9, sum);
+    sum = 0;
+    uelt_assert("sum_until_zero_array() must not halt", sum_until_zero_array(evens, 3, &sum));
+    uelt_assert_ints_equal("sum", 12, sum);
+
+    uint32_t destination[5];
+    uelt_assert_ints_equal("squares()", 3, squares(iterator, NULL, destination, 3));
+    uelt_assert_ints_equal("destination[2]", 16, destination[2]);
+    uelt_assert_ints_equal("squares_array()", 5, squares_array(numbers, 5, NULL, destination, 5));
+    uelt_assert_ints_equal("destination[4]", 25, destination[4]);
+
+    uelt_assert_pointers_equal("find_odd()", &numbers[1], find_odd(iterator, NULL));
+    uelt_assert_pointer_null("find_odd_array(evens)", find_odd_array(evens, 3, NULL));
+    uelt_assert_ints_equal("count_odd()", 2, count_odd(iterator, NULL));
+    uelt_assert_ints_equal("count_odd_array()", 2, count_odd_array(numbers, 5, NULL));
+    uelt_assert("all_odd() must be false", !all_odd(iterator, NULL));
+    uelt_assert("any_odd() must be true", any_odd(iterator, NULL));
+    uelt_assert("none_odd_array(evens) must be true", none_odd_array(evens, 3, NULL));
+    uelt_assert("none_odd() must be false", !none_odd(iterator, NULL));
+
+    return NULL;
+}
+
 char * uel_closure_run_tests(){
     uelt_run_test("should correctly create closure", should_create_closure);
     uelt_run_test("should correctly invoke closure", should_invoke_closure);
     uelt_run_test("should verify the closure's returned value", should_check_uel_closure_return);
     uelt_run_test("should create a nop closure", should_create_nop);
+    uelt_run_test("should invoke static closure", should_invoke_static_closure);
+    uelt_run_test("should compose static pipeline", should_compose_static_pipeline);
+    uelt_run_test("should branch static conditional", should_branch_static_conditional);
+    uelt_run_test(
+        "should apply static iterator operations",
+        should_apply_static_iterator_operations
+    );
 
     return NULL;
 }
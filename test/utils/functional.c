@@ -64,6 +64,41 @@ static char *should_operate_conditional_closure(){
     return NULL;
 }
 
+static void *remainder_of(void *context, void *params){
+    uintptr_t divisor = (uintptr_t)context;
+    uintptr_t dividend = (uintptr_t)params;
+
+    return (void *)(uintptr_t)(dividend % divisor);
+}
+
+static char *should_operate_switch_closure(){
+    uel_switch_case_t cases[] = {
+        {0, uel_closure_create(exponentiate, (void *)2)},
+        {1, uel_closure_create(add, (void *)1)}
+    };
+    UEL_DECLARE_SWITCH_TABLE(1, math);
+    uel_switch_t math_switch;
+    uel_switch_init(
+        &math_switch,
+        uel_closure_create(remainder_of, (void *)3),
+        cases,
+        2,
+        uel_closure_create(add, (void *)0),
+        math_switch_table,
+        1
+    );
+
+    uel_closure_t f = uel_func_switch(&math_switch);
+
+    uelt_assert_pointers_equal("f.context", &math_switch, f.context);
+    uelt_assert_ints_equal("f(0)", 0, F(0));
+    uelt_assert_ints_equal("f(3)", 9, F(3));
+    uelt_assert_ints_equal("f(4)", 5, F(4));
+    uelt_assert_ints_equal("f(5)", 5, F(5));
+
+    return NULL;
+}
+
 static void *accumulate(void *context, void *params){
     uintptr_t *destination = (uintptr_t *)context;
     uintptr_t value = *(uintptr_t *)params;
@@ -241,6 +276,35 @@ static char *should_operate_all_none_any_closure(){
 
     return NULL;
 }
+static char *should_operate_array_kernel_closures(){
+    uint16_t readings[] = {100, 2000, 350, 4095, 12, 4095, 800};
+    uel_iterator_array_t frame =
+        uel_iterator_array_create(readings, 7, sizeof(uint16_t));
+
+    uel_array_filter_t saturated = uel_array_filter_u16_eq(4095);
+    uel_array_filter_t valid = uel_array_filter_u16_range(0, 4095);
+    uel_array_filter_t negative_like = uel_array_filter_u16_gt(4095);
+
+    uel_closure_t count_saturated = uel_func_array_count(&saturated);
+    uel_closure_t find_saturated = uel_func_array_find(&saturated);
+    uel_closure_t all_valid = uel_func_array_all(&valid);
+    uel_closure_t any_overflow = uel_func_array_any(&negative_like);
+
+    uelt_assert_ints_equal(
+        "saturated readings",
+        2,
+        (uintptr_t)uel_closure_invoke(&count_saturated, &frame)
+    );
+    uelt_assert_pointers_equal(
+        "first saturated reading",
+        &readings[3],
+        uel_closure_invoke(&find_saturated, &frame)
+    );
+    uelt_assert("all readings are valid", uel_closure_invoke(&all_valid, &frame));
+    uelt_assert_not("no reading overflows", uel_closure_invoke(&any_overflow, &frame));
+
+    return NULL;
+}
 char *uel_functional_run_tests(){
 
     uelt_run_test(
@@ -251,6 +315,10 @@ char *uel_functional_run_tests(){
         "should correctly operate conditional closure",
         should_operate_conditional_closure
     );
+    uelt_run_test(
+        "should correctly operate switch closure",
+        should_operate_switch_closure
+    );
     uelt_run_test(
         "should correctly operate foreach closure",
         should_operate_foreach_closure
@@ -271,6 +339,10 @@ char *uel_functional_run_tests(){
         "should correctly operate all/none/any closures",
         should_operate_all_none_any_closure
     );
+    uelt_run_test(
+        "should correctly operate array kernel closures",
+        should_operate_array_kernel_closures
+    );
 
     return NULL;
 }
@@ -0,0 +1,103 @@
+#include "histogram.h"
+
+#include <stdint.h>
+
+#include "uevloop/utils/histogram.h"
+#include "../uelt.h"
+
+static char *should_init_histogram(){
+    uel_histogram_t histogram;
+    uel_histogram_init(&histogram);
+
+    uelt_assert_int_zero("histogram.count", histogram.count);
+    uelt_assert_int_zero("histogram.max", histogram.max);
+    uelt_assert_ints_equal("histogram.min", UINT32_MAX, histogram.min);
+    uelt_assert_int_zero("histogram.sum", histogram.sum);
+    for(size_t i = 0; i < UEL_HISTOGRAM_BUCKET_COUNT; i++){
+        uelt_assert_int_zero("histogram.buckets[i]", histogram.buckets[i]);
+    }
+
+    return NULL;
+}
+
+static char *should_map_values_to_buckets(){
+    // Small values are recorded exactly
+    for(uint32_t i = 0; i < 2 * UEL_HISTOGRAM_SUB_BUCKET_COUNT; i++){
+        uelt_assert_ints_equal("small value index", i, uel_histogram_bucket_index(i));
+        uelt_assert_ints_equal("small value floor", i, uel_histogram_bucket_floor(i));
+    }
+
+    // Larger values are rounded down to their bucket floor within the configured precision
+    uint32_t values[] = { 9, 100, 1000, 12345, 1u<<20, UINT32_MAX };
+    for(size_t i = 0; i < sizeof(values)/sizeof(values[0]); i++){
+        size_t index = uel_histogram_bucket_index(values[i]);
+        uint32_t floor = uel_histogram_bucket_floor(index);
+        uelt_assert("bucket index within bounds", index < UEL_HISTOGRAM_BUCKET_COUNT);
+        uelt_assert("floor not above value", floor <= values[i]);
+        uelt_assert(
+            "value within precision",
+            values[i] - floor <= (floor >> UEL_HISTOGRAM_PRECISION_BITS)
+        );
+        uelt_assert_ints_equal("floor maps to same bucket", index, uel_histogram_bucket_index(floor));
+    }
+    uelt_assert_ints_equal(
+        "last bucket",
+        UEL_HISTOGRAM_BUCKET_COUNT - 1,
+        uel_histogram_bucket_index(UINT32_MAX)
+    );
+
+    return NULL;
+}
+
+static char *should_record_values(){
+    uel_histogram_t histogram;
+    uel_histogram_init(&histogram);
+
+    for(uint32_t i = 1; i <= 100; i++){
+        uel_histogram_record(&histogram, i);
+    }
+
+    uelt_assert_ints_equal("histogram.count", 100, histogram.count);
+    uelt_assert_ints_equal("histogram.min", 1, histogram.min);
+    uelt_assert_ints_equal("histogram.max", 100, histogram.max);
+    uelt_assert_ints_equal("histogram.sum", 5050, histogram.sum);
+    uelt_assert_ints_equal(
+        "histogram.buckets[1]",
+        1,
+        histogram.buckets[uel_histogram_bucket_index(1)]
+    );
+
+    return NULL;
+}
+
+static char *should_estimate_quantiles(){
+    uel_histogram_t histogram;
+    uel_histogram_init(&histogram);
+
+    uelt_assert_int_zero("empty histogram quantile", uel_histogram_quantile(&histogram, 500));
+
+    for(uint32_t i = 0; i < 99; i++){
+        uel_histogram_record(&histogram, 3);
+    }
+    uel_histogram_record(&histogram, 1000);
+
+    uelt_assert_ints_equal("p0", 3, uel_histogram_quantile(&histogram, 0));
+    uelt_assert_ints_equal("p50", 3, uel_histogram_quantile(&histogram, 500));
+    uelt_assert_ints_equal("p99", 3, uel_histogram_quantile(&histogram, 990));
+    uelt_assert_ints_equal(
+        "p100",
+        uel_histogram_bucket_floor(uel_histogram_bucket_index(1000)),
+        uel_histogram_quantile(&histogram, 1000)
+    );
+
+    return NULL;
+}
+
+char *uel_histogram_run_tests(){
+    uelt_run_test("should correctly initialise a histogram", should_init_histogram);
+    uelt_run_test("should map values to log-linear buckets", should_map_values_to_buckets);
+    uelt_run_test("should record values", should_record_values);
+    uelt_run_test("should estimate quantiles", should_estimate_quantiles);
+
+    return NULL;
+}
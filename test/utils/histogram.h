@@ -0,0 +1,6 @@
+#ifndef TEST_HISTOGRAM_H
+#define TEST_HISTOGRAM_H
+
+char *uel_histogram_run_tests();
+
+#endif /* end of include guard: TEST_HISTOGRAM_H */
@@ -22,6 +22,11 @@ static char *should_create_array_iterator(){
         &uel_iterator_array_next,
         iterator.base.next
     );
+    uelt_assert_pointers_equal(
+        "iterator.base.next_batch",
+        &uel_iterator_array_next_batch,
+        iterator.base.next_batch
+    );
     uelt_assert_ints_equal("iterator.item_count", 5, iterator.item_count);
     uelt_assert_ints_equal("iterator.item_size", sizeof(int), iterator.item_size);
 
@@ -62,6 +67,11 @@ static char *should_create_llist_iterator(){
 
     uelt_assert_pointers_equal("iterator.collection", &list, iterator.collection);
     uelt_assert_pointers_equal("iterator.next", &uel_iterator_llist_next, iterator.next);
+    uelt_assert_pointers_equal(
+        "iterator.next_batch",
+        &uel_iterator_llist_next_batch,
+        iterator.next_batch
+    );
 
     return NULL;
 }
@@ -341,6 +351,169 @@ static char *should_operate_iterator_all_none_any(){
     return NULL;
 }
 
+static char *should_batch_array_iterator(){
+    UEL_TEST_DECLARE_ITERATOR_ARRAY();
+    void *batch[3];
+
+    size_t count = uel_iterator_array_next_batch(&iterator, NULL, batch, 3);
+    uelt_assert_ints_equal("count of first batch", 3, count);
+    for(size_t i = 0; i < count; i++){
+        uelt_assert_pointers_equal("first batch element", &nums[i], batch[i]);
+    }
+    count = uel_iterator_array_next_batch(&iterator, batch[2], batch, 3);
+    uelt_assert_ints_equal("count of second batch", 2, count);
+    uelt_assert_pointers_equal("second batch, first element", &nums[3], batch[0]);
+    uelt_assert_pointers_equal("second batch, last element", &nums[4], batch[1]);
+    count = uel_iterator_array_next_batch(&iterator, batch[1], batch, 3);
+    uelt_assert_ints_equal("count after last element", 0, count);
+
+    return NULL;
+}
+
+static char *should_batch_llist_iterator(){
+    UEL_TEST_DECLARE_ITERATOR_LLIST();
+    void *batch[3];
+
+    size_t count = uel_iterator_llist_next_batch(&iterator, NULL, batch, 3);
+    uelt_assert_ints_equal("count of first batch", 3, count);
+    for(size_t i = 0; i < count; i++){
+        uelt_assert_pointers_equal("first batch element", &nodes[i], batch[i]);
+    }
+    count = uel_iterator_llist_next_batch(&iterator, batch[2], batch, 3);
+    uelt_assert_ints_equal("count of second batch", 2, count);
+    uelt_assert_pointers_equal("second batch, last element", &nodes[4], batch[1]);
+    count = uel_iterator_llist_next_batch(&iterator, batch[1], batch, 3);
+    uelt_assert_ints_equal("count after last element", 0, count);
+
+    return NULL;
+}
+
+static char *should_fall_back_to_next_without_next_batch(){
+    UEL_TEST_DECLARE_ITERATOR_ARRAY();
+    iterator.base.next_batch = NULL;
+    void *batch[3];
+
+    size_t count = uel_iterator_next_batch((uel_iterator_t *)&iterator, NULL, batch, 3);
+    uelt_assert_ints_equal("count of batch", 1, count);
+    uelt_assert_pointers_equal("batch element", &nums[0], batch[0]);
+    count = uel_iterator_next_batch((uel_iterator_t *)&iterator, &nums[4], batch, 3);
+    uelt_assert_ints_equal("count after last element", 0, count);
+
+    int sum = 0;
+    uel_closure_t closure = uel_closure_create(accumulate, (void *)&sum);
+    uel_iterator_foreach((uel_iterator_t *)&iterator, &closure);
+    uelt_assert_ints_equal("sum of array members", 15, sum);
+
+    return NULL;
+}
+
+static void *square_int(void *context, void *params){
+    int number = *(int *)params;
+    return (void *)(uintptr_t)(number * number);
+}
+static void *is_odd_value(void *context, void *params){
+    uintptr_t value = (uintptr_t)*(void **)params;
+    return (void *)(uintptr_t)(value % 2 != 0);
+}
+static void *always(void *context, void *params){
+    return (void *)true;
+}
+static char *should_chain_map_and_filter_adapters(){
+    UEL_TEST_DECLARE_ITERATOR_ARRAY();
+
+    uel_closure_t square = uel_closure_create(square_int, NULL);
+    uel_closure_t is_odd = uel_closure_create(is_odd_value, NULL);
+    uel_closure_t pass = uel_closure_create(always, NULL);
+    uel_iterator_map_adapter_t squares =
+        uel_iterator_map_adapter_create((uel_iterator_t *)&iterator, &square);
+
+    void *values[5];
+    size_t count = uel_iterator_map((uel_iterator_t *)&squares, &pass, values, 5);
+    uelt_assert_ints_equal("count of mapped values", 5, count);
+
+    void *element = uel_iterator_find((uel_iterator_t *)&squares, &is_odd);
+    uelt_assert_pointer_not_null("found element", (uintptr_t)element);
+    uelt_assert_ints_equal("first odd square", 1, (uintptr_t)*(void **)element);
+
+    uel_iterator_filter_adapter_t odd_squares =
+        uel_iterator_filter_adapter_create((uel_iterator_t *)&squares, &is_odd);
+
+    count = uel_iterator_count((uel_iterator_t *)&odd_squares, &pass);
+    uelt_assert_ints_equal("count of odd squares", 3, count);
+    count = uel_iterator_count((uel_iterator_t *)&odd_squares, &pass);
+    uelt_assert_ints_equal("count of odd squares on restart", 3, count);
+
+    void *last = odd_squares.base.next((uel_iterator_t *)&odd_squares, NULL);
+    uelt_assert_ints_equal("first odd square", 1, (uintptr_t)*(void **)last);
+    last = odd_squares.base.next((uel_iterator_t *)&odd_squares, last);
+    uelt_assert_ints_equal("second odd square", 9, (uintptr_t)*(void **)last);
+
+    return NULL;
+}
+
+static char *should_take_and_skip_elements(){
+    UEL_TEST_DECLARE_ITERATOR_ARRAY();
+    uel_closure_t pass = uel_closure_create(always, NULL);
+
+    uel_iterator_skip_adapter_t skip =
+        uel_iterator_skip_adapter_create((uel_iterator_t *)&iterator, 1);
+    uel_iterator_take_adapter_t take =
+        uel_iterator_take_adapter_create((uel_iterator_t *)&skip, 3);
+
+    void *elements[5];
+    size_t count = uel_iterator_map((uel_iterator_t *)&take, &pass, elements, 5);
+    uelt_assert_ints_equal("count of taken elements", 3, count);
+
+    void *batch[5];
+    count = uel_iterator_next_batch((uel_iterator_t *)&take, NULL, batch, 5);
+    uelt_assert_ints_equal("count of batch", 3, count);
+    for(size_t i = 0; i < count; i++){
+        uelt_assert_pointers_equal("taken element", &nums[i + 1], batch[i]);
+    }
+
+    uel_iterator_skip_adapter_t skip_all =
+        uel_iterator_skip_adapter_create((uel_iterator_t *)&iterator, 7);
+    count = uel_iterator_count((uel_iterator_t *)&skip_all, &pass);
+    uelt_assert_ints_equal("count after skipping everything", 0, count);
+
+    return NULL;
+}
+
+static void *sum_pair(void *context, void *params){
+    int *sum = (int *)context;
+    void **pair = (void **)params;
+    uel_llist_node_t *node = (uel_llist_node_t *)pair[1];
+    *sum += *(int *)pair[0] * (int)(uintptr_t)node->value;
+    return (void *)true;
+}
+static char *should_zip_iterators(){
+    int nums[] = {1, 2, 3};
+    uel_iterator_array_t array = uel_iterator_array_create(nums, 3, sizeof(int));
+    UEL_TEST_DECLARE_ITERATOR_LLIST();
+
+    uel_iterator_zip_adapter_t zip = uel_iterator_zip_adapter_create(
+        (uel_iterator_t *)&iterator,
+        (uel_iterator_t *)&array
+    );
+    uel_closure_t pass = uel_closure_create(always, NULL);
+    uelt_assert_ints_equal(
+        "count of pairs",
+        3,
+        uel_iterator_count((uel_iterator_t *)&zip, &pass)
+    );
+
+    uel_iterator_zip_adapter_t reversed = uel_iterator_zip_adapter_create(
+        (uel_iterator_t *)&array,
+        (uel_iterator_t *)&iterator
+    );
+    int sum = 0;
+    uel_closure_t accumulate_pair = uel_closure_create(sum_pair, (void *)&sum);
+    uel_iterator_foreach((uel_iterator_t *)&reversed, &accumulate_pair);
+    uelt_assert_ints_equal("sum of products", 1 * 1 + 2 * 2 + 3 * 3, sum);
+
+    return NULL;
+}
+
 void *uel_iterator_run_tests(){
 
     uelt_run_test(
@@ -373,6 +546,15 @@ void *uel_iterator_run_tests(){
         "should correctly operate iterators: all / none / any",
         should_operate_iterator_all_none_any
     );
+    uelt_run_test("should yield batches from an array", should_batch_array_iterator);
+    uelt_run_test("should yield batches from a linked list", should_batch_llist_iterator);
+    uelt_run_test(
+        "should fall back to next() without next_batch()",
+        should_fall_back_to_next_without_next_batch
+    );
+    uelt_run_test("should chain map and filter adapters", should_chain_map_and_filter_adapters);
+    uelt_run_test("should take and skip elements", should_take_and_skip_elements);
+    uelt_run_test("should zip iterators", should_zip_iterators);
 
     return NULL;
 }
@@ -214,10 +214,13 @@ static char *should_remove_elements(){
     uel_llist_remove(&list, &node3);
     uelt_assert_ints_equal("list.count after second removal", 1, list.count);
     uelt_assert_not("list must not contain node3", contains(&list, &node3));
+    uelt_assert_pointers_equal("list.head after removing head", &node1, list.head);
 
     uel_llist_remove(&list, &node1);
     uelt_assert_int_zero("list.count after third removal", list.count);
     uelt_assert_not("list must not contain node1", contains(&list, &node1));
+    uelt_assert_pointer_null("list.head after removing all", list.head);
+    uelt_assert_pointer_null("list.tail after removing all", list.tail);
 
     return NULL;
 }
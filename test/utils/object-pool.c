@@ -23,7 +23,10 @@ static char *should_init_objpool(){
         pool.queue.buffer
     );
     uelt_assert_ints_equal("pool.queue.size", 8, pool.queue.size);
-    uelt_assert_ints_equal("pool.queue.count", 8, pool.queue.count);
+    uelt_assert_int_zero("pool.queue.count", pool.queue.count);
+    uelt_assert_ints_equal("pool.item_size", sizeof(object_t), pool.item_size);
+    uelt_assert_int_zero("pool.untouched", pool.untouched);
+    uelt_assert_ints_equal("uel_objpool_count_available", 8, uel_objpool_count_available(&pool));
 
     return NULL;
 }
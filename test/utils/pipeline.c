@@ -77,12 +77,40 @@ static char *should_operate_pipeline(){
     return NULL;
 }
 
+static uintptr_t static_numbers[] = {0, 0, 0};
+UEL_PIPELINE_DECLARE_STATIC(static_nums,
+    (increment_and_store, &static_numbers[0]),
+    (increment_and_store, &static_numbers[1]),
+    (increment_and_store, &static_numbers[2])
+)
+UEL_PIPELINE_DECLARE_STATIC(single, (increment_and_store, &static_numbers[0]))
+
+static char *should_operate_static_pipeline(){
+    uintptr_t result = (uintptr_t)static_nums_pipeline_apply((void *)5);
+
+    uelt_assert_ints_equal("result", 8, result);
+    uelt_assert_ints_equal("static_numbers[0]", 6, static_numbers[0]);
+    uelt_assert_ints_equal("static_numbers[1]", 7, static_numbers[1]);
+    uelt_assert_ints_equal("static_numbers[2]", 8, static_numbers[2]);
+
+    uel_closure_t closure = uel_closure_create(static_nums_pipeline_function, NULL);
+    result = (uintptr_t)uel_closure_invoke(&closure, (void *)1);
+    uelt_assert_ints_equal("result through closure", 4, result);
+
+    result = (uintptr_t)single_pipeline_apply((void *)9);
+    uelt_assert_ints_equal("single stage result", 10, result);
+    uelt_assert_ints_equal("static_numbers[0] after single stage", 10, static_numbers[0]);
+
+    return NULL;
+}
+
 char *uel_pipeline_run_tests(){
     uelt_run_test(
         "should correctly initialise a pipeline object",
         should_initialise_pipeline
     );
     uelt_run_test("should correctly operate a pipeline", should_operate_pipeline);
+    uelt_run_test("should operate a static pipeline", should_operate_static_pipeline);
 
     return NULL;
 }
@@ -0,0 +1,167 @@
+#include "profiler.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "uevloop/utils/profiler.h"
+#include "uevloop/utils/clock.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/system/containers/application.h"
+#include "../uelt.h"
+
+static uintptr_t fake_clock = 0;
+
+static void *read_clock(void *context, void *params){
+    return (void *)fake_clock;
+}
+
+// Takes as long as its parameter
+static void *spend(void *context, void *params){
+    fake_clock += (uintptr_t)params;
+    return NULL;
+}
+
+static void *other(void *context, void *params){
+    return NULL;
+}
+
+static void *store_sample(void *context, void *params){
+    *(uel_profile_sample_t *)context = *(uel_profile_sample_t *)params;
+    return NULL;
+}
+
+static char *should_init_profiler(){
+    static uel_profiler_t profiler;
+    uel_profiler_init(&profiler, 100, uel_nop());
+
+    uelt_assert_int_zero("profiler.dropped", profiler.dropped);
+    uelt_assert_ints_equal("profiler.threshold", 100, profiler.threshold);
+    for(size_t i = 0; i < UEL_PROFILER_TABLE_SIZE; i++){
+        uelt_assert_pointer_null("profiler.entries[i].function", profiler.entries[i].function);
+    }
+    uelt_assert_pointer_null("uel_profiler_find", uel_profiler_find(&profiler, spend));
+
+    return NULL;
+}
+
+static char *should_account_invocations(){
+    static uel_profiler_t profiler;
+    uel_profiler_init(&profiler, 100, uel_nop());
+    uel_closure_t spender = uel_closure_create(spend, NULL);
+    uel_closure_t another = uel_closure_create(other, NULL);
+
+    uel_profiler_record(&profiler, &spender, 10);
+    uel_profiler_record(&profiler, &spender, 30);
+    uel_profiler_record(&profiler, &another, 5);
+
+    uel_profile_entry_t *entry = uel_profiler_find(&profiler, spend);
+    uelt_assert_pointer_not_null("spend entry", entry);
+    uelt_assert_ints_equal("entry->calls", 2, entry->calls);
+    uelt_assert_ints_equal("entry->total", 40, entry->total);
+    uelt_assert_ints_equal("entry->max", 30, entry->max);
+    entry = uel_profiler_find(&profiler, other);
+    uelt_assert_pointer_not_null("other entry", entry);
+    uelt_assert_ints_equal("entry->calls", 1, entry->calls);
+
+    return NULL;
+}
+
+static char *should_fire_watchdog(){
+    static uel_profiler_t profiler;
+    uel_profile_sample_t sample = { NULL, 0 };
+    uel_profiler_init(&profiler, 100, uel_closure_create(store_sample, (void *)&sample));
+    uel_closure_t spender = uel_closure_create(spend, NULL);
+
+    uel_profiler_record(&profiler, &spender, 100);
+    uelt_assert_pointer_null("sample.closure under threshold", sample.closure);
+
+    uel_profiler_record(&profiler, &spender, 101);
+    uelt_assert_pointers_equal("sample.closure", &spender, sample.closure);
+    uelt_assert_ints_equal("sample.elapsed", 101, sample.elapsed);
+
+    return NULL;
+}
+
+static char *should_profile_event_loop(){
+    static uel_application_t app;
+    static uel_profiler_t profiler;
+    uel_app_init(&app);
+    uel_profiler_init(&profiler, 1000, uel_nop());
+    uel_clock_set_source(uel_closure_create(read_clock, NULL));
+    uel_profiler_attach(&profiler);
+
+    uel_closure_t spender = uel_closure_create(spend, NULL);
+    uel_app_enqueue_closure(&app, &spender, (void *)7);
+    uel_app_run_later(&app, 0, spender, (void *)3);
+    uel_app_tick(&app);
+
+    uel_profiler_attach(NULL);
+    uel_app_enqueue_closure(&app, &spender, (void *)7);
+    uel_app_tick(&app);
+    uel_clock_set_source(uel_closure_create(NULL, NULL));
+
+    uel_profile_entry_t *entry = uel_profiler_find(&profiler, spend);
+    uelt_assert_pointer_not_null("spend entry", entry);
+    uelt_assert_ints_equal("entry->calls", 2, entry->calls);
+    uelt_assert_ints_equal("entry->total", 10, entry->total);
+    uelt_assert_ints_equal("entry->max", 7, entry->max);
+
+    return NULL;
+}
+
+#define RACE_THREADS    (4)
+#define RACE_SAMPLES    (20000)
+
+static void *record_samples(void *arg){
+    uel_profiler_t *profiler = (uel_profiler_t *)arg;
+    uel_closure_t spender = uel_closure_create(spend, NULL);
+    uel_closure_t other_closure = uel_closure_create(other, NULL);
+    for(uintptr_t i = 0; i < RACE_SAMPLES; i++){
+        uel_profiler_record(profiler, &spender, 1 + (i & 7));
+        uel_profiler_record(profiler, &other_closure, 1);
+    }
+    return NULL;
+}
+
+static char *should_account_from_many_threads(){
+    static uel_profiler_t profiler;
+    uel_profiler_init(&profiler, 1000, uel_nop());
+
+    pthread_t threads[RACE_THREADS];
+    for(size_t i = 0; i < RACE_THREADS; i++){
+        pthread_create(&threads[i], NULL, record_samples, (void *)&profiler);
+    }
+    for(size_t i = 0; i < RACE_THREADS; i++){
+        pthread_join(threads[i], NULL);
+    }
+
+    size_t claimed = 0;
+    for(size_t i = 0; i < UEL_PROFILER_TABLE_SIZE; i++){
+        if(profiler.entries[i].function != NULL) claimed++;
+    }
+    uelt_assert_ints_equal("claimed entries", 2, claimed);
+    uelt_assert_int_zero("profiler.dropped", profiler.dropped);
+
+    uel_profile_entry_t *entry = uel_profiler_find(&profiler, spend);
+    uelt_assert_pointer_not_null("spend entry", entry);
+    uelt_assert_ints_equal("entry->calls", RACE_THREADS * RACE_SAMPLES, entry->calls);
+    // Each thread records 1..8 in turn
+    uelt_assert_ints_equal("entry->total", RACE_THREADS * RACE_SAMPLES / 8 * 36, entry->total);
+    uelt_assert_ints_equal("entry->max", 8, entry->max);
+
+    entry = uel_profiler_find(&profiler, other);
+    uelt_assert_pointer_not_null("other entry", entry);
+    uelt_assert_ints_equal("entry->calls", RACE_THREADS * RACE_SAMPLES, entry->calls);
+
+    return NULL;
+}
+
+char *uel_profiler_run_tests(){
+    uelt_run_test("should correctly initialise a profiler", should_init_profiler);
+    uelt_run_test("should account invocations per closure function", should_account_invocations);
+    uelt_run_test("should fire the watchdog on slow invocations", should_fire_watchdog);
+    uelt_run_test("should profile closures run by the event loop", should_profile_event_loop);
+    uelt_run_test("should account invocations from many threads", should_account_from_many_threads);
+
+    return NULL;
+}
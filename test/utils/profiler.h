@@ -0,0 +1,6 @@
+#ifndef TEST_PROFILER_H
+#define TEST_PROFILER_H
+
+char *uel_profiler_run_tests();
+
+#endif /* end of include guard: TEST_PROFILER_H */
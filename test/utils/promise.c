@@ -5,6 +5,7 @@
 #include "uevloop/utils/promise.h"
 
 #include <stddef.h>
+#include <pthread.h>
 
 #define DECLARE_STORE                                               \
     UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_t, 4, promise);         \
@@ -35,12 +36,48 @@ static char *should_create_promise_store() {
     return NULL;
 }
 
+#define SHARED_STORE_ITERATIONS (20000)
+
+static void *churn_promises(void *arg){
+    uel_promise_store_t *store = (uel_promise_store_t *)arg;
+    for(uintptr_t i = 0; i < SHARED_STORE_ITERATIONS; i++){
+        uel_promise_t *promise = uel_promise_create(store, uel_nop());
+        uel_promise_then(promise, uel_nop());
+        uel_promise_destroy(promise);
+    }
+    return NULL;
+}
+
+static char *should_share_pools_between_stores() {
+    DECLARE_STORE;
+    uel_promise_store_t other =
+        uel_promise_store_create(&promise_pool, &segment_pool);
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, churn_promises, (void *)&other);
+    churn_promises((void *)&store);
+    pthread_join(thread, NULL);
+
+    uelt_assert_ints_equal(
+        "available promises",
+        promise_pool.queue.size,
+        uel_objpool_count_available(&promise_pool)
+    );
+    uelt_assert_ints_equal(
+        "available segments",
+        segment_pool.queue.size,
+        uel_objpool_count_available(&segment_pool)
+    );
+
+    return NULL;
+}
+
 static char *should_create_and_destroy_promise() {
     DECLARE_STORE;
 
-    size_t old_count = store.promise_pool->queue.count;
+    size_t old_count = uel_objpool_count_available(store.promise_pool);
     uel_promise_t *promise = uel_promise_create(&store, uel_nop());
-    size_t new_count = store.promise_pool->queue.count;
+    size_t new_count = uel_objpool_count_available(store.promise_pool);
 
     uelt_assert_ints_equal("promise count", old_count - 1, new_count);
     uelt_assert_pointers_equal("promise->source", &store, promise->source);
@@ -49,21 +86,21 @@ static char *should_create_and_destroy_promise() {
     uelt_assert_pointer_null("promise->first_segment", promise->first_segment);
     uelt_assert_pointer_null("promise->last_segment", promise->last_segment);
 
-    old_count = store.segment_pool->queue.count;
+    old_count = uel_objpool_count_available(store.segment_pool);
     uel_promise_then(promise, uel_nop());
-    new_count = store.segment_pool->queue.count;
+    new_count = uel_objpool_count_available(store.segment_pool);
     uelt_assert_ints_equal("segment count", old_count - 1, new_count);
 
     uel_promise_destroy(promise);
     uelt_assert_ints_equal(
         "promise count after destroy",
         store.promise_pool->queue.size,
-        store.promise_pool->queue.count
+        uel_objpool_count_available(store.promise_pool)
     );
     uelt_assert_ints_equal(
         "segment count after destroy",
         store.segment_pool->queue.size,
-        store.segment_pool->queue.count
+        uel_objpool_count_available(store.segment_pool)
     );
 
     return NULL;
@@ -477,9 +514,9 @@ static char *should_supply_helpers() {
     uelt_assert_ints_equal("p2->state", UEL_PROMISE_REJECTED, p2->state);
     uelt_assert_ints_equal("p2->value", (void *)2, p2->value);
 
-    size_t old_count = store.promise_pool->queue.count;
+    size_t old_count = uel_objpool_count_available(store.promise_pool);
     uel_closure_invoke(&destroyer, (void *)3);
-    size_t new_count = store.promise_pool->queue.count;
+    size_t new_count = uel_objpool_count_available(store.promise_pool);
     uelt_assert_ints_equal("promise count", old_count + 1, new_count);
 
     return NULL;
@@ -517,6 +554,7 @@ char *uel_promise_run_tests() {
     uelt_run_test("should correctly resettle promises", should_resettle);
     uelt_run_test("should correctly handle sub-promisses", should_handle_subpromises);
     uelt_run_test("should correctly supply helper closures", should_supply_helpers);
+    uelt_run_test("should share pools between stores", should_share_pools_between_stores);
 
     return NULL;
 }
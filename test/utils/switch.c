@@ -0,0 +1,160 @@
+#include "switch.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../uelt.h"
+#include "uevloop/utils/switch.h"
+
+struct message {
+    uintptr_t type;
+    uintptr_t payload;
+};
+
+static void *message_type(void *context, void *params){
+    return (void *)((struct message *)params)->type;
+}
+
+// Returns its context plus the payload of the message
+static void *tag_payload(void *context, void *params){
+    return (void *)((uintptr_t)context + ((struct message *)params)->payload);
+}
+
+static void *identity(void *context, void *params){
+    return params;
+}
+
+// Checks every case and a few absent keys take the expected branch
+static char *check_branches(uel_switch_t *sw, uintptr_t *absent, size_t absent_count){
+    for(size_t i = 0; i < sw->count; i++){
+        uelt_assert_pointers_equal(
+            "case closure",
+            &sw->cases[i].closure,
+            uel_switch_find(sw, sw->cases[i].key)
+        );
+    }
+    for(size_t i = 0; i < absent_count; i++){
+        uelt_assert_pointers_equal(
+            "default branch",
+            &sw->default_branch,
+            uel_switch_find(sw, absent[i])
+        );
+    }
+    return NULL;
+}
+
+static char *should_initialise_switch(){
+    uel_switch_case_t cases[] = {
+        {1, uel_closure_create(tag_payload, (void *)100)},
+        {2, uel_closure_create(tag_payload, (void *)200)}
+    };
+    UEL_DECLARE_SWITCH_TABLE(2, test);
+    uel_switch_t sw;
+    uel_switch_init(
+        &sw,
+        uel_closure_create(message_type, NULL),
+        cases,
+        2,
+        uel_closure_create(identity, NULL),
+        test_switch_table,
+        2
+    );
+
+    uelt_assert_pointers_equal("sw.selector.function", &message_type, sw.selector.function);
+    uelt_assert_pointers_equal("sw.default_branch.function", &identity, sw.default_branch.function);
+    uelt_assert_pointers_equal("sw.cases", cases, sw.cases);
+    uelt_assert_ints_equal("sw.count", 2, sw.count);
+    uelt_assert_pointers_equal("sw.table", test_switch_table, sw.table);
+    uelt_assert_ints_equal("sw.table_size_log2n", 2, sw.table_size_log2n);
+
+    return NULL;
+}
+
+static char *should_build_dense_table(){
+    uel_switch_case_t cases[] = {
+        {12, uel_closure_create(tag_payload, (void *)100)},
+        {10, uel_closure_create(tag_payload, (void *)200)},
+        {15, uel_closure_create(tag_payload, (void *)300)},
+        {10, uel_closure_create(tag_payload, (void *)400)}
+    };
+    UEL_DECLARE_SWITCH_TABLE(3, dense);
+    uel_switch_t sw;
+    uel_switch_init(&sw, uel_closure_create(message_type, NULL), cases, 3,
+        uel_closure_create(identity, NULL), dense_switch_table, 3);
+
+    uelt_assert_ints_equal("sw.mode", UEL_SWITCH_DENSE, sw.mode);
+    uelt_assert_ints_equal("sw.base", 10, sw.base);
+    uintptr_t absent[] = {0, 9, 11, 16, 17, 18, UINTPTR_MAX};
+    char *failure = check_branches(&sw, absent, sizeof(absent) / sizeof(uintptr_t));
+    if(failure) return failure;
+
+    // Repeated keys are resolved to the first case
+    uel_switch_init(&sw, uel_closure_create(message_type, NULL), cases, 4,
+        uel_closure_create(identity, NULL), dense_switch_table, 3);
+    uelt_assert_pointers_equal("repeated key", &cases[1].closure, uel_switch_find(&sw, 10));
+
+    return NULL;
+}
+
+static char *should_build_hashed_table(){
+    uel_switch_case_t cases[] = {
+        {3, uel_closure_create(tag_payload, (void *)100)},
+        {1000, uel_closure_create(tag_payload, (void *)200)},
+        {70000, uel_closure_create(tag_payload, (void *)300)},
+        {0x7FFFFFFF, uel_closure_create(tag_payload, (void *)400)},
+        {42, uel_closure_create(tag_payload, (void *)500)},
+        {4096, uel_closure_create(tag_payload, (void *)600)}
+    };
+    UEL_DECLARE_SWITCH_TABLE(5, hashed);
+    uel_switch_t sw;
+    uel_switch_init(&sw, uel_closure_create(message_type, NULL), cases, 6,
+        uel_closure_create(identity, NULL), hashed_switch_table, 5);
+
+    uelt_assert_ints_equal("sw.mode", UEL_SWITCH_HASHED, sw.mode);
+    uintptr_t absent[] = {0, 2, 4, 41, 999, 1001, 69999, 0x7FFFFFFE, UINTPTR_MAX};
+    return check_branches(&sw, absent, sizeof(absent) / sizeof(uintptr_t));
+}
+
+static char *should_fall_back_to_linear_search(){
+    uel_switch_case_t cases[] = {
+        {3, uel_closure_create(tag_payload, (void *)100)},
+        {1000, uel_closure_create(tag_payload, (void *)200)},
+        {70000, uel_closure_create(tag_payload, (void *)300)}
+    };
+    UEL_DECLARE_SWITCH_TABLE(1, small);
+    uel_switch_t sw;
+    uel_switch_init(&sw, uel_closure_create(message_type, NULL), cases, 3,
+        uel_closure_create(identity, NULL), small_switch_table, 1);
+
+    uelt_assert_ints_equal("sw.mode", UEL_SWITCH_LINEAR, sw.mode);
+    uintptr_t absent[] = {0, 4, 999, 70001};
+    return check_branches(&sw, absent, sizeof(absent) / sizeof(uintptr_t));
+}
+
+static char *should_apply_switch(){
+    uel_switch_case_t cases[] = {
+        {1, uel_closure_create(tag_payload, (void *)100)},
+        {500, uel_closure_create(tag_payload, (void *)200)}
+    };
+    UEL_DECLARE_SWITCH_TABLE(2, apply);
+    uel_switch_t sw;
+    uel_switch_init(&sw, uel_closure_create(message_type, NULL), cases, 2,
+        uel_closure_create(identity, NULL), apply_switch_table, 2);
+
+    struct message first = {1, 5}, second = {500, 7}, unknown = {2, 9};
+    uelt_assert_ints_equal("first", 105, (uintptr_t)uel_switch_apply(&sw, &first));
+    uelt_assert_ints_equal("second", 207, (uintptr_t)uel_switch_apply(&sw, &second));
+    uelt_assert_pointers_equal("unknown", &unknown, uel_switch_apply(&sw, &unknown));
+
+    return NULL;
+}
+
+char *uel_switch_run_tests(){
+    uelt_run_test("should initialise a switch", should_initialise_switch);
+    uelt_run_test("should build a dense table", should_build_dense_table);
+    uelt_run_test("should build a hashed table", should_build_hashed_table);
+    uelt_run_test("should fall back to linear search", should_fall_back_to_linear_search);
+    uelt_run_test("should apply a switch", should_apply_switch);
+
+    return NULL;
+}
@@ -0,0 +1,6 @@
+#ifndef UELT_SWITCH_H
+#define UELT_SWITCH_H
+
+char *uel_switch_run_tests();
+
+#endif /* end of include guard: UELT_SWITCH_H */
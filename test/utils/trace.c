@@ -0,0 +1,152 @@
+#include "trace.h"
+
+#include <stdlib.h>
+
+#include "uevloop/utils/trace.h"
+#include "uevloop/utils/clock.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/system/containers/application.h"
+#include "../uelt.h"
+
+#define TRACE_SIZE  (1<<UEL_TRACE_BUFFER_SIZE_LOG2N)
+
+typedef struct trace_copy {
+    uel_trace_record_t records[TRACE_SIZE];
+    uintptr_t count;
+} trace_copy_t;
+
+static void *copy_record(void *context, void *params){
+    trace_copy_t *copy = (trace_copy_t *)context;
+    copy->records[copy->count++] = *(uel_trace_record_t *)params;
+    return NULL;
+}
+
+static void *tick_clock(void *context, void *params){
+    uintptr_t *clock = (uintptr_t *)context;
+    return (void *)(*clock)++;
+}
+
+static char *should_record_in_order(){
+    static trace_copy_t copy;
+    uintptr_t clock = 100;
+    copy.count = 0;
+    uel_clock_set_source(uel_closure_create(tick_clock, (void *)&clock));
+    uel_trace_reset();
+
+    uel_trace_record(UEL_TRACE_SIGNAL_EMITTED, 1, 2);
+    uel_trace_record(UEL_TRACE_PROMISE_RESOLVED, 3, 4);
+    uel_closure_t writer = uel_closure_create(copy_record, (void *)&copy);
+
+    uelt_assert_ints_equal("records dumped", 2, uel_trace_dump(&writer));
+    uelt_assert_ints_equal("copy.count", 2, copy.count);
+    uelt_assert_ints_equal("records[0].timestamp", 100, copy.records[0].timestamp);
+    uelt_assert_ints_equal("records[0].type", UEL_TRACE_SIGNAL_EMITTED, copy.records[0].type);
+    uelt_assert_ints_equal("records[0].subject", 1, copy.records[0].subject);
+    uelt_assert_ints_equal("records[0].detail", 2, copy.records[0].detail);
+    uelt_assert_ints_equal("records[1].timestamp", 101, copy.records[1].timestamp);
+    uelt_assert_ints_equal("records[1].type", UEL_TRACE_PROMISE_RESOLVED, copy.records[1].type);
+
+    uel_clock_set_source(uel_closure_create(NULL, NULL));
+    return NULL;
+}
+
+static char *should_overwrite_oldest_records(){
+    static trace_copy_t copy;
+    copy.count = 0;
+    uel_trace_reset();
+
+    for(uintptr_t i = 0; i < TRACE_SIZE + 3; i++){
+        uel_trace_record(UEL_TRACE_SIGNAL_EMITTED, i, 0);
+    }
+    uel_closure_t writer = uel_closure_create(copy_record, (void *)&copy);
+
+    uelt_assert_ints_equal("records dumped", TRACE_SIZE, uel_trace_dump(&writer));
+    uelt_assert_ints_equal("oldest record", 3, copy.records[0].subject);
+    uelt_assert_ints_equal("newest record", TRACE_SIZE + 2, copy.records[TRACE_SIZE - 1].subject);
+
+    return NULL;
+}
+
+static char *should_pause_tracing(){
+    static trace_copy_t copy;
+    copy.count = 0;
+    uel_trace_reset();
+
+    uel_trace_set_enabled(false);
+    uel_trace_record(UEL_TRACE_SIGNAL_EMITTED, 0, 0);
+    uel_trace_set_enabled(true);
+    uel_closure_t writer = uel_closure_create(copy_record, (void *)&copy);
+
+    uelt_assert_int_zero("records dumped", uel_trace_dump(&writer));
+
+    return NULL;
+}
+
+static void *nop(void *context, void *params){
+    return NULL;
+}
+
+static char *should_trace_event_loop(){
+    static uel_application_t app;
+    static trace_copy_t copy;
+    copy.count = 0;
+    uel_app_init(&app);
+    uel_closure_t closure = uel_closure_create(nop, NULL);
+    uel_app_run_later(&app, 0, closure, NULL);
+    uel_trace_reset();
+    uel_app_tick(&app);
+
+    uel_closure_t writer = uel_closure_create(copy_record, (void *)&copy);
+    uelt_assert_ints_equal("records dumped", 3, uel_trace_dump(&writer));
+    uelt_assert_ints_equal("records[0].type", UEL_TRACE_TIMER_EXPIRED, copy.records[0].type);
+    uelt_assert_ints_equal("records[1].type", UEL_TRACE_DISPATCH_BEGIN, copy.records[1].type);
+    uelt_assert_ints_equal("records[1].detail", UEL_TIMER_EVENT, copy.records[1].detail);
+    uelt_assert_ints_equal("records[2].type", UEL_TRACE_DISPATCH_END, copy.records[2].type);
+    uelt_assert("dispatch subject", copy.records[1].subject == (uintptr_t)nop);
+
+    return NULL;
+}
+
+static void *deferred(void *context, void *params){
+    return NULL;
+}
+
+static char *should_trace_nominal_due_times(){
+    static uel_application_t app;
+    static trace_copy_t copy;
+    copy.count = 0;
+    uel_app_init(&app);
+    uel_app_run_later(&app, 10, uel_closure_create(nop, NULL), NULL);
+    uel_event_t *timer =
+        uel_app_run_later(&app, 8, uel_closure_create(deferred, NULL), NULL);
+    // Defers the timer to expire along the one due at 10
+    uel_event_timer_set_slack(timer, 5);
+    uel_app_tick(&app);
+    uel_trace_reset();
+    uel_app_update_timer(&app, 10);
+    uel_app_tick(&app);
+
+    uel_closure_t writer = uel_closure_create(copy_record, (void *)&copy);
+    uel_trace_dump(&writer);
+    uel_trace_record_t *expired = NULL;
+    for(size_t i = 0; i < copy.count; i++){
+        if(copy.records[i].type == UEL_TRACE_TIMER_EXPIRED &&
+            copy.records[i].subject == (uintptr_t)deferred){
+            expired = &copy.records[i];
+        }
+    }
+    uelt_assert_pointer_not_null("deferred timer expiration", expired);
+    uelt_assert_ints_equal("expired->detail", 8, expired->detail);
+
+    return NULL;
+}
+
+char *uel_trace_run_tests(){
+    uelt_run_test("should record into the trace ring in order", should_record_in_order);
+    uelt_run_test("should overwrite the oldest records when full", should_overwrite_oldest_records);
+    uelt_run_test("should not record while paused", should_pause_tracing);
+    uelt_run_test("should trace timers and event dispatches", should_trace_event_loop);
+    uelt_run_test("should trace the nominal due times of timers", should_trace_nominal_due_times);
+
+    return NULL;
+}
@@ -0,0 +1,6 @@
+#ifndef TEST_TRACE_H
+#define TEST_TRACE_H
+
+char *uel_trace_run_tests();
+
+#endif /* end of include guard: TEST_TRACE_H */
@@ -0,0 +1,155 @@
+#include "work-stealing-deque.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "uevloop/utils/work-stealing-deque.h"
+#include "uevloop/portability/atomic.h"
+#include "../uelt.h"
+
+#define BUFFER_SIZE_LOG2N   (2)
+#define BUFFER_SIZE         (1<<BUFFER_SIZE_LOG2N)
+
+static char *should_init(){
+    uel_wsdeque_t deque;
+    void *buffer[BUFFER_SIZE];
+    uel_wsdeque_init(&deque, buffer, BUFFER_SIZE_LOG2N);
+
+    uelt_assert_pointers_equal("deque.buffer", &buffer, deque.buffer);
+    uelt_assert_ints_equal("deque.mask", 3, deque.mask);
+    uelt_assert_int_zero("deque.top", deque.top);
+    uelt_assert_int_zero("deque.bottom", deque.bottom);
+    uelt_assert_int_zero("uel_wsdeque_count", uel_wsdeque_count(&deque));
+
+    return NULL;
+}
+
+static char *should_push_and_pop_in_lifo_order(){
+    uel_wsdeque_t deque;
+    void *buffer[BUFFER_SIZE];
+    uel_wsdeque_init(&deque, buffer, BUFFER_SIZE_LOG2N);
+
+    for(uintptr_t i = 1; i <= BUFFER_SIZE; i++){
+        uelt_assert("push must succeed", uel_wsdeque_push(&deque, (void *)i));
+    }
+    uelt_assert_not("push must fail when full", uel_wsdeque_push(&deque, (void *)5));
+    uelt_assert_ints_equal("uel_wsdeque_count", BUFFER_SIZE, uel_wsdeque_count(&deque));
+
+    for(uintptr_t i = BUFFER_SIZE; i > 0; i--){
+        uelt_assert_ints_equal("uel_wsdeque_pop", i, (uintptr_t)uel_wsdeque_pop(&deque));
+    }
+    uelt_assert_pointer_null("uel_wsdeque_pop when empty", uel_wsdeque_pop(&deque));
+    uelt_assert_int_zero("uel_wsdeque_count", uel_wsdeque_count(&deque));
+
+    return NULL;
+}
+
+static char *should_steal_in_fifo_order(){
+    uel_wsdeque_t deque;
+    void *buffer[BUFFER_SIZE];
+    uel_wsdeque_init(&deque, buffer, BUFFER_SIZE_LOG2N);
+
+    uel_wsdeque_push(&deque, (void *)1);
+    uel_wsdeque_push(&deque, (void *)2);
+    uel_wsdeque_push(&deque, (void *)3);
+
+    uelt_assert_ints_equal("uel_wsdeque_steal #1", 1, (uintptr_t)uel_wsdeque_steal(&deque));
+    uelt_assert_ints_equal("uel_wsdeque_pop", 3, (uintptr_t)uel_wsdeque_pop(&deque));
+    uelt_assert_ints_equal("uel_wsdeque_steal #2", 2, (uintptr_t)uel_wsdeque_steal(&deque));
+    uelt_assert_pointer_null("uel_wsdeque_steal when empty", uel_wsdeque_steal(&deque));
+    uelt_assert_pointer_null("uel_wsdeque_pop when empty", uel_wsdeque_pop(&deque));
+
+    return NULL;
+}
+
+static char *should_wrap_around(){
+    uel_wsdeque_t deque;
+    void *buffer[BUFFER_SIZE];
+    uel_wsdeque_init(&deque, buffer, BUFFER_SIZE_LOG2N);
+
+    for(uintptr_t i = 1; i <= 3 * BUFFER_SIZE; i++){
+        uelt_assert("push must succeed", uel_wsdeque_push(&deque, (void *)i));
+        uelt_assert_ints_equal("uel_wsdeque_steal", i, (uintptr_t)uel_wsdeque_steal(&deque));
+    }
+    uelt_assert_int_zero("uel_wsdeque_count", uel_wsdeque_count(&deque));
+
+    return NULL;
+}
+
+#define RACE_THIEVES    (3)
+#define RACE_ELEMENTS   (20000)
+
+typedef struct race race_t;
+struct race {
+    uel_wsdeque_t deque;
+    void *buffer[BUFFER_SIZE];
+    volatile bool done;
+    // How many times each element was taken, by either the owner or a thief
+    volatile uintptr_t taken[RACE_ELEMENTS];
+};
+
+static void take(race_t *race, void *element){
+    UEL_ATOMIC_FETCH_ADD(&race->taken[(uintptr_t)element - 1], 1, UEL_ATOMIC_RELAXED);
+}
+
+static void *steal(void *arg){
+    race_t *race = (race_t *)arg;
+    while(!UEL_ATOMIC_LOAD(&race->done, UEL_ATOMIC_ACQUIRE)){
+        void *element = uel_wsdeque_steal(&race->deque);
+        if(element != NULL){
+            take(race, element);
+        }else{
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static char *should_hand_each_element_out_once(){
+    static race_t race;
+    uel_wsdeque_init(&race.deque, race.buffer, BUFFER_SIZE_LOG2N);
+    race.done = false;
+    for(uintptr_t i = 0; i < RACE_ELEMENTS; i++) race.taken[i] = 0;
+
+    pthread_t thieves[RACE_THIEVES];
+    for(size_t i = 0; i < RACE_THIEVES; i++){
+        pthread_create(&thieves[i], NULL, steal, (void *)&race);
+    }
+
+    // Keeps at most two elements in the deque, so the owner keeps popping the
+    // last element while thieves try to steal it
+    for(uintptr_t i = 1; i <= RACE_ELEMENTS; i++){
+        while(!uel_wsdeque_push(&race.deque, (void *)i)) sched_yield();
+        if(i % 2 == 0){
+            void *element = uel_wsdeque_pop(&race.deque);
+            if(element != NULL) take(&race, element);
+        }
+    }
+    void *element;
+    while((element = uel_wsdeque_pop(&race.deque)) != NULL){
+        take(&race, element);
+    }
+    UEL_ATOMIC_STORE(&race.done, true, UEL_ATOMIC_RELEASE);
+    for(size_t i = 0; i < RACE_THIEVES; i++){
+        pthread_join(thieves[i], NULL);
+    }
+
+    uelt_assert_int_zero("uel_wsdeque_count", uel_wsdeque_count(&race.deque));
+    for(uintptr_t i = 0; i < RACE_ELEMENTS; i++){
+        uelt_assert_ints_equal("times taken", 1, race.taken[i]);
+    }
+
+    return NULL;
+}
+
+char *uel_wsdeque_run_tests(){
+    uelt_run_test("should correctly initialise a deque", should_init);
+    uelt_run_test("should push and pop elements in LIFO order", should_push_and_pop_in_lifo_order);
+    uelt_run_test("should steal elements in FIFO order", should_steal_in_fifo_order);
+    uelt_run_test("should wrap indices around the buffer", should_wrap_around);
+    uelt_run_test("should hand each element out once under contention", should_hand_each_element_out_once);
+
+    return NULL;
+}
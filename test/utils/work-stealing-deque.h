@@ -0,0 +1,6 @@
+#ifndef TEST_WORK_STEALING_DEQUE_H
+#define TEST_WORK_STEALING_DEQUE_H
+
+char *uel_wsdeque_run_tests();
+
+#endif /* end of include guard: TEST_WORK_STEALING_DEQUE_H */